@@ -17,6 +17,7 @@
 #include "EmDlgAndroid.h"		// HandleDialogs
 #include "EmDocument.h"			// gDocument
 #include "EmMenus.h"			// MenuInitialize
+#include "EmScreen.h"			// EmScreen::StartPublishing
 #include "EmWindowAndroid.h"
 #include "PHEMNativeIF.h"
 
@@ -151,6 +152,11 @@ Bool EmApplicationAndroid::Startup (int argc, char** argv)
         PHEM_Log_Place(3);
 	::MenuInitialize (false);
 
+	// Have the CPU thread hand us finished LCD frames, so that the
+	// periodic HandleIdle from the Java side never has to stop it.
+
+	EmScreen::StartPublishing ();
+
 	// Start the clipboard idling.
 	// !!! Get rid of this special clipboard window.  I think that
 	// we can roll this functionality into fAppWindow.
@@ -14,7 +14,8 @@
 #include "EmCommon.h"
 #include "EmDocumentAndroid.h"
 
-#include "EmScreen.h"			// EmScreen
+#include "EmScreenCapture.h"	// EmScreenCapture::SaveStill
+#include "EmSession.h"			// gSession, EmSessionStopper
 
 #include <stdio.h>				// fopen, fprintf, fwrite, fclose, FILE
 
@@ -87,60 +88,15 @@ EmDocumentAndroid::~EmDocumentAndroid (void)
 // ---------------------------------------------------------------------------
 //		 EmDocumentAndroid::HostSaveScreen
 // ---------------------------------------------------------------------------
-// Save the current contents of the LCD buffer to the given file.
+// Save the current contents of the LCD buffer to the given file as a PNG.
 
 void EmDocumentAndroid::HostSaveScreen (const EmFileRef& destRef)
 {
-#if 0
-//AndroidTODO
-	// Make sure the extension is right.
-
-	string	fullPath = destRef.GetFullPath ();
-	char*	fNameExt = (char*) malloc (fullPath.size () + 4);
-	strcpy (fNameExt, fullPath.c_str ());
-	fl_filename_setext (fNameExt, ".ppm");
-
-	FILE* f = fopen (fNameExt, "wb");
-	if (f)
-	{
-		EmScreen::InvalidateAll ();
-
-		EmScreenUpdateInfo info;
-		EmScreen::GetBits (info);
-
-		EmScreen::InvalidateAll ();
-
-		info.fImage.ConvertToFormat (kPixMapFormat24RGB);
-
-		// PPM format is:
-		//
-		// File type tag
-		// Width
-		// Height
-		// Max component value
-		// Width * Height pixels
-		//
-		// The first items in the file are all text and
-		// seperated by whitespace.  The array of pixels
-		// is in text format if the file type is P3, and
-		// is in binary format if the type is P6.
-
-		EmPoint size = info.fImage.GetSize ();
-
-		fprintf (f, "P6 %ld %ld 255\x0D", size.fX, size.fY);
-
-		uint8* bits = (uint8*) info.fImage.GetBits ();
-		for (long yy = 0; yy < size.fY; ++yy)
-		{
-			long rowBytes = info.fImage.GetRowBytes ();
-			uint8* basePtr = bits + yy * rowBytes;
-
-			fwrite (basePtr, 1, rowBytes, f);
-		}
-
-		fclose (f);
-	}
-
-	free (fNameExt);
-#endif
+	// HostSaveScreen comes in on the CPU thread; the Save Screen command
+	// comes in on the UI thread, which has to stop the CPU first.
+
+	EmSessionStopper	stopper (gSession,
+		gSession->InCPUThread () ? kStopNone : kStopNow);
+
+	EmScreenCapture::SaveStill (destRef);
 }
@@ -16,38 +16,132 @@
 
 #include "PHEMNativeIF.h"
 
+#include <string.h>				// memcpy
+
+
+// ---------------------------------------------------------------------------
+//		 PrvPack565
+// ---------------------------------------------------------------------------
+
+inline uint16 PrvPack565 (const RGBType& rgb)
+{
+	return	((rgb.fRed   & 0xF8) << 8) |
+			((rgb.fGreen & 0xFC) << 3) |
+			((rgb.fBlue        ) >> 3);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvEmitRow
+// ---------------------------------------------------------------------------
+// Store one converted scanline at dest, doubling each pixel horizontally
+// and then duplicating the whole row when scaling.
+
+inline void PrvEmitRow (const uint16* row, int width, uint8* dest,
+				EmPixMapRowBytes destRowBytes, Bool scale)
+{
+	if (!scale)
+	{
+		memcpy (dest, row, width * 2);
+		return;
+	}
+
+	uint16*	destPix = (uint16*) dest;
+
+	for (int xx = 0; xx < width; ++xx)
+	{
+		uint16	p = row[xx];
+
+		*destPix++ = p;
+		*destPix++ = p;
+	}
+
+	memcpy (dest + destRowBytes, dest, width * 4);
+}
+
 
 // ---------------------------------------------------------------------------
 //		 ConvertPixMapToHost
 // ---------------------------------------------------------------------------
+// Convert lines [firstLine, lastLine) of src to 16-bit 565, scaling by two
+// if asked, and store them into dest.  dest is the host location of pixel
+// (0, 0) of the (scaled) image, and destRowBytes the stride there, so the
+// LCD can be written straight into the skin's frame buffer.  A destRowBytes
+// of zero means a tightly packed buffer exactly as wide as the image.
+//
+// The LCD arrives as either native 565 (16-bit controllers) or indexed
+// 8-bit or less; those two cases are handled here directly rather than by
+// the general EmPixMap::CopyRect, which funnels every pixel through an
+// RGB triple.
 
 void ConvertPixMapToHost(const EmPixMap& src, void* dest,
-				int firstLine, int lastLine, Bool scale)
+				int firstLine, int lastLine, Bool scale,
+				EmPixMapRowBytes destRowBytes)
 {
 	// Determine a lot of the values we'll need.
 
 	int			factor		= scale ? 2 : 1;
-#if 0
-        PHEM_Log_Msg("ConvertPixMapToHost");
-        PHEM_Log_Place(factor);
-        PHEM_Log_Place(firstLine);
-        PHEM_Log_Place(lastLine);
-#endif
-
-	EmPoint			factorPoint	= EmPoint (factor, factor);
-
-	EmPoint			srcSize		= src.GetSize ();
-#if 0
-        PHEM_Log_Place(srcSize.fX);
-        PHEM_Log_Place(srcSize.fY);
-#endif
-	EmPixMapRowBytes	destRowBytes	= srcSize.fX * 2 * factor;
-#if 0
-        PHEM_Log_Msg("RowBytes:");
-        PHEM_Log_Place(destRowBytes);
-#endif
-
-	// Finally, copy the bits, converting to 16-bit 565 format along the way.
+	EmPoint		factorPoint	= EmPoint (factor, factor);
+	EmPoint		srcSize		= src.GetSize ();
+
+	if (destRowBytes == 0)
+		destRowBytes = srcSize.fX * 2 * factor;
+
+	EmPixMapFormat		srcFormat	= src.GetFormat ();
+	EmPixMapRowBytes	srcRowBytes	= src.GetRowBytes ();
+	const uint8*		srcBits		= (const uint8*) src.GetBits ();
+	uint8*				destBits	= (uint8*) dest;
+
+	// Native 565: nothing to convert, only to copy (and maybe double).
+
+	if (srcFormat == kPixMapFormat16RGB565)
+	{
+		for (int yy = firstLine; yy < lastLine; ++yy)
+		{
+			::PrvEmitRow (
+				(const uint16*) (srcBits + yy * srcRowBytes), srcSize.fX,
+				destBits + yy * factor * destRowBytes, destRowBytes, scale);
+		}
+
+		return;
+	}
+
+	// 8-bit indexed: go through a 565 version of the color table.
+
+	if (srcFormat == kPixMapFormat8)
+	{
+		const RGBList&	colors = src.GetColorTable ();
+		uint16			clut[256];
+		uint16			row[1024];
+
+		if (srcSize.fX <= (int) countof (row))
+		{
+			size_t	numColors = colors.size ();
+
+			for (size_t ii = 0; ii < 256; ++ii)
+			{
+				clut[ii] = ii < numColors ? ::PrvPack565 (colors[ii]) : 0;
+			}
+
+			for (int yy = firstLine; yy < lastLine; ++yy)
+			{
+				const uint8*	srcPtr = srcBits + yy * srcRowBytes;
+
+				for (int xx = 0; xx < srcSize.fX; ++xx)
+				{
+					row[xx] = clut[srcPtr[xx]];
+				}
+
+				::PrvEmitRow (row, srcSize.fX,
+					destBits + yy * factor * destRowBytes, destRowBytes, scale);
+			}
+
+			return;
+		}
+	}
+
+	// Everything else (1, 2, and 4 bit LCDs, and the skin image): let
+	// EmPixMap do the conversion.
 
 	EmPixMap	wrapper;
 
@@ -17,6 +17,7 @@
 #include "EmPixMap.h"			// EmPixMap
 
 void	ConvertPixMapToHost	(	const EmPixMap& src, void* buffer,
-								int firstLine, int lastLine, Bool scale);
+								int firstLine, int lastLine, Bool scale,
+								EmPixMapRowBytes destRowBytes = 0);
 
 #endif	// EmPixMapAndroid_h
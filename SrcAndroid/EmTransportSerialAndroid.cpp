@@ -28,6 +28,12 @@
 
 #define PRINTF	if (!LogSerial ()) ; else LogAppendMsg
 
+// Enough for well over a second of data at 115200 baud, so that CommRead
+// can keep draining the host port even if the CPU thread is slow to pull
+// data into the UART's RX FIFO.
+
+const long	kReadRingSize	= 16 * 1024;
+
 
 /***********************************************************************
  *
@@ -622,8 +628,7 @@ EmHostTransportSerial::EmHostTransportSerial (void) :
 	fTimeToQuit (false),
 	fDataMutex (),
 	fDataCondition (&fDataMutex),
-	fReadMutex (),
-	fReadBuffer (),
+	fReadRing (kReadRingSize),
 	fWriteMutex (),
 	fWriteBuffer ()
 {
@@ -828,11 +833,15 @@ ErrCode EmHostTransportSerial::CloseCommPort (void)
  *
  * FUNCTION:	EmHostTransportSerial::PutIncomingData
  *
- * DESCRIPTION:	Thread-safe method for adding data to the queue that
- *				holds data read from the serial port.
+ * DESCRIPTION:	Lock-free method for adding data to the ring that
+ *				holds data read from the serial port.  Must only be
+ *				called from CommRead (or, for the GPS pseudo-port,
+ *				which has no host handle for CommRead to read, from
+ *				the NMEA passthrough).
  *
  * PARAMETERS:	data - pointer to the read data.
- *				len - number of bytes pointed to by "data".
+ *				len - on input, number of bytes pointed to by "data".
+ *					On exit, number of bytes added to the ring.
  *
  * RETURNED:	Nothing
  *
@@ -843,12 +852,7 @@ void EmHostTransportSerial::PutIncomingData	(const void* data, long& len)
 	if (len == 0)
 		return;
 
-	omni_mutex_lock lock (fReadMutex);
-
-	char*	begin = (char*) data;
-	char*	end = begin + len;
-	while (begin < end)
-		fReadBuffer.push_back (*begin++);
+	len = fReadRing.Put (data, len);
 }
 
 
@@ -856,8 +860,9 @@ void EmHostTransportSerial::PutIncomingData	(const void* data, long& len)
  *
  * FUNCTION:	EmHostTransportSerial::GetIncomingData
  *
- * DESCRIPTION:	Thread-safe method for getting data from the queue
- *				holding data read from the serial port.
+ * DESCRIPTION:	Lock-free method for getting data from the ring
+ *				holding data read from the serial port.  Must only be
+ *				called from the CPU thread.
  *
  * PARAMETERS:	data - pointer to buffer to receive data.
  *				len - on input, number of bytes available in "data".
@@ -869,17 +874,7 @@ void EmHostTransportSerial::PutIncomingData	(const void* data, long& len)
 
 void EmHostTransportSerial::GetIncomingData	(void* data, long& len)
 {
-	omni_mutex_lock lock (fReadMutex);
-
-	if (len > (long) fReadBuffer.size ())
-		len = (long) fReadBuffer.size ();
-
-	char*	p = (char*) data;
-	deque<char>::iterator	begin = fReadBuffer.begin ();
-	deque<char>::iterator	end = begin + len;
-
-	copy (begin, end, p);
-	fReadBuffer.erase (begin, end);
+	len = fReadRing.Get (data, len);
 }
 
 
@@ -887,20 +882,19 @@ void EmHostTransportSerial::GetIncomingData	(void* data, long& len)
  *
  * FUNCTION:	EmHostTransportSerial::IncomingDataSize
  *
- * DESCRIPTION:	Thread-safe method returning the number of bytes in the
- *				read queue.
+ * DESCRIPTION:	Lock-free method returning the number of bytes in the
+ *				read ring.  This is cheap enough for the UART emulation
+ *				to poll as often as it likes.
  *
  * PARAMETERS:	None.
  *
- * RETURNED:	Number of bytes in the read queue.
+ * RETURNED:	Number of bytes in the read ring.
  *
  ***********************************************************************/
 
 long EmHostTransportSerial::IncomingDataSize (void)
 {
-	omni_mutex_lock lock (fReadMutex);
-
-	return fReadBuffer.size ();
+	return fReadRing.GetUsed ();
 }
 
 
@@ -927,8 +921,7 @@ void EmHostTransportSerial::PutOutgoingData	(const void* data, long& len)
 
 	char*	begin = (char*) data;
 	char*	end = begin + len;
-	while (begin < end)
-		fWriteBuffer.push_back (*begin++);
+	fWriteBuffer.insert (fWriteBuffer.end (), begin, end);
 
 	// Wake up CommWrite.
 
@@ -1013,6 +1006,16 @@ void* EmHostTransportSerial::CommRead (void* data)
 	PRINTF ("CommRead starting.");
 
 	while (!This->fTimeToQuit) {
+		// If the ring is full, leave the data in the host port (where
+		// flow control can push back) until the CPU thread drains it.
+
+		long	space = This->fReadRing.GetFree ();
+
+		if (space == 0) {
+			omni_thread::sleep (0, 1000000);	// 1 msec
+			continue;
+		}
+
 		int		status, fd1, fd2, maxfd;
 		fd_set	read_fds;
 		FD_ZERO (&read_fds);
@@ -1040,12 +1043,15 @@ void* EmHostTransportSerial::CommRead (void* data)
 		{
 			if ((This->fCommHandle > 0) && FD_ISSET (fd1, &read_fds)) {
 				char	buf[1024];
-				int		len = 1024;
+				int		len = (int) min (space, (long) sizeof (buf));
 				len = read (fd1, buf, len);
 
 				if (len == 0)
 					break; // port closed
 
+				if (len < 0)
+					continue; // EINTR, EAGAIN, etc.
+
 				// Log the data.
 				if (LogSerialData ())
 					LogAppendData (buf, len, "EmHostTransportSerial::CommRead: Received data:");
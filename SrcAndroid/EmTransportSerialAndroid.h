@@ -16,6 +16,7 @@
 
 #include "EmTransportSerial.h"
 
+#include "EmThreadSafeQueue.h"	// EmByteRing
 #include "omnithread.h"			// omni_mutex
 #include <deque>				// deque
 
@@ -58,8 +59,8 @@ class EmHostTransportSerial
 		omni_mutex				fDataMutex;
 		omni_condition			fDataCondition;
 
-		omni_mutex				fReadMutex;
-		deque<char>				fReadBuffer;
+		// Filled by CommRead, drained by the CPU thread.
+		EmByteRing				fReadRing;
 
 		omni_mutex				fWriteMutex;
 		deque<char>				fWriteBuffer;
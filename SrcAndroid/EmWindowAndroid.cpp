@@ -658,81 +658,34 @@ void EmWindowAndroid::HostPaintCase (const EmScreenUpdateInfo&)
 // ---------------------------------------------------------------------------
 // Draw the LCD area.  info contains the raw LCD data, including a partially
 // updated fImage, and fFirstList and fLastLine which indicate the valid
-// range of the image.  srcRect and destRect also indicate the range that
-// needs to be updated, and have also been scaled appropriately.  scaled is
-// true if we need to scale info.fImage during the process of converting it
-// to a host pixmap.
+// range of the image.  srcRect and destRect indicate the band that needs
+// to be updated (one of those in info.fDirtyRegion), and have also been
+// scaled appropriately.  scaled is true if we need to scale info.fImage
+// during the process of converting it to a host pixmap.
 
 void EmWindowAndroid::HostPaintLCD (const EmScreenUpdateInfo& info, const EmRect& srcRect,
 						  const EmRect& destRect, Bool scaled)
 {
-	// Determine the buffer size and allocate it.
-	// We assume that ConvertPixMapToHost is converting to 16-bit RGB 565.
-
-        int i;
-	int		rowBytes	= srcRect.fRight * 2; // 2 bytes per pixel
-	int		lcd_bufferSize	= srcRect.fBottom * rowBytes;
-	uint8 *	lcd_buffer		= (uint8 *) Platform::AllocateMemory (lcd_bufferSize);
-        uint8 * saved_lcd_buffer;
-        uint8 * target_buffer = PHEM_Get_Buffer();
-        saved_lcd_buffer = lcd_buffer; // so we can free it
-
-        const EmPixMap& p = this->GetCurrentSkin ();
-        EmPoint size = p.GetSize ();
-#if 0
-        PHEM_Log_Msg("HostPaintLCD");
-        if (scaled) {
-          PHEM_Log_Msg("Scaled");
-        } else {
-          PHEM_Log_Msg("Unscaled");
-        }
-
-        PHEM_Log_Msg("SrcRect");
-        PHEM_Log_Place(srcRect.fTop);
-        PHEM_Log_Place(srcRect.fLeft);
-        PHEM_Log_Place(srcRect.fRight);
-        PHEM_Log_Place(srcRect.fBottom);
-        PHEM_Log_Place(srcRect.Width());
-        PHEM_Log_Place(srcRect.Height());
-
-        PHEM_Log_Msg("DestRect");
-        PHEM_Log_Place(destRect.fTop);
-        PHEM_Log_Place(destRect.fLeft);
-        PHEM_Log_Place(destRect.fRight);
-        PHEM_Log_Place(destRect.fBottom);
-        PHEM_Log_Place(destRect.Width());
-        PHEM_Log_Place(destRect.Height());
-
-        PHEM_Log_Msg("info");
-        PHEM_Log_Place(info.fFirstLine);
-        PHEM_Log_Place(info.fLastLine);
-
-        PHEM_Log_Msg("skin size");
-        PHEM_Log_Place(size.fX);
-        PHEM_Log_Place(size.fY);
-#endif
+	// Convert the image straight into the skin buffer, scaling along the
+	// way.  srcRect is in (scaled) image coordinates and destRect is where
+	// that lands in the skin, so the image origin sits at their difference.
+	// The buffer is always 16-bit RGB 565, one skin width per row.
 
-	// Convert the image, scaling along the way.
+	const EmPixMap& p = this->GetCurrentSkin ();
+	EmPoint size = p.GetSize ();
 
-	::ConvertPixMapToHost (info.fImage, lcd_buffer,
-				 info.fFirstLine, info.fLastLine, scaled);
+	EmPixMapRowBytes	rowBytes	= size.fX * 2; // 2 bytes per pixel
+	uint8*				lcdOrigin	= PHEM_Get_Buffer ()
+									+ (destRect.fTop - srcRect.fTop) * rowBytes
+									+ (destRect.fLeft - srcRect.fLeft) * 2;
 
-	// Draw the converted image.
+	// Only convert the scanlines in this band.
 
-        // We need to copy line-by-line into the buffer.
-        // Position the target_buffer pointer: (lines * bytes in a line) + (bytes inset)
-        target_buffer += (destRect.fTop * size.fX * 2) + (destRect.fLeft * 2);
-        lcd_buffer += srcRect.fTop * rowBytes;
+	EmRect	lines = ::SkinScaleDown (srcRect);
 
-        for (i=srcRect.fTop; i<srcRect.fBottom; i++) {
-	  memcpy(target_buffer, lcd_buffer, rowBytes);
-          // increment the pointers
-          target_buffer += (size.fX * 2);
-          lcd_buffer += rowBytes;
-        }
-	// Clean up.
+	::ConvertPixMapToHost (info.fImage, lcdOrigin,
+				 lines.fTop, lines.fBottom, scaled, rowBytes);
 
-	Platform::DisposeMemory (saved_lcd_buffer);
 #if 0
   // Set the flag to tell the Android side to update the screen
   if (scaled) {
@@ -59,6 +59,7 @@
 #include "EmPalmStructs.h"		// EmAliasPenBtnInfoType
 #include "EmPatchState.h"		// GetCurrentAppInfo
 #include "EmSession.h"			// gSession, ScheduleAutoSaveState
+#include "EmVirtualTime.h"		// EmVirtualTime::GetMilliseconds
 #include "ErrorHandling.h"		// Errors::ThrowIfPalmError
 #include "Hordes.h"				// Hordes::IsOn, TurnOn
 #include "Logging.h"
@@ -1532,7 +1533,7 @@ Gremlins::New (const GremlinInfo& info)
 
 	this->Initialize (info.fNumber, info.fSteps, info.fFinal);
 
-	gremlinStartTime = Platform::GetMilliseconds ();
+	gremlinStartTime = EmVirtualTime::GetMilliseconds ();
 
 	// Make sure the app's awake.  Normally, we post events on a patch to
 	// SysEvGroupWait.  However, if the Palm device is already waiting,
@@ -1566,7 +1567,7 @@ Gremlins::New (const GremlinInfo& info)
 void
 Gremlins::Save (SessionFile& f)
 {
-	gremlinStopTime = Platform::GetMilliseconds ();
+	gremlinStopTime = EmVirtualTime::GetMilliseconds ();
 
 	const long	kCurrentVersion = 2;
 
@@ -1665,7 +1666,7 @@ Gremlins::Load (SessionFile& f)
 			// Patch up the start and stop times.
 
 			int32	delta = gremlinStopTime - gremlinStartTime;
-			gremlinStopTime = Platform::GetMilliseconds ();
+			gremlinStopTime = EmVirtualTime::GetMilliseconds ();
 			gremlinStartTime = gremlinStopTime - delta;
 
 			// Reset keyProbabilitiesSum to zero so that it gets
@@ -1834,7 +1835,7 @@ void Gremlins::Step()
 void
 Gremlins::Resume (void)
 {
-	gremlinStartTime = Platform::GetMilliseconds () - (gremlinStopTime - gremlinStartTime);
+	gremlinStartTime = EmVirtualTime::GetMilliseconds () - (gremlinStopTime - gremlinStartTime);
 
 	// Make sure we're all on the same page...
 	::ResetCalibrationInfo ();
@@ -1867,7 +1868,7 @@ Gremlins::Stop (void)
 	if (Hordes::IsOn())
 	{
 		Hordes::TurnOn(false);
-		gremlinStopTime = Platform::GetMilliseconds ();
+		gremlinStopTime = EmVirtualTime::GetMilliseconds ();
 
 		unsigned short	number;
 		unsigned long	step;
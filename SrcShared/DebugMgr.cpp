@@ -21,12 +21,15 @@
 #include "EmCPU68K.h"			// gCPU68K
 #include "EmErrCodes.h"			// kError_NoError
 #include "EmException.h"		// EmExceptionReset
+#include "EmGDBStub.h"			// EmGDBStub::IsConnected, SendStopReply
 #include "EmHAL.h"				// EmHAL
 #include "EmLowMem.h"			// LowMem_SetGlobal, LowMem_GetGlobal
 #include "EmMemory.h"			// CEnableFullAccess
 #include "EmPalmFunction.h"		// SysTrapIndex, IsSystemTrap
 #include "EmPatchState.h"		// EmPatchState::UIInitialized
 #include "EmSession.h"			// EmSessionStopper, SuspendByDebugger
+#include "EmTimeTravel.h"		// EmTimeTravel::IsMoving, sysPktTimeTravelCmd
+#include "EmWatchpoints.h"		// EmWatchpoints::Add, Remove
 #include "ErrorHandling.h"		// ReportUnhandledException
 #include "Logging.h"			// gErrLog
 #include "MetaMemory.h"			// MetaMemory::MarkInstructionBreak
@@ -39,7 +42,8 @@
 #include "SystemPacket.h"		// SystemPacket::
 #include "UAE.h"				// m68k_areg, m68k_dreg, etc.
 
-#include "ctype.h"				// isspace, isdigit, isxdigit
+#include "ctype.h"				// isspace, isdigit, isalpha
+#include <stdlib.h>				// strtoul
 
 
 #define PRINTF	if (!LogHLDebugger ()) ; else LogAppendMsg
@@ -49,10 +53,61 @@
 #pragma mark ===== Types
 // ---------------------------------------------------------------------------
 
-struct NamedConditionType
+	// Operations in a compiled BreakpointCondition.  The ones marked with
+	// a "+" are followed by an operand.
+
+enum
+{
+	kCondConst,			// + value
+	kCondDReg,			// + register number
+	kCondAReg,			// + register number
+	kCondPC,
+	kCondSR,
+	kCondTrap,
+	kCondHits,
+
+	kCondLoad8,
+	kCondLoad16,
+	kCondLoad32,
+	kCondTrunc8,
+	kCondTrunc16,
+
+	kCondNeg,
+	kCondNot,
+	kCondLogNot,
+	kCondBool,
+
+	kCondMul,
+	kCondAdd,
+	kCondSub,
+	kCondShl,
+	kCondShr,
+	kCondAnd,
+	kCondOr,
+	kCondXor,
+	kCondEq,
+	kCondNe,
+	kCondLt,
+	kCondLe,
+	kCondGt,
+	kCondGe,
+
+	kCondJumpIfFalse,	// + target; pops unless it jumps
+	kCondJumpIfTrue		// + target; pops unless it jumps
+};
+
+struct NamedOperatorType
 {
 	const char*	name;
-	compareFun	function;
+	uint32		op;
+};
+
+struct ConditionCompilerType
+{
+	const char*				p;
+	BreakpointCondition*	bc;
+	int						depth;
+	Bool					ok;
 };
 
 
@@ -60,17 +115,21 @@ struct NamedConditionType
 #pragma mark ===== Functions
 // ---------------------------------------------------------------------------
 
-static uint32		PrvGetAddressRegister	(int num);
-static uint32		PrvGetDataRegister		(int num);
-static Bool			PrvBPEquals				(uint32 a, uint32 b);
-static Bool			PrvBPNotEquals			(uint32 a, uint32 b);
-static Bool			PrvBPGreater			(uint32 a, uint32 b);
-static Bool			PrvBPGreaterOrEqual		(uint32 a, uint32 b);
-static Bool			PrvBPLess				(uint32 a, uint32 b);
-static Bool			PrvBPLessOrEqual		(uint32 a, uint32 b);
+static void			PrvCondEmit				(ConditionCompilerType& c, uint32 op, int depthChange);
+static void			PrvCondOperand			(ConditionCompilerType& c, uint32 operand);
+static Bool			PrvCondMatch			(ConditionCompilerType& c, const char* token);
+static const NamedOperatorType*
+					PrvCondMatchOperator	(ConditionCompilerType& c, const NamedOperatorType* ops);
+static void			PrvCondOr				(ConditionCompilerType& c);
+static void			PrvCondAnd				(ConditionCompilerType& c);
+static void			PrvCondLevel			(ConditionCompilerType& c, int level);
+static void			PrvCondUnary			(ConditionCompilerType& c);
+static void			PrvCondPrimary			(ConditionCompilerType& c);
+static void			PrvCondLoad				(ConditionCompilerType& c);
+static void			PrvCondTruncate			(ConditionCompilerType& c);
+static uint32		PrvCondTrapWord			(void);
 static const char*	PrvSkipWhite			(const char* p);
 
-static Bool			PrvParseDecimal			(const char **ps, int *i);
 static Bool			PrvParseUnsigned		(const char **ps, uint32 *u);
 
 
@@ -84,6 +143,7 @@ static Bool			PrvParseUnsigned		(const char **ps, uint32 *u);
 #define kOpcode_RTD		0x4E74
 #define kOpcode_RTS		0x4E75
 #define kOpcode_JMP		0x4ED0
+#define kOpcode_TRAP15	0x4E4F
 
 
 // ---------------------------------------------------------------------------
@@ -97,15 +157,50 @@ DebugGlobalsType		gDebuggerGlobals;
 
 // ----- UnSaved variables ---------------------------------------------------
 
-static NamedConditionType kConditions[] =
+// Binary operators in breakpoint conditions, by precedence (see DebugMgr.h).
+// Where one is a prefix of another, the longer one comes first.
+
+static NamedOperatorType kCondCompareOps[] =
+{
+	{"==",	kCondEq},
+	{"!=",	kCondNe},
+	{">=",	kCondGe},
+	{">",	kCondGt},
+	{"<=",	kCondLe},
+	{"<",	kCondLt},
+	{NULL,	0}
+};
+
+static NamedOperatorType kCondBitwiseOps[] =
+{
+	{"&",	kCondAnd},
+	{"|",	kCondOr},
+	{"^",	kCondXor},
+	{NULL,	0}
+};
+
+static NamedOperatorType kCondSumOps[] =
+{
+	{"+",	kCondAdd},
+	{"-",	kCondSub},
+	{"<<",	kCondShl},
+	{">>",	kCondShr},
+	{NULL,	0}
+};
+
+static NamedOperatorType kCondProductOps[] =
+{
+	{"*",	kCondMul},
+	{NULL,	0}
+};
+
+static const NamedOperatorType* kCondLevels[] =
 {
-	{"==",	&PrvBPEquals},
-	{"!=",	&PrvBPNotEquals},
-	{">",	&PrvBPGreater},
-	{">=",	&PrvBPGreaterOrEqual},
-	{"<",	&PrvBPLess},
-	{"<=",	&PrvBPLessOrEqual},
-	{NULL,	NULL}
+	kCondCompareOps,
+	kCondBitwiseOps,
+	kCondSumOps,
+	kCondProductOps,
+	NULL
 };
 
 emuptr	gExceptionAddress;
@@ -123,6 +218,10 @@ static CSocket*			gDebuggerSocket2;	 // TCP socket on port 2000
 static CSocket*			gDebuggerSocket3;	 // Platform-specific socket
 static CTCPSocket*		gConnectedDebugSocket;
 
+	// The EmWatchpoints ID of the data breakpoint described by
+	// gDebuggerGlobals.watchAddr and watchBytes, or zero if none.
+static int				gDataBreakID;
+
 
 #pragma mark -
 
@@ -196,7 +295,7 @@ void Debug::Shutdown (void)
 
 Bool Debug::ConnectedToTCPDebugger (void)
 {
-	return Debug::GetTCPDebuggerSocket () != NULL;
+	return Debug::GetTCPDebuggerSocket () != NULL || EmGDBStub::IsConnected ();
 }
 
 
@@ -562,6 +661,8 @@ void Debug::Load (SessionFile& f)
 			s >> gDebuggerGlobals.watchEnabled;
 			s >> gDebuggerGlobals.watchAddr;
 			s >> gDebuggerGlobals.watchBytes;
+
+			Debug::SyncDataBreak ();
 		}
 	}
 	else
@@ -591,6 +692,9 @@ void Debug::Dispose (void)
 	{
 		Debug::DeleteBreakpointCondition (ii);
 	}
+
+	EmWatchpoints::RemoveAll ();
+	gDataBreakID = 0;
 }
 
 
@@ -778,6 +882,10 @@ ErrCode Debug::HandleNewPacket (SLP& slp)
 				PRINTF ("   Should not be *receiving these!");
 				break;
 
+			case sysPktTimeTravelCmd:
+				result = SystemPacket::TimeTravel (slp);
+				break;
+
 #if 0
 			case 0xFF:
 			{
@@ -1016,6 +1124,11 @@ Bool Debug::HandleTrap8 (ExceptionNumber exceptionNumber)
 	if (gSession->IsNested ())
 		return true;
 
+	// Don't break if we're replaying history (see EmTimeTravel).
+
+	if (EmTimeTravel::IsMoving ())
+		return true;
+
 	if (gDebuggerGlobals.ignoreDbgBreaks)
 	{
 		return true;
@@ -1060,6 +1173,11 @@ Bool Debug::HandleSystemCall (const SystemCallContext& context)
 	if (gSession->IsNested ())
 		return false;
 
+	// Don't break if we're replaying history (see EmTimeTravel).
+
+	if (EmTimeTravel::IsMoving ())
+		return false;
+
 	Bool	doBreak = false;
 
 	if (!gDebuggerGlobals.continueOverATrap && gDebuggerGlobals.breakingOnATrap)
@@ -1210,7 +1328,15 @@ ErrCode Debug::EnterDebugger (ExceptionNumber reason, SLP* slp)
 	if (!slp)
 	{
 		CSocket*	debuggerSocket = Debug::GetDebuggerSocket ();
-		if (debuggerSocket)
+
+		// A connected gdb takes precedence; it gets a stop reply instead
+		// of a state packet.
+
+		if (EmGDBStub::IsConnected ())
+		{
+			result = EmGDBStub::SendStopReply ();
+		}
+		else if (debuggerSocket)
 		{
 			SLP	newSLP (debuggerSocket);
 			result = SystemPacket::SendState (newSLP);
@@ -1333,6 +1459,12 @@ void Debug::HandleInstructionBreak (void)
 	if (gSession->IsNested ())
 		return;
 
+	// Don't break on soft breakpoints if we're replaying history (see
+	// EmTimeTravel).
+
+	if (EmTimeTravel::IsMoving ())
+		return;
+
 	// Don't break on soft breakpoints if we're exiting the debugger.
 
 	if (gDebuggerGlobals.continueOverBP)
@@ -1412,109 +1544,34 @@ void Debug::RemoveInstructionBreaks (void)
 
 BreakpointCondition* Debug::NewBreakpointCondition (const char* sourceString)
 {
-	const char* source = sourceString;
-	registerFun regType;
-	int		regNum;
-	Bool		indirect = false;
-	uint32		indirectOffset;
-	int		size = 4;
-
-	compareFun	condition;
-	int		value;
-
-	source = PrvSkipWhite (source);
-	if (!source)
-		return NULL;
+	BreakpointCondition*	bc = new BreakpointCondition;
 
-	if (isdigit (*source))
-	{
-		indirect = true;
-		if (!PrvParseUnsigned (&source, &indirectOffset))
-			return NULL;
+	bc->codeLength	= 0;
+	bc->hits		= 0;
+	bc->source		= NULL;
 
-		source = PrvSkipWhite (source);
+	ConditionCompilerType	c;
 
-		if (*source != '(')
-			return NULL;
+	c.p		= sourceString;
+	c.bc	= bc;
+	c.depth	= 0;
+	c.ok	= sourceString != NULL;
 
-		++source;
-		source = PrvSkipWhite (source);
-	}
-
-	switch (tolower (*source++))
+	if (c.ok)
 	{
-	case 'd':
-		regType = PrvGetDataRegister;
-		break;
-
-	case 'a':
-		regType = PrvGetAddressRegister;
-		break;
-
-	default:
-		return NULL;
+		PrvCondOr (c);
 	}
 
-	source = PrvSkipWhite (source);
-
-	if (!PrvParseDecimal (&source, &regNum))
-		return NULL;
-
-	source = PrvSkipWhite (source);
-
-	if (indirect)
-	{
-		if (*source != ')')
-			return NULL;
-
-		++source;
-		source = PrvSkipWhite (source);
-	}
+	// Make sure we used up all of the text, and that the code leaves
+	// exactly one value behind.
 
-	if (*source == '.')
+	if (!c.ok || *PrvSkipWhite (c.p) != 0 || c.depth != 1)
 	{
-		++source;
-
-		switch (*source)
-		{
-		case 'b': size = 1; break;
-		case 'w': size = 2; break;
-		case 'l': size = 4; break;
-		default: return NULL;
-		}
-
-		++source;
-		source = PrvSkipWhite (source);
-	}
-
-	condition = NULL;
-	for (NamedConditionType* c = kConditions; c->name; ++c)
-	{
-		if (!strncmp (source, c->name, strlen (c->name)))
-		{
-			condition = c->function;
-			source += strlen (c->name);
-			break;
-		}
-	}
-
-	if (!condition)
-		return NULL;
-
-	if (sscanf (source, "%i", &value) != 1)
+		delete bc;
 		return NULL;
+	}
 
-	BreakpointCondition* bc = new BreakpointCondition;
-
-	bc->regType		= regType;
-	bc->regNum			= regNum;
-	bc->indirect		= indirect;
-	bc->indirectOffset	= indirectOffset;
-	bc->size			= size;
-
-	bc->condition		= condition;
-	bc->value			= value;
-	bc->source			= _strdup (sourceString);
+	bc->source = _strdup (sourceString);
 
 	return bc;
 }
@@ -1587,8 +1644,25 @@ void Debug::ClearBreakpoint (int index)
 
 void Debug::DeleteBreakpointCondition (int index)
 {
-	BreakpointCondition*&	cond = gDebuggerGlobals.bpCondition[index];
+	Debug::DeleteBreakpointCondition (gDebuggerGlobals.bpCondition[index]);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	Debug::DeleteBreakpointCondition
+ *
+ * DESCRIPTION: Delete a condition created by NewBreakpointCondition.
+ *
+ * PARAMETERS:	cond - the condition to delete, or NULL.  Set to NULL
+ *					on exit.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
 
+void Debug::DeleteBreakpointCondition (BreakpointCondition*& cond)
+{
 	if (cond)
 	{
 		if (cond->source)
@@ -1712,146 +1786,498 @@ void Debug::DoCheckStepSpy (emuptr writeAddress, int writeBytes)
 
 /***********************************************************************
  *
- * FUNCTION:	Debug::DoCheckWatchpoint
+ * FUNCTION:	Debug::SyncDataBreak
  *
- * DESCRIPTION: .
+ * DESCRIPTION: Install the data breakpoint described by watchEnabled,
+ *				watchAddr, and watchBytes as a write watchpoint,
+ *				replacing the one installed before.  Call this after
+ *				changing any of them.
  *
- * PARAMETERS:	.
+ * PARAMETERS:	None.
  *
- * RETURNED:	.
+ * RETURNED:	Nothing.
  *
  ***********************************************************************/
 
-void Debug::DoCheckWatchpoint (emuptr writeAddress, int writeBytes)
+void Debug::SyncDataBreak (void)
 {
-	if (writeAddress < gDebuggerGlobals.watchAddr + gDebuggerGlobals.watchBytes &&
-		writeAddress + writeBytes > gDebuggerGlobals.watchAddr)
+	if (gDataBreakID)
 	{
-		gSession->ScheduleDeferredError (new EmDeferredErrWatchpoint (writeAddress, writeBytes,
-			gDebuggerGlobals.watchAddr, gDebuggerGlobals.watchBytes));
+		EmWatchpoints::Remove (gDataBreakID);
+		gDataBreakID = 0;
+	}
+
+	if (gDebuggerGlobals.watchEnabled)
+	{
+		gDataBreakID = EmWatchpoints::Add (gDebuggerGlobals.watchAddr,
+			gDebuggerGlobals.watchBytes, kWatchWrite, NULL);
 	}
 }
 
 
 ////// breakpoint conditions
 
-uint32 PrvGetAddressRegister (int num)
+// ---------------------------------------------------------------------------
+//		 PrvCondEmit
+// ---------------------------------------------------------------------------
+// Add an operation to the condition being compiled, keeping track of how
+// deep the stack will get.
+
+void PrvCondEmit (ConditionCompilerType& c, uint32 op, int depthChange)
 {
-	return m68k_areg (regs, num);
+	PrvCondOperand (c, op);
+
+	c.depth += depthChange;
+
+	if (c.depth > BreakpointCondition::kMaxStack)
+		c.ok = false;
 }
 
-uint32 PrvGetDataRegister (int num)
+
+// ---------------------------------------------------------------------------
+//		 PrvCondOperand
+// ---------------------------------------------------------------------------
+
+void PrvCondOperand (ConditionCompilerType& c, uint32 operand)
 {
-	return m68k_dreg (regs, num);
+	if (c.bc->codeLength >= BreakpointCondition::kMaxCode)
+	{
+		c.ok = false;
+		return;
+	}
+
+	c.bc->code[c.bc->codeLength++] = operand;
 }
 
-Bool PrvBPEquals (uint32 a, uint32 b)
+
+// ---------------------------------------------------------------------------
+//		 PrvCondMatch
+// ---------------------------------------------------------------------------
+// If the next thing in the source is the given token, skip over it and
+// return true.
+
+Bool PrvCondMatch (ConditionCompilerType& c, const char* token)
 {
-	return a == b;
+	c.p = PrvSkipWhite (c.p);
+
+	size_t	len = strlen (token);
+
+	if (strncmp (c.p, token, len) != 0)
+		return false;
+
+	// Don't take "&" from "&&", or "|" from "||".
+
+	if (len == 1 && (*token == '&' || *token == '|') && c.p[1] == *token)
+		return false;
+
+	c.p += len;
+	return true;
 }
 
-Bool PrvBPNotEquals (uint32 a, uint32 b)
+
+// ---------------------------------------------------------------------------
+//		 PrvCondMatchOperator
+// ---------------------------------------------------------------------------
+
+const NamedOperatorType* PrvCondMatchOperator (ConditionCompilerType& c,
+											   const NamedOperatorType* ops)
 {
-	return a != b;
+	for (; ops->name; ++ops)
+	{
+		if (PrvCondMatch (c, ops->name))
+			return ops;
+	}
+
+	return NULL;
 }
 
-// Comparisons are unsigned for now.  Would it be more useful if they were signed?
 
-Bool PrvBPGreater (uint32 a, uint32 b)
+// ---------------------------------------------------------------------------
+//		 PrvCondOr
+// ---------------------------------------------------------------------------
+// <and> || <and> ...
+//
+// If the left side is true, leave the 1 it turns into on the stack and
+// jump past the right side.
+
+void PrvCondOr (ConditionCompilerType& c)
 {
-	return a > b;
+	PrvCondAnd (c);
+
+	while (c.ok && PrvCondMatch (c, "||"))
+	{
+		PrvCondEmit (c, kCondBool, 0);
+		PrvCondEmit (c, kCondJumpIfTrue, -1);
+		PrvCondOperand (c, 0);
+
+		int		fixup = c.bc->codeLength - 1;
+
+		PrvCondAnd (c);
+		PrvCondEmit (c, kCondBool, 0);
+
+		if (c.ok)
+			c.bc->code[fixup] = c.bc->codeLength;
+	}
 }
 
-Bool PrvBPGreaterOrEqual (uint32 a, uint32 b)
+
+// ---------------------------------------------------------------------------
+//		 PrvCondAnd
+// ---------------------------------------------------------------------------
+// <compare> && <compare> ...
+//
+// If the left side is false, leave the zero on the stack and jump past the
+// right side.
+
+void PrvCondAnd (ConditionCompilerType& c)
 {
-	return a >= b;
+	PrvCondLevel (c, 0);
+
+	while (c.ok && PrvCondMatch (c, "&&"))
+	{
+		PrvCondEmit (c, kCondJumpIfFalse, -1);
+		PrvCondOperand (c, 0);
+
+		int		fixup = c.bc->codeLength - 1;
+
+		PrvCondLevel (c, 0);
+		PrvCondEmit (c, kCondBool, 0);
+
+		if (c.ok)
+			c.bc->code[fixup] = c.bc->codeLength;
+	}
 }
 
-Bool PrvBPLess (uint32 a, uint32 b)
+
+// ---------------------------------------------------------------------------
+//		 PrvCondLevel
+// ---------------------------------------------------------------------------
+// The binary operators in kCondLevels[level], and everything that binds
+// more tightly than them.
+
+void PrvCondLevel (ConditionCompilerType& c, int level)
 {
-	return a < b;
+	if (!kCondLevels[level])
+	{
+		PrvCondUnary (c);
+		return;
+	}
+
+	PrvCondLevel (c, level + 1);
+
+	while (c.ok)
+	{
+		const NamedOperatorType*	op = PrvCondMatchOperator (c, kCondLevels[level]);
+
+		if (!op)
+			break;
+
+		PrvCondLevel (c, level + 1);
+		PrvCondEmit (c, op->op, -1);
+	}
 }
 
-Bool PrvBPLessOrEqual (uint32 a, uint32 b)
+
+// ---------------------------------------------------------------------------
+//		 PrvCondUnary
+// ---------------------------------------------------------------------------
+
+void PrvCondUnary (ConditionCompilerType& c)
 {
-	return a <= b;
+	if (PrvCondMatch (c, "-"))
+	{
+		PrvCondUnary (c);
+		PrvCondEmit (c, kCondNeg, 0);
+	}
+	else if (PrvCondMatch (c, "~"))
+	{
+		PrvCondUnary (c);
+		PrvCondEmit (c, kCondNot, 0);
+	}
+	else if (PrvCondMatch (c, "!"))
+	{
+		PrvCondUnary (c);
+		PrvCondEmit (c, kCondLogNot, 0);
+	}
+	else
+	{
+		PrvCondPrimary (c);
+	}
 }
 
-const char* PrvSkipWhite (const char* p)
+
+// ---------------------------------------------------------------------------
+//		 PrvCondPrimary
+// ---------------------------------------------------------------------------
+// A number, register, memory reference, or parenthesized expression.
+
+void PrvCondPrimary (ConditionCompilerType& c)
 {
-	while (p && isspace (*p))
-		++p;
+	c.p = PrvSkipWhite (c.p);
 
-	return p;
+	if (PrvCondMatch (c, "("))
+	{
+		PrvCondOr (c);
+
+		if (!PrvCondMatch (c, ")"))
+			c.ok = false;
+	}
+
+	else if (PrvCondMatch (c, "["))
+	{
+		PrvCondOr (c);
+
+		if (!PrvCondMatch (c, "]"))
+			c.ok = false;
+
+		PrvCondLoad (c);
+	}
+
+	else if (isdigit (*c.p))
+	{
+		uint32	value;
+
+		if (!PrvParseUnsigned (&c.p, &value))
+		{
+			c.ok = false;
+			return;
+		}
+
+		PrvCondEmit (c, kCondConst, 1);
+		PrvCondOperand (c, value);
+
+		// "offset(expr)" reads from memory.
+
+		if (PrvCondMatch (c, "("))
+		{
+			PrvCondOr (c);
+
+			if (!PrvCondMatch (c, ")"))
+				c.ok = false;
+
+			PrvCondEmit (c, kCondAdd, -1);
+			PrvCondLoad (c);
+		}
+	}
+
+	else if (isalpha (*c.p))
+	{
+		char	name[8];
+		size_t	len = 0;
+
+		while (isalnum (*c.p))
+		{
+			if (len < sizeof (name) - 1)
+				name[len++] = tolower (*c.p);
+			else
+				c.ok = false;
+
+			++c.p;
+		}
+
+		name[len] = 0;
+
+		if (len == 2 && name[0] == 'd' && name[1] >= '0' && name[1] <= '7')
+		{
+			PrvCondEmit (c, kCondDReg, 1);
+			PrvCondOperand (c, name[1] - '0');
+		}
+		else if (len == 2 && name[0] == 'a' && name[1] >= '0' && name[1] <= '7')
+		{
+			PrvCondEmit (c, kCondAReg, 1);
+			PrvCondOperand (c, name[1] - '0');
+		}
+		else if (strcmp (name, "sp") == 0)
+		{
+			PrvCondEmit (c, kCondAReg, 1);
+			PrvCondOperand (c, 7);
+		}
+		else if (strcmp (name, "pc") == 0)
+			PrvCondEmit (c, kCondPC, 1);
+		else if (strcmp (name, "sr") == 0)
+			PrvCondEmit (c, kCondSR, 1);
+		else if (strcmp (name, "trap") == 0)
+			PrvCondEmit (c, kCondTrap, 1);
+		else if (strcmp (name, "hits") == 0)
+			PrvCondEmit (c, kCondHits, 1);
+		else
+			c.ok = false;
+
+		PrvCondTruncate (c);
+	}
+
+	else
+	{
+		c.ok = false;
+	}
 }
 
-/* Parse a signed decimal integer */
 
-Bool PrvParseDecimal (const char **ps, int *i)
+// ---------------------------------------------------------------------------
+//		 PrvCondLoad
+// ---------------------------------------------------------------------------
+// Read from the address on the stack, as much as the size after the
+// memory reference says.
+
+void PrvCondLoad (ConditionCompilerType& c)
 {
-	const char *s = *ps;
+	uint32	op = kCondLoad32;
 
-	if (sscanf (s, "%d", i) != 1)
-		return false;
+	if (PrvCondMatch (c, ".b"))
+		op = kCondLoad8;
+	else if (PrvCondMatch (c, ".w"))
+		op = kCondLoad16;
+	else
+		PrvCondMatch (c, ".l");
 
-	while (isdigit (*s))
-		++s;
+	PrvCondEmit (c, op, 0);
+}
 
-	*ps = s;
 
-	return true;
+// ---------------------------------------------------------------------------
+//		 PrvCondTruncate
+// ---------------------------------------------------------------------------
+// Use as much of the register on the stack as the size after it says.
+
+void PrvCondTruncate (ConditionCompilerType& c)
+{
+	if (PrvCondMatch (c, ".b"))
+		PrvCondEmit (c, kCondTrunc8, 0);
+	else if (PrvCondMatch (c, ".w"))
+		PrvCondEmit (c, kCondTrunc16, 0);
+	else
+		PrvCondMatch (c, ".l");
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvCondTrapWord
+// ---------------------------------------------------------------------------
+// Return the system call the instruction at the PC makes, or zero.
+
+uint32 PrvCondTrapWord (void)
+{
+	emuptr	pc		= m68k_getpc ();
+	uint16	opcode	= EmMemGet16 (pc);
+
+	if (opcode == kOpcode_TRAP15)
+		opcode = EmMemGet16 (pc + 2);
+
+	if ((opcode & 0xF000) != 0xA000)
+		return 0;
+
+	return opcode;
+}
+
+const char* PrvSkipWhite (const char* p)
+{
+	while (p && isspace (*p))
+		++p;
+
+	return p;
 }
 
 /* Parse an unsigned integer which may be either decimal or hex (e.g. "0xabc")
  */
 Bool PrvParseUnsigned (const char **ps, uint32 *u)
 {
-	const char *s = *ps;
+	char *end;
 
-	if (sscanf (s, "%li", u) != 1)
-		return false;
+	/* Not sscanf "%li", which would write a long into a uint32 */
 
-	if (s[0] == '0' && (s[1] == 'x' || s[1] == 'X'))	/* hex */
-	{
-		s += 2;
-		while (isxdigit (*s))
-			++s;
-	}
-	else /* decimal */
-	{
-		while (isdigit (*s))
-			++s;
-	}
+	*u = (uint32) strtoul (*ps, &end, 0);
+
+	if (end == *ps)
+		return false;
 
-	*ps = s;
+	*ps = end;
 
 	return true;
 }
 
 Bool BreakpointCondition::Evaluate (void)
 {
-	uint32 r = regType (regNum);
+	uint32	stack[kMaxStack];
+	int		sp = -1;
+	int		pc = 0;
 
-	if (indirect)
-	{
-		if (size == 4)
-			r = EmMemGet32 (r + indirectOffset);
-		else if (size == 2)
-			r = EmMemGet16 (r + indirectOffset);
-		else if (size == 1)
-			r = EmMemGet8 (r + indirectOffset);
-		else
-			return false;
-	}
-	else
+	++hits;
+
+	while (pc < codeLength)
 	{
-		if (size == 2)
-			r = (uint16) r;
-		else if (size == 1)
-			r = (uint8) r;
+		uint32	a, b;
+
+		switch (code[pc++])
+		{
+			case kCondConst:	stack[++sp] = code[pc++];						break;
+			case kCondDReg: 	stack[++sp] = m68k_dreg (regs, code[pc++]);		break;
+			case kCondAReg: 	stack[++sp] = m68k_areg (regs, code[pc++]);		break;
+			case kCondPC:		stack[++sp] = m68k_getpc ();					break;
+			case kCondTrap: 	stack[++sp] = PrvCondTrapWord ();				break;
+			case kCondHits: 	stack[++sp] = hits; 							break;
+
+			case kCondSR:
+				EmAssert (gCPU68K);
+				gCPU68K->UpdateSRFromRegisters ();
+				stack[++sp] = regs.sr;
+				break;
+
+			case kCondLoad8:	stack[sp] = EmMemGet8 (stack[sp]);				break;
+			case kCondLoad16:	stack[sp] = EmMemGet16 (stack[sp]); 			break;
+			case kCondLoad32:	stack[sp] = EmMemGet32 (stack[sp]); 			break;
+			case kCondTrunc8:	stack[sp] = (uint8) stack[sp];					break;
+			case kCondTrunc16:	stack[sp] = (uint16) stack[sp]; 				break;
+
+			case kCondNeg:		stack[sp] = 0 - stack[sp];						break;
+			case kCondNot:		stack[sp] = ~stack[sp]; 						break;
+			case kCondLogNot:	stack[sp] = stack[sp] == 0; 					break;
+			case kCondBool: 	stack[sp] = stack[sp] != 0; 					break;
+
+			case kCondJumpIfFalse:
+				if (stack[sp] == 0)
+					pc = code[pc];
+				else
+					--sp, ++pc;
+				break;
+
+			case kCondJumpIfTrue:
+				if (stack[sp] != 0)
+					pc = code[pc];
+				else
+					--sp, ++pc;
+				break;
+
+			default:
+				b = stack[sp--];
+				a = stack[sp];
+
+				switch (code[pc - 1])
+				{
+					case kCondMul:	a = a * b;						break;
+					case kCondAdd:	a = a + b;						break;
+					case kCondSub:	a = a - b;						break;
+					case kCondShl:	a = b < 32 ? a << b : 0;		break;
+					case kCondShr:	a = b < 32 ? a >> b : 0;		break;
+					case kCondAnd:	a = a & b;						break;
+					case kCondOr:	a = a | b;						break;
+					case kCondXor:	a = a ^ b;						break;
+					case kCondEq:	a = a == b; 					break;
+					case kCondNe:	a = a != b; 					break;
+					case kCondLt:	a = a < b;						break;
+					case kCondLe:	a = a <= b; 					break;
+					case kCondGt:	a = a > b;						break;
+					case kCondGe:	a = a >= b; 					break;
+					default:		EmAssert (false);				break;
+				}
+
+				stack[sp] = a;
+				break;
+		}
 	}
 
-	return condition (r, value);
+	EmAssert (sp == 0);
+
+	return stack[0] != 0;
 }
 
 
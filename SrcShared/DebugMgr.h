@@ -28,45 +28,68 @@ class CTCPSocket;
 
 struct SystemCallContext;
 
-typedef uint32	(*registerFun)(int num);
-typedef Bool	(*compareFun)(UInt32 a, UInt32 b);
-
-// Breakpoint conditions are of the form:
+// Breakpoint conditions are expressions that are true if they're non-zero.
+// They're made up of:
+//
+//		d0-d7, a0-a7, sp, pc, sr
+//			the 68000 registers.
 //
-//		<register-expr>[<size>] <cond> <value>
+//		trap
+//			the system call being made, if the instruction at the PC is one
+//			(either "TRAP #15; DC.W $Axxx" or a bare $Axxx), or zero.
 //
-// where:
+//		hits
+//			the number of times the condition has been checked, this time
+//			included.
 //
-//		<register-expr>
-//			is either a 68000 register (e.g. "d5") or an indirect reference at
-//			a constant offset from a 68000 register (e.g. "8(a6)").  An indirect
-//			reference reads from memory; when you set up a breakpoint condition
-//			involving an indirect reference, you must be sure that the indirect
-//			reference will point to a valid memory address whenever the breakpoint
-//			is hit.
+//		<value>
+//			a 32-bit integer, in decimal or hex (e.g. "0x1F").
 //
-//		<size>
-//			is either ".l" (long), ".w" (word) or ".b" (byte).  If no size is
-//			specified, the expression is assumed to be long.
+//		[<expr>]
+//			the long at the given address.
 //
-//		<cond>
-//			is a binary comparison operator: ==, !=, <=, >=, <, or >
+//		<value>(<expr>)
+//			the long at the given address plus <value> (e.g. "8(a6)").
 //
-//		<value>
-//			is a 32-bit integer
+// Registers and memory references can be followed by a size: ".l" (long,
+// the default), ".w" (word), or ".b" (byte).  For a memory reference,
+// that's how much is read; for a register, it's how much of it is used.
+// A memory reference reads from memory; when you set up a breakpoint
+// condition involving one, you must be sure that it will point to a
+// valid memory address whenever the breakpoint is hit.
+//
+// They can be put together with the following operators, listed from
+// highest precedence to lowest:
+//
+//		-  ~  !			(unary)
+//		*
+//		+  -  <<  >>
+//		&  |  ^
+//		==  !=  <  <=  >  >=
+//		&&
+//		||
+//
+// && and || only evaluate their right side if they need to, so that
+// "a0 != 0 && [a0] == 5" doesn't read from address zero.
 //
-// All comparisons are unsigned!
+// All arithmetic and comparisons are unsigned!
+//
+// Conditions are compiled to a short list of operations for a small
+// stack machine when they're created, so that evaluating them every time
+// a breakpoint is hit doesn't involve any parsing or memory allocation.
 
 struct BreakpointCondition
 {
-	registerFun				regType;
-	int				 		regNum;
-	Bool					indirect;
-	uint32			 		indirectOffset;
-	int						size;				/* number of bytes to compare: 4, 2, or 1 */
+	enum
+	{
+		kMaxCode	= 64,		// uint32's of code (operations and their operands)
+		kMaxStack	= 16		// deepest the evaluation stack can get
+	};
 
-	compareFun				condition;
-	uint32					value;
+	uint32					code[kMaxCode];
+	int						codeLength;
+
+	uint32					hits;
 
 	// The source text.  We keep this around so that, for example, a user can specify
 	// a condition using either hex or decimal notation and they will see the same
@@ -120,6 +143,7 @@ struct DebugGlobalsType
 
 	// (adam) Data breakpoint support.	This is similar to the step spy capability, but can monitor
 	// an arbitrary range of addresses for writes, and doesn't require a saved value.
+	// It's installed in EmWatchpoints by Debug::SyncDataBreak.
 
 	bool					watchEnabled;
 	emuptr			 		watchAddr;			// address to watch, or 0 if none
@@ -171,6 +195,9 @@ class Debug
 		static void 			SetBreakpoint			(int index, emuptr addr, BreakpointCondition* c);
 		static void 			ClearBreakpoint 		(int index);
 		static void 			DeleteBreakpointCondition	(int index);
+		static void 			DeleteBreakpointCondition	(BreakpointCondition*&);
+
+		static void 			SyncDataBreak			(void);
 
 		static Bool				BreakpointInstalled		(void);
 
@@ -179,7 +206,6 @@ class Debug
 		static Bool 			MustBreakOnTrapSystemCall	(uint16 trapWord, uint16 refNum);
 
 		static void 			DoCheckStepSpy			(emuptr writeAddress, int writeBytes);
-		static void 			DoCheckWatchpoint		(emuptr writeAddress, int writeBytes);
 
 		static void 			EventCallback			(CSocket* s, int event);
 		static void 			CreateListeningSockets	(void);
@@ -197,11 +223,6 @@ inline void Debug::CheckStepSpy (emuptr writeAddress, int writeBytes)
 	{
 		Debug::DoCheckStepSpy (writeAddress, writeBytes);
 	}
-
-	if (gDebuggerGlobals.watchEnabled)
-	{
-		Debug::DoCheckWatchpoint (writeAddress, writeBytes);
-	}
 }
 
 
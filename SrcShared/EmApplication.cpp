@@ -33,6 +33,7 @@
 
 #include "DebugMgr.h"			// Debug::Startup
 #include "EmDlg.h"				// DoCommonDialog
+#include "EmGDBStub.h"			// EmGDBStub::Startup
 #include "EmRPC.h"				// RPC::Startup
 #include "Logging.h"			// LogStartup
 #include "SocketMessaging.h"	// CSocket::Startup
@@ -209,6 +210,7 @@ Bool EmApplication::Startup (int argc, char** argv)
 	CSocket::Startup ();
 	Debug::Startup ();	// Create our sockets
 	RPC::Startup ();	// Create our sockets
+	EmGDBStub::Startup ();	// Create our sockets
         PHEM_Log_Msg("Sockets started.");
 
 #if HAS_TRACER
@@ -261,8 +263,14 @@ void EmApplication::Shutdown (void)
 {
 	RPC::SignalWaiters (hostSignalQuit);
 
+	// Stop servicing sockets in the background before their owners
+	// start deleting them.
+
+	CSocket::StopEventThread ();
+
 	Debug::Shutdown ();
 	RPC::Shutdown ();
+	EmGDBStub::Shutdown ();
 	CSocket::Shutdown ();
 
 	LogShutdown ();
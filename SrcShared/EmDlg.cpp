@@ -4005,6 +4005,8 @@ EmDlgFnResult EmDlg::PrvEditBreakpoints (EmDlgContext& context)
 						gDebuggerGlobals.watchBytes = EmDlg::GetItemValue (dlg, kDlgItemBrkNumberOfBytes);
 					}
 
+					Debug::SyncDataBreak ();
+
 					// Fall thru...
 				}
 
@@ -16,11 +16,13 @@
 
 #include "CGremlinsStubs.h"		// StubAppEnqueueKey, StubAppEnqueuePt
 #include "EmEventOutput.h"		// GetEventInfo
+#include "EmIOJournal.h"		// EmIOJournal::Save, Load, Clear, Rewind
 #include "EmMemory.h"			// EmMem_strlen, EmMem_strcpy
 #include "EmMinimize.h"			// EmMinimize::IsOn
 #include "EmPalmStructs.h"		// EmAliasControlType
 #include "EmStreamFile.h"		// EmStreamFile
 #include "Logging.h"			// LogAppendMsg
+#include "Miscellaneous.h"		// GzipEncode, GzipDecode, StMemory
 #include "ROMStubs.h"			// EvtResetAutoOffTimer
 #include "SessionFile.h"		// SessionFile
 
@@ -41,10 +43,19 @@ EmStream&	operator >> (EmStream&, EmRecordedEvent&);
 EmStream&	operator << (EmStream&, const Chunk&);
 EmStream&	operator >> (EmStream&, Chunk&);
 
+static void	PrvPackBlock	(const Chunk& events, Chunk& packed);
+static void	PrvUnpackBlock	(const Chunk& packed, long length, Chunk& events);
+
+
+	// How much of the event stream to collect before compressing it
+	// into a block.
+
+const long							kEventBlockSize = 64 * 1024L;
 
 // List of events that we've recorded or re-read from a session file.
 
-Chunk								EmEventPlayback::fgEvents;
+EmEventPlayback::EmEventStore		EmEventPlayback::fgEvents;
+EmEventPlayback::EmEventCache		EmEventPlayback::fgCache;
 EmRecordedEventFilter				EmEventPlayback::fgMask;
 Bool								EmEventPlayback::fgRecording;
 Bool								EmEventPlayback::fgReplaying;
@@ -210,7 +221,8 @@ void EmEventPlayback::Dispose (void)
 //		 EmEventPlayback::SaveEvents
 // ---------------------------------------------------------------------------
 // Saves the given events to the given session file.  Saves all of the events
-// in their own chunk.
+// in their own chunk.  The full blocks are already compressed, so only the
+// tail needs compressing here; it's written out as one more (short) block.
 
 void EmEventPlayback::SaveEvents (SessionFile& f)
 {
@@ -218,10 +230,43 @@ void EmEventPlayback::SaveEvents (SessionFile& f)
 	Chunk			chunk;
 	EmStreamChunk	s (chunk);
 
+	EmEventBlockList&	blocks = fgEvents.fBlocks;
+	EmEventBlock		tail;
+
+	tail.fFirst		= blocks.empty () ? 0 : blocks.back ().fFirst + blocks.back ().fNumEvents;
+	tail.fNumEvents	= fgEvents.fNumEvents - tail.fFirst;
+	tail.fLength	= fgEvents.fTail.GetLength ();
+
+	if (tail.fNumEvents > 0)
+	{
+		::PrvPackBlock (fgEvents.fTail, tail.fPacked);
+	}
+
 	s << kCurrentVersion;
-	s << fgEvents;
+	s << (int32) (blocks.size () + (tail.fNumEvents > 0 ? 1 : 0));
 
-	f.WriteGremlinHistory (chunk);
+	EmEventBlockList::iterator	iter = blocks.begin ();
+	while (iter != blocks.end ())
+	{
+		s << (int32) iter->fNumEvents;
+		s << (int32) iter->fLength;
+		s << iter->fPacked;
+
+		++iter;
+	}
+
+	if (tail.fNumEvents > 0)
+	{
+		s << (int32) tail.fNumEvents;
+		s << (int32) tail.fLength;
+		s << tail.fPacked;
+	}
+
+	f.WriteGremlinBlocks (chunk);
+
+	// Host I/O recorded along with the events goes in its own chunk.
+
+	EmIOJournal::Save (f);
 
 #if 0
 	LogAppendMsg ("EmEventPlayback::SaveEvents: saved %d events", EmEventPlayback::GetNumEvents ());
@@ -261,23 +306,68 @@ void EmEventPlayback::LoadEvents (SessionFile& f)
 {
 	Chunk	chunk;
 
-	fgEvents.SetLength (0);	// Clear the list in case of failure.
+	fgEvents = EmEventStore ();	// Clear the list in case of failure.
+	fgCache = EmEventCache ();
 
-	if (f.ReadGremlinHistory (chunk))
+	if (f.ReadGremlinBlocks (chunk))
 	{
 		uint32			version;
+		int32			numBlocks;
 		EmStreamChunk	s (chunk);
 
 		s >> version;
-		s >> fgEvents;
+		s >> numBlocks;
 
-		// Set the event mask to be the same size, with all events enabled.
-		// (I'd use assign() here, but it's not support on my Linux's version
-		// of STL.)
-//		fgMask.assign (events.size (), true);
-		fgMask = EmRecordedEventFilter (EmEventPlayback::CountNumEvents (), true);
+		fgEvents.fBlocks.resize (numBlocks);
+
+		for (int32 ii = 0; ii < numBlocks; ++ii)
+		{
+			EmEventBlock&	block = fgEvents.fBlocks[ii];
+			int32			numEvents;
+			int32			length;
+
+			s >> numEvents;
+			s >> length;
+			s >> block.fPacked;
+
+			block.fFirst		= fgEvents.fNumEvents;
+			block.fNumEvents	= numEvents;
+			block.fLength		= length;
+
+			fgEvents.fNumEvents += numEvents;
+		}
+	}
+
+	// Event files written before events were kept in blocks have them all
+	// in one chunk.
+
+	else if (f.ReadGremlinHistory (chunk))
+	{
+		uint32			version;
+		Chunk			events;
+		EmStreamChunk	s (chunk);
+
+		s >> version;
+		s >> events;
+
+		EmRecordedEvent	event;
+		EmStreamChunk	eventStream (events);
+
+		while (eventStream.GetMarker () < eventStream.GetLength ())
+		{
+			eventStream >> event;
+			EmEventPlayback::AppendEvent (fgEvents, event);
+		}
 	}
 
+	// Set the event mask to be the same size, with all events enabled.
+	// (I'd use assign() here, but it's not support on my Linux's version
+	// of STL.)
+//	fgMask.assign (events.size (), true);
+	fgMask = EmRecordedEventFilter (EmEventPlayback::CountNumEvents (), true);
+
+	EmIOJournal::Load (f);
+
 #if 0
 	LogAppendMsg ("EmEventPlayback::LoadEvents: loaded %d events", EmEventPlayback::GetNumEvents ());
 
@@ -285,16 +375,13 @@ void EmEventPlayback::LoadEvents (SessionFile& f)
 
 	long			ii = 0;
 	EmRecordedEvent	event;
-	EmStreamChunk	s (fgEvents);
 
-	while (s.GetMarker () < s.GetLength ())
+	for (ii = 0; ii < EmEventPlayback::GetNumEvents (); ++ii)
 	{
-		s >> event;
+		EmEventPlayback::ReadEvent (ii, event);
 
 		LogAppendMsg ("%d:", ii);
 		EmEventPlayback::LogEvent (event);
-
-		++ii;
 	}
 #endif
 }
@@ -421,11 +508,14 @@ void EmEventPlayback::RecordErrorEvent (void)
 
 void EmEventPlayback::Clear (void)
 {
-	fgEvents.SetLength (0);
+	fgEvents = EmEventStore ();
+	fgCache = EmEventCache ();
 	fgMask.clear ();
 	fgRecording		= false;
 	fgReplaying		= false;
 
+	EmIOJournal::Clear ();
+
 	EmEventPlayback::ResetPlayback ();
 }
 
@@ -437,15 +527,14 @@ void EmEventPlayback::Clear (void)
 
 void EmEventPlayback::CullEvents (void)
 {
-	Chunk			newEvents;
-	EmStreamChunk	s (newEvents);
+	EmEventStore	newEvents;
 
 	EmEventPlayback::ResetPlayback ();
 
 	EmRecordedEvent	event;
 	while (EmEventPlayback::GetNextReplayEvent (event))
 	{
-		s << event;
+		EmEventPlayback::AppendEvent (newEvents, event);
 
 		// Keep track of pen up/down state so that GetNextReplayEvent
 		// will filter properly.
@@ -454,6 +543,7 @@ void EmEventPlayback::CullEvents (void)
 	}
 
 	fgEvents = newEvents;
+	fgCache = EmEventCache ();
 
 	// Set the event mask to be the same size, with all events enabled.
 	// (I'd use assign() here, but it's not support on my Linux's version
@@ -529,20 +619,7 @@ long EmEventPlayback::GetNumEvents (void)
 
 long EmEventPlayback::CountNumEvents (void)
 {
-	long			result = 0;
-
-	// Iterate over all the events, counting them up.
-
-	EmRecordedEvent	event;
-	EmStreamChunk	s (fgEvents);
-
-	while (s.GetMarker () < s.GetLength ())
-	{
-		s >> event;
-		++result;
-	}
-
-	return result;
+	return fgEvents.fNumEvents;
 }
 
 
@@ -553,11 +630,12 @@ long EmEventPlayback::CountNumEvents (void)
 
 void EmEventPlayback::GetEvent (long index, EmRecordedEvent& event)
 {
-	EmStreamChunk	s (fgEvents);
+	if (index >= fgEvents.fNumEvents)
+		index = fgEvents.fNumEvents - 1;
 
-	while ((index-- >= 0) && (s.GetMarker () < s.GetLength ()))
+	if (index >= 0)
 	{
-		s >> event;
+		EmEventPlayback::ReadEvent (index, event);
 	}
 }
 
@@ -745,14 +823,14 @@ Bool EmEventPlayback::ReplayGetPen (void)
 		PRINTF ("EmEventPlayback::ReplayGetPen[%ld]: next event wasn't a pen event; fabricating a pen up event",
 			fgIterationState.fIndex - 1);
 
-		EmAssert (fgPrevIterationState.fOffset != -1);
+		EmAssert (fgPrevIterationState.fIndex != -1);
 
 		fgIterationState = fgPrevIterationState;
 
 		// Invalidate the previously saved iteration state so that
 		// we can make sure we don't use it again.
 
-		fgPrevIterationState.fOffset = -1;
+		fgPrevIterationState.fIndex = -1;
 
 		event.eType = kRecordedPenEvent;
 		event.penEvent.coords.x = -1;
@@ -785,9 +863,7 @@ void EmEventPlayback::RecordEvent (const EmRecordedEvent& event)
 {
 	if (EmEventPlayback::RecordingEvents ())
 	{
-		EmStreamChunk	s (fgEvents);
-		s.SetMarker (0, kStreamFromEnd);
-		s << event;
+		EmEventPlayback::AppendEvent (fgEvents, event);
 
 		fgMask.push_back (true);
 	}
@@ -802,23 +878,18 @@ void EmEventPlayback::RecordEvent (const EmRecordedEvent& event)
 
 long EmEventPlayback::FindFirstError (void)
 {
-	long	result = 0;
-
-	// Iterate over all the events, counting them up.
+	// Iterate over all the events, looking for an error.
 
 	EmRecordedEvent	event;
-	EmStreamChunk	s (fgEvents);
 
-	while (s.GetMarker () < s.GetLength ())
+	for (long result = 0; result < fgEvents.fNumEvents; ++result)
 	{
-		s >> event;
+		EmEventPlayback::ReadEvent (result, event);
 
 		if (event.eType == kRecordedErrorEvent)
 		{
 			return result;
 		}
-
-		++result;
 	}
 
 	return -1;
@@ -832,18 +903,14 @@ long EmEventPlayback::FindFirstError (void)
 
 void EmEventPlayback::LogEvents (void)
 {
-	long			counter = 0;
 	EmRecordedEvent	event;
-	EmStreamChunk	s (fgEvents);
 
-	while (s.GetMarker () < s.GetLength ())
+	for (long counter = 0; counter < fgEvents.fNumEvents; ++counter)
 	{
-		s >> event;
+		EmEventPlayback::ReadEvent (counter, event);
 
 		LogAppendMsg ("%d:", counter);
 		EmEventPlayback::LogEvent (event);
-
-		++counter;
 	}
 }
 
@@ -936,7 +1003,9 @@ void EmEventPlayback::ResetPlayback (void)
 	// Invalidate the previously saved iteration state so that
 	// we can make sure we don't use it.
 
-	fgPrevIterationState.fOffset = -1;
+	fgPrevIterationState.fIndex = -1;
+
+	EmIOJournal::Rewind ();
 }
 
 
@@ -958,22 +1027,18 @@ void EmEventPlayback::ResetPlayback (void)
 
 Bool EmEventPlayback::GetNextReplayEvent (EmRecordedEvent& event)
 {
-	EmStreamChunk	s (fgEvents);
-	s.SetMarker (fgIterationState.fOffset, kStreamFromStart);
-
 	// Save the current position so that we can push back to it
 	// later if we have to (see EmEventPlayback::ReplayGetPen).
 
 	fgPrevIterationState = fgIterationState;
 
-	while (s.GetMarker () < s.GetLength ())
+	while (fgIterationState.fIndex < fgEvents.fNumEvents)
 	{
-		s >> event;
+		EmEventPlayback::ReadEvent (fgIterationState.fIndex, event);
 
 		Bool	eventEnabled	= fgMask[fgIterationState.fIndex];
 
 		fgIterationState.fIndex++;
-		fgIterationState.fOffset = s.GetMarker ();
 
 		// If this is a pen up event:
 		//
@@ -1124,6 +1189,169 @@ Bool EmEventPlayback::ReplayErrorEvent (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmEventPlayback::AppendEvent
+// ---------------------------------------------------------------------------
+// Add an event to the end of the given list.  If that fills up the tail,
+// compress it and add it to the list of blocks.
+
+void EmEventPlayback::AppendEvent (EmEventStore& store, const EmRecordedEvent& event)
+{
+	EmStreamChunk	s (store.fTail);
+	s.SetMarker (0, kStreamFromEnd);
+	s << event;
+
+	store.fNumEvents++;
+
+	if (store.fTail.GetLength () >= kEventBlockSize)
+	{
+		EmEventBlock	block;
+
+		block.fFirst		= store.fBlocks.empty () ? 0 :
+								store.fBlocks.back ().fFirst + store.fBlocks.back ().fNumEvents;
+		block.fNumEvents	= store.fNumEvents - block.fFirst;
+		block.fLength		= store.fTail.GetLength ();
+
+		::PrvPackBlock (store.fTail, block.fPacked);
+
+		store.fBlocks.push_back (block);
+		store.fTail.SetLength (0);
+
+		// If the cache was on the tail, it's now on a block it doesn't
+		// know is a block.
+
+		if (&store == &fgEvents)
+		{
+			fgCache = EmEventCache ();
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmEventPlayback::ReadEvent
+// ---------------------------------------------------------------------------
+// Get the event with the given index, which must be in range.  Reading the
+// events in order only unpacks each block once.
+
+void EmEventPlayback::ReadEvent (long index, EmRecordedEvent& event)
+{
+	EmAssert (index >= 0 && index < fgEvents.fNumEvents);
+
+	long	block		= EmEventPlayback::FindBlock (index);
+	long	numBlocks	= (long) fgEvents.fBlocks.size ();
+
+	if (block != fgCache.fBlock)
+	{
+		if (block < numBlocks)
+		{
+			const EmEventBlock&	b = fgEvents.fBlocks[block];
+			::PrvUnpackBlock (b.fPacked, b.fLength, fgCache.fEvents);
+		}
+
+		fgCache.fBlock	= block;
+		fgCache.fIndex	= -1;	// Force a rewind, below.
+	}
+
+	if (index < fgCache.fIndex || fgCache.fIndex < 0)
+	{
+		fgCache.fIndex	= block < numBlocks ? fgEvents.fBlocks[block].fFirst :
+							numBlocks > 0 ? fgEvents.fBlocks.back ().fFirst +
+								fgEvents.fBlocks.back ().fNumEvents : 0;
+		fgCache.fOffset	= 0;
+	}
+
+	// The tail is read in place, since it's still being added to.
+
+	EmStreamChunk	s (block < numBlocks ? fgCache.fEvents : fgEvents.fTail);
+	s.SetMarker (fgCache.fOffset, kStreamFromStart);
+
+	while (fgCache.fIndex <= index)
+	{
+		s >> event;
+		fgCache.fIndex++;
+	}
+
+	fgCache.fOffset = s.GetMarker ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmEventPlayback::FindBlock
+// ---------------------------------------------------------------------------
+// Return the block holding the event with the given index, or the number
+// of blocks if it's in the tail.
+
+long EmEventPlayback::FindBlock (long index)
+{
+	const EmEventBlockList&	blocks = fgEvents.fBlocks;
+
+	if (blocks.empty () || index >= blocks.back ().fFirst + blocks.back ().fNumEvents)
+		return (long) blocks.size ();
+
+	// Check the cached block first, since that's usually the one.
+
+	if (fgCache.fBlock >= 0 && fgCache.fBlock < (long) blocks.size ())
+	{
+		const EmEventBlock&	b = blocks[fgCache.fBlock];
+
+		if (index >= b.fFirst && index < b.fFirst + b.fNumEvents)
+			return fgCache.fBlock;
+	}
+
+	long	low		= 0;
+	long	high	= (long) blocks.size () - 1;
+
+	while (low < high)
+	{
+		long	mid = (low + high + 1) / 2;
+
+		if (blocks[mid].fFirst <= index)
+			low = mid;
+		else
+			high = mid - 1;
+	}
+
+	return low;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvPackBlock
+// ---------------------------------------------------------------------------
+
+void PrvPackBlock (const Chunk& events, Chunk& packed)
+{
+	long		worstSize = ::GzipWorstSize (events.GetLength ());
+	StMemory	buffer (worstSize);
+
+	void*	src		= events.GetPointer ();
+	void*	dest	= buffer.Get ();
+
+	::GzipEncode (&src, &dest, events.GetLength (), worstSize);
+
+	long	packedSize = (char*) dest - buffer.Get ();
+
+	packed.SetLength (packedSize);
+	memcpy (packed.GetPointer (), buffer.Get (), packedSize);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvUnpackBlock
+// ---------------------------------------------------------------------------
+
+void PrvUnpackBlock (const Chunk& packed, long length, Chunk& events)
+{
+	events.SetLength (length);
+
+	void*	src		= packed.GetPointer ();
+	void*	dest	= events.GetPointer ();
+
+	::GzipDecode (&src, &dest, packed.GetLength (), length);
+}
+
+
 #pragma mark -
 
 // ---------------------------------------------------------------------------
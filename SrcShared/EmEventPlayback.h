@@ -26,7 +26,8 @@
 
 		* Recording them in a list so that they can be replayed later.
 		* Replaying them later
-		* Saving them to and loading them from a file.
+		* Saving them to and loading them from a file, along with
+		  the host I/O recorded with them (see EmIOJournal).
 		* Logging events for debugging.
 		* Filtering the events so that not all of them get replayed.
 
@@ -158,11 +159,17 @@ class EmEventPlayback
 		static void				LogEvents			(void);
 
 	private:
+		struct EmEventStore;
+
 		static void				RecordEvent			(const EmRecordedEvent&);
 		static void				LogEvent			(const EmRecordedEvent&);
 		static void				ResetPlayback		(void);
 		static Bool				GetNextReplayEvent	(EmRecordedEvent&);
 
+		static void				AppendEvent			(EmEventStore&, const EmRecordedEvent&);
+		static void				ReadEvent			(long, EmRecordedEvent&);
+		static long				FindBlock			(long);
+
 		static Bool				ReplayKeyEvent		(WChar		ascii,
 													 UInt16		keycode,
 													 UInt16		modifiers);
@@ -175,7 +182,52 @@ class EmEventPlayback
 		static Bool				ReplayErrorEvent	(void);
 
 	private:
-		static Chunk					fgEvents;
+		// Events are kept in blocks of about kEventBlockSize bytes.  Full
+		// blocks are kept compressed, with the index of their first event
+		// so that any event can be found without unpacking the ones before
+		// it.  Events are recorded into an uncompressed tail block, which
+		// is compressed and added to the list when it fills up.
+
+		struct EmEventBlock
+		{
+			long				fFirst;			// Index of the first event.
+			long				fNumEvents;
+			long				fLength;		// Size of the events, unpacked.
+			Chunk				fPacked;
+		};
+
+		typedef vector<EmEventBlock>	EmEventBlockList;
+
+		struct EmEventStore
+		{
+			EmEventStore (void) :
+				fNumEvents (0)
+				{}
+
+			EmEventBlockList	fBlocks;
+			Chunk				fTail;
+			long				fNumEvents;		// Including the ones in fTail.
+		};
+
+		// The block ReadEvent last read from, unpacked, and where in it the
+		// next event is.  fBlock is fgEvents.fBlocks.size () for the tail.
+
+		struct EmEventCache
+		{
+			EmEventCache (void) :
+				fBlock (-1),
+				fIndex (0),
+				fOffset (0)
+				{}
+
+			long				fBlock;
+			Chunk				fEvents;
+			long				fIndex;
+			long				fOffset;
+		};
+
+		static EmEventStore				fgEvents;
+		static EmEventCache				fgCache;
 		static EmRecordedEventFilter	fgMask;
 		static Bool						fgRecording;
 		static Bool						fgReplaying;
@@ -184,12 +236,10 @@ class EmEventPlayback
 		{
 			EmIterationState (void) :
 				fIndex (0),
-				fOffset (0),
 				fPenIsDown (false)
 				{}
 
 			long				fIndex;
-			long				fOffset;
 			Bool				fPenIsDown;
 		};
 
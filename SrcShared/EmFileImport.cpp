@@ -14,11 +14,13 @@
 #include "EmCommon.h"
 #include "EmFileImport.h"
 
+#include "ChunkFile.h"			// Chunk
 #include "EmCPU.h"				// Emulator::ExecuteUntilIdle
 #include "EmDlg.h"				// EmDlg::DoCommonDialog
 #include "EmErrCodes.h"			// kError_OutOfMemory, ConvertFromPalmError, etc.
 #include "EmExgMgr.h"			// EmExgMgrStream, EmExgMgrImport
 #include "EmLowMem.h"			// TrapExists
+#include "EmMemory.h"			// CEnableFullAccess, EmMem_memcpy
 #include "EmPalmStructs.h"		// SysLibTblEntryType, RecordEntryType, RsrcEntryType, etc.
 #include "EmPatchState.h"		// EmPatchState::AutoAcceptBeamDialogs
 #include "EmSession.h"			// ExecuteUntilIdle, gSession
@@ -28,6 +30,7 @@
 #include "Platform.h"			// Platform::DisposeMemory
 #include "ROMStubs.h"			// ExgLibControl, DmFindDatabase, EvtEnqueueKey, EvtWakeup, DmDeleteDatabase, DmCreateDatabase...
 #include "Strings.r.h"			// kStr_CmdInstall
+#include "omnithread.h"			// omni_thread, omni_mutex, omni_condition
 
 #include "PHEMNativeIF.h"
 
@@ -75,8 +78,21 @@
 
 	If we're not using the Exchange Manager method, we instead use
 	standard Database Manager calls to install the file.  That is,
-	we call DmCreateDatabase, DmNewResource, DmWrite, etc., in
-	order to convert the file into a database.
+	we call DmCreateDatabase, DmNewResource, etc., in order to convert
+	the file into a database.  The contents of each resource or record
+	are copied straight into the newly allocated chunk instead of
+	being passed to DmWrite, which would have to marshal them onto the
+	emulated stack and then copy them a byte at a time with emulated
+	code.
+
+	When LoadPalmFileList installs a list of files with the Database
+	Manager, it reads them in on a few worker threads while it installs
+	the ones it already has.  The workers only read; validating and
+	installing stay on the calling thread, because they report errors
+	through Errors::SetParameter and dialogs, and because only that
+	thread may call into the ROM.  The workers stay at most a few files
+	ahead, so that installing a big list doesn't hold all of it in
+	memory at once.
 */
 
 const int		kInstallStart	= -1;
@@ -106,6 +122,41 @@ static ErrCode	PrvValidateDatabase	(const EmAliasDatabaseHdrType<LAS>& hdr, UInt
 static void		PrvSetDate			(const char* varName, uint32 seconds);
 static void		PrvSetExgMgr		(void* mgr);
 
+	// Files being read ahead for LoadPalmFileList.
+struct EmPrefetchFile
+{
+	EmFileRef				fRef;
+	Chunk					fData;
+	Bool					fDone;		// Set when the worker is through with it
+	Bool					fFailed;	// Set if the worker couldn't read it
+};
+
+struct EmPrefetchJob
+{
+							EmPrefetchJob (void) :
+								fNextRead (0),
+								fNextInstall (0),
+								fQuit (false),
+								fCondition (&fMutex)
+							{
+							}
+
+	vector<EmPrefetchFile>	fFiles;
+	long					fNextRead;		// Next file for a worker to read
+	long					fNextInstall;	// Next file to be installed
+	Bool					fQuit;
+	omni_mutex				fMutex;
+	omni_condition			fCondition;
+};
+
+const int		kPrefetchThreads	= 4;
+const long		kPrefetchAhead		= 8;
+
+static ErrCode	PrvLoadPrefetched	(const EmFileRefList&, EmFileImportMethod, vector<LocalID>&);
+static void*	PrvPrefetchThread	(void*);
+static Bool		PrvReadFile			(const EmFileRef& ref, Chunk& data);
+static void		PrvWriteChunk		(MemPtr dstP, const void* srcP, UInt32 size);
+
 static UInt16	gHostExgLibRefNum;
 
 
@@ -145,6 +196,46 @@ EmFileImport::EmFileImport	(EmStream& stream, EmFileImportMethod method) :
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileImport::EmFileImport
+ *
+ * DESCRIPTION:	Constructor for installing the contents of a file that
+ *				has already been read into some other kind of stream.
+ *				The file is used to determine how to validate what's
+ *				in the stream.
+ *
+ * PARAMETERS:	stream - stream holding the file's contents.
+ *				file - the file those contents came from.
+ *				method - installation method to use.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+EmFileImport::EmFileImport	(EmStream& stream, const EmFileRef& file,
+							 EmFileImportMethod method) :
+	fUsingExgMgr (::PrvDetermineMethod (method)),
+	fGotoWhenDone (false),
+	fState (kInstallStart),
+	fError (errNone),
+	fStream (stream),
+	fFileRef (file),
+
+	fExgMgrStream (NULL),
+	fExgMgrImport (NULL),
+	fOldAcceptBeamState (EmPatchState::AutoAcceptBeamDialogs (true)),
+
+	fFileBuffer (NULL),
+	fFileBufferSize (0),
+	fDBID (0),
+	fCardNo (0),
+	fOpenID (0),
+	fCurrentEntry (0)
+{
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	EmFileImport::~EmFileImport
@@ -220,6 +311,14 @@ ErrCode EmFileImport::LoadPalmFileList (const EmFileRefList& fileList,
 										EmFileImportMethod method,
 										vector<LocalID>& newIDList)
 {
+	// The Exchange Manager reads the files itself, a bit at a time.
+	// Otherwise, read them in on the side while installing them.
+
+	if (!::PrvDetermineMethod (method))
+	{
+		return ::PrvLoadPrefetched (fileList, method, newIDList);
+	}
+
 	ErrCode	err = errNone;
 
 	newIDList.clear ();
@@ -605,6 +704,12 @@ void EmFileImport::ExgMgrInstallStart (void)
 	if (fError)
 		return;
 
+	// The Exchange Manager reads the file from fStream, so we don't
+	// need the copy that was made for validating it.
+
+	Platform::DisposeMemory (fFileBuffer);
+	fFileBufferSize = 0;
+
 	// Create the stub ExgMgr driver callback object.
 
 	EmAssert (gHostExgLibRefNum != 0);
@@ -729,21 +834,12 @@ void EmFileImport::HomeBrewInstallStart (void)
 	fDBID	= 0;
 	fOpenID	= 0;
 
-	// Get the file and read it into memory.
-	// Set up a proxy to get to the header contents.
-
-	EmAssert (fFileBuffer == NULL);
+	// Get the file into memory (ValidateStream has usually done that
+	// already).  Set up a proxy to get to the header contents.
 
-	fFileBufferSize = fStream.GetLength ();
-	fFileBuffer		= Platform::AllocateMemory (fFileBufferSize);
-	if (!fFileBuffer)
-	{
-		this->SetResult (kError_OutOfMemory);
+	this->ReadStream ();
+	if (fError)
 		return;
-	}
-
-	fStream.SetMarker (0, kStreamFromStart);
-	fStream.GetBytes (fFileBuffer, fFileBufferSize);
 
 	EmAliasDatabaseHdrType<LAS>	hdr (fFileBuffer);
 
@@ -845,8 +941,8 @@ void EmFileImport::HomeBrewInstallStart (void)
 			// Copy the data in.
 
 			UInt8*	srcP = (UInt8*) hdr.GetPtr () + (UInt32) hdr.appInfoID;
-			UInt8*	dstP = (UInt8*) ::MemHandleLock ((MemHandle) newRecH);
-			::DmWrite (dstP, 0, srcP, recSize);
+			MemPtr	dstP = ::MemHandleLock ((MemHandle) newRecH);
+			::PrvWriteChunk (dstP, srcP, recSize);
 			::MemHandleUnlock ((MemHandle) newRecH);
 
 			// Store it in the header.
@@ -897,7 +993,7 @@ void EmFileImport::HomeBrewInstallMiddle (void)
 	Err		err = errNone;
 
 	UInt8*	srcP;
-	UInt8*	dstP;
+	MemPtr	dstP;
 
 	EmAssert (fFileBuffer);
 	EmAliasDatabaseHdrType<LAS>	hdr (fFileBuffer);
@@ -952,8 +1048,8 @@ void EmFileImport::HomeBrewInstallMiddle (void)
 		// Copy the data in.
 
 		srcP = (UInt8*) hdr.GetPtr () + (UInt32) rsrcEntry.localChunkID;
-		dstP = (UInt8*) ::MemHandleLock ((MemHandle) newResH);
-		::DmWrite (dstP, 0, srcP, resSize);
+		dstP = ::MemHandleLock ((MemHandle) newResH);
+		::PrvWriteChunk (dstP, srcP, resSize);
 		::MemHandleUnlock ((MemHandle) newResH);
 
 		// Done with it.
@@ -1017,8 +1113,8 @@ void EmFileImport::HomeBrewInstallMiddle (void)
 			// Copy the data in.
 
 			srcP = (UInt8*) hdr.GetPtr () + (UInt32) recordEntry.localChunkID;
-			dstP = (UInt8*) ::MemHandleLock ((MemHandle) newRecH);
-			::DmWrite (dstP, 0, srcP, recSize);
+			dstP = ::MemHandleLock ((MemHandle) newRecH);
+			::PrvWriteChunk (dstP, srcP, recSize);
 			::MemHandleUnlock ((MemHandle) newRecH);
 
 			// Set the attributes.
@@ -1119,6 +1215,37 @@ void EmFileImport::HomeBrewInstallCancel (void)
 
 #pragma mark -
 
+/***********************************************************************
+ *
+ * FUNCTION:	EmFileImport::ReadStream
+ *
+ * DESCRIPTION:	Read the contents of the stream into fFileBuffer, if
+ *				that hasn't been done already.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmFileImport::ReadStream (void)
+{
+	if (fFileBuffer)
+		return;
+
+	fFileBufferSize = fStream.GetLength ();
+	fFileBuffer		= Platform::AllocateMemory (fFileBufferSize);
+	if (!fFileBuffer)
+	{
+		this->SetResult (kError_OutOfMemory);
+		return;
+	}
+
+	fStream.SetMarker (0, kStreamFromStart);
+	fStream.GetBytes (fFileBuffer, fFileBufferSize);
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	EmFileImport::ValidateStream
@@ -1138,10 +1265,14 @@ void EmFileImport::HomeBrewInstallCancel (void)
  *				what the stream contains (one of the files we can
  *				validate, or something else, like a text, vCard, or
  *				vCal file), we look at the file type.  Therefore,
- *				we try casting the base stream into an EmStreamFile.
- *				If that works, then we can check the file type.  If
- *				the cast fails, then we just assume the best and
- *				say the file can be installed.
+ *				we use the file we were given when we were created,
+ *				or else try casting the base stream into an
+ *				EmStreamFile.  If that works, then we can check the
+ *				file type.  If the cast fails, then we just assume the
+ *				best and say the file can be installed.
+ *
+ *				The contents are left in fFileBuffer for the
+ *				installer.
  *
  * PARAMETERS:	None.
  *
@@ -1155,25 +1286,27 @@ void EmFileImport::ValidateStream (void)
 	// that we can only validate EmStreamFiles.  Anything else, well,
 	// we hope they're OK.
 
-	EmStreamFile*	fileStream = dynamic_cast <EmStreamFile*> (&fStream);
-	if (fileStream == NULL)
-		return;
+	EmFileRef		fileRef = fFileRef;
+	if (!fileRef.IsSpecified ())
+	{
+		EmStreamFile*	fileStream = dynamic_cast <EmStreamFile*> (&fStream);
+		if (fileStream == NULL)
+			return;
+
+		fileRef = fileStream->GetFileRef ();
+	}
 
-	EmFileRef		fileRef = fileStream->GetFileRef ();
 	if (fileRef.IsType (kFileTypePalmApp) ||
 		fileRef.IsType (kFileTypePalmDB) ||
 		fileRef.IsType (kFileTypePalmQA))
 	{
-		long		len = fStream.GetLength ();
-		StMemory	buffer (len);
-		void*		bufferP = buffer.Get ();
+		this->ReadStream ();
+		if (fError)
+			return;
 
-		fStream.SetMarker (0, kStreamFromStart);
-		fStream.GetBytes (bufferP, len);
+		EmAliasDatabaseHdrType<LAS>	hdr (fFileBuffer);
 
-		EmAliasDatabaseHdrType<LAS>	hdr (bufferP);
-
-		ErrCode	err = ::PrvValidateDatabase (hdr, len);
+		ErrCode	err = ::PrvValidateDatabase (hdr, fFileBufferSize);
 		this->SetResult (err);
 	}
 
@@ -1775,6 +1908,267 @@ void PrvSetExgMgr (void* mgr)
 	}
 }
 
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvWriteChunk
+ *
+ * DESCRIPTION:	Copy data into a chunk in the storage heap.  This does
+ *				what DmWrite does, minus its checks (we just allocated
+ *				the chunk, and know the data fits), and without running
+ *				any emulated code.
+ *
+ * PARAMETERS:	dstP - locked pointer to the chunk.
+ *				srcP - data to copy into it.
+ *				size - number of bytes to copy.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvWriteChunk (MemPtr dstP, const void* srcP, UInt32 size)
+{
+	CEnableFullAccess	munge;	// Storage heap is write-protected.
+
+	EmMem_memcpy ((emuptr) dstP, srcP, size);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvLoadPrefetched
+ *
+ * DESCRIPTION:	LoadPalmFileList for the Database Manager method.  Start
+ *				some threads reading the files, and install each one as
+ *				soon as it's been read.
+ *
+ * PARAMETERS:	Same as LoadPalmFileList.
+ *
+ * RETURNED:	result code
+ *
+ ***********************************************************************/
+
+ErrCode PrvLoadPrefetched (const EmFileRefList& fileList,
+						   EmFileImportMethod method,
+						   vector<LocalID>& newIDList)
+{
+	ErrCode			err = errNone;
+	EmPrefetchJob	job;
+
+	newIDList.clear ();
+
+	EmFileRefList::const_iterator	iter = fileList.begin ();
+	while (iter != fileList.end ())
+	{
+		EmPrefetchFile	file;
+
+		file.fRef		= *iter;
+		file.fDone		= false;
+		file.fFailed	= false;
+
+		job.fFiles.push_back (file);
+
+		++iter;
+	}
+
+	long	numFiles	= (long) job.fFiles.size ();
+	long	numThreads	= numFiles < kPrefetchThreads ? numFiles : kPrefetchThreads;
+
+	vector<omni_thread*>	threads;
+
+	for (long ii = 0; ii < numThreads; ++ii)
+	{
+		omni_thread*	thread = new omni_thread (&::PrvPrefetchThread, &job);
+		thread->start ();
+		threads.push_back (thread);
+	}
+
+	try
+	{
+		for (long ii = 0; ii < numFiles; ++ii)
+		{
+			EmPrefetchFile&	file = job.fFiles[ii];
+
+			{
+				omni_mutex_lock	lock (job.fMutex);
+
+				while (!file.fDone)
+				{
+					job.fCondition.wait ();
+				}
+			}
+
+			if (file.fFailed)
+			{
+				// Open it ourselves so that whatever went wrong is
+				// reported (or, if it was a fluke, so that it gets
+				// installed anyway).
+
+				EmStreamFile	stream (file.fRef, kOpenExistingForRead);
+				EmFileImport	importer (stream, method);
+
+				while (!importer.Done () && err == errNone)
+				{
+					err = importer.Continue ();
+				}
+
+				newIDList.push_back (importer.GetLocalID ());
+			}
+			else
+			{
+				EmStreamBlock	stream (file.fData.GetPointer (), file.fData.GetLength ());
+				EmFileImport	importer (stream, file.fRef, method);
+
+				while (!importer.Done () && err == errNone)
+				{
+					err = importer.Continue ();
+				}
+
+				newIDList.push_back (importer.GetLocalID ());
+			}
+
+			// Let go of this file and let the workers read further ahead.
+
+			omni_mutex_lock	lock (job.fMutex);
+
+			file.fData.SetLength (0);
+			job.fNextInstall = ii + 1;
+			job.fCondition.broadcast ();
+		}
+	}
+	catch (...)
+	{
+		{
+			omni_mutex_lock	lock (job.fMutex);
+			job.fQuit = true;
+			job.fCondition.broadcast ();
+		}
+
+		for (size_t ii = 0; ii < threads.size (); ++ii)
+		{
+			threads[ii]->join (NULL);
+		}
+
+		throw;
+	}
+
+	for (size_t ii = 0; ii < threads.size (); ++ii)
+	{
+		threads[ii]->join (NULL);
+	}
+
+	return err;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvPrefetchThread
+ *
+ * DESCRIPTION:	Worker thread for PrvLoadPrefetched.  Read the next file
+ *				nobody has taken yet, as long as that's not too far
+ *				ahead of the one being installed.  Quit when there are
+ *				no more.
+ *
+ * PARAMETERS:	data - the EmPrefetchJob.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void* PrvPrefetchThread (void* data)
+{
+	EmPrefetchJob&	job			= *(EmPrefetchJob*) data;
+	long			numFiles	= (long) job.fFiles.size ();
+
+	while (true)
+	{
+		long	index;
+
+		{
+			omni_mutex_lock	lock (job.fMutex);
+
+			while (!job.fQuit && job.fNextRead < numFiles &&
+				job.fNextRead >= job.fNextInstall + kPrefetchAhead)
+			{
+				job.fCondition.wait ();
+			}
+
+			if (job.fQuit || job.fNextRead >= numFiles)
+				break;
+
+			index = job.fNextRead++;
+		}
+
+		// Nobody else looks at the file until fDone is set, so it can
+		// be filled in without holding the mutex.
+
+		EmPrefetchFile&	file	= job.fFiles[index];
+		Bool			ok		= false;
+
+		try
+		{
+			ok = ::PrvReadFile (file.fRef, file.fData);
+		}
+		catch (...)
+		{
+		}
+
+		omni_mutex_lock	lock (job.fMutex);
+
+		if (!ok)
+			file.fData.SetLength (0);
+
+		file.fFailed	= !ok;
+		file.fDone		= true;
+
+		job.fCondition.broadcast ();
+	}
+
+	return NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReadFile
+ *
+ * DESCRIPTION:	Read a whole file into memory.  Called on the worker
+ *				threads, so this sticks to the C library: EmStreamFile
+ *				reports errors through Errors::SetParameter, which
+ *				isn't safe to call from here.
+ *
+ * PARAMETERS:	ref - the file to read.
+ *				data - receives the contents.
+ *
+ * RETURNED:	True if the file was read.
+ *
+ ***********************************************************************/
+
+Bool PrvReadFile (const EmFileRef& ref, Chunk& data)
+{
+	FILE*	f = fopen (ref.GetFullPath ().c_str (), "rb");
+	if (!f)
+		return false;
+
+	Bool	ok = false;
+
+	if (fseek (f, 0, SEEK_END) == 0)
+	{
+		long	size = ftell (f);
+
+		if (size >= 0 && fseek (f, 0, SEEK_SET) == 0)
+		{
+			data.SetLength (size);
+			ok = fread (data.GetPointer (), 1, size, f) == (size_t) size;
+		}
+	}
+
+	fclose (f);
+
+	return ok;
+}
+
 const uint8 kHostExgLib[] =
 {
 	0x48, 0x6F, 0x73, 0x74, 0x45, 0x78, 0x67, 0x4C, 0x69, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
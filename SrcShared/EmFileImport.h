@@ -15,6 +15,7 @@
 #define EMFILEIMPORT_H
 
 #include "EmDirRef.h"			// EmFileRefList
+#include "EmFileRef.h"			// EmFileRef
 #include "EmTypes.h"			// ErrCode
 
 class EmExgMgr;
@@ -34,6 +35,9 @@ class EmFileImport
 	public:
 								EmFileImport			(EmStream& stream,
 														 EmFileImportMethod method);
+								EmFileImport			(EmStream& stream,
+														 const EmFileRef& file,
+														 EmFileImportMethod method);
 								~EmFileImport			(void);
 
 		static ErrCode			LoadPalmFile			(const void*, uint32, EmFileImportMethod, LocalID&);
@@ -69,6 +73,7 @@ class EmFileImport
 		void					HomeBrewInstallEnd		(void);
 		void					HomeBrewInstallCancel	(void);
 
+		void					ReadStream				(void);
 		void					ValidateStream			(void);
 		void					DeleteCurrentDatabase	(void);
 
@@ -78,6 +83,7 @@ class EmFileImport
 		long					fState;
 		ErrCode					fError;
 		EmStream&				fStream;
+		EmFileRef				fFileRef;		// What fStream holds, if known
 
 		// Fields for ExgMgr installer
 		EmExgMgr*				fExgMgrStream;
@@ -0,0 +1,1305 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmGDBStub.h"
+
+#include "DebugMgr.h"			// Debug::EnterDebugger, gDebuggerGlobals
+#include "EmBankROM.h"			// EmBankROM::GetMemoryStart, GetMemorySize
+#include "EmBankSRAM.h"			// EmBankSRAM::GetMemoryStart, gRAMBank_Size
+#include "EmCPU68K.h"			// kException_SoftBreak
+#include "EmHAL.h"				// EmHAL::GetDynamicHeapSize
+#include "EmMemory.h"			// CEnableFullAccess, EmMemCheckAddress, EmMem_memcpy
+#include "EmPatchState.h"		// EmPatchState::UIInitialized
+#include "EmSession.h"			// EmSessionStopper
+#include "EmWatchpoints.h"		// EmWatchpoints::Add, Remove
+#include "Logging.h"			// LogAppendMsg
+#include "Platform.h"			// Platform::ExitDebugger
+#include "PreferenceMgr.h"		// Preference
+#include "ROMStubs.h"			// FtrSet, FtrUnregister
+#include "SocketMessaging.h"	// CTCPSocket
+#include "SystemPacket.h"		// SystemPacket::GetRegs, SetRegs
+
+#include <stdio.h>				// sprintf
+#include <stdlib.h>				// strtoul
+#include <string.h>				// strncmp
+
+
+/*
+	Packets come in a byte at a time (CTCPSocket::Read blocks until it
+	has as many bytes as were asked for, so asking for one is the only
+	way to not get stuck on a short packet).  Outside a packet, '$'
+	starts one, ^C means "stop", and '+' and '-' are acknowledgements
+	for what we last sent.  A packet runs to '#', followed by two hex
+	digits of checksum.
+
+	gdb's register numbers for the m68k are d0-d7, a0-a7 (a6 is "fp"
+	and a7 is "sp"), then the status register and the PC.  gdb doesn't
+	know about the two stack pointers; "sp" is whichever one is active.
+*/
+
+enum
+{
+	kRegSP		= 15,
+	kRegSR		= 16,
+	kRegPC		= 17,
+
+	kNumRegs	= 18
+};
+
+enum
+{
+	kStateIdle,
+	kStatePacket,
+	kStateChecksum1,
+	kStateChecksum2
+};
+
+	// Reply sizes are bounded by this, which we tell gdb in qSupported.
+const long		kMaxPacketSize	= 0x4000;
+
+	// gdb's Z/z packet types.
+enum
+{
+	kZSoftware,
+	kZHardware,
+	kZWrite,
+	kZRead,
+	kZAccess
+};
+
+struct EmGDBWatch
+{
+	int			fType;		// kZWrite, kZRead, or kZAccess
+	emuptr		fAddr;
+	uint32		fSize;
+	int			fID;		// From EmWatchpoints::Add
+};
+
+typedef vector<EmGDBWatch>	EmGDBWatchList;
+
+static CSocket*			gListener;
+static CSocket*			gConnection;
+static omni_mutex		gMutex;
+
+static int				gState;
+static string			gPacket;
+static uint8			gChecksum;
+static uint8			gSentChecksum;
+static string			gLastSent;
+static Bool 			gNoAck;
+
+static Bool 			gOwnBreakpoint[dbgNormalBreakpoints];
+static EmGDBWatchList	gWatches;
+
+static Bool 			gInterrupted;
+static int				gWatchType;		// Set by WatchHit for SendStopReply
+static emuptr			gWatchAddr;
+
+static const char		kTargetXML[] =
+	"<?xml version=\"1.0\"?>"
+	"<!DOCTYPE target SYSTEM \"gdb-target.dtd\">"
+	"<target version=\"1.0\">"
+	"<architecture>m68k</architecture>"
+	"<feature name=\"org.gnu.gdb.m68k.core\">"
+	"<reg name=\"d0\" bitsize=\"32\"/>"
+	"<reg name=\"d1\" bitsize=\"32\"/>"
+	"<reg name=\"d2\" bitsize=\"32\"/>"
+	"<reg name=\"d3\" bitsize=\"32\"/>"
+	"<reg name=\"d4\" bitsize=\"32\"/>"
+	"<reg name=\"d5\" bitsize=\"32\"/>"
+	"<reg name=\"d6\" bitsize=\"32\"/>"
+	"<reg name=\"d7\" bitsize=\"32\"/>"
+	"<reg name=\"a0\" bitsize=\"32\" type=\"data_ptr\"/>"
+	"<reg name=\"a1\" bitsize=\"32\" type=\"data_ptr\"/>"
+	"<reg name=\"a2\" bitsize=\"32\" type=\"data_ptr\"/>"
+	"<reg name=\"a3\" bitsize=\"32\" type=\"data_ptr\"/>"
+	"<reg name=\"a4\" bitsize=\"32\" type=\"data_ptr\"/>"
+	"<reg name=\"a5\" bitsize=\"32\" type=\"data_ptr\"/>"
+	"<reg name=\"fp\" bitsize=\"32\" type=\"data_ptr\"/>"
+	"<reg name=\"sp\" bitsize=\"32\" type=\"data_ptr\"/>"
+	"<reg name=\"ps\" bitsize=\"32\"/>"
+	"<reg name=\"pc\" bitsize=\"32\" type=\"code_ptr\"/>"
+	"</feature>"
+	"</target>";
+
+	// What follows the "q" in the qXfer reads we support.
+static const char		kFeaturesPrefix[]	= "Xfer:features:read:target.xml:";
+static const char		kMemoryMapPrefix[]	= "Xfer:memory-map:read::";
+
+#define PRINTF	if (!LogHLDebugger ()) ; else LogAppendMsg
+
+
+static void 	PrvHandleByte		(uint8 ch);
+static void 	PrvHandlePacket		(const string& packet);
+static Bool 	PrvDoPacket			(const string& packet, string& reply);
+static void 	PrvSend				(const string& data);
+static void 	PrvSendPacket		(const string& payload);
+
+static Bool 	PrvInDebugger		(void);
+static void 	PrvResume			(Bool step);
+static void 	PrvDetach			(void);
+
+static void 	PrvGetRegisters		(uint32* r);
+static void 	PrvSetRegisters		(const uint32* r);
+
+static Bool 	PrvReadMemory		(emuptr addr, uint32 len, string& data);
+static Bool 	PrvWriteMemory		(emuptr addr, const string& data);
+
+static Bool 	PrvInsertPoint		(int type, emuptr addr, uint32 len);
+static Bool 	PrvRemovePoint		(int type, emuptr addr, uint32 len);
+
+static string	PrvMemoryMap		(void);
+static void 	PrvAddRegion		(string& map, const char* type, emuptr start, uint32 len);
+static string	PrvXferChunk		(const string& object, const char* args);
+
+static int		PrvSignal			(void);
+static int		PrvHexValue			(char ch);
+static uint32	PrvParseHex			(const char*& p);
+static void 	PrvAppendHex		(string& s, uint32 value, int digits);
+static void 	PrvAppendBinary		(string& s, const string& data);
+static string	PrvFromHex			(const char* p, long len);
+static string	PrvUnescape			(const char* p, long len);
+
+
+// ---------------------------------------------------------------------------
+//		 EmGDBStub::Startup
+// ---------------------------------------------------------------------------
+
+void EmGDBStub::Startup (void)
+{
+	EmGDBStub::CreateListener ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmGDBStub::Shutdown
+// ---------------------------------------------------------------------------
+// The sockets themselves are closed by CSocket::Shutdown.
+
+void EmGDBStub::Shutdown (void)
+{
+	gListener = NULL;
+	gConnection = NULL;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmGDBStub::IsConnected
+// ---------------------------------------------------------------------------
+
+Bool EmGDBStub::IsConnected (void)
+{
+	return gConnection != NULL;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmGDBStub::SendStopReply
+// ---------------------------------------------------------------------------
+// Tell gdb why we stopped.  Called from Debug::EnterDebugger, which has
+// already recorded the reason in gDebuggerGlobals.excType.
+
+ErrCode EmGDBStub::SendStopReply (void)
+{
+	if (!gConnection)
+		return 1;
+
+	char	buffer[32];
+
+	if (gWatchType != 0)
+	{
+		const char*	kind =
+			gWatchType == kZRead	? "rwatch" :
+			gWatchType == kZAccess	? "awatch" : "watch";
+
+		sprintf (buffer, "T%02x%s:%08lx;", ::PrvSignal (), kind, (long) gWatchAddr);
+	}
+	else
+	{
+		sprintf (buffer, "S%02x", ::PrvSignal ());
+	}
+
+	gInterrupted = false;
+	gWatchType = 0;
+
+	::PrvSendPacket (buffer);
+
+	return errNone;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmGDBStub::WatchHit
+// ---------------------------------------------------------------------------
+// Called from EmDeferredErrWatchpoint::Do.  Find the gdb watchpoint that
+// was hit so that the stop reply can say which one it was.
+
+Bool EmGDBStub::WatchHit (emuptr addr, Bool forRead)
+{
+	if (!gConnection)
+		return false;
+
+	EmGDBWatchList::iterator	iter = gWatches.begin ();
+	while (iter != gWatches.end ())
+	{
+		if (addr >= iter->fAddr && addr < iter->fAddr + iter->fSize &&
+			(iter->fType == kZAccess || (iter->fType == kZRead) == (forRead != 0)))
+		{
+			gWatchType = iter->fType;
+			gWatchAddr = addr;
+			break;
+		}
+
+		++iter;
+	}
+
+	if (Debug::EnterDebugger (kException_SoftBreak, NULL) == errNone)
+		return true;
+
+	gWatchType = 0;
+	return false;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmGDBStub::EventCallback
+// ---------------------------------------------------------------------------
+// Callback for the listening and connected sockets.  Once gdb connects,
+// we stop listening until it goes away again.
+
+void EmGDBStub::EventCallback (CSocket* s, int event)
+{
+	switch (event)
+	{
+		case CSocket::kConnected:
+		{
+			EmAssert (gListener == s);
+			EmAssert (gConnection == NULL);
+
+			gConnection = s;
+			gListener = NULL;
+
+			gState = kStateIdle;
+			gNoAck = false;
+			gLastSent.erase ();
+			gInterrupted = false;
+			gWatchType = 0;
+
+			// As for PalmDebugger, install the 'gdbS' feature so that
+			// applications built with the prc-tools stop when launched.
+
+			if (EmPatchState::UIInitialized ())
+			{
+				EmSessionStopper	stopper (gSession, kStopOnSysCall);
+				if (stopper.Stopped ())
+				{
+					::FtrSet ('gdbS', 0, 0x12BEEF34);
+				}
+			}
+			break;
+		}
+
+		case CSocket::kDataReceived:
+		{
+			while (s == gConnection && s->HasUnreadData (0))
+			{
+				uint8	ch;
+				long	amtRead;
+
+				if (s->Read (&ch, 1, &amtRead) != errNone || amtRead != 1)
+					break;
+
+				::PrvHandleByte (ch);
+			}
+			break;
+		}
+
+		case CSocket::kDisconnected:
+		{
+			EmAssert (gConnection == s);
+
+			{
+				EmSessionStopper	stopper (gSession, kStopNow);
+				if (stopper.Stopped ())
+				{
+					::PrvDetach ();
+				}
+			}
+
+			gConnection = NULL;
+			s->Delete ();
+
+			EmGDBStub::CreateListener ();
+
+			if (EmPatchState::UIInitialized ())
+			{
+				EmSessionStopper	stopper (gSession, kStopOnSysCall);
+				if (stopper.Stopped ())
+				{
+					::FtrUnregister ('gdbS', 0);
+				}
+			}
+			break;
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmGDBStub::CreateListener
+// ---------------------------------------------------------------------------
+
+void EmGDBStub::CreateListener (void)
+{
+	Preference<long>	portPref (kPrefKeyGDBSocketPort);
+
+	if (*portPref != 0)
+	{
+		gListener = new CTCPSocket (&EmGDBStub::EventCallback, *portPref);
+		ErrCode		err = gListener->Open ();
+		if (err != errNone)
+		{
+			gListener->Delete ();
+			gListener = NULL;
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvHandleByte
+// ---------------------------------------------------------------------------
+
+void PrvHandleByte (uint8 ch)
+{
+	switch (gState)
+	{
+		case kStateIdle:
+			if (ch == '$')
+			{
+				gPacket.erase ();
+				gChecksum = 0;
+				gState = kStatePacket;
+			}
+			else if (ch == 0x03)
+			{
+				EmSessionStopper	stopper (gSession, kStopNow);
+				if (stopper.Stopped () && !::PrvInDebugger ())
+				{
+					gInterrupted = true;
+					Debug::EnterDebugger (kException_SoftBreak, NULL);
+				}
+			}
+			else if (ch == '-' && !gLastSent.empty ())
+			{
+				::PrvSend (gLastSent);
+			}
+			break;
+
+		case kStatePacket:
+			if (ch == '#')
+			{
+				gState = kStateChecksum1;
+			}
+			else
+			{
+				gPacket += (char) ch;
+				gChecksum += ch;
+			}
+			break;
+
+		case kStateChecksum1:
+			gSentChecksum = (uint8) (::PrvHexValue (ch) << 4);
+			gState = kStateChecksum2;
+			break;
+
+		case kStateChecksum2:
+			gSentChecksum |= (uint8) ::PrvHexValue (ch);
+			gState = kStateIdle;
+
+			if (!gNoAck && gSentChecksum != gChecksum)
+			{
+				::PrvSend ("-");
+				break;
+			}
+
+			if (!gNoAck)
+			{
+				::PrvSend ("+");
+			}
+
+			::PrvHandlePacket (gPacket);
+			break;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvHandlePacket
+// ---------------------------------------------------------------------------
+
+void PrvHandlePacket (const string& packet)
+{
+	PRINTF ("EmGDBStub: received \"%s\".", packet.c_str ());
+
+	string	reply;
+	Bool	sendReply;
+
+	{
+		EmSessionStopper	stopper (gSession, kStopNow);
+		if (!stopper.Stopped ())
+		{
+			::PrvSendPacket ("E01");
+			return;
+		}
+
+		CEnableFullAccess	munge;
+
+		sendReply = ::PrvDoPacket (packet, reply);
+	}
+
+	if (sendReply)
+	{
+		::PrvSendPacket (reply);
+	}
+
+	if (packet == "QStartNoAckMode")
+	{
+		gNoAck = true;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvDoPacket
+// ---------------------------------------------------------------------------
+// Carry out a packet with the CPU stopped.  Returns false if there's no
+// reply to send right away (continue and step; their reply is the stop
+// reply sent when the CPU stops again).
+
+Bool PrvDoPacket (const string& packet, string& reply)
+{
+	const char*	p		= packet.c_str ();
+	char		cmd		= *p++;
+	Bool		stopped	= ::PrvInDebugger ();
+
+	reply.erase ();
+
+	switch (cmd)
+	{
+		case '?':
+			// Stop if we're running.  EnterDebugger sends the stop reply.
+
+			if (stopped)
+				EmGDBStub::SendStopReply ();
+			else
+				Debug::EnterDebugger (kException_SoftBreak, NULL);
+			return false;
+
+		case 'g':
+		{
+			if (!stopped)
+				break;
+
+			uint32	r[kNumRegs];
+			::PrvGetRegisters (r);
+
+			for (int ii = 0; ii < kNumRegs; ++ii)
+			{
+				::PrvAppendHex (reply, r[ii], 8);
+			}
+			return true;
+		}
+
+		case 'G':
+		{
+			if (!stopped || strlen (p) < kNumRegs * 8)
+				break;
+
+			uint32	r[kNumRegs];
+
+			for (int ii = 0; ii < kNumRegs; ++ii)
+			{
+				char	digits[9];
+				strncpy (digits, p + ii * 8, 8);
+				digits[8] = 0;
+				r[ii] = strtoul (digits, NULL, 16);
+			}
+
+			::PrvSetRegisters (r);
+			reply = "OK";
+			return true;
+		}
+
+		case 'p':
+		{
+			uint32	regNum = ::PrvParseHex (p);
+			if (!stopped || regNum >= kNumRegs)
+				break;
+
+			uint32	r[kNumRegs];
+			::PrvGetRegisters (r);
+			::PrvAppendHex (reply, r[regNum], 8);
+			return true;
+		}
+
+		case 'P':
+		{
+			uint32	regNum = ::PrvParseHex (p);
+			if (!stopped || regNum >= kNumRegs || *p++ != '=')
+				break;
+
+			uint32	r[kNumRegs];
+			::PrvGetRegisters (r);
+			r[regNum] = ::PrvParseHex (p);
+			::PrvSetRegisters (r);
+			reply = "OK";
+			return true;
+		}
+
+		case 'm':
+		case 'x':
+		{
+			emuptr	addr	= ::PrvParseHex (p);
+			uint32	len		= (*p++ == ',') ? ::PrvParseHex (p) : 0;
+
+			if (!stopped)
+				break;
+
+			// Leave room for the "b", escapes, and the packet framing.
+
+			if (len > (kMaxPacketSize - 8) / 2)
+				len = (kMaxPacketSize - 8) / 2;
+
+			string	data;
+			if (!::PrvReadMemory (addr, len, data))
+				break;
+
+			if (cmd == 'm')
+			{
+				for (string::size_type ii = 0; ii < data.size (); ++ii)
+				{
+					::PrvAppendHex (reply, (uint8) data[ii], 2);
+				}
+			}
+			else
+			{
+				reply = "b";
+				::PrvAppendBinary (reply, data);
+			}
+			return true;
+		}
+
+		case 'M':
+		case 'X':
+		{
+			emuptr	addr	= ::PrvParseHex (p);
+			uint32	len		= (*p++ == ',') ? ::PrvParseHex (p) : 0;
+
+			if (!stopped || *p++ != ':')
+				break;
+
+			long	avail	= packet.size () - (p - packet.c_str ());
+			string	data	= (cmd == 'M') ? ::PrvFromHex (p, avail)
+										   : ::PrvUnescape (p, avail);
+
+			if (data.size () != len)
+				break;
+
+			if (!::PrvWriteMemory (addr, data))
+				break;
+
+			reply = "OK";
+			return true;
+		}
+
+		case 'c':
+		case 's':
+		{
+			if (!stopped)
+				break;
+
+			if (*p)
+			{
+				uint32	r[kNumRegs];
+				::PrvGetRegisters (r);
+				r[kRegPC] = ::PrvParseHex (p);
+				::PrvSetRegisters (r);
+			}
+
+			::PrvResume (cmd == 's');
+			return false;
+		}
+
+		case 'v':
+		{
+			if (packet == "vCont?")
+			{
+				reply = "vCont;c;C;s;S";
+				return true;
+			}
+
+			if (strncmp (p, "Cont;", 5) == 0)
+			{
+				if (!stopped)
+					break;
+
+				// We only have the one thread, so the first action
+				// is the one that applies to it.
+
+				char	action = p[5];
+
+				if (action == 'c' || action == 'C')
+				{
+					::PrvResume (false);
+					return false;
+				}
+
+				if (action == 's' || action == 'S')
+				{
+					::PrvResume (true);
+					return false;
+				}
+
+				break;
+			}
+
+			return true;
+		}
+
+		case 'Z':
+		case 'z':
+		{
+			int		type	= ::PrvParseHex (p);
+			emuptr	addr	= (*p++ == ',') ? ::PrvParseHex (p) : 0;
+			uint32	len		= (*p++ == ',') ? ::PrvParseHex (p) : 0;
+
+			if (type > kZAccess)
+				return true;	// Not supported.
+
+			Bool	ok = (cmd == 'Z') ? ::PrvInsertPoint (type, addr, len)
+									  : ::PrvRemovePoint (type, addr, len);
+			if (!ok)
+				break;
+
+			reply = "OK";
+			return true;
+		}
+
+		case 'q':
+		{
+			if (strncmp (p, "Supported", 9) == 0)
+			{
+				char	buffer[100];
+				sprintf (buffer, "PacketSize=%lx;qXfer:features:read+;"
+					"qXfer:memory-map:read+;QStartNoAckMode+", kMaxPacketSize);
+				reply = buffer;
+			}
+			else if (strncmp (p, kFeaturesPrefix, strlen (kFeaturesPrefix)) == 0)
+			{
+				reply = ::PrvXferChunk (kTargetXML, p + strlen (kFeaturesPrefix));
+			}
+			else if (strncmp (p, kMemoryMapPrefix, strlen (kMemoryMapPrefix)) == 0)
+			{
+				reply = ::PrvXferChunk (::PrvMemoryMap (), p + strlen (kMemoryMapPrefix));
+			}
+			else if (strcmp (p, "Attached") == 0)
+			{
+				reply = "1";
+			}
+			else if (strcmp (p, "C") == 0)
+			{
+				reply = "QC1";
+			}
+			else if (strcmp (p, "fThreadInfo") == 0)
+			{
+				reply = "m1";
+			}
+			else if (strcmp (p, "sThreadInfo") == 0)
+			{
+				reply = "l";
+			}
+			return true;
+		}
+
+		case 'Q':
+			if (strcmp (p, "StartNoAckMode") == 0)
+				reply = "OK";
+			return true;
+
+		case 'H':
+		case 'T':
+			reply = "OK";
+			return true;
+
+		case 'D':
+			// Reply before letting go, so gdb hears it before we
+			// start running again.
+
+			::PrvSendPacket ("OK");
+			::PrvDetach ();
+			return false;
+
+		case 'k':
+			::PrvDetach ();
+			return false;
+
+		default:
+			// Empty reply for "not supported".
+
+			return true;
+	}
+
+	reply = "E01";
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvSend
+// ---------------------------------------------------------------------------
+
+void PrvSend (const string& data)
+{
+	omni_mutex_lock	lock (gMutex);
+
+	if (gConnection)
+	{
+		long	amtWritten;
+		gConnection->Write (data.c_str (), data.size (), &amtWritten);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvSendPacket
+// ---------------------------------------------------------------------------
+// Frame and send a reply, remembering it in case gdb asks for it again.
+
+void PrvSendPacket (const string& payload)
+{
+	PRINTF ("EmGDBStub: sending \"%s\".", payload.c_str ());
+
+	uint8	checksum = 0;
+
+	for (string::size_type ii = 0; ii < payload.size (); ++ii)
+	{
+		checksum += (uint8) payload[ii];
+	}
+
+	string	packet ("$");
+	packet += payload;
+	packet += '#';
+	::PrvAppendHex (packet, checksum, 2);
+
+	gLastSent = packet;
+
+	::PrvSend (packet);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvInDebugger
+// ---------------------------------------------------------------------------
+
+Bool PrvInDebugger (void)
+{
+	EmAssert (gSession);
+
+	EmSuspendState	state = gSession->GetSuspendState ();
+	return state.fCounters.fSuspendByDebugger != 0;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvResume
+// ---------------------------------------------------------------------------
+// Continue or single-step, as a PalmDebugger Continue packet would: set
+// or clear the trace bit, then leave the debugger.
+
+void PrvResume (Bool step)
+{
+	uint32	r[kNumRegs];
+	::PrvGetRegisters (r);
+
+	if (step)
+		r[kRegSR] |= 0x8000;
+	else
+		r[kRegSR] &= ~0xC000;
+
+	::PrvSetRegisters (r);
+
+	if (Debug::ExitDebugger () == errNone)
+	{
+		Platform::ExitDebugger ();
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvDetach
+// ---------------------------------------------------------------------------
+// Take out everything gdb put in, and let the CPU go if gdb had it
+// stopped.  Called with the CPU stopped.
+
+void PrvDetach (void)
+{
+	for (int ii = 0; ii < dbgNormalBreakpoints; ++ii)
+	{
+		if (gOwnBreakpoint[ii])
+		{
+			Debug::ClearBreakpoint (ii);
+			gOwnBreakpoint[ii] = false;
+		}
+	}
+
+	EmGDBWatchList::iterator	iter = gWatches.begin ();
+	while (iter != gWatches.end ())
+	{
+		EmWatchpoints::Remove (iter->fID);
+		++iter;
+	}
+
+	gWatches.clear ();
+
+	if (::PrvInDebugger ())
+	{
+		::PrvResume (false);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvGetRegisters
+// ---------------------------------------------------------------------------
+
+void PrvGetRegisters (uint32* r)
+{
+	M68KRegsType	regs;
+	SystemPacket::GetRegs (regs);
+
+	for (int ii = 0; ii < 8; ++ii)
+	{
+		r[ii] = regs.d[ii];
+	}
+
+	for (int ii = 0; ii < 7; ++ii)
+	{
+		r[8 + ii] = regs.a[ii];
+	}
+
+	r[kRegSP] = (regs.sr & 0x2000) ? regs.ssp : regs.usp;
+	r[kRegSR] = regs.sr;
+	r[kRegPC] = regs.pc;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvSetRegisters
+// ---------------------------------------------------------------------------
+
+void PrvSetRegisters (const uint32* r)
+{
+	M68KRegsType	regs;
+	SystemPacket::GetRegs (regs);
+
+	for (int ii = 0; ii < 8; ++ii)
+	{
+		regs.d[ii] = r[ii];
+	}
+
+	for (int ii = 0; ii < 7; ++ii)
+	{
+		regs.a[ii] = r[8 + ii];
+	}
+
+	regs.sr = (UInt16) r[kRegSR];
+	regs.pc = r[kRegPC];
+
+	if (regs.sr & 0x2000)
+		regs.ssp = r[kRegSP];
+	else
+		regs.usp = r[kRegSP];
+
+	SystemPacket::SetRegs (regs);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvReadMemory
+// ---------------------------------------------------------------------------
+
+Bool PrvReadMemory (emuptr addr, uint32 len, string& data)
+{
+	data.resize (len);
+
+	if (len == 0)
+		return true;
+
+	if (addr + len - 1 < addr ||
+		!EmMemCheckAddress (addr, 1) ||
+		!EmMemCheckAddress (addr + len - 1, 1))
+	{
+		return false;
+	}
+
+	EmMem_memcpy ((void*) &data[0], addr, len);
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvWriteMemory
+// ---------------------------------------------------------------------------
+
+Bool PrvWriteMemory (emuptr addr, const string& data)
+{
+	uint32	len = data.size ();
+
+	if (len == 0)
+		return true;
+
+	if (addr + len - 1 < addr ||
+		!EmMemCheckAddress (addr, 1) ||
+		!EmMemCheckAddress (addr + len - 1, 1))
+	{
+		return false;
+	}
+
+	EmMem_memcpy (addr, (const void*) data.data (), len);
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvInsertPoint
+// ---------------------------------------------------------------------------
+// Breakpoints (hardware or software, it's all the same to us) take a free
+// slot in the Debug breakpoint table.  Watchpoints are EmWatchpoints.
+
+Bool PrvInsertPoint (int type, emuptr addr, uint32 len)
+{
+	if (type == kZSoftware || type == kZHardware)
+	{
+		for (int ii = 0; ii < dbgNormalBreakpoints; ++ii)
+		{
+			if (gOwnBreakpoint[ii] && (emuptr) gDebuggerGlobals.bp[ii].addr == addr)
+				return true;
+		}
+
+		for (int ii = 0; ii < dbgNormalBreakpoints; ++ii)
+		{
+			if (!gDebuggerGlobals.bp[ii].enabled && !gOwnBreakpoint[ii])
+			{
+				Debug::SetBreakpoint (ii, addr, NULL);
+				gOwnBreakpoint[ii] = true;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	int		access =
+		type == kZWrite	? kWatchWrite :
+		type == kZRead	? kWatchRead : (kWatchRead | kWatchWrite);
+
+	EmGDBWatch	watch;
+
+	watch.fType	= type;
+	watch.fAddr	= addr;
+	watch.fSize	= len;
+	watch.fID	= EmWatchpoints::Add (addr, len, access, NULL);
+
+	if (watch.fID == 0)
+		return false;
+
+	gWatches.push_back (watch);
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvRemovePoint
+// ---------------------------------------------------------------------------
+
+Bool PrvRemovePoint (int type, emuptr addr, uint32 len)
+{
+	if (type == kZSoftware || type == kZHardware)
+	{
+		for (int ii = 0; ii < dbgNormalBreakpoints; ++ii)
+		{
+			if (gOwnBreakpoint[ii] && (emuptr) gDebuggerGlobals.bp[ii].addr == addr)
+			{
+				Debug::ClearBreakpoint (ii);
+				gOwnBreakpoint[ii] = false;
+			}
+		}
+
+		return true;
+	}
+
+	EmGDBWatchList::iterator	iter = gWatches.begin ();
+	while (iter != gWatches.end ())
+	{
+		if (iter->fType == type && iter->fAddr == addr && iter->fSize == len)
+		{
+			EmWatchpoints::Remove (iter->fID);
+			gWatches.erase (iter);
+			break;
+		}
+
+		++iter;
+	}
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvMemoryMap
+// ---------------------------------------------------------------------------
+// Describe the address space for qXfer:memory-map:read.  gdb won't touch
+// memory outside of these ranges.
+
+string PrvMemoryMap (void)
+{
+	string	map (
+		"<?xml version=\"1.0\"?>"
+		"<!DOCTYPE memory-map PUBLIC \"+//IDN gnu.org//DTD GDB Memory Map V1.0//EN\""
+		" \"http://sourceware.org/gdb/gdb-memory-map.dtd\">"
+		"<memory-map>");
+
+	emuptr	ramStart = EmBankSRAM::GetMemoryStart ();
+
+	// On the original Dragonball, the dynamic heap is also at zero.
+
+	if (ramStart != 0)
+	{
+		uint32	heapSize = EmHAL::GetDynamicHeapSize ();
+		if (heapSize > gRAMBank_Size)
+			heapSize = gRAMBank_Size;
+
+		::PrvAddRegion (map, "ram", 0, heapSize);
+	}
+
+	::PrvAddRegion (map, "ram", ramStart, gRAMBank_Size);
+	::PrvAddRegion (map, "rom", EmBankROM::GetMemoryStart (), EmBankROM::GetMemorySize ());
+	::PrvAddRegion (map, "ram", 0xFFFFF000, 0x1000);	// Dragonball registers
+
+	map += "</memory-map>";
+
+	return map;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvAddRegion
+// ---------------------------------------------------------------------------
+
+void PrvAddRegion (string& map, const char* type, emuptr start, uint32 len)
+{
+	char	buffer[100];
+
+	sprintf (buffer, "<memory type=\"%s\" start=\"0x%08lx\" length=\"0x%lx\"/>",
+		type, (long) start, (long) len);
+
+	map += buffer;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvXferChunk
+// ---------------------------------------------------------------------------
+// Return the part of "object" asked for by the "offset,length" in a
+// qXfer:...:read packet, prefixed with "m" if there's more after it or
+// "l" if it's the last part.
+
+string PrvXferChunk (const string& object, const char* args)
+{
+	uint32	offset	= ::PrvParseHex (args);
+	uint32	len		= (*args++ == ',') ? ::PrvParseHex (args) : 0;
+
+	if (len > kMaxPacketSize - 8)
+		len = kMaxPacketSize - 8;
+
+	if (offset >= object.size ())
+		return "l";
+
+	string	chunk (object.substr (offset, len));
+	string	result (offset + chunk.size () < object.size () ? "m" : "l");
+
+	::PrvAppendBinary (result, chunk);
+
+	return result;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvSignal
+// ---------------------------------------------------------------------------
+// Turn the exception that got us into the debugger into a Unix signal
+// number for the stop reply.
+
+int PrvSignal (void)
+{
+	enum { kSIGINT = 2, kSIGILL = 4, kSIGTRAP = 5, kSIGFPE = 8, kSIGBUS = 10 };
+
+	if (gInterrupted)
+		return kSIGINT;
+
+	ExceptionNumber	exc = (ExceptionNumber) (gDebuggerGlobals.excType / 4);
+
+	if (exc >= kException_Trap0 && exc <= kException_Trap15)
+		return kSIGTRAP;
+
+	switch (exc)
+	{
+		case kException_BusErr:
+		case kException_AddressErr:
+			return kSIGBUS;
+
+		case kException_IllegalInstr:
+		case kException_ATrap:
+		case kException_FTrap:
+		case kException_Privilege:
+			return kSIGILL;
+
+		case kException_DivideByZero:
+		case kException_Chk:
+		case kException_Trap:
+			return kSIGFPE;
+
+		case kException_AutoVec7:
+			return kSIGINT;
+
+		default:
+			break;
+	}
+
+	return kSIGTRAP;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvHexValue
+// ---------------------------------------------------------------------------
+
+int PrvHexValue (char ch)
+{
+	if (ch >= '0' && ch <= '9')
+		return ch - '0';
+
+	if (ch >= 'a' && ch <= 'f')
+		return ch - 'a' + 10;
+
+	if (ch >= 'A' && ch <= 'F')
+		return ch - 'A' + 10;
+
+	return 0;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvParseHex
+// ---------------------------------------------------------------------------
+// Parse a hex number, leaving "p" pointing after it.
+
+uint32 PrvParseHex (const char*& p)
+{
+	char*	end;
+	uint32	result = strtoul (p, &end, 16);
+
+	p = end;
+
+	return result;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvAppendHex
+// ---------------------------------------------------------------------------
+
+void PrvAppendHex (string& s, uint32 value, int digits)
+{
+	static const char	kDigits[] = "0123456789abcdef";
+
+	while (digits--)
+	{
+		s += kDigits[(value >> (digits * 4)) & 0x0F];
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvAppendBinary
+// ---------------------------------------------------------------------------
+// Append data for an 'x' or qXfer reply, escaping the bytes that have
+// meaning to the protocol.
+
+void PrvAppendBinary (string& s, const string& data)
+{
+	for (string::size_type ii = 0; ii < data.size (); ++ii)
+	{
+		char	ch = data[ii];
+
+		if (ch == '#' || ch == '$' || ch == '}' || ch == '*')
+		{
+			s += '}';
+			s += (char) (ch ^ 0x20);
+		}
+		else
+		{
+			s += ch;
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvFromHex
+// ---------------------------------------------------------------------------
+
+string PrvFromHex (const char* p, long len)
+{
+	string	result;
+
+	for (long ii = 0; ii + 1 < len; ii += 2)
+	{
+		result += (char) ((::PrvHexValue (p[ii]) << 4) | ::PrvHexValue (p[ii + 1]));
+	}
+
+	return result;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvUnescape
+// ---------------------------------------------------------------------------
+// Undo the escaping of the data in an 'X' packet.
+
+string PrvUnescape (const char* p, long len)
+{
+	string	result;
+
+	for (long ii = 0; ii < len; ++ii)
+	{
+		if (p[ii] == '}' && ii + 1 < len)
+			result += (char) (p[++ii] ^ 0x20);
+		else
+			result += p[ii];
+	}
+
+	return result;
+}
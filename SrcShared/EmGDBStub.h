@@ -0,0 +1,72 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmGDBStub_h
+#define EmGDBStub_h
+
+class CSocket;
+
+/*
+	EmGDBStub lets gdb (m68k-palmos-gdb, or any gdb built for m68k) debug
+	the emulated device directly with "target remote :<port>", using
+	gdb's remote serial protocol instead of the PalmDebugger packets that
+	the rest of the Debug sub-system speaks.  It listens on the port in
+	the GDBSocketPort preference; a port of zero (the default) turns it
+	off.  Only one gdb can be connected at a time.
+
+	The stub is a translator.  Registers are read and written with
+	SystemPacket::GetRegs and SetRegs, memory with EmMem_memcpy,
+	software breakpoints go into the Debug breakpoint table (so there
+	are only dbgNormalBreakpoints of them, shared with PalmDebugger),
+	and watchpoints are EmWatchpoints.  Stopping and resuming are done
+	with Debug::EnterDebugger and ExitDebugger, just as for PalmDebugger;
+	while gdb is connected, EnterDebugger sends gdb a stop reply instead
+	of a state packet.
+
+	Supported packets are ?, g, G, p, P, m, M, x, X, c, s, vCont, Z0-Z4,
+	z0-z4, D, k, and the queries gdb needs to get started: qSupported,
+	qXfer:features:read (an m68k target description) and
+	qXfer:memory-map:read (RAM, ROM, and the Dragonball registers), plus
+	QStartNoAckMode.  Everything else gets the empty "not supported"
+	reply.  A ^C from gdb stops the CPU.
+
+	This system is accessed from the following locations:
+
+		* EmApplication		: Startup, Shutdown.
+		* Debug				: IsConnected, SendStopReply.
+		* ErrorHandling		: WatchHit.
+*/
+
+class EmGDBStub
+{
+	public:
+		static void 			Startup				(void);
+		static void 			Shutdown			(void);
+
+		static Bool 			IsConnected			(void);
+
+		// Called from Debug::EnterDebugger when the CPU stops.
+
+		static ErrCode			SendStopReply		(void);
+
+		// Called when a watchpoint fires.  Returns true if gdb is
+		// connected and has been told about it.
+
+		static Bool 			WatchHit			(emuptr addr, Bool forRead);
+
+	private:
+		static void 			EventCallback		(CSocket* s, int event);
+		static void 			CreateListener		(void);
+};
+
+#endif	// EmGDBStub_h
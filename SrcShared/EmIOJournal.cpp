@@ -0,0 +1,257 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmIOJournal.h"
+
+#include "ChunkFile.h"			// Chunk, EmStreamChunk
+#include "EmEventPlayback.h"	// RecordingEvents, ReplayingEvents
+#include "SessionFile.h"		// SessionFile
+
+
+/*
+	The journal is a single chunk of variable-length records, in the
+	order they were made:
+
+		kind:	1 byte (EmIOJournalKind)
+		when:	4 bytes (the Poll count the record is for)
+		result:	4 bytes
+		err:	4 bytes
+		size:	4 bytes
+		data:	"size" bytes
+
+	Replay keeps one read position per kind, so that the kinds can get
+	out of step with each other without losing their place.
+*/
+
+static Chunk	gJournal;
+static uint32	gPolls[kIOJournalNumKinds];
+static long		gCursors[kIOJournalNumKinds];
+
+
+// ---------------------------------------------------------------------------
+//		 EmIOJournal::Clear
+// ---------------------------------------------------------------------------
+// Throw away everything recorded so far.
+
+void EmIOJournal::Clear (void)
+{
+	gJournal.SetLength (0);
+
+	EmIOJournal::Rewind ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmIOJournal::Rewind
+// ---------------------------------------------------------------------------
+// Start over from the beginning.  Called whenever event playback starts
+// over, so that the poll counts here line up with the events.
+
+void EmIOJournal::Rewind (void)
+{
+	for (int ii = 0; ii < kIOJournalNumKinds; ++ii)
+	{
+		gPolls[ii] = 0;
+		gCursors[ii] = 0;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmIOJournal::Save
+// ---------------------------------------------------------------------------
+// Called from EmEventPlayback::SaveEvents.  The poll counts are saved, too,
+// so that Hordes can pick up recording where it left off.
+
+void EmIOJournal::Save (SessionFile& f)
+{
+	const uint32	kCurrentVersion = 1;
+	Chunk			chunk;
+	EmStreamChunk	s (chunk);
+
+	s << kCurrentVersion;
+	s << (uint32) kIOJournalNumKinds;
+
+	for (int ii = 0; ii < kIOJournalNumKinds; ++ii)
+	{
+		s << gPolls[ii];
+	}
+
+	s << (uint32) gJournal.GetLength ();
+	s.PutBytes (gJournal.GetPointer (), gJournal.GetLength ());
+
+	f.WriteIOJournal (chunk);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmIOJournal::Load
+// ---------------------------------------------------------------------------
+// Called from EmEventPlayback::LoadEvents.  Event files made before there
+// was a journal just leave it empty.
+
+void EmIOJournal::Load (SessionFile& f)
+{
+	Chunk	chunk;
+
+	EmIOJournal::Clear ();
+
+	if (f.ReadIOJournal (chunk))
+	{
+		uint32			version;
+		uint32			numKinds;
+		uint32			size;
+		EmStreamChunk	s (chunk);
+
+		s >> version;
+		s >> numKinds;
+
+		for (uint32 ii = 0; ii < numKinds; ++ii)
+		{
+			uint32	polls;
+			s >> polls;
+
+			if (ii < kIOJournalNumKinds)
+				gPolls[ii] = polls;
+		}
+
+		s >> size;
+		gJournal.SetLength (size);
+		s.GetBytes (gJournal.GetPointer (), size);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmIOJournal::Recording
+// ---------------------------------------------------------------------------
+
+Bool EmIOJournal::Recording (void)
+{
+	return EmEventPlayback::RecordingEvents ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmIOJournal::Replaying
+// ---------------------------------------------------------------------------
+
+Bool EmIOJournal::Replaying (void)
+{
+	return EmEventPlayback::ReplayingEvents ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmIOJournal::Poll
+// ---------------------------------------------------------------------------
+// Count a call of the given kind, and return the count to pass to Record
+// or Replay.  Call this once per call, whether or not anything ends up
+// being recorded for it.
+
+uint32 EmIOJournal::Poll (EmIOJournalKind kind)
+{
+	EmAssert (kind >= 0 && kind < kIOJournalNumKinds);
+
+	return gPolls[kind]++;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmIOJournal::Record
+// ---------------------------------------------------------------------------
+// Add a record, as long as events are being recorded.
+
+void EmIOJournal::Record (EmIOJournalKind kind, uint32 when, int32 result,
+						  int32 err, const void* data, long len)
+{
+	if (!EmIOJournal::Recording ())
+		return;
+
+	EmStreamChunk	s (gJournal);
+	s.SetMarker (0, kStreamFromEnd);
+
+	s << (uint8) kind;
+	s << when;
+	s << result;
+	s << err;
+	s << (uint32) len;
+
+	if (len > 0)
+	{
+		s.PutBytes (data, len);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmIOJournal::Replay
+// ---------------------------------------------------------------------------
+// Find the record of the given kind for the given poll count.  Records for
+// earlier counts that were never asked for are skipped.  Returns false if
+// there's no record for this count.
+
+Bool EmIOJournal::Replay (EmIOJournalKind kind, uint32 when, int32& result,
+						  int32& err, Chunk& data)
+{
+	EmAssert (kind >= 0 && kind < kIOJournalNumKinds);
+
+	EmStreamChunk	s (gJournal);
+	long			length = gJournal.GetLength ();
+	long			offset = gCursors[kind];
+
+	while (offset < length)
+	{
+		uint8	recKind;
+		uint32	recWhen;
+		int32	recResult;
+		int32	recErr;
+		uint32	recSize;
+
+		s.SetMarker (offset, kStreamFromStart);
+
+		s >> recKind;
+		s >> recWhen;
+		s >> recResult;
+		s >> recErr;
+		s >> recSize;
+
+		long	next = s.GetMarker () + recSize;
+
+		if (recKind == kind)
+		{
+			// Not there yet; leave this record for later.
+
+			if (recWhen > when)
+				break;
+
+			if (recWhen == when)
+			{
+				result	= recResult;
+				err		= recErr;
+
+				data.SetLength (recSize);
+				s.GetBytes (data.GetPointer (), recSize);
+
+				gCursors[kind] = next;
+				return true;
+			}
+		}
+
+		offset = next;
+	}
+
+	gCursors[kind] = offset;
+	return false;
+}
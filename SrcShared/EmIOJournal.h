@@ -0,0 +1,92 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmIOJournal_h
+#define EmIOJournal_h
+
+class Chunk;
+class SessionFile;
+
+/*
+	EmIOJournal records what the host handed back from calls whose
+	results can't be reproduced: data received on a socket, what select
+	said was ready, whether a connection went through or data went out,
+	bytes arriving on the serial port, what a HostControl file read returned, and the
+	values of environment variables.  It rides along with EmEventPlayback:
+	it records while events are being recorded, is saved to and loaded
+	from the same files as the event history, and, while events are
+	being replayed, serves the recorded results instead of calling the
+	host at all.
+
+	Each record is tagged with its kind and with how many times that
+	kind of call had been made so far (see Poll).  During replay, a
+	call gets the record for the same kind and count.  If there is
+	none (because event filtering during minimization changed what the
+	application did), the caller acts as if nothing came back: no data,
+	a timeout, and so on.
+
+	This system is accessed from the following locations:
+
+		* EmEventPlayback	: Clear, Rewind, Save, Load.
+		* EmUARTDragonball	: serial data arriving.
+		* HostControl		: HostFRead, HostGetEnv.
+		* Platform_NetLib	: receives, selects, connects, sends.
+
+	Accepting a connection isn't journaled; it hands back a new host
+	socket, which a replay would have no way to supply.
+*/
+
+enum EmIOJournalKind
+{
+	// These values are written to external files, and so should not
+	// be changed.  New values should be added to the end.
+
+	kIOJournalNetReceive,
+	kIOJournalNetSelect,
+	kIOJournalNetConnect,
+	kIOJournalNetSend,
+	kIOJournalSerialRead,
+	kIOJournalHostFRead,
+	kIOJournalHostGetEnv,
+
+	kIOJournalNumKinds
+};
+
+class EmIOJournal
+{
+	public:
+		static void 			Clear				(void);
+		static void 			Rewind				(void);
+		static void 			Save				(SessionFile&);
+		static void 			Load				(SessionFile&);
+
+		static Bool 			Recording			(void);
+		static Bool 			Replaying			(void);
+
+		static uint32			Poll				(EmIOJournalKind);
+
+		static void 			Record				(EmIOJournalKind,
+													 uint32 when,
+													 int32 result,
+													 int32 err,
+													 const void* data = NULL,
+													 long len = 0);
+
+		static Bool 			Replay				(EmIOJournalKind,
+													 uint32 when,
+													 int32& result,
+													 int32& err,
+													 Chunk& data);
+};
+
+#endif	// EmIOJournal_h
@@ -0,0 +1,522 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2000-2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmInstructionStats.h"
+
+#include "EmCPU68K.h"			// gCPU68K, GetOpcodeName
+#include "EmFileRef.h"			// EmFileRef
+#include "EmMemory.h"			// CEnableFullAccess
+#include "EmPalmFunction.h"		// FindFunctionName
+#include "EmPalmHeap.h"			// EmPalmHeap::GetHeapByPtr
+#include "ErrorHandling.h"		// Errors::ThrowIfStdCError
+#include "Logging.h"			// LogGetDirectory
+#include "Platform.h"			// Platform::AllocateMemoryClear
+#include "UAE.h"				// cpufunctbl, cpuop_func
+
+#include <algorithm>			// sort
+#include <errno.h>				// errno
+#include <stdio.h>				// FILE, fopen
+#include <string.h>				// memset
+
+
+// ===========================================================================
+//		 EmInstructionStats
+// ===========================================================================
+
+// Size of the PC hash table.  Stop adding new PCs when it's 3/4 full so
+// that probe sequences stay short.
+
+const uint32	kPCTableBits	= 16;
+const uint32	kPCTableSize	= 1 << kPCTableBits;
+const uint32	kPCTableMax		= kPCTableSize / 4 * 3;
+
+// Code with no MacsBug names and not in a heap chunk is lumped together
+// in blocks of this size.
+
+const emuptr	kUnnamedBlockSize	= 0x400;
+
+struct EmPCCount
+{
+	emuptr		fPC;
+	uint32		fCount;		// Zero if this slot is unused.  Sticks at
+							// 0xFFFFFFFF rather than wrapping back to it.
+};
+
+struct EmHandlerCount
+{
+	uint64		fCount;
+	uint32		fTopCount;
+	uint16		fTopOpcode;
+	long		fOpcodes;
+};
+
+struct EmHotSpot
+{
+	emuptr		fStart;
+	string		fName;
+	uint64		fCount;
+};
+
+typedef map<cpuop_func*, EmHandlerCount>	EmHandlerCountMap;
+typedef vector<EmHotSpot>					EmHotSpotList;
+
+static uint32*		gOpcodeCounts;
+static EmPCCount*	gPCCounts;
+static uint32		gPCsUsed;
+static uint32		gOtherCount;
+
+
+static uint32		PrvHash				(emuptr pc);
+static void 		PrvResolve			(emuptr pc, EmHotSpot&, emuptr& end);
+static bool 		PrvByPC				(const EmPCCount&, const EmPCCount&);
+static bool 		PrvByHandlerCount	(const EmHandlerCountMap::value_type*, const EmHandlerCountMap::value_type*);
+static bool 		PrvByHotSpotCount	(const EmHotSpot&, const EmHotSpot&);
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmInstructionStats::Dispose
+ *
+ * DESCRIPTION:	Stop counting and release the tables.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmInstructionStats::Dispose (void)
+{
+	if (gCPU68K)
+	{
+		gCPU68K->SetCountInstructions (false);
+	}
+
+	Platform::DisposeMemory (gOpcodeCounts);
+	Platform::DisposeMemory (gPCCounts);
+
+	gPCsUsed	= 0;
+	gOtherCount	= 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmInstructionStats::Start
+ *
+ * DESCRIPTION:	Start counting instructions.  Counts from any previous
+ *				run are kept; call Clear to start over.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmInstructionStats::Start (void)
+{
+	if (!gOpcodeCounts)
+	{
+		gOpcodeCounts	= (uint32*) Platform::AllocateMemoryClear (65536 * sizeof (uint32));
+		gPCCounts		= (EmPCCount*) Platform::AllocateMemoryClear (kPCTableSize * sizeof (EmPCCount));
+	}
+
+	EmAssert (gCPU68K);
+	gCPU68K->SetCountInstructions (true);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmInstructionStats::Stop
+ *
+ * DESCRIPTION:	Stop counting instructions.  The counts are kept until
+ *				the next Clear or the end of the session.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmInstructionStats::Stop (void)
+{
+	EmAssert (gCPU68K);
+	gCPU68K->SetCountInstructions (false);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmInstructionStats::IsOn
+ *
+ * DESCRIPTION:	Return whether or not instructions are being counted.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	True if counting.
+ *
+ ***********************************************************************/
+
+Bool EmInstructionStats::IsOn (void)
+{
+	return gCPU68K && gCPU68K->GetCountInstructions ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmInstructionStats::Clear
+ *
+ * DESCRIPTION:	Zero all counts.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmInstructionStats::Clear (void)
+{
+	if (gOpcodeCounts)
+	{
+		memset (gOpcodeCounts, 0, 65536 * sizeof (uint32));
+		memset (gPCCounts, 0, kPCTableSize * sizeof (EmPCCount));
+	}
+
+	gPCsUsed	= 0;
+	gOtherCount	= 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmInstructionStats::Count
+ *
+ * DESCRIPTION:	Count an instruction.  Called from the CPU loop, so
+ *				keep it short.
+ *
+ * PARAMETERS:	pc - address of the instruction.
+ *
+ *				opcode - first word of the instruction.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmInstructionStats::Count (emuptr pc, uint16 opcode)
+{
+	EmAssert (gOpcodeCounts);
+
+	++gOpcodeCounts[opcode];
+
+	uint32	index = ::PrvHash (pc);
+
+	while (1)
+	{
+		EmPCCount&	entry = gPCCounts[index];
+
+		if (entry.fPC == pc && entry.fCount != 0)
+		{
+			if (entry.fCount != 0xFFFFFFFF)
+				++entry.fCount;
+			return;
+		}
+
+		if (entry.fCount == 0)
+		{
+			if (gPCsUsed >= kPCTableMax)
+			{
+				++gOtherCount;
+				return;
+			}
+
+			entry.fPC		= pc;
+			entry.fCount	= 1;
+			++gPCsUsed;
+			return;
+		}
+
+		index = (index + 1) & (kPCTableSize - 1);
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmInstructionStats::Dump
+ *
+ * DESCRIPTION:	Write the instruction mix and hot spots to a
+ *				tab-delimited text file, biggest first.  Must be called
+ *				on the CPU thread (or with it stopped), since naming
+ *				the hot spots looks into emulated memory.
+ *
+ * PARAMETERS:	ref - the file to write.
+ *
+ * RETURNED:	Nothing.  Throws an ErrCode if the file can't be
+ *				written.
+ *
+ ***********************************************************************/
+
+void EmInstructionStats::Dump (const EmFileRef& ref)
+{
+	// Group the opcodes by handler.
+
+	EmHandlerCountMap	handlers;
+	uint64				total = 0;
+
+	for (long opcode = 0; gOpcodeCounts && opcode < 65536; ++opcode)
+	{
+		uint32	count = gOpcodeCounts[opcode];
+
+		if (count == 0)
+			continue;
+
+		EmHandlerCount&	handler = handlers[cpufunctbl[opcode]];
+
+		if (handler.fOpcodes == 0 || count > handler.fTopCount)
+		{
+			handler.fTopCount	= count;
+			handler.fTopOpcode	= (uint16) opcode;
+		}
+
+		handler.fCount += count;
+		handler.fOpcodes++;
+
+		total += count;
+	}
+
+	vector<const EmHandlerCountMap::value_type*>	sortedHandlers;
+
+	EmHandlerCountMap::const_iterator	hIter = handlers.begin ();
+	while (hIter != handlers.end ())
+	{
+		sortedHandlers.push_back (&*hIter);
+		++hIter;
+	}
+
+	sort (sortedHandlers.begin (), sortedHandlers.end (), PrvByHandlerCount);
+
+	// Group the PCs by function.  Sort them by address first so that
+	// each function only needs to be looked up once.
+
+	vector<EmPCCount>	pcs;
+
+	for (uint32 index = 0; gPCCounts && index < kPCTableSize; ++index)
+	{
+		if (gPCCounts[index].fCount != 0)
+		{
+			pcs.push_back (gPCCounts[index]);
+		}
+	}
+
+	sort (pcs.begin (), pcs.end (), PrvByPC);
+
+	EmHotSpotList	hotSpots;
+	emuptr			end = EmMemNULL;
+
+	{
+		CEnableFullAccess	munge;
+
+		vector<EmPCCount>::iterator	pIter = pcs.begin ();
+		while (pIter != pcs.end ())
+		{
+			if (hotSpots.empty () || pIter->fPC < hotSpots.back ().fStart || pIter->fPC >= end)
+			{
+				EmHotSpot	hotSpot;
+				::PrvResolve (pIter->fPC, hotSpot, end);
+
+				if (hotSpots.empty () || hotSpot.fStart != hotSpots.back ().fStart)
+				{
+					hotSpots.push_back (hotSpot);
+				}
+			}
+
+			hotSpots.back ().fCount += pIter->fCount;
+			++pIter;
+		}
+	}
+
+	sort (hotSpots.begin (), hotSpots.end (), PrvByHotSpotCount);
+
+	// Write it all out.
+
+	FILE*	f = fopen (ref.GetFullPath ().c_str (), "w");
+	if (!f)
+	{
+		Errors::ThrowIfStdCError (errno);
+	}
+
+	double	percent = total ? 100.0 / total : 0;
+
+	fprintf (f, "Instruction mix: %llu instructions, %ld handlers\n\n",
+		total, (long) sortedHandlers.size ());
+	fprintf (f, "count\tpercent\ttop opcode\tmnemonic\topcodes\n");
+
+	for (size_t ii = 0; ii < sortedHandlers.size (); ++ii)
+	{
+		const EmHandlerCount&	handler = sortedHandlers[ii]->second;
+
+		fprintf (f, "%llu\t%.2f\t0x%04X\t%s\t%ld\n",
+			handler.fCount,
+			handler.fCount * percent,
+			(unsigned int) handler.fTopOpcode,
+			EmCPU68K::GetOpcodeName (handler.fTopOpcode),
+			handler.fOpcodes);
+	}
+
+	fprintf (f, "\nHot spots: %lu distinct PCs, %lu instructions at other PCs\n\n",
+		(unsigned long) gPCsUsed, (unsigned long) gOtherCount);
+	fprintf (f, "count\tpercent\taddress\tfunction\n");
+
+	for (size_t jj = 0; jj < hotSpots.size (); ++jj)
+	{
+		const EmHotSpot&	hotSpot = hotSpots[jj];
+
+		fprintf (f, "%llu\t%.2f\t0x%08lX\t%s\n",
+			hotSpot.fCount,
+			hotSpot.fCount * percent,
+			(unsigned long) hotSpot.fStart,
+			hotSpot.fName.c_str ());
+	}
+
+	int	err = ferror (f);
+	fclose (f);
+
+	if (err)
+	{
+		Errors::ThrowIfStdCError (EIO);
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmInstructionStats::GetDumpFile
+ *
+ * DESCRIPTION:	Return the default file for Dump, in the same place
+ *				as the log files.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	The file reference.
+ *
+ ***********************************************************************/
+
+EmFileRef EmInstructionStats::GetDumpFile (void)
+{
+	return EmFileRef (::LogGetDirectory (), "InstructionStats.txt");
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 PrvHash
+// ---------------------------------------------------------------------------
+// Fibonacci hash of the PC.  Instructions are word-aligned, so drop the
+// low bit first.
+
+uint32 PrvHash (emuptr pc)
+{
+	return ((uint32) (pc >> 1) * 0x9E3779B1UL) >> (32 - kPCTableBits);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvResolve
+// ---------------------------------------------------------------------------
+// Find the function containing the given PC.  Use its MacsBug name if it
+// has one.  Otherwise, use the heap chunk holding the code, or failing
+// that, a fixed-size block of memory.  Return the end of the range so
+// that the caller can tell which of the following PCs are in the same
+// place.
+
+void PrvResolve (emuptr pc, EmHotSpot& hotSpot, emuptr& end)
+{
+	char	name[256];
+	emuptr	start = EmMemNULL;
+
+	name[0] = 0;
+	end = EmMemNULL;
+
+	try
+	{
+		::FindFunctionName (pc, name, &start, &end, sizeof (name));
+	}
+	catch (...)
+	{
+		name[0] = 0;
+	}
+
+	hotSpot.fCount = 0;
+
+	if (name[0] && start != EmMemNULL && end > pc && start <= pc)
+	{
+		hotSpot.fStart	= start;
+		hotSpot.fName	= name;
+		return;
+	}
+
+	const EmPalmHeap*	heap = EmPalmHeap::GetHeapByPtr (pc);
+	const EmPalmChunk*	chunk = heap ? heap->GetChunkBodyContaining (pc) : NULL;
+
+	if (chunk)
+	{
+		sprintf (name, "<code chunk 0x%08lX>", (unsigned long) chunk->BodyStart ());
+
+		hotSpot.fStart	= chunk->BodyStart ();
+		hotSpot.fName	= name;
+		end				= chunk->BodyEnd ();
+		return;
+	}
+
+	start = pc & ~(kUnnamedBlockSize - 1);
+
+	sprintf (name, "<unnamed code 0x%08lX>", (unsigned long) start);
+
+	hotSpot.fStart	= start;
+	hotSpot.fName	= name;
+	end				= start + kUnnamedBlockSize;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvByPC
+// ---------------------------------------------------------------------------
+
+bool PrvByPC (const EmPCCount& a, const EmPCCount& b)
+{
+	return a.fPC < b.fPC;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvByHandlerCount
+// ---------------------------------------------------------------------------
+
+bool PrvByHandlerCount (const EmHandlerCountMap::value_type* a, const EmHandlerCountMap::value_type* b)
+{
+	return a->second.fCount > b->second.fCount;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvByHotSpotCount
+// ---------------------------------------------------------------------------
+
+bool PrvByHotSpotCount (const EmHotSpot& a, const EmHotSpot& b)
+{
+	return a.fCount > b.fCount;
+}
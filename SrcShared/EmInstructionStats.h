@@ -0,0 +1,57 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2000-2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmInstructionStats_h
+#define EmInstructionStats_h
+
+class EmFileRef;
+
+/*
+	EmInstructionStats counts the instructions executed by the emulated
+	CPU: how many times each opcode ran (the "instruction mix"), and how
+	many times each PC was reached (the "hot spots").
+
+	While it's on, the CPU loop calls Count before every instruction it
+	executes (see EmCPU68K::SetCountInstructions).  That slows emulation
+	down noticeably, but nothing else is affected; when it's off, it
+	costs nothing.  Instructions executed while Poser is calling into
+	the ROM on its own behalf are not counted.
+
+	The report written by Dump has two sections.  The instruction mix is
+	grouped by opcode handler, since many opcodes share a handler in the
+	UAE tables; these are the candidates for faster handlers.  The hot
+	spots are grouped by function, named after their MacsBug symbols.
+	PCs in code without symbols are grouped by the heap chunk (that is,
+	the code resource) they're in.
+
+	PCs are kept in a fixed-size hash table.  If a program reaches more
+	distinct PCs than it holds, the rest are counted as "other".
+*/
+
+class EmInstructionStats
+{
+	public:
+		static void 			Dispose 			(void);
+
+		static void 			Start				(void);
+		static void 			Stop				(void);
+		static Bool 			IsOn				(void);
+		static void 			Clear				(void);
+
+		static void 			Count				(emuptr pc, uint16 opcode);
+
+		static void 			Dump				(const EmFileRef&);
+		static EmFileRef		GetDumpFile 		(void);
+};
+
+#endif	// EmInstructionStats_h
@@ -758,10 +758,15 @@ void EmMinimize::SaveMinimalEvents (void)
 
 	while (oldEventChunkFile.ReadChunk (index, tag, chunk))
 	{
-		// Copy all chunks except the previous (pre-minimized) event set. 
-		// We'll be adding the minimized event set to the file later.
-
-		if (tag != /*SessionFile::kGremlinHistory*/ 'hist')
+		// Copy all chunks except the previous (pre-minimized) event set,
+		// in either its old or its block format, and the host I/O journal
+		// that goes with it.  We'll be adding the minimized event set and
+		// journal to the file later, and ChunkFile finds the first chunk
+		// with a given tag, so a stale copy would win.
+
+		if (tag != SessionFile::kGremlinHistory &&
+			tag != SessionFile::kGremlinBlocks &&
+			tag != SessionFile::kIOJournal)
 		{
 			newEventChunkFile.WriteChunk (tag, chunk);
 		}
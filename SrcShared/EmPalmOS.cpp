@@ -29,6 +29,7 @@
 #include "EmPalmStructs.h"		// EmAliasCardHeaderType
 #include "EmPatchMgr.h"			// EmPatchMgr
 #include "EmPatchState.h"		// EmPatchState
+#include "EmTrapStats.h"		// EmTrapStats::EnterTrap
 #include "EmSession.h"			// gSession->Reset
 #include "ErrorHandling.h"		// Errors::ReportInvalidPC
 #include "Logging.h"			// LogSystemCalls
@@ -109,9 +110,18 @@ void EmPalmOS::Initialize (void)
 	gPrefs->AddNotification (&EmPalmOS::PrefsChanged, kPrefKeyReportStrictIntlChecks);
 	gPrefs->AddNotification (&EmPalmOS::PrefsChanged, kPrefKeyReportOverlayErrors);
 
+	// Pick the opcode handlers according to CheckStackPointer, and
+	// switch them whenever it changes.
+
+	gPrefs->AddNotification (&EmPalmOS::PrefsChanged, kPrefKeyCheckStackPointer);
+
+	Preference<bool>	checkStack (kPrefKeyCheckStackPointer);
+	gCPU68K->SetCheckStackPointer (*checkStack);
+
 	Hordes::Initialize ();
 	EmEventPlayback::Initialize ();
 	EmPatchMgr::Initialize ();
+	EmTrapStats::Initialize ();
 	Platform_NetLib::Initialize ();
 	EmPalmHeap::Initialize ();
 	EmLowMem::Initialize ();
@@ -149,6 +159,7 @@ void EmPalmOS::Reset (void)
 	Hordes::Reset ();
 	EmEventPlayback::Reset ();
 	EmPatchMgr::Reset ();
+	EmTrapStats::Reset ();
 	Platform_NetLib::Reset ();
 	EmPalmHeap::Reset ();
 	EmLowMem::Reset ();
@@ -238,6 +249,7 @@ void EmPalmOS::Load (SessionFile& f)
 	Hordes::Load (f);
 	EmEventPlayback::Load (f);
 	EmPatchMgr::Load (f);
+	EmTrapStats::Reset ();
 	Platform_NetLib::Load (f);
 	EmPalmHeap::Load (f);
 	EmLowMem::Load (f);
@@ -294,6 +306,7 @@ void EmPalmOS::Dispose (void)
 	EmLowMem::Dispose ();
 	EmPalmHeap::Dispose ();
 	Platform_NetLib::Dispose ();
+	EmTrapStats::Dispose ();
 	EmPatchMgr::Dispose ();
 	EmEventPlayback::Dispose ();
 	Hordes::Dispose ();
@@ -933,6 +946,12 @@ void EmPalmOS::GenerateStackCrawl (EmStackFrameList& frameList)
 
 static void PrvRespondToPrefsChange (PrefKeyType prefKey)
 {
+	if (::PrefKeysEqual (prefKey, kPrefKeyCheckStackPointer))
+	{
+		Preference<Bool> pref (kPrefKeyCheckStackPointer, false);
+		gCPU68K->SetCheckStackPointer (*pref);
+	}
+
 	if (EmPatchState::UIInitialized ())
 	{
 		if (::PrefKeysEqual (prefKey, kPrefKeyReportStrictIntlChecks) && EmPatchMgr::IntlMgrAvailable ())
@@ -1643,6 +1662,16 @@ Bool EmPalmOS::HandleSystemCall (Bool fromTrap)
 #endif
 
 
+	// ======================================================================
+	//	Count the call, and start timing it if asked to.
+	// ======================================================================
+
+	if (!gSession->IsNested ())
+	{
+		EmTrapStats::EnterTrap (context);
+	}
+
+
 	// ======================================================================
 	// If this trap is patched, let the patch handler handle the patch.
 	// ======================================================================
@@ -1657,6 +1686,11 @@ Bool EmPalmOS::HandleSystemCall (Bool fromTrap)
 	
 	if (result == kSkipROM)
 	{
+		if (!gSession->IsNested ())
+		{
+			EmTrapStats::SkipTrap (context);
+		}
+
 #if HAS_PROFILING
 		if (gProfilingEnabled)
 		{
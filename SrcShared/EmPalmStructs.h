@@ -248,6 +248,19 @@
 		assignments, and an additional 12 bytes to call the proxy class's
 		constructor.
 
+		Reading a struct in emulated memory through an Alias<PAS> goes
+		through the memory banks once per field.  When many fields are
+		needed, it's cheaper to take a snapshot: create a Proxy, call
+		Fetch to fill it in with one bulk read, and read the fields from
+		the local copy.  Fetch is a "meta" access, made with access checks
+		turned off, the same as reading under CEnableFullAccess.  Call
+		Store to write a modified snapshot back.
+
+			EmProxyEventType	event;
+			event.Fetch (eventP);
+
+			if (event.eType == keyDownEvent) ...
+
 	LIMITATIONS:
 
 	*	Can't take the adress of an EmFoo.  Will get *its* address
@@ -657,6 +670,9 @@ class PAS
 			EmAlias##type<LAS>	operator[] (int);									\
 			const EmAlias##type<LAS>	operator[] (int) const;						\
 																					\
+			void				Fetch	(emuptr);									\
+			void				Store	(emuptr) const;								\
+																					\
 		private:																	\
 			struct {																\
 				char			_bytes[size];										\
@@ -750,6 +766,16 @@ class PAS
 	INLINE_ const EmAlias##type<LAS> EmProxy##type::operator [] (int index) const	\
 	{																				\
 		return EmAlias##type<LAS> ((ptr_type) (((char*) this->GetPtr ()) + index * this->GetSize ()));	\
+	}																			\
+																					\
+	INLINE_ void EmProxy##type::Fetch (emuptr p)									\
+	{																			\
+		EmMem_GetBlock (this->GetPtr (), p, this->GetSize ());						\
+	}																			\
+																					\
+	INLINE_ void EmProxy##type::Store (emuptr p) const								\
+	{																			\
+		EmMem_memcpy (p, (const void*) this->GetPtr (), this->GetSize ());			\
 	}
 
 #define DEFINE_STRUCT_CLASSES(type, size, FOR_EACH_FIELD)							\
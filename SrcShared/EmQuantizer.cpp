@@ -95,6 +95,34 @@ Bool EmQuantizer::ProcessImage (const EmPixMap& pixMap)
 			break;
 		}
 
+		case kPixMapFormat16RGB565:
+		{
+			pbBits = (uint8*) pixMap.GetBits ();
+			for (i = 0; i < size.fY; ++i)
+			{
+				for (j = 0; j < size.fX; ++j)
+				{
+					uint16	pixel = *(uint16*) pbBits;
+					pbBits += 2;
+
+					r = ((pixel >> 8) & 0xF8) | ((pixel >> 13) & 0x07);
+					g = ((pixel >> 3) & 0xFC) | ((pixel >>  9) & 0x03);
+					b = ((pixel << 3) & 0xF8) | ((pixel >>  2) & 0x07);
+
+					this->AddColor (&m_pTree, r, g, b, m_nColorBits, 0, &m_nLeafCount,
+						m_pReducibleNodes);
+
+					while (m_nLeafCount > m_nMaxColors)
+					{
+						this->ReduceTree (m_nColorBits, &m_nLeafCount, m_pReducibleNodes);
+					}
+				}
+
+				pbBits += nPad;
+			}
+			break;
+		}
+
 		case kPixMapFormat24RGB:
 		{
 			pbBits = (uint8*) pixMap.GetBits ();
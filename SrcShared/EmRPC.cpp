@@ -108,57 +108,72 @@ void RPC::Shutdown (void)
 
 void RPC::Idle (void)
 {
-	omni_mutex_lock	lock (gMutex);
-
-	uint32	now = Platform::GetMilliseconds ();
+	// Pull out the packets that have timed out, and reply to them after
+	// letting go of gMutex.  Sockets are serviced on their own thread, and
+	// a failed send leads to a disconnect notification that needs the
+	// mutex in order to clean up.
 
-	SLPTimeoutList::iterator	iter = gSLPTimeouts.begin ();
+	SLPTimeoutList	expired;
 
-	while (iter != gSLPTimeouts.end ())
 	{
-		SLP&	slp		= iter->fSLP;
-		uint32	start	= iter->fStart;
-		uint32	timeout	= iter->fTimeout;
+		omni_mutex_lock	lock (gMutex);
+
+		uint32	now = Platform::GetMilliseconds ();
 
-		if (now - start > timeout)
+		SLPTimeoutList::iterator	iter = gSLPTimeouts.begin ();
+
+		while (iter != gSLPTimeouts.end ())
 		{
-			PRINTF ("RPC::Idle: Timing out.");
+			if (now - iter->fStart > iter->fTimeout)
+			{
+				expired.push_back (*iter);
+				iter = gSLPTimeouts.erase (iter);
+				continue;
+			}
 
-			EmAssert (slp.HavePacket ());
+			++iter;
+		}
+	}
 
-			slp.DeferReply (false);
+	SLPTimeoutList::iterator	iter = expired.begin ();
 
-			EmProxySysPktBodyType&	response = slp.Body ();
-			if (response.command == sysPktRPCCmd)
-			{
-				EmAliasSysPktRPCType<LAS>	response (slp.Body().GetPtr());
+	while (iter != expired.end ())
+	{
+		SLP&	slp		= iter->fSLP;
 
-				response.command			= sysPktRPCRsp;
-				response._filler			= 0;
+		PRINTF ("RPC::Idle: Timing out.");
 
-				response.resultD0			= (UInt32) hostErrTimeout;
-				response.resultA0			= 0;
-			}
-			else
-			{
-				EmAliasSysPktRPC2Type<LAS>	response (slp.Body().GetPtr());
+		EmAssert (slp.HavePacket ());
 
-				response.command			= sysPktRPC2Rsp;
-				response._filler			= 0;
+		slp.DeferReply (false);
 
-				response.resultD0			= (UInt32) hostErrTimeout;
-				response.resultA0			= 0;
-				response.resultException	= 0;
-			}
+		EmProxySysPktBodyType&	response = slp.Body ();
+		if (response.command == sysPktRPCCmd)
+		{
+			EmAliasSysPktRPCType<LAS>	response (slp.Body().GetPtr());
 
-			long	bodySize = slp.GetPacketSize () - (slp.Header().GetSize() + slp.Footer().GetSize());
+			response.command			= sysPktRPCRsp;
+			response._filler			= 0;
 
-			slp.SendPacket (response.GetPtr (), bodySize);
+			response.resultD0			= (UInt32) hostErrTimeout;
+			response.resultA0			= 0;
+		}
+		else
+		{
+			EmAliasSysPktRPC2Type<LAS>	response (slp.Body().GetPtr());
 
-			iter = gSLPTimeouts.erase (iter);
-			continue;
+			response.command			= sysPktRPC2Rsp;
+			response._filler			= 0;
+
+			response.resultD0			= (UInt32) hostErrTimeout;
+			response.resultA0			= 0;
+			response.resultException	= 0;
 		}
 
+		long	bodySize = slp.GetPacketSize () - (slp.Header().GetSize() + slp.Footer().GetSize());
+
+		slp.SendPacket (response.GetPtr (), bodySize);
+
 		++iter;
 	}
 }
@@ -178,14 +193,22 @@ void RPC::Idle (void)
 
 void RPC::SignalWaiters (HostSignalType signal)
 {
-	omni_mutex_lock	lock (gMutex);
-
 	PRINTF ("RPC::SignalWaiters: Entering");
 
+	// Take over the list of waiters and reply to them after letting go
+	// of gMutex (see RPC::Idle).
+
+	SLPTimeoutList	waiters;
+
+	{
+		omni_mutex_lock	lock (gMutex);
+		waiters.swap (gSLPTimeouts);
+	}
+
 	Bool						signalledOne = false;
-	SLPTimeoutList::iterator	iter = gSLPTimeouts.begin ();
+	SLPTimeoutList::iterator	iter = waiters.begin ();
 
-	while (iter != gSLPTimeouts.end ())
+	while (iter != waiters.end ())
 	{
 		PRINTF ("RPC::SignalWaiters: Signaling");
 
@@ -241,8 +264,6 @@ void RPC::SignalWaiters (HostSignalType signal)
 		++iter;
 	}
 
-	gSLPTimeouts.clear ();
-
 	// gSession may be NULL if we're signally a hostSignalQuit.
 
 	if (signalledOne && gSession)
@@ -300,6 +321,10 @@ ErrCode RPC::HandleNewPacket (SLP& slp)
 				result = SystemPacket::RPC2 (slp);
 				break;
 
+			case sysPktRPCBatchCmd:
+				result = SystemPacket::RPCBatch (slp);
+				break;
+
 			default:
 				break;
 		}
@@ -354,6 +379,16 @@ void RPC::DeferCurrentPacket (long timeout)
 
 	EmAssert (gCurrentPacket);
 
+	// A batch can't be replied to from RPC::Idle or RPC::SignalWaiters,
+	// which only know how to build RPC and RPC2 responses.  Let
+	// HostSignalWait return immediately instead.
+
+	if (gCurrentPacket->Body ().command == sysPktRPCBatchCmd)
+	{
+		PRINTF ("RPC::DeferCurrentPacket: Not deferring batch packet");
+		return;
+	}
+
 	gCurrentPacket->DeferReply (true);
 	gSLPTimeouts.push_back (SLPTimeout (*gCurrentPacket, timeout));
 
@@ -398,6 +433,8 @@ void RPC::EventCallback (CSocket* s, int event)
 			// A socket just disconnected.  If we had anything on that
 			// socket waiting for us to signal it, forget about it.
 
+			omni_mutex_lock	lock (gMutex);
+
 			SLPTimeoutList::iterator	iter = gSLPTimeouts.begin ();
 
 			while (iter != gSLPTimeouts.end ())
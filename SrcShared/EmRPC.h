@@ -23,6 +23,8 @@ class CSocket;
 #define slkSocketRPC			(slkSocketFirstDynamic + 10)
 #define sysPktRPC2Cmd			0x70
 #define sysPktRPC2Rsp			0xF0
+#define sysPktRPCBatchCmd		0x71
+#define sysPktRPCBatchRsp		0xF1
 
 class RPC
 {
@@ -17,6 +17,7 @@
 #include "EmHAL.h"				// EmHAL:: GetLCDBeginEnd
 #include "EmMemory.h"			// CEnableFullAccess
 #include "MetaMemory.h"			// MetaMemory::MarkScreen
+#include "Platform.h"			// Platform::GetMilliseconds
 
 
 static emuptr	gScreenDirtyLow;
@@ -25,6 +26,80 @@ static emuptr	gScreenDirtyHigh;
 static emuptr	gScreenBegin;
 static emuptr	gScreenEnd;
 
+// In addition to the low/high water marks, writes are recorded in a
+// bitmap with one bit per band of (1 << gScreenBandShift) bytes of the
+// frame buffer.  GetBits uses it to fetch and paint only the runs of
+// scanlines that actually changed, rather than everything between the
+// water marks.  Writes outside of the buffer as last seen by
+// InvalidateAll (possible while the LCD is being reprogrammed) fall back
+// to the single-span behavior.
+
+const int		kMaxScreenBands		= 2048;
+const int		kMinScreenBandShift	= 4;
+const int		kMaxScreenSpans		= 8;	// More runs than this: fetch it all
+const int		kScreenSpanGap		= 4;	// Merge runs closer than this
+
+static uint32	gScreenDirtyBands[kMaxScreenBands / 32];
+static int		gScreenBandShift;
+static uint32	gScreenBandLimit;			// Bytes covered by the bitmap
+static Bool		gScreenDirtyUntracked;
+
+static void		PrvSetBandGeometry		(emuptr begin, emuptr end);
+static void		PrvClearBands			(void);
+static int		PrvCollectSpans			(emuptr low, emuptr high,
+										 emuptr* spanLow, emuptr* spanHigh);
+
+// Frame publishing.  Three EmScreenFrames form a triple buffer.  The CPU
+// thread fills in gFrames[gBackFrame] and then swaps it with the "middle"
+// frame, marking it fresh.  The UI thread swaps the middle frame with
+// gFrames[gFrontFrame] when it finds the fresh bit set.  Neither thread
+// ever waits on the other, and the UI always gets the newest frame.
+//
+// Each frame holds a complete image.  The CPU thread keeps a running copy
+// of the LCD in gFrameShadow and, before publishing a frame, copies into
+// it just the lines that have changed since that frame was last filled.
+
+const uint32	kFramePeriod		= 16;	// Milliseconds; about 60 Hz
+const int		kFrameIndexMask		= 0x03;
+const int		kFrameFresh			= 0x04;
+
+static Bool					gPublishing;
+static EmScreenFrame		gFrames[3];
+static int					gBackFrame;		// CPU thread only
+static int					gFrontFrame;	// UI thread only
+static volatile int			gMiddleFrame;	// Index | kFrameFresh
+static volatile Bool		gFullFrameRequested;
+
+// The rest are used by the CPU thread only.
+
+static EmScreenUpdateInfo	gFrameShadow;
+static EmRegion				gFrameStale[3];	// Lines changed since each was filled
+static EmRegion				gFramePending;	// Lines changed that the UI hasn't seen
+static uint32				gFrameLastTime;
+static Bool					gFrameLastLCDOn;
+static Bool					gFrameLastBacklightOn;
+static uint16				gFrameLastLEDState;
+
+#if defined (__GNUC__)
+	#define PrvMemoryBarrier()			__sync_synchronize ()
+	#define PrvFrameExchange(p, v)		__sync_lock_test_and_set (p, v)
+#else
+	static omni_mutex	gFrameMutex;
+	#define PrvMemoryBarrier()			do { gFrameMutex.lock (); gFrameMutex.unlock (); } while (0)
+
+	static int PrvFrameExchange (volatile int* p, int v)
+	{
+		omni_mutex_lock	lock (gFrameMutex);
+		int	old = *p;
+		*p = v;
+		return old;
+	}
+#endif
+
+static void		PrvResetFrames			(void);
+static void		PrvCopyStaleLines		(EmPixMap& dest, const EmPixMap& src,
+										 const EmRegion& stale);
+
 
 /***********************************************************************
  *
@@ -48,6 +123,10 @@ void EmScreen::Initialize (void)
 
 	gScreenBegin		= EmMemNULL;
 	gScreenEnd			= EmMemNULL;
+
+	::PrvSetBandGeometry (gScreenBegin, gScreenEnd);
+
+	::PrvResetFrames ();
 }
 
 
@@ -75,6 +154,10 @@ void EmScreen::Reset (void)
 
 	gScreenBegin		= EmMemNULL;
 	gScreenEnd			= EmMemNULL;
+
+	::PrvSetBandGeometry (gScreenBegin, gScreenEnd);
+
+	gScreenDirtyUntracked	= true;
 }
 
 
@@ -115,6 +198,10 @@ void EmScreen::Load (SessionFile&)
 	gScreenDirtyHigh	= EmMemEOM;
 
 	EmHAL::GetLCDBeginEnd (gScreenBegin, gScreenEnd);
+
+	::PrvSetBandGeometry (gScreenBegin, gScreenEnd);
+
+	gScreenDirtyUntracked	= true;
 }
 
 
@@ -179,6 +266,32 @@ void EmScreen::MarkDirty (emuptr address, uint32 size)
 	{
 		gScreenDirtyHigh = address + size;
 	}
+
+	// Record the bands touched.  The unsigned compare also catches
+	// addresses below gScreenBegin.
+
+	uint32	offset = address - gScreenBegin;
+
+	if (offset < gScreenBandLimit && size > 0)
+	{
+		uint32	band		= offset >> gScreenBandShift;
+		uint32	lastBand	= (offset + size - 1) >> gScreenBandShift;
+
+		if (lastBand >= (uint32) kMaxScreenBands)
+		{
+			lastBand = kMaxScreenBands - 1;
+		}
+
+		do
+		{
+			gScreenDirtyBands[band >> 5] |= 1UL << (band & 31);
+		}
+		while (++band <= lastBand);
+	}
+	else
+	{
+		gScreenDirtyUntracked = true;
+	}
 }
 
 
@@ -211,7 +324,13 @@ void EmScreen::InvalidateAll (void)
 		gScreenEnd		= newScreenEnd;
 
 		MetaMemory::MarkScreen (gScreenBegin, gScreenEnd);
+
+		::PrvSetBandGeometry (gScreenBegin, gScreenEnd);
 	}
+
+	// Everything is dirty, not just the bands written to so far.
+
+	gScreenDirtyUntracked	= true;
 }
 
 
@@ -250,8 +369,28 @@ Bool EmScreen::GetBits (EmScreenUpdateInfo& info)
 	// screen.  From this information, we can determine the first and
 	// last affected scanlines.
 
-	info.fScreenLow		= max (gScreenDirtyLow, screenBegin);
-	info.fScreenHigh	= min (gScreenDirtyHigh, screenEnd);
+	emuptr	screenLow	= max (gScreenDirtyLow, screenBegin);
+	emuptr	screenHigh	= min (gScreenDirtyHigh, screenEnd);
+
+	// Break that range up into the runs of bands that were actually
+	// written to.  If we can't trust the bitmap (the screen moved, or
+	// something was written outside of it), use the whole range.
+
+	emuptr	spanLow[kMaxScreenSpans];
+	emuptr	spanHigh[kMaxScreenSpans];
+	int		numSpans = 0;
+
+	if (!gScreenDirtyUntracked && screenBegin == gScreenBegin && screenEnd == gScreenEnd)
+	{
+		numSpans = ::PrvCollectSpans (screenLow, screenHigh, spanLow, spanHigh);
+	}
+
+	if (numSpans == 0)
+	{
+		spanLow[0]	= screenLow;
+		spanHigh[0]	= screenHigh;
+		numSpans	= 1;
+	}
 
 	// Reset gScreenDirtyLow/High with sentinel values so that they can
 	// be munged again by EmScreen::MarkDirty.
@@ -259,6 +398,12 @@ Bool EmScreen::GetBits (EmScreenUpdateInfo& info)
 	gScreenDirtyLow		= EmMemEOM;
 	gScreenDirtyHigh	= EmMemNULL;
 
+	::PrvClearBands ();
+
+	info.fScreenLow		= screenLow;
+	info.fScreenHigh	= screenHigh;
+	info.fDirtyRegion.BeEmpty ();
+
 	// If no lines need to be updated, we can return now.
 
 	if (info.fScreenLow >= info.fScreenHigh)
@@ -274,8 +419,550 @@ Bool EmScreen::GetBits (EmScreenUpdateInfo& info)
 	{
 		CEnableFullAccess	munge;	// Remove blocks on memory access.
 
-		EmHAL::GetLCDScanlines (info);
+		long	firstLine	= 0;
+		long	lastLine	= 0;
+
+		for (int ii = 0; ii < numSpans; ++ii)
+		{
+			info.fScreenLow		= spanLow[ii];
+			info.fScreenHigh	= spanHigh[ii];
+
+			EmHAL::GetLCDScanlines (info);
+
+			if (ii == 0 || info.fFirstLine < firstLine)
+				firstLine = info.fFirstLine;
+
+			if (ii == 0 || info.fLastLine > lastLine)
+				lastLine = info.fLastLine;
+
+			EmRect	band (0, info.fFirstLine, info.fImage.GetSize ().fX, info.fLastLine);
+			info.fDirtyRegion.UnionWith (EmRegion (band));
+		}
+
+		info.fFirstLine		= firstLine;
+		info.fLastLine		= lastLine;
+		info.fScreenLow		= screenLow;
+		info.fScreenHigh	= screenHigh;
+	}
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::GetAllBits
+ *
+ * DESCRIPTION: Like GetBits, but always fetches the entire LCD and
+ *				leaves the dirty state alone, so that it can be used to
+ *				take a picture of the screen without upsetting whoever
+ *				is drawing it.
+ *
+ * PARAMETERS:	info - receives the LCD contents.
+ *
+ * RETURNED:	True if info.fImage was filled in.  False if the LCD is
+ *				off or has no frame buffer.
+ *
+ ***********************************************************************/
+
+Bool EmScreen::GetAllBits (EmScreenUpdateInfo& info)
+{
+	info.fLCDOn			= EmHAL::GetLCDScreenOn ();
+
+	emuptr screenBegin;
+	emuptr screenEnd;
+	EmHAL::GetLCDBeginEnd (screenBegin, screenEnd);
+
+	info.fScreenLow		= screenBegin;
+	info.fScreenHigh	= screenEnd;
+	info.fDirtyRegion.BeEmpty ();
+
+	if (!info.fLCDOn || info.fScreenLow >= info.fScreenHigh)
+	{
+		return false;
 	}
 
+	CEnableFullAccess	munge;	// Remove blocks on memory access.
+
+	EmHAL::GetLCDScanlines (info);
+
+	EmRect	bounds (0, info.fFirstLine, info.fImage.GetSize ().fX, info.fLastLine);
+	info.fDirtyRegion.UnionWith (EmRegion (bounds));
+
 	return true;
 }
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvSetBandGeometry
+ *
+ * DESCRIPTION: Size the dirty band bitmap for a new frame buffer.  The
+ *				band size is the smallest power of two that lets the
+ *				buffer fit in kMaxScreenBands bands.
+ *
+ * PARAMETERS:	begin, end - range of the frame buffer.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvSetBandGeometry (emuptr begin, emuptr end)
+{
+	gScreenBandLimit	= end > begin ? end - begin : 0;
+	gScreenBandShift	= kMinScreenBandShift;
+
+	while ((gScreenBandLimit >> gScreenBandShift) >= (uint32) kMaxScreenBands)
+	{
+		++gScreenBandShift;
+	}
+
+	::PrvClearBands ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvClearBands
+ *
+ * DESCRIPTION: Mark every band clean again.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvClearBands (void)
+{
+	memset (gScreenDirtyBands, 0, sizeof (gScreenDirtyBands));
+
+	gScreenDirtyUntracked = false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvCollectSpans
+ *
+ * DESCRIPTION: Turn the dirty bands between low and high into a list
+ *				of address ranges.  Runs separated by only a few clean
+ *				bands are merged, since fetching and painting a
+ *				scanline or two extra is cheaper than another pass.
+ *
+ * PARAMETERS:	low, high - range of memory to scan, already clipped to
+ *					the frame buffer.
+ *
+ *				spanLow, spanHigh - receive the ranges; room for
+ *					kMaxScreenSpans of them.
+ *
+ * RETURNED:	Number of ranges found, or zero if there were too many
+ *				(or none), in which case the caller should use low and
+ *				high as is.
+ *
+ ***********************************************************************/
+
+int PrvCollectSpans (emuptr low, emuptr high, emuptr* spanLow, emuptr* spanHigh)
+{
+	if (low >= high || gScreenBandLimit == 0)
+		return 0;
+
+	uint32	firstBand	= (low - gScreenBegin) >> gScreenBandShift;
+	uint32	lastBand	= (high - 1 - gScreenBegin) >> gScreenBandShift;
+	int		numSpans	= 0;
+	uint32	runStart	= 0;
+	uint32	runEnd		= 0;	// One past the last dirty band of the run
+	Bool	inRun		= false;
+
+	for (uint32 band = firstBand; band <= lastBand; ++band)
+	{
+		uint32	word = gScreenDirtyBands[band >> 5];
+
+		// Skip over clean words a word at a time.
+
+		if (word == 0 && (band & 31) == 0 && band + 31 <= lastBand)
+		{
+			band += 31;
+			continue;
+		}
+
+		if ((word & (1UL << (band & 31))) == 0)
+			continue;
+
+		if (inRun && band - runEnd < (uint32) kScreenSpanGap)
+		{
+			runEnd = band + 1;
+			continue;
+		}
+
+		if (inRun)
+		{
+			if (numSpans == kMaxScreenSpans)
+				return 0;
+
+			spanLow[numSpans]	= gScreenBegin + (runStart << gScreenBandShift);
+			spanHigh[numSpans]	= gScreenBegin + (runEnd << gScreenBandShift);
+			++numSpans;
+		}
+
+		runStart	= band;
+		runEnd		= band + 1;
+		inRun		= true;
+	}
+
+	if (inRun)
+	{
+		if (numSpans == kMaxScreenSpans)
+			return 0;
+
+		spanLow[numSpans]	= gScreenBegin + (runStart << gScreenBandShift);
+		spanHigh[numSpans]	= gScreenBegin + (runEnd << gScreenBandShift);
+		++numSpans;
+	}
+
+	// Clip the outer ends to the requested range.
+
+	for (int ii = 0; ii < numSpans; ++ii)
+	{
+		spanLow[ii]		= max (spanLow[ii], low);
+		spanHigh[ii]	= min (spanHigh[ii], high);
+	}
+
+	return numSpans;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::StartPublishing
+ *
+ * DESCRIPTION: Have the CPU thread publish frames for the UI from now
+ *				on.  Call before the CPU thread is started.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmScreen::StartPublishing (void)
+{
+	::PrvResetFrames ();
+
+	gPublishing = true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::StopPublishing
+ *
+ * DESCRIPTION: Go back to having the UI thread fetch the LCD itself.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmScreen::StopPublishing (void)
+{
+	gPublishing = false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::IsPublishing
+ *
+ * DESCRIPTION: Return whether or not the CPU thread publishes frames.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	True if so.
+ *
+ ***********************************************************************/
+
+Bool EmScreen::IsPublishing (void)
+{
+	return gPublishing;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::PublishFrame
+ *
+ * DESCRIPTION: Called periodically on the CPU thread.  If a frame
+ *				period has gone by and anything about the LCD changed,
+ *				fetch the changed lines, bring the back frame up to
+ *				date, and make it the newest frame for the UI.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmScreen::PublishFrame (void)
+{
+	if (!gPublishing)
+		return;
+
+	uint32	now = Platform::GetMilliseconds ();
+
+	if (now - gFrameLastTime < kFramePeriod)
+		return;
+
+	gFrameLastTime = now;
+
+	if (gFullFrameRequested)
+	{
+		gFullFrameRequested = false;
+		EmScreen::InvalidateAll ();
+	}
+
+	// Fetch the changed lines into our running copy of the LCD.
+
+	EmPoint			oldSize		= gFrameShadow.fImage.GetSize ();
+	EmPixMapFormat	oldFormat	= gFrameShadow.fImage.GetFormat ();
+
+	Bool	bufferDirty	= EmScreen::GetBits (gFrameShadow);
+	Bool	lcdOn		= gFrameShadow.fLCDOn;
+	Bool	backlightOn	= EmHAL::GetLCDBacklightOn ();
+	uint16	ledState	= EmHAL::GetLEDState ();
+
+	if (!bufferDirty &&
+		lcdOn == gFrameLastLCDOn &&
+		backlightOn == gFrameLastBacklightOn &&
+		ledState == gFrameLastLEDState)
+	{
+		return;
+	}
+
+	gFrameLastLCDOn			= lcdOn;
+	gFrameLastBacklightOn	= backlightOn;
+	gFrameLastLEDState		= ledState;
+
+	// If the image was reallocated, only the lines we just fetched are
+	// any good.  Pick up the rest next time around.
+
+	if (gFrameShadow.fImage.GetSize () != oldSize ||
+		gFrameShadow.fImage.GetFormat () != oldFormat)
+	{
+		gFullFrameRequested = true;
+	}
+
+	EmRegion	damage;
+
+	if (bufferDirty && lcdOn)
+	{
+		damage = gFrameShadow.fDirtyRegion;
+	}
+
+	for (int ii = 0; ii < 3; ++ii)
+	{
+		gFrameStale[ii].UnionWith (damage);
+	}
+
+	// If the UI took the last frame we published, it's seen everything
+	// up to now.  Otherwise, this frame also has to carry the changes in
+	// the frames it skipped.
+
+	if ((gMiddleFrame & kFrameFresh) == 0)
+	{
+		gFramePending = damage;
+	}
+	else
+	{
+		gFramePending.UnionWith (damage);
+	}
+
+	// Fill in the back frame.  Its dirty region is built from scratch so
+	// that it shares nothing with the regions we hang on to.
+
+	EmScreenFrame&	frame = gFrames[gBackFrame];
+
+	::PrvCopyStaleLines (frame.fInfo.fImage, gFrameShadow.fImage, gFrameStale[gBackFrame]);
+	gFrameStale[gBackFrame].BeEmpty ();
+
+	frame.fInfo.fDirtyRegion.BeEmpty ();
+
+	EmRegionRectIterator	iter (gFramePending);
+	EmRect					band;
+
+	while (iter.Next (band))
+	{
+		frame.fInfo.fDirtyRegion.UnionWith (EmRegion (band));
+	}
+
+	frame.fInfo.fFirstLine		= frame.fInfo.fDirtyRegion.Bounds ().fTop;
+	frame.fInfo.fLastLine		= frame.fInfo.fDirtyRegion.Bounds ().fBottom;
+	frame.fInfo.fLeftMargin		= gFrameShadow.fLeftMargin;
+	frame.fInfo.fLCDOn			= lcdOn;
+	frame.fInfo.fScreenLow		= gFrameShadow.fScreenLow;
+	frame.fInfo.fScreenHigh		= gFrameShadow.fScreenHigh;
+
+	frame.fBufferDirty			= !frame.fInfo.fDirtyRegion.IsEmpty ();
+	frame.fBacklightOn			= backlightOn;
+	frame.fLCDHasFrame			= lcdOn && EmHAL::GetLCDHasFrame ();
+	frame.fLEDState				= ledState;
+
+	// Publish it, and take back whatever was in the middle.
+
+	PrvMemoryBarrier ();
+
+	int	old = PrvFrameExchange (&gMiddleFrame, gBackFrame | kFrameFresh);
+
+	gBackFrame = old & kFrameIndexMask;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::TakeFrame
+ *
+ * DESCRIPTION: Called on the UI thread to get the newest frame
+ *				published by the CPU thread.  The frame belongs to the
+ *				caller until the next call to TakeFrame.
+ *
+ * PARAMETERS:	isNew - set to true if a frame was published since the
+ *					last call; false if the previous frame is returned
+ *					again.
+ *
+ * RETURNED:	The frame.  Its image is empty if nothing has been
+ *				published yet.
+ *
+ ***********************************************************************/
+
+EmScreenFrame* EmScreen::TakeFrame (Bool& isNew)
+{
+	isNew = false;
+
+	if (gMiddleFrame & kFrameFresh)
+	{
+		int	old = PrvFrameExchange (&gMiddleFrame, gFrontFrame);
+
+		PrvMemoryBarrier ();
+
+		gFrontFrame	= old & kFrameIndexMask;
+		isNew		= true;
+	}
+
+	return &gFrames[gFrontFrame];
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreen::RequestFullFrame
+ *
+ * DESCRIPTION: Ask the CPU thread to fetch the entire LCD for the next
+ *				frame it publishes, as when something other than
+ *				PublishFrame consumed the dirty range.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmScreen::RequestFullFrame (void)
+{
+	gFullFrameRequested = true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvResetFrames
+ *
+ * DESCRIPTION: Put the frame buffers back into their initial state.
+ *				Called only while the CPU thread is not running.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvResetFrames (void)
+{
+	for (int ii = 0; ii < 3; ++ii)
+	{
+		gFrames[ii].fInfo.fImage			= EmPixMap ();
+		gFrames[ii].fInfo.fDirtyRegion.BeEmpty ();
+		gFrames[ii].fInfo.fLCDOn			= false;
+		gFrames[ii].fBufferDirty			= false;
+		gFrames[ii].fBacklightOn			= false;
+		gFrames[ii].fLCDHasFrame			= false;
+		gFrames[ii].fLEDState				= 0;
+
+		gFrameStale[ii].BeEmpty ();
+	}
+
+	gBackFrame				= 0;
+	gMiddleFrame			= 1;
+	gFrontFrame				= 2;
+	gFullFrameRequested		= true;
+
+	gFrameShadow.fImage		= EmPixMap ();
+	gFramePending.BeEmpty ();
+
+	gFrameLastTime			= 0;
+	gFrameLastLCDOn			= false;
+	gFrameLastBacklightOn	= false;
+	gFrameLastLEDState		= 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvCopyStaleLines
+ *
+ * DESCRIPTION: Bring a frame's image up to date with the running copy
+ *				of the LCD, copying only the given lines.  If the image
+ *				geometry changed, copy the whole thing.
+ *
+ * PARAMETERS:	dest - image to update.
+ *
+ *				src - current LCD image.
+ *
+ *				stale - lines of dest that are out of date.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvCopyStaleLines (EmPixMap& dest, const EmPixMap& src, const EmRegion& stale)
+{
+	EmPoint				size		= src.GetSize ();
+	EmPixMapRowBytes	rowBytes	= src.GetRowBytes ();
+
+	if (dest.GetSize () != size ||
+		dest.GetFormat () != src.GetFormat () ||
+		dest.GetRowBytes () != rowBytes)
+	{
+		dest = src;
+		return;
+	}
+
+	dest.SetColorTable (src.GetColorTable ());
+
+	uint8*					destBits	= (uint8*) dest.GetBits ();
+	const uint8*			srcBits		= (const uint8*) src.GetBits ();
+	EmRegionRectIterator	iter (stale);
+	EmRect					band;
+
+	while (iter.Next (band))
+	{
+		EmCoord	top		= max (band.fTop, (EmCoord) 0);
+		EmCoord	bottom	= min (band.fBottom, size.fY);
+
+		if (top < bottom)
+		{
+			memcpy (destBits + top * rowBytes, srcBits + top * rowBytes,
+				(bottom - top) * rowBytes);
+		}
+	}
+}
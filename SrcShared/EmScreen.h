@@ -15,6 +15,7 @@
 #define EmScreen_h
 
 #include "EmPixMap.h"			// EmPixMap
+#include "EmRegion.h"			// EmRegion
 
 class SessionFile;
 
@@ -29,6 +30,8 @@ class EmScreenUpdateInfo
 		EmPixMap	fImage;			// LCD image
 		long		fFirstLine;		// First changed scanline
 		long		fLastLine;		// Last changed scanline + 1
+		EmRegion	fDirtyRegion;	// Changed scanlines, as a set of bands
+									// between fFirstLine and fLastLine.
 		long		fLeftMargin;	// If LCD is scrlled by some sub-byte amount,
 									// this contains that amount.
 		Bool		fLCDOn;			// True if LCD is on at all
@@ -40,6 +43,22 @@ class EmScreenUpdateInfo
 		emuptr		fScreenHigh;	// Last dirty byte
 };
 
+class EmScreenFrame
+{
+	public:
+		// A complete LCD image and the hardware state that goes with it,
+		// handed from the CPU thread to the UI thread by
+		// EmScreen::PublishFrame and EmScreen::TakeFrame.
+		// fInfo.fDirtyRegion holds the scanlines that changed since the
+		// last frame the UI took.
+
+		EmScreenUpdateInfo	fInfo;
+		Bool		fBufferDirty;	// True if fInfo.fDirtyRegion is not empty
+		Bool		fBacklightOn;
+		Bool		fLCDHasFrame;
+		uint16		fLEDState;
+};
+
 class EmScreen
 {
 	public:
@@ -53,6 +72,20 @@ class EmScreen
 		static void 			InvalidateAll		(void);
 
 		static Bool 			GetBits 			(EmScreenUpdateInfo&);
+		static Bool 			GetAllBits			(EmScreenUpdateInfo&);
+
+		// Frame publishing.  When started, the CPU thread calls
+		// PublishFrame at regular intervals, and the UI thread picks up
+		// the results with TakeFrame instead of stopping the CPU to call
+		// GetBits itself.
+
+		static void 			StartPublishing		(void);
+		static void 			StopPublishing		(void);
+		static Bool 			IsPublishing		(void);
+
+		static void 			PublishFrame		(void);
+		static EmScreenFrame*	TakeFrame			(Bool& isNew);
+		static void 			RequestFullFrame	(void);
 };
 
 #endif	// EmScreen_h
@@ -0,0 +1,734 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2000-2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmScreenCapture.h"
+
+#include "EmFileRef.h"			// EmFileRef
+#include "EmLowMem.h"			// EmLowMem_GetGlobal
+#include "EmScreen.h"			// EmScreen::GetAllBits
+#include "ErrorHandling.h"		// Errors::ThrowIfStdCError
+#include "Hordes.h"				// Hordes::IsOn, GremlinNumber, EventCounter
+#include "Logging.h"			// LogAppendMsg
+#include "omnithread.h"			// omni_thread, omni_mutex, omni_condition
+
+#include <deque>
+#include <errno.h>				// errno
+#include <stdio.h>				// FILE, fopen
+#include <string.h>				// memcmp
+
+
+// Frames are taken every kRecordTickInterval Palm OS ticks (there are
+// 100 of those a second) while recording.  If the writer thread falls
+// more than kMaxPendingFrames behind, new frames are dropped rather than
+// letting the queue grow without bound.
+
+const uint32	kRecordTickInterval	= 5;
+const size_t	kMaxPendingFrames	= 32;
+
+struct EmCaptureJob
+{
+	enum Kind
+	{
+		kStill,
+		kFrame,
+		kClose
+	};
+
+	Kind		fKind;
+	FILE*		fFile;
+	EmPixMap	fImage;
+	uint32		fTicks;
+	int32		fGremlin;
+	int32		fEvent;
+};
+
+typedef deque<EmCaptureJob*>	EmCaptureJobList;
+
+static omni_mutex			gCaptureMutex;
+static omni_condition		gCaptureCondition (&gCaptureMutex);
+static EmCaptureJobList		gCaptureJobs;
+static omni_thread*			gCaptureThread;
+static Bool					gCaptureQuit;
+
+// Recording state; CPU thread only.
+
+static FILE*				gRecordFile;
+static uint32				gRecordLastTicks;
+static EmPixMap				gRecordLastImage;
+static long					gRecordDropped;
+
+// Writer thread only.
+
+static EmPoint				gStreamSize;
+
+static void		PrvStartThread		(void);
+static void		PrvStopThread		(void);
+static void*	PrvCaptureThread	(void*);
+static void		PrvQueueJob			(EmCaptureJob* job);
+static void		PrvFillJob			(EmCaptureJob* job, EmCaptureJob::Kind kind, FILE* f);
+static void		PrvWritePNG			(FILE* f, EmPixMap& image);
+static void		PrvWriteY4MFrame	(FILE* f, EmPixMap& image, const EmCaptureJob& job);
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreenCapture::Dispose
+ *
+ * DESCRIPTION: Standard dispose function.  Ends any recording, waits
+ *				for everything queued to be written, and stops the
+ *				writer thread.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmScreenCapture::Dispose (void)
+{
+	EmScreenCapture::StopRecording ();
+
+	::PrvStopThread ();
+
+	gRecordLastImage = EmPixMap ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreenCapture::SaveStill
+ *
+ * DESCRIPTION: Save the current contents of the LCD to a PNG file.
+ *				The file is created right away (so that errors can be
+ *				reported to the caller); the image is written to it on
+ *				the writer thread.  PNG has no way to say "no image",
+ *				so if the LCD is off or not set up yet, no file is
+ *				created and EINVAL is thrown.
+ *
+ * PARAMETERS:	ref - file to create.
+ *
+ * RETURNED:	Nothing.  Throws an ErrCode on failure.
+ *
+ ***********************************************************************/
+
+void EmScreenCapture::SaveStill (const EmFileRef& ref)
+{
+	EmCaptureJob*	job = new EmCaptureJob;
+
+	::PrvFillJob (job, EmCaptureJob::kStill, NULL);
+
+	EmPoint	size = job->fImage.GetSize ();
+
+	if (size.fX <= 0 || size.fY <= 0)
+	{
+		delete job;
+		Errors::ThrowIfStdCError (EINVAL);
+	}
+
+	job->fFile = fopen (ref.GetFullPath ().c_str (), "wb");
+
+	if (!job->fFile)
+	{
+		int	err = errno;
+		delete job;
+		Errors::ThrowIfStdCError (err);
+	}
+
+	::PrvQueueJob (job);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreenCapture::StartRecording
+ *
+ * DESCRIPTION: Start recording the LCD to the given file.  Any current
+ *				recording is ended first.
+ *
+ * PARAMETERS:	ref - file to create.
+ *
+ * RETURNED:	Nothing.  Throws an ErrCode on failure.
+ *
+ ***********************************************************************/
+
+void EmScreenCapture::StartRecording (const EmFileRef& ref)
+{
+	EmScreenCapture::StopRecording ();
+
+	FILE*	f = fopen (ref.GetFullPath ().c_str (), "wb");
+
+	if (!f)
+	{
+		Errors::ThrowIfStdCError (errno);
+	}
+
+	gRecordFile			= f;
+	gRecordLastImage	= EmPixMap ();
+	gRecordDropped		= 0;
+
+	// Take the first frame right away.
+
+	gRecordLastTicks	= EmLowMem_GetGlobal (hwrCurTicks) - kRecordTickInterval;
+
+	EmScreenCapture::CaptureFrame ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreenCapture::StopRecording
+ *
+ * DESCRIPTION: End the current recording, if any.  The file is closed
+ *				on the writer thread after the frames still queued for
+ *				it are written.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmScreenCapture::StopRecording (void)
+{
+	if (!gRecordFile)
+		return;
+
+	EmCaptureJob*	job = new EmCaptureJob;
+
+	job->fKind	= EmCaptureJob::kClose;
+	job->fFile	= gRecordFile;
+
+	::PrvQueueJob (job);
+
+	if (gRecordDropped)
+	{
+		LogAppendMsg ("EmScreenCapture: dropped %ld frames; writer fell behind",
+			gRecordDropped);
+	}
+
+	gRecordFile = NULL;
+	gRecordLastImage = EmPixMap ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreenCapture::IsRecording
+ *
+ * DESCRIPTION: Return whether or not a recording is in progress.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	True if so.
+ *
+ ***********************************************************************/
+
+Bool EmScreenCapture::IsRecording (void)
+{
+	return gRecordFile != NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmScreenCapture::CaptureFrame
+ *
+ * DESCRIPTION: Called periodically on the CPU thread.  If recording and
+ *				enough emulated time has passed, grab the LCD and queue
+ *				it for the recording if it differs from the last frame
+ *				written.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmScreenCapture::CaptureFrame (void)
+{
+	if (!gRecordFile)
+		return;
+
+	uint32	ticks = EmLowMem_GetGlobal (hwrCurTicks);
+
+	if (ticks - gRecordLastTicks < kRecordTickInterval)
+		return;
+
+	gRecordLastTicks = ticks;
+
+	EmCaptureJob*	job = new EmCaptureJob;
+
+	::PrvFillJob (job, EmCaptureJob::kFrame, gRecordFile);
+
+	// Drop frames that show nothing new.
+
+	EmPixMap&	image	= job->fImage;
+	EmPixMap&	last	= gRecordLastImage;
+
+	if (image.GetSize () == last.GetSize () &&
+		image.GetFormat () == last.GetFormat () &&
+		image.GetRowBytes () == last.GetRowBytes () &&
+		image.GetColorTable () == last.GetColorTable () &&
+		memcmp (image.GetBits (), last.GetBits (),
+			image.GetRowBytes () * image.GetSize ().fY) == 0)
+	{
+		delete job;
+		return;
+	}
+
+	// Drop frames the writer can't keep up with.
+
+	{
+		omni_mutex_lock	lock (gCaptureMutex);
+
+		if (gCaptureJobs.size () >= kMaxPendingFrames)
+		{
+			++gRecordDropped;
+			delete job;
+			return;
+		}
+	}
+
+	last = image;
+
+	::PrvQueueJob (job);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvFillJob
+ *
+ * DESCRIPTION: Fill in a job with the current contents of the LCD and
+ *				the time and Gremlin state they go with.
+ *
+ * PARAMETERS:	job - job to fill in.
+ *
+ *				kind - kStill or kFrame.
+ *
+ *				f - file to write to.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvFillJob (EmCaptureJob* job, EmCaptureJob::Kind kind, FILE* f)
+{
+	job->fKind		= kind;
+	job->fFile		= f;
+	job->fTicks		= EmLowMem_GetGlobal (hwrCurTicks);
+	job->fGremlin	= Hordes::IsOn () ? Hordes::GremlinNumber () : -1;
+	job->fEvent		= Hordes::IsOn () ? Hordes::EventCounter () : -1;
+
+	EmScreenUpdateInfo	info;
+
+	if (EmScreen::GetAllBits (info))
+	{
+		job->fImage = info.fImage;
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvQueueJob
+ *
+ * DESCRIPTION: Hand a job to the writer thread, starting it if needed.
+ *
+ * PARAMETERS:	job - job to write.  The writer thread deletes it.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvQueueJob (EmCaptureJob* job)
+{
+	::PrvStartThread ();
+
+	omni_mutex_lock	lock (gCaptureMutex);
+
+	gCaptureJobs.push_back (job);
+	gCaptureCondition.signal ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvStartThread
+ *
+ * DESCRIPTION: Start the writer thread if it isn't running.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvStartThread (void)
+{
+	if (gCaptureThread)
+		return;
+
+	gCaptureQuit = false;
+
+	// Created with a function returning void*, so the thread is joinable.
+
+	gCaptureThread = new omni_thread (&PrvCaptureThread);
+	gCaptureThread->start ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvStopThread
+ *
+ * DESCRIPTION: Have the writer thread finish the queued jobs and exit,
+ *				and wait for it to do so.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvStopThread (void)
+{
+	if (!gCaptureThread)
+		return;
+
+	{
+		omni_mutex_lock	lock (gCaptureMutex);
+
+		gCaptureQuit = true;
+		gCaptureCondition.signal ();
+	}
+
+	gCaptureThread->join (NULL);
+	gCaptureThread = NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvCaptureThread
+ *
+ * DESCRIPTION: Writer thread.  Encodes and writes queued jobs until
+ *				told to quit and the queue is empty.
+ *
+ * PARAMETERS:	Unused.
+ *
+ * RETURNED:	NULL.
+ *
+ ***********************************************************************/
+
+void* PrvCaptureThread (void*)
+{
+	while (true)
+	{
+		EmCaptureJob*	job;
+
+		{
+			omni_mutex_lock	lock (gCaptureMutex);
+
+			while (gCaptureJobs.empty () && !gCaptureQuit)
+			{
+				gCaptureCondition.wait ();
+			}
+
+			if (gCaptureJobs.empty ())
+				break;
+
+			job = gCaptureJobs.front ();
+			gCaptureJobs.pop_front ();
+		}
+
+		switch (job->fKind)
+		{
+			case EmCaptureJob::kStill:
+				::PrvWritePNG (job->fFile, job->fImage);
+				fclose (job->fFile);
+				break;
+
+			case EmCaptureJob::kFrame:
+				::PrvWriteY4MFrame (job->fFile, job->fImage, *job);
+				break;
+
+			case EmCaptureJob::kClose:
+				fclose (job->fFile);
+				gStreamSize = EmPoint ();
+				break;
+		}
+
+		delete job;
+	}
+
+	return NULL;
+}
+
+
+#pragma mark -
+
+// ===========================================================================
+//		PNG output
+// ===========================================================================
+// Images are written as 8-bit RGB.  There's no zlib in the tree, so the
+// image data is wrapped in "stored" (uncompressed) deflate blocks.  That's
+// still a perfectly valid, lossless PNG; LCD-sized images are small, and
+// anything that cares can recompress them.
+
+static uint32	gCRCTable[256];
+
+static void PrvInitCRCTable (void)
+{
+	if (gCRCTable[1] != 0)
+		return;
+
+	for (uint32 n = 0; n < 256; ++n)
+	{
+		uint32	c = n;
+
+		for (int k = 0; k < 8; ++k)
+		{
+			c = (c & 1) ? (0xEDB88320UL ^ (c >> 1)) : (c >> 1);
+		}
+
+		gCRCTable[n] = c;
+	}
+}
+
+
+static uint32 PrvUpdateCRC (uint32 crc, const uint8* p, size_t len)
+{
+	while (len--)
+	{
+		crc = gCRCTable[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+	}
+
+	return crc;
+}
+
+
+static void PrvPut32 (uint8* p, uint32 value)
+{
+	p[0] = (uint8) (value >> 24);
+	p[1] = (uint8) (value >> 16);
+	p[2] = (uint8) (value >> 8);
+	p[3] = (uint8) (value);
+}
+
+
+static void PrvWriteChunk (FILE* f, const char* type, const uint8* data, size_t len)
+{
+	uint8	header[8];
+
+	PrvPut32 (header, len);
+	memcpy (header + 4, type, 4);
+
+	uint32	crc = 0xFFFFFFFFUL;
+	crc = ::PrvUpdateCRC (crc, header + 4, 4);
+	crc = ::PrvUpdateCRC (crc, data, len);
+
+	uint8	trailer[4];
+	PrvPut32 (trailer, crc ^ 0xFFFFFFFFUL);
+
+	fwrite (header, 1, sizeof (header), f);
+	fwrite (data, 1, len, f);
+	fwrite (trailer, 1, sizeof (trailer), f);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvWritePNG
+ *
+ * DESCRIPTION: Write an image as a PNG file.  The image must not be
+ *				empty; a zero width or height isn't a legal IHDR.
+ *
+ * PARAMETERS:	f - file to write to.
+ *
+ *				image - image to write.  Converted to 24-bit RGB in
+ *					place.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvWritePNG (FILE* f, EmPixMap& image)
+{
+	::PrvInitCRCTable ();
+
+	image.ConvertToFormat (kPixMapFormat24RGB);
+
+	EmPoint			size		= image.GetSize ();
+	long			rowBytes	= image.GetRowBytes ();
+	const uint8*	bits		= (const uint8*) image.GetBits ();
+
+	EmAssert (size.fX > 0 && size.fY > 0);
+
+	static const uint8	kSignature[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+	fwrite (kSignature, 1, sizeof (kSignature), f);
+
+	// IHDR: width, height, 8 bits per channel, RGB, default compression,
+	// filtering, and no interlace.
+
+	uint8	ihdr[13];
+
+	PrvPut32 (ihdr + 0, size.fX);
+	PrvPut32 (ihdr + 4, size.fY);
+	ihdr[8]		= 8;
+	ihdr[9]		= 2;
+	ihdr[10]	= 0;
+	ihdr[11]	= 0;
+	ihdr[12]	= 0;
+
+	::PrvWriteChunk (f, "IHDR", ihdr, sizeof (ihdr));
+
+	// IDAT: a zlib stream of stored blocks holding each scanline preceded
+	// by a filter type byte of zero.
+
+	const size_t	kMaxStored	= 65535;
+	size_t			rawLen		= (size_t) size.fY * (size.fX * 3 + 1);
+	size_t			numBlocks	= (rawLen + kMaxStored - 1) / kMaxStored;
+	size_t			idatLen		= 2 + rawLen + numBlocks * 5 + 4;
+	uint8*			idat		= new uint8[idatLen];
+	uint8*			out			= idat;
+
+	*out++ = 0x78;	// Deflate, 32K window
+	*out++ = 0x01;	// No preset dictionary; check bits
+
+	uint32	adlerA	= 1;
+	uint32	adlerB	= 0;
+	size_t	left	= rawLen;
+	long	row		= 0;
+	long	col		= -1;	// -1 == filter byte
+
+	do
+	{
+		size_t	blockLen = left < kMaxStored ? left : kMaxStored;
+
+		left -= blockLen;
+
+		*out++ = left == 0 ? 1 : 0;
+		*out++ = (uint8) (blockLen);
+		*out++ = (uint8) (blockLen >> 8);
+		*out++ = (uint8) (~blockLen);
+		*out++ = (uint8) (~blockLen >> 8);
+
+		for (size_t ii = 0; ii < blockLen; ++ii)
+		{
+			uint8	b = col < 0 ? 0 : bits[row * rowBytes + col];
+
+			if (++col == size.fX * 3)
+			{
+				col = -1;
+				++row;
+			}
+
+			*out++ = b;
+
+			adlerA = (adlerA + b) % 65521;
+			adlerB = (adlerB + adlerA) % 65521;
+		}
+	}
+	while (left > 0);
+
+	PrvPut32 (out, (adlerB << 16) | adlerA);
+	out += 4;
+
+	::PrvWriteChunk (f, "IDAT", idat, out - idat);
+	::PrvWriteChunk (f, "IEND", NULL, 0);
+
+	delete [] idat;
+}
+
+
+#pragma mark -
+
+// ===========================================================================
+//		YUV4MPEG2 output
+// ===========================================================================
+// The stream header is written along with the first frame, since that's
+// when we know the size.  Later frames of a different size (the LCD was
+// reprogrammed) can't be represented in the stream, and are skipped.
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvWriteY4MFrame
+ *
+ * DESCRIPTION: Append an image to a YUV4MPEG2 stream as a 4:4:4 frame.
+ *
+ * PARAMETERS:	f - file to write to.
+ *
+ *				image - image to write.  Converted to 24-bit RGB in
+ *					place.
+ *
+ *				job - timestamp and Gremlin information for the frame.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvWriteY4MFrame (FILE* f, EmPixMap& image, const EmCaptureJob& job)
+{
+	EmPoint	size = image.GetSize ();
+
+	if (size.fX == 0 || size.fY == 0)
+		return;
+
+	if (gStreamSize == EmPoint ())
+	{
+		gStreamSize = size;
+
+		fprintf (f, "YUV4MPEG2 W%ld H%ld F%ld:%ld Ip A1:1 C444\n",
+			(long) size.fX, (long) size.fY, 100L, (long) kRecordTickInterval);
+	}
+
+	if (size != gStreamSize)
+		return;
+
+	image.ConvertToFormat (kPixMapFormat24RGB);
+
+	fprintf (f, "FRAME Xtick=%lu Xgremlin=%ld Xevent=%ld\n",
+		(unsigned long) job.fTicks, (long) job.fGremlin, (long) job.fEvent);
+
+	// BT.601 RGB -> Y'CbCr, in 8.8 fixed point.
+
+	long			numPixels	= size.fX * size.fY;
+	long			rowBytes	= image.GetRowBytes ();
+	const uint8*	bits		= (const uint8*) image.GetBits ();
+	uint8*			planes		= new uint8[numPixels * 3];
+	uint8*			yPlane		= planes;
+	uint8*			uPlane		= planes + numPixels;
+	uint8*			vPlane		= planes + numPixels * 2;
+
+	for (long yy = 0; yy < size.fY; ++yy)
+	{
+		const uint8*	p = bits + yy * rowBytes;
+
+		for (long xx = 0; xx < size.fX; ++xx)
+		{
+			int	r = *p++;
+			int	g = *p++;
+			int	b = *p++;
+
+			*yPlane++ = (uint8) ((  66 * r + 129 * g +  25 * b + 128) / 256 +  16);
+			*uPlane++ = (uint8) (( -38 * r -  74 * g + 112 * b + 128) / 256 + 128);
+			*vPlane++ = (uint8) (( 112 * r -  94 * g -  18 * b + 128) / 256 + 128);
+		}
+	}
+
+	fwrite (planes, 1, numPixels * 3, f);
+
+	delete [] planes;
+}
@@ -0,0 +1,55 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2000-2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmScreenCapture_h
+#define EmScreenCapture_h
+
+class EmFileRef;
+
+/*
+	EmScreenCapture takes pictures of the LCD without needing a window or
+	document, so that it works just as well in a headless Gremlin run as
+	in the UI.  Frames are fetched on the calling thread with
+	EmScreen::GetAllBits, which leaves the dirty range used for painting
+	alone, and are encoded and written on a background thread.
+
+	Stills are written as PNG.  Recordings are written as a YUV4MPEG2
+	stream, one FRAME per change of the LCD contents.  Since unchanged
+	frames are dropped, each FRAME header carries the Palm OS tick count
+	at which it was taken, plus the Gremlin and event numbers if Gremlins
+	are running:
+
+		FRAME Xtick=1234 Xgremlin=5 Xevent=678
+
+	Hordes records each Gremlin it runs when the RecordGremlinScreen
+	preference is set, and saves a still when a Gremlin fails.
+
+	All functions should be called on the CPU thread, or with the CPU
+	thread stopped.
+*/
+
+class EmScreenCapture
+{
+	public:
+		static void 			Dispose 			(void);
+
+		static void 			SaveStill			(const EmFileRef&);
+
+		static void 			StartRecording		(const EmFileRef&);
+		static void 			StopRecording		(void);
+		static Bool 			IsRecording			(void);
+
+		static void 			CaptureFrame		(void);
+};
+
+#endif	// EmScreenCapture_h
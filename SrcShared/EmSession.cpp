@@ -25,6 +25,8 @@
 #include "EmMemory.h"			// Memory::ResetBankHandlers
 #include "EmMinimize.h"			// EmMinimize::RealLoadInitialState
 #include "EmStreamFile.h"		// EmStreamFile
+#include "EmTimeTravel.h"		// EmTimeTravel::HasLoggedInput, etc.
+#include "EmVirtualTime.h"		// EmVirtualTime::GetMilliseconds
 #include "ErrorHandling.h"		// Errors::Throw
 #include "Hordes.h"				// Hordes::AutoSaveState, etc.
 #include "Logging.h"			// LogAppendMsg
@@ -39,6 +41,8 @@
 #include "DebugMgr.h"			// Debug::Initialize ();
 #include "HostControlPrv.h"		// Host::Initialize ();
 #include "EmScreen.h"			// EmScreen::Initialize ();
+#include "EmInstructionStats.h"	// EmInstructionStats::Dispose ();
+#include "EmScreenCapture.h"	// EmScreenCapture::Dispose ();
 #include "ErrorHandling.h"		// Errors::Initialize ();
 #include "EmPalmOS.h"			// EmPalmOS::Initialize
 
@@ -129,6 +133,7 @@ EmSession::EmSession (void) :
 	fHordeNextGremlinFromRootState (false),
 	fHordeNextGremlinFromSuspendState (false),
 	fMinimizeLoadState (false),
+	fTimeTravelSnapshot (false),
 	fDeferredErrs (),
 	fResetType (kResetSys),
 	fButtonQueue (),
@@ -327,8 +332,11 @@ void EmSession::Initialize (const Configuration& cfg)
 	Host::Initialize ();
 	EmScreen::Initialize ();
 	Errors::Initialize ();
+	EmVirtualTime::Initialize ();
 
 	EmPalmOS::Initialize ();
+
+	EmTimeTravel::Initialize ();
 }
 
 
@@ -347,10 +355,15 @@ void EmSession::Dispose (void)
 	// Therefore, each Dispose method should be prepared to handle
 	// NULL pointers, etc.
 
+	EmTimeTravel::Dispose ();
+
 	EmPalmOS::Dispose ();
 
+	EmVirtualTime::Dispose ();
 	Errors::Dispose ();
 	EmScreen::Dispose ();
+	EmScreenCapture::Dispose ();
+	EmInstructionStats::Dispose ();
 	Host::Dispose ();
 	Debug::Dispose ();
 	Platform::Dispose ();
@@ -466,9 +479,12 @@ void EmSession::Reset (EmResetType resetType)
 	Host::Reset ();
 	EmScreen::Reset ();
 	Errors::Reset ();
+	EmVirtualTime::Reset ();
 
 	EmPalmOS::Reset ();
 
+	EmTimeTravel::Reset ();
+
 
 #if HAS_OMNI_THREAD
         PHEM_Log_Msg("Reset, sharedlock.");
@@ -496,6 +512,7 @@ void EmSession::Reset (EmResetType resetType)
 	fHordeNextGremlinFromRootState = false;
 	fHordeNextGremlinFromSuspendState = false;
 	fMinimizeLoadState = false;
+	fTimeTravelSnapshot = false;
 
 	this->ClearDeferredErrors ();
 
@@ -575,6 +592,7 @@ void EmSession::Save (SessionFile& f)
 	Host::Save (f);
 	EmScreen::Save (f);
 	Errors::Save (f);
+	EmVirtualTime::Save (f);
 
 	EmPalmOS::Save (f);
         PHEM_Log_Msg("::Save done.");
@@ -612,9 +630,12 @@ void EmSession::Load (SessionFile& f)
 	Host::Load (f);
 	EmScreen::Load (f);
 	Errors::Load (f);
+	EmVirtualTime::Load (f);
 
 	EmPalmOS::Load (f);
 
+	EmTimeTravel::Load (f);
+
 	// If we weren't able to get all the pieces from the file we needed,
 	// force a reset.
 
@@ -1521,6 +1542,12 @@ Bool EmSession::ExecuteSpecial (Bool checkForResetOnly)
 		EmMinimize::RealLoadInitialState ();
 	}
 
+	if (fTimeTravelSnapshot)
+	{
+		fTimeTravelSnapshot = false;
+		EmTimeTravel::TakeSnapshot ();
+	}
+
 	return false;
 }
 
@@ -1725,17 +1752,23 @@ void EmSession::PostButtonEvent (const EmButtonEvent& event, Bool postNow)
 
 	if (postNow)
 	{
-		gLastButtonEvent = Platform::GetMilliseconds () - kButtonEventThreshold;
+		gLastButtonEvent = EmVirtualTime::GetMilliseconds () - kButtonEventThreshold;
 	}
 }
 
 
 Bool EmSession::HasButtonEvent (void)
 {
+	// If we've been here before, do what we did then.
+
+	Bool	logged;
+	if (EmTimeTravel::HasLoggedInput (kTimeTravelButton, logged))
+		return logged;
+
 	// Don't feed hardware events out too quickly.  Otherwise, the OS
 	// may not have time to react to the register changes.
 
-	uint32	now = Platform::GetMilliseconds ();
+	uint32	now = EmVirtualTime::GetMilliseconds ();
 
 	if (now - gLastButtonEvent < kButtonEventThreshold)
 	{
@@ -1748,18 +1781,27 @@ Bool EmSession::HasButtonEvent (void)
 
 EmButtonEvent EmSession::PeekButtonEvent (void)
 {
+	if (EmTimeTravel::IsReplayingInput ())
+		return EmTimeTravel::NextButtonEvent (false);
+
 	return fButtonQueue.Peek ();
 }
 
 
 EmButtonEvent EmSession::GetButtonEvent (void)
 {
+	if (EmTimeTravel::IsReplayingInput ())
+		return EmTimeTravel::NextButtonEvent (true);
+
 	// Don't feed hardware events out too quickly.  Otherwise, the OS
 	// may not have time to react to the register changes.
 
-	gLastButtonEvent = Platform::GetMilliseconds ();
+	gLastButtonEvent = EmVirtualTime::GetMilliseconds ();
+
+	EmButtonEvent	event = fButtonQueue.Get ();
+	EmTimeTravel::LogInput (event);
 
-	return fButtonQueue.Get ();
+	return event;
 }
 
 
@@ -1786,19 +1828,32 @@ void EmSession::PostKeyEvent (const EmKeyEvent& event)
 
 Bool EmSession::HasKeyEvent (void)
 {
+	Bool	logged;
+	if (EmTimeTravel::HasLoggedInput (kTimeTravelKey, logged))
+		return logged;
+
 	return fKeyQueue.GetUsed () > 0;
 }
 
 
 EmKeyEvent EmSession::PeekKeyEvent (void)
 {
+	if (EmTimeTravel::IsReplayingInput ())
+		return EmTimeTravel::NextKeyEvent (false);
+
 	return fKeyQueue.Peek ();
 }
 
 
 EmKeyEvent EmSession::GetKeyEvent (void)
 {
-	return fKeyQueue.Get ();
+	if (EmTimeTravel::IsReplayingInput ())
+		return EmTimeTravel::NextKeyEvent (true);
+
+	EmKeyEvent	event = fKeyQueue.Get ();
+	EmTimeTravel::LogInput (event);
+
+	return event;
 }
 
 
@@ -1839,19 +1894,32 @@ void EmSession::PostPenEvent (const EmPenEvent& event)
 
 Bool EmSession::HasPenEvent (void)
 {
+	Bool	logged;
+	if (EmTimeTravel::HasLoggedInput (kTimeTravelPen, logged))
+		return logged;
+
 	return fPenQueue.GetUsed () > 0;
 }
 
 
 EmPenEvent EmSession::PeekPenEvent (void)
 {
+	if (EmTimeTravel::IsReplayingInput ())
+		return EmTimeTravel::NextPenEvent (false);
+
 	return fPenQueue.Peek ();
 }
 
 
 EmPenEvent EmSession::GetPenEvent (void)
 {
-	return fPenQueue.Get ();
+	if (EmTimeTravel::IsReplayingInput ())
+		return EmTimeTravel::NextPenEvent (true);
+
+	EmPenEvent	event = fPenQueue.Get ();
+	EmTimeTravel::LogInput (event);
+
+	return event;
 }
 
 
@@ -2217,10 +2285,28 @@ void EmSession::ScheduleMinimizeLoadState (void)
 }
 
 
+void EmSession::ScheduleTimeTravelSnapshot (void)
+{
+	fTimeTravelSnapshot = 1;
+
+	EmAssert (fCPU);
+	fCPU->CheckAfterCycle ();
+}
+
+
 void EmSession::ScheduleDeferredError (EmDeferredErr* err)
 {
 	EmAssert (gIterating == false);
 
+	// Errors were reported the first time through this part of
+	// history; don't report them again on the way to somewhere else.
+
+	if (EmTimeTravel::IsMoving ())
+	{
+		delete err;
+		return;
+	}
+
 	fDeferredErrs.push_back (err);
 
 	EmAssert (fCPU);
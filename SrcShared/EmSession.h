@@ -542,6 +542,7 @@ class EmSession
 		void					ScheduleNextGremlinFromRootState		(void);
 		void					ScheduleNextGremlinFromSuspendedState	(void);
 		void					ScheduleMinimizeLoadState			(void);
+		void					ScheduleTimeTravelSnapshot				(void);
 		void					ScheduleDeferredError					(EmDeferredErr*);
 
 		void					ClearDeferredErrors						(void);
@@ -676,6 +677,7 @@ class EmSession
 		Bool					fHordeNextGremlinFromRootState;
 		Bool					fHordeNextGremlinFromSuspendState;
 		Bool					fMinimizeLoadState;
+		Bool					fTimeTravelSnapshot;
 
 		EmDeferredErrList		fDeferredErrs;
 
@@ -14,6 +14,11 @@
 #include "EmCommon.h"
 #include "EmThreadSafeQueue.h"
 
+#include "Miscellaneous.h"		// NextPowerOf2
+#include "Platform.h"			// Platform::AllocateMemory
+
+#include <string.h>				// memcpy
+
 
 // ---------------------------------------------------------------------------
 //		 EmThreadSafeQueue
@@ -61,6 +66,30 @@ void EmThreadSafeQueue<T>::Put (const T& value)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmThreadSafeQueue::Put
+// ---------------------------------------------------------------------------
+// Add a run of values, taking the lock only once.
+
+template <class T>
+void EmThreadSafeQueue<T>::Put (const T* values, int count)
+{
+	if (count <= 0)
+		return;
+
+	omni_mutex_lock	lock (fMutex);
+
+	EmAssert (fMaxSize == 0 || (long) fContainer.size () + count <= fMaxSize);
+
+	fContainer.insert (fContainer.end (), values, values + count);
+
+#if HAS_OMNI_THREAD
+	// Tell clients that there may be new data in the buffer.
+	fAvailable.signal ();
+#endif
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmThreadSafeQueue::Get
 // ---------------------------------------------------------------------------
@@ -82,6 +111,33 @@ T EmThreadSafeQueue<T>::Get (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmThreadSafeQueue::Get
+// ---------------------------------------------------------------------------
+// Remove up to "count" values, taking the lock only once.  Returns the
+// number of values actually removed.
+
+template <class T>
+int EmThreadSafeQueue<T>::Get (T* values, int count)
+{
+	omni_mutex_lock	lock (fMutex);
+
+	if (count > (int) fContainer.size ())
+		count = (int) fContainer.size ();
+
+	if (count > 0)
+	{
+		typename deque<T>::iterator	begin = fContainer.begin ();
+		typename deque<T>::iterator	end = begin + count;
+
+		copy (begin, end, values);
+		fContainer.erase (begin, end);
+	}
+
+	return count;
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmThreadSafeQueue::Peek
 // ---------------------------------------------------------------------------
@@ -176,6 +232,159 @@ int EmThreadSafeQueue<T>::GetMaxSize (void)
 	return fMaxSize;
 }
 
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 EmByteRing
+// ---------------------------------------------------------------------------
+// fHead and fTail are free-running counters; their difference is the
+// number of bytes in the ring.  The barrier makes sure the bytes are
+// in the buffer before the other side can see the counter that
+// publishes them (and vice versa).
+
+#if defined (__GNUC__)
+	#define PrvMemoryBarrier()	__sync_synchronize ()
+#else
+	static omni_mutex	gBarrierMutex;
+	#define PrvMemoryBarrier()	do { gBarrierMutex.lock (); gBarrierMutex.unlock (); } while (0)
+#endif
+
+EmByteRing::EmByteRing (long capacity) :
+	fBuffer (NULL),
+	fMask (::NextPowerOf2 (capacity) - 1),
+	fHead (0),
+	fTail (0)
+{
+	fBuffer = (uint8*) Platform::AllocateMemory (fMask + 1);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmByteRing
+// ---------------------------------------------------------------------------
+
+EmByteRing::~EmByteRing (void)
+{
+	Platform::DisposeMemory (fBuffer);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmByteRing::Put
+// ---------------------------------------------------------------------------
+// Copy in as many of the given bytes as will fit.  Returns the number of
+// bytes copied.  Call only from the producer thread.
+
+long EmByteRing::Put (const void* data, long len)
+{
+	long	avail = this->GetFree ();
+
+	if (len > avail)
+		len = avail;
+
+	const uint8*	src = (const uint8*) data;
+	uint32			tail = fTail;
+
+	for (long done = 0; done < len; )
+	{
+		uint32	offset	= (tail + done) & fMask;
+		long	run		= min ((long) (fMask + 1 - offset), len - done);
+
+		memcpy (fBuffer + offset, src + done, run);
+		done += run;
+	}
+
+	PrvMemoryBarrier ();
+	fTail = tail + len;
+
+	return len;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmByteRing::GetFree
+// ---------------------------------------------------------------------------
+
+long EmByteRing::GetFree (void) const
+{
+	return (long) (fMask + 1) - this->GetUsed ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmByteRing::Get
+// ---------------------------------------------------------------------------
+// Copy out up to "len" bytes.  Returns the number of bytes copied.  Call
+// only from the consumer thread.
+
+long EmByteRing::Get (void* data, long len)
+{
+	len = this->Peek (data, len);
+
+	PrvMemoryBarrier ();
+	fHead = fHead + len;
+
+	return len;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmByteRing::Peek
+// ---------------------------------------------------------------------------
+// Like Get, but leaves the bytes in the ring.  Call only from the consumer
+// thread.
+
+long EmByteRing::Peek (void* data, long len) const
+{
+	long	avail = this->GetUsed ();
+
+	if (len > avail)
+		len = avail;
+
+	PrvMemoryBarrier ();
+
+	uint8*	dest = (uint8*) data;
+	uint32	head = fHead;
+
+	for (long done = 0; done < len; )
+	{
+		uint32	offset	= (head + done) & fMask;
+		long	run		= min ((long) (fMask + 1 - offset), len - done);
+
+		memcpy (dest + done, fBuffer + offset, run);
+		done += run;
+	}
+
+	return len;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmByteRing::GetUsed
+// ---------------------------------------------------------------------------
+
+long EmByteRing::GetUsed (void) const
+{
+	return (long) (uint32) (fTail - fHead);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmByteRing::Clear
+// ---------------------------------------------------------------------------
+// Discard everything currently in the ring.  Call only from the consumer
+// thread.
+
+void EmByteRing::Clear (void)
+{
+	PrvMemoryBarrier ();
+	fHead = fTail;
+}
+
+
+#pragma mark -
+
 // Instantiate the ones we want.
 
 #include "EmSession.h"			// uint8 (Byte), EmButtonEvent, EmKeyEvent, EmPenEvent
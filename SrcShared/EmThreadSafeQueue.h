@@ -26,7 +26,9 @@ class EmThreadSafeQueue
 								~EmThreadSafeQueue		(void);
 
 		void					Put 					(const T&);
+		void					Put 					(const T*, int count);
 		T						Get 					(void);
+		int						Get 					(T*, int count);
 		T						Peek 					(void);
 		int 					GetUsed					(void);
 		int 					GetFree					(void);
@@ -46,4 +48,43 @@ class EmThreadSafeQueue
 
 typedef EmThreadSafeQueue<uint8>	EmByteQueue;
 
+
+// ---------------------------------------------------------------------------
+//	EmByteRing
+//
+//		Fixed-size ring of bytes shared between exactly one producer thread
+//		and one consumer thread (for instance, a host I/O thread feeding the
+//		CPU thread).  The producer only ever advances fTail and the consumer
+//		only ever advances fHead, so neither side needs to take a lock.
+// ---------------------------------------------------------------------------
+
+class EmByteRing
+{
+	public:
+								EmByteRing				(long capacity);
+								~EmByteRing				(void);
+
+		// Producer side.
+
+		long					Put 					(const void*, long len);
+		long					GetFree					(void) const;
+
+		// Consumer side.
+
+		long					Get 					(void*, long len);
+		long					Peek 					(void*, long len) const;
+		long					GetUsed					(void) const;
+		void					Clear					(void);
+
+	private:
+		uint8*					fBuffer;
+		uint32					fMask;
+		volatile uint32			fHead;
+		volatile uint32			fTail;
+
+	private:
+								EmByteRing				(const EmByteRing&);
+		EmByteRing&				operator=				(const EmByteRing&);
+};
+
 #endif	// EmThreadSafeQueue_h
@@ -0,0 +1,1102 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2000-2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmTimeTravel.h"
+
+#include "ChunkFile.h"			// Chunk, ChunkFile, EmStreamChunk
+#include "DebugMgr.h"			// Debug::EnterDebugger, Debug::Save
+#include "EmBankSRAM.h"			// gRAM_Memory, gRAM_MetaMemory, gRAMBank_Size
+#include "EmCPU68K.h"			// gCPU68K
+#include "EmErrCodes.h"			// kError_NoError
+#include "EmScreen.h"			// EmScreen::InvalidateAll
+#include "EmSession.h"			// gSession, EmButtonEvent, etc.
+#include "EmVirtualTime.h"		// EmVirtualTime::GetCycles
+#include "EmWatchpoints.h"		// EmWatchpoints::Count
+#include "MetaMemory.h"			// MetaMemory::ResyncPages, kMetaPageSize
+#include "Miscellaneous.h"		// EmValueChanger
+#include "Platform.h"			// Platform::AllocateMemory
+#include "PreferenceMgr.h"		// Preference
+#include "SessionFile.h"		// SessionFile
+
+#include <string.h>				// memcmp, memcpy
+
+
+// ===========================================================================
+//		 EmTimeTravel
+// ===========================================================================
+
+enum
+{
+	kModeIdle,			// Not going anywhere.
+	kModeRunTo,			// Running forward to gTarget.
+	kModeFindStep,		// Looking for the last instruction before gLimit.
+	kModeFindWatch		// Looking for the last watchpoint hit before gLimit.
+};
+
+	// Pages of RAM or meta-memory that changed between a snapshot and
+	// the next one, as they were at the first one.  fPages holds their
+	// offsets; fData holds their contents, one after the other.
+struct EmSavedPages
+{
+	vector<uint32>	fPages;
+	vector<uint8>	fData;
+};
+
+struct EmSnapshot
+{
+	uint64			fNow;
+	uint32			fPolls;
+	uint32			fCycleSlowlyCount;
+	Chunk			fState;
+	EmSavedPages	fRAM;
+	EmSavedPages	fMetaRAM;
+};
+
+struct EmLoggedInput
+{
+	EmLoggedInput (void) :
+		fPoll (0),
+		fKind (kTimeTravelButton),
+		fButton (kElement_None, false),
+		fKey (0),
+		fPen (EmPoint (-1, -1), false)
+	{
+	}
+
+	uint32			fPoll;		// Value of gPolls when it was asked for.
+	int				fKind;
+	EmButtonEvent	fButton;
+	EmKeyEvent		fKey;
+	EmPenEvent		fPen;
+};
+
+typedef vector<EmSnapshot*>		EmSnapshotList;
+typedef vector<EmLoggedInput>	EmLoggedInputList;
+
+static Bool 				gOn;
+static uint32				gInterval;
+static uint32				gMaxSnapshots;
+
+static EmSnapshotList		gSnapshots;
+static uint8*				gShadowRAM;
+static uint8*				gShadowMetaRAM;
+static uint32				gShadowSize;
+static Bool 				gRestoring;
+
+	// gPolls counts the calls to HasLoggedInput.  Calls up to gHorizon
+	// have been made before, and are answered from the log.
+static uint32				gPolls;
+static uint32				gHorizon;
+static EmLoggedInputList	gLog;
+static EmLoggedInputList::size_type	gLogNext;
+
+static int					gMode;
+static uint64				gTarget;
+static uint64				gLimit;
+static uint64				gFound;
+static Bool 				gHaveFound;
+static uint64				gInstrStart;
+static int					gSearchIndex;
+
+
+static uint64			PrvNow				(void);
+static void 			PrvDiscardHistory	(void);
+static int				PrvFindSnapshot		(uint64 when);
+static void 			PrvRestore			(int index);
+static void 			PrvUpdateShadow		(const uint8* live, uint8* shadow, EmSavedPages* saved);
+static void 			PrvApplySaved		(const EmSavedPages& saved, uint8* shadow);
+static void 			PrvCopyChanged		(const uint8* shadow, uint8* live);
+static void 			PrvStartMove		(int mode);
+static void 			PrvEndMove			(void);
+static Bool 			PrvArrive			(void);
+static const EmLoggedInput&	PrvNextInput	(int kind, Bool remove);
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::Initialize
+ *
+ * DESCRIPTION: Standard initialization function.  Responsible for
+ *				initializing this sub-system when a new session is
+ *				created.  Will be followed by at least one call to
+ *				Reset or Load.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTimeTravel::Initialize (void)
+{
+	Preference<bool>	pref (kPrefKeyTimeTravel);
+
+	gOn = *pref;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::Reset
+ *
+ * DESCRIPTION: Standard reset function.  Sets the sub-system to a
+ *				default state.  This occurs not only on a Reset (as
+ *				from the menu item), but also when the sub-system
+ *				is first initialized (Reset is called after Initialize)
+ *				as well as when the system is re-loaded from an
+ *				insufficient session file.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTimeTravel::Reset (void)
+{
+	// Don't lose the history while we're restoring part of it.
+
+	if (gRestoring)
+		return;
+
+	::PrvDiscardHistory ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::Load
+ *
+ * DESCRIPTION: Standard load function.  Loads any sub-system state
+ *				from the given session file.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTimeTravel::Load (SessionFile&)
+{
+	EmTimeTravel::Reset ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::Dispose
+ *
+ * DESCRIPTION: Standard dispose function.	Completely release any
+ *				resources acquired or allocated in Initialize and/or
+ *				Load.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTimeTravel::Dispose (void)
+{
+	::PrvDiscardHistory ();
+
+	gOn = false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::TurnOn
+ *
+ * DESCRIPTION: Start or stop recording history.  Turning it off throws
+ *				away what's been recorded.
+ *
+ * PARAMETERS:	on - true to start recording.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTimeTravel::TurnOn (Bool on)
+{
+	if (on == gOn)
+		return;
+
+	::PrvDiscardHistory ();
+
+	gOn = on;
+}
+
+
+Bool EmTimeTravel::IsOn (void)
+{
+	return gOn;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::GetNow
+ *				EmTimeTravel::GetOldest
+ *				EmTimeTravel::GetNumSnapshots
+ *
+ * DESCRIPTION: Return the current cycle, the cycle of the oldest
+ *				snapshot (which is as far back as we can go), and the
+ *				number of snapshots.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	As above.
+ *
+ ***********************************************************************/
+
+uint64 EmTimeTravel::GetNow (void)
+{
+	return ::PrvNow ();
+}
+
+
+uint64 EmTimeTravel::GetOldest (void)
+{
+	if (gSnapshots.empty ())
+		return ::PrvNow ();
+
+	return gSnapshots.front ()->fNow;
+}
+
+
+int EmTimeTravel::GetNumSnapshots (void)
+{
+	return (int) gSnapshots.size ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::RunToCycle
+ *
+ * DESCRIPTION: Go to the first instruction that starts at or after the
+ *				given cycle.  If it's in the past, restore the snapshot
+ *				before it first.
+ *
+ * PARAMETERS:	target - the cycle to go to.
+ *
+ *				running - set to true if the CPU needs to run to get
+ *					there, or false if we're there already.
+ *
+ * RETURNED:	A kTimeTravelErr code.
+ *
+ ***********************************************************************/
+
+int EmTimeTravel::RunToCycle (uint64 target, Bool& running)
+{
+	running = false;
+
+	if (!gOn || !gCPU68K)
+		return kTimeTravelErrOff;
+
+	if (target < ::PrvNow ())
+	{
+		int	index = ::PrvFindSnapshot (target);
+		if (index < 0)
+			return kTimeTravelErrNoHistory;
+
+		::PrvRestore (index);
+	}
+
+	if (::PrvNow () >= target)
+		return kTimeTravelErrNone;
+
+	gTarget = target;
+	::PrvStartMove (kModeRunTo);
+
+	running = true;
+	return kTimeTravelErrNone;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::ReverseStep
+ *
+ * DESCRIPTION: Go back to the start of the instruction before the
+ *				current one.  We don't know when that was, so restore
+ *				the snapshot before it and run up to the present,
+ *				noting where each instruction starts.  CheckInstruction
+ *				then restores the snapshot again and runs to the last
+ *				one.
+ *
+ * PARAMETERS:	running - set to true if the CPU needs to run to get
+ *					there.
+ *
+ * RETURNED:	A kTimeTravelErr code.
+ *
+ ***********************************************************************/
+
+int EmTimeTravel::ReverseStep (Bool& running)
+{
+	running = false;
+
+	if (!gOn || !gCPU68K)
+		return kTimeTravelErrOff;
+
+	uint64	now		= ::PrvNow ();
+	int		index	= now > 0 ? ::PrvFindSnapshot (now - 1) : -1;
+
+	if (index < 0)
+		return kTimeTravelErrNoHistory;
+
+	::PrvRestore (index);
+
+	// The snapshot itself is at the start of an instruction, and we won't
+	// be called for that one.
+
+	gLimit			= now;
+	gFound			= ::PrvNow ();
+	gSearchIndex	= index;
+	::PrvStartMove (kModeFindStep);
+
+	running = true;
+	return kTimeTravelErrNone;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::ReverseContinue
+ *
+ * DESCRIPTION: Go back to the start of the last instruction that hit a
+ *				watchpoint.  Restore the snapshot before the present and
+ *				run up to the present, noting any hits.  If there were
+ *				none, do the same from the snapshot before that, and so
+ *				on.  If there are no hits in the whole history, stop at
+ *				the oldest snapshot.
+ *
+ * PARAMETERS:	running - set to true if the CPU needs to run to get
+ *					there.
+ *
+ * RETURNED:	A kTimeTravelErr code.
+ *
+ ***********************************************************************/
+
+int EmTimeTravel::ReverseContinue (Bool& running)
+{
+	running = false;
+
+	if (!gOn || !gCPU68K)
+		return kTimeTravelErrOff;
+
+	if (EmWatchpoints::Count () == 0)
+		return kTimeTravelErrNoWatchpoints;
+
+	uint64	now		= ::PrvNow ();
+	int		index	= now > 0 ? ::PrvFindSnapshot (now - 1) : -1;
+
+	if (index < 0)
+		return kTimeTravelErrNoHistory;
+
+	::PrvRestore (index);
+
+	gLimit			= now;
+	gHaveFound		= false;
+	gInstrStart		= ::PrvNow ();
+	gSearchIndex	= index;
+	::PrvStartMove (kModeFindWatch);
+
+	running = true;
+	return kTimeTravelErrNone;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::IsMoving
+ *
+ * DESCRIPTION: Return whether we're replaying history to get somewhere.
+ *				Breakpoints, watchpoints, and error reports should be
+ *				ignored while we are.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	True if so.
+ *
+ ***********************************************************************/
+
+Bool EmTimeTravel::IsMoving (void)
+{
+	return gMode != kModeIdle;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::CycleSlowly
+ *
+ * DESCRIPTION: Called from EmCPU68K::CycleSlowly.  Schedule a
+ *				snapshot if it's time for one.  The
+ *				snapshot is taken at the end of the cycle, where the CPU
+ *				loop is between instructions.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTimeTravel::CycleSlowly (void)
+{
+	if (!gCPU68K)
+		return;
+
+	if (!gOn || gMode == kModeFindStep || gMode == kModeFindWatch)
+		return;
+
+	if (gSnapshots.empty () || ::PrvNow () - gSnapshots.back ()->fNow >= gInterval)
+	{
+		EmAssert (gSession);
+		gSession->ScheduleTimeTravelSnapshot ();
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::TakeSnapshot
+ *
+ * DESCRIPTION: Save the session state to memory, and bring the copies
+ *				of RAM and meta-memory up to date.  The pages that
+ *				changed since the last snapshot are saved with it, so
+ *				that it can be restored later.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTimeTravel::TakeSnapshot (void)
+{
+	if (!gOn || !gCPU68K || !gRAM_Memory || !gRAM_MetaMemory)
+		return;
+
+	// The first time, start the copies out the same as the originals.
+
+	if (!gShadowRAM)
+	{
+		gShadowSize		= gRAMBank_Size;
+		gShadowRAM		= (uint8*) Platform::AllocateMemory (gShadowSize);
+		gShadowMetaRAM	= (uint8*) Platform::AllocateMemory (gShadowSize);
+
+		memcpy (gShadowRAM, gRAM_Memory, gShadowSize);
+		memcpy (gShadowMetaRAM, gRAM_MetaMemory, gShadowSize);
+	}
+
+	EmSnapshot*	snapshot = new EmSnapshot;
+
+	snapshot->fNow				= ::PrvNow ();
+	snapshot->fPolls			= gPolls;
+	snapshot->fCycleSlowlyCount	= gCPU68K->GetCycleSlowlyCount ();
+
+	{
+		EmStreamChunk	stream (snapshot->fState);
+		ChunkFile		chunkFile (stream);
+		SessionFile		sessionFile (chunkFile);
+
+		sessionFile.SetSnapshot (true);
+
+		EmAssert (gSession);
+		gSession->Save (sessionFile);
+	}
+
+	EmSnapshot*	previous = gSnapshots.empty () ? NULL : gSnapshots.back ();
+
+	::PrvUpdateShadow (gRAM_Memory, gShadowRAM, previous ? &previous->fRAM : NULL);
+	::PrvUpdateShadow (gRAM_MetaMemory, gShadowMetaRAM, previous ? &previous->fMetaRAM : NULL);
+
+	gSnapshots.push_back (snapshot);
+
+	// Forget the oldest snapshot if there are too many, along with the
+	// input that can't be replayed any more.
+
+	while (gSnapshots.size () > gMaxSnapshots)
+	{
+		delete gSnapshots.front ();
+		gSnapshots.erase (gSnapshots.begin ());
+
+		uint32	oldest = gSnapshots.front ()->fPolls;
+
+		EmLoggedInputList::iterator	iter = gLog.begin ();
+		while (iter != gLog.end () && iter->fPoll <= oldest)
+		{
+			++iter;
+		}
+
+		EmLoggedInputList::size_type	numDropped = iter - gLog.begin ();
+
+		gLog.erase (gLog.begin (), iter);
+		gLogNext = gLogNext > numDropped ? gLogNext - numDropped : 0;
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::CheckInstruction
+ *
+ * DESCRIPTION: Called by the CPU loop before each instruction while
+ *				we're moving.  Stop if we've arrived, or go on to the
+ *				next step of a reverse search.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	True if we entered the debugger.
+ *
+ ***********************************************************************/
+
+Bool EmTimeTravel::CheckInstruction (void)
+{
+	uint64	now = ::PrvNow ();
+
+	switch (gMode)
+	{
+		case kModeRunTo:
+			if (now >= gTarget)
+				return ::PrvArrive ();
+			break;
+
+		case kModeFindStep:
+			if (now < gLimit)
+			{
+				gFound = now;
+				break;
+			}
+
+			// We're back where we started.  Go back again, this time to
+			// the start of the instruction before it.
+
+			::PrvRestore (gSearchIndex);
+
+			gTarget	= gFound;
+			gMode	= kModeRunTo;
+
+			if (::PrvNow () >= gTarget)
+				return ::PrvArrive ();
+			break;
+
+		case kModeFindWatch:
+			if (now < gLimit)
+			{
+				gInstrStart = now;
+				break;
+			}
+
+			if (gHaveFound)
+			{
+				::PrvRestore (gSearchIndex);
+
+				gTarget	= gFound;
+				gMode	= kModeRunTo;
+
+				if (::PrvNow () >= gTarget)
+					return ::PrvArrive ();
+			}
+
+			// Nothing since the snapshot we started from.  Look
+			// between it and the one before it.
+
+			else if (gSearchIndex > 0)
+			{
+				gLimit = gSnapshots[gSearchIndex]->fNow;
+				--gSearchIndex;
+
+				::PrvRestore (gSearchIndex);
+
+				gInstrStart = ::PrvNow ();
+			}
+
+			// Nothing in the whole history.  Stop at the beginning of it.
+
+			else
+			{
+				::PrvRestore (0);
+				return ::PrvArrive ();
+			}
+			break;
+	}
+
+	return false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::NoteWatchHit
+ *
+ * DESCRIPTION: Called by EmWatchpoints instead of reporting a hit while
+ *				we're moving.  If we're looking for hits, remember the
+ *				instruction that made it.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTimeTravel::NoteWatchHit (void)
+{
+	if (gMode == kModeFindWatch)
+	{
+		gFound		= gInstrStart;
+		gHaveFound	= true;
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::HasLoggedInput
+ *
+ * DESCRIPTION: Called by EmSession::HasFooEvent.  Count the call, and
+ *				if it was made before, answer it from the log.
+ *
+ * PARAMETERS:	kind - kTimeTravelButton, etc.
+ *
+ *				has - set to whether there's an event to be had.
+ *
+ * RETURNED:	True if "has" was set; false if the live queue should
+ *				be checked instead.
+ *
+ ***********************************************************************/
+
+Bool EmTimeTravel::HasLoggedInput (int kind, Bool& has)
+{
+	if (!gOn)
+		return false;
+
+	++gPolls;
+
+	if (gPolls > gHorizon)
+		return false;
+
+	has =	gLogNext < gLog.size () &&
+			gLog[gLogNext].fPoll == gPolls &&
+			gLog[gLogNext].fKind == kind;
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::IsReplayingInput
+ *
+ * DESCRIPTION: Return whether events should come from the log rather
+ *				than the live queue.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	True if so.
+ *
+ ***********************************************************************/
+
+Bool EmTimeTravel::IsReplayingInput (void)
+{
+	return gOn && gPolls <= gHorizon;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::LogInput
+ *
+ * DESCRIPTION: Called by EmSession::GetFooEvent with each event taken
+ *				from the live queue.
+ *
+ * PARAMETERS:	event - the event.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTimeTravel::LogInput (const EmButtonEvent& event)
+{
+	if (!gOn)
+		return;
+
+	EmLoggedInput	input;
+
+	input.fPoll		= gPolls;
+	input.fKind		= kTimeTravelButton;
+	input.fButton	= event;
+
+	gLog.push_back (input);
+	gLogNext = gLog.size ();
+}
+
+
+void EmTimeTravel::LogInput (const EmKeyEvent& event)
+{
+	if (!gOn)
+		return;
+
+	EmLoggedInput	input;
+
+	input.fPoll		= gPolls;
+	input.fKind		= kTimeTravelKey;
+	input.fKey		= event;
+
+	gLog.push_back (input);
+	gLogNext = gLog.size ();
+}
+
+
+void EmTimeTravel::LogInput (const EmPenEvent& event)
+{
+	if (!gOn)
+		return;
+
+	EmLoggedInput	input;
+
+	input.fPoll		= gPolls;
+	input.fKind		= kTimeTravelPen;
+	input.fPen		= event;
+
+	gLog.push_back (input);
+	gLogNext = gLog.size ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTimeTravel::NextButtonEvent
+ *				EmTimeTravel::NextKeyEvent
+ *				EmTimeTravel::NextPenEvent
+ *
+ * DESCRIPTION: Called by EmSession::PeekFooEvent and GetFooEvent while
+ *				replaying input.  Return the next logged event.
+ *
+ * PARAMETERS:	remove - true to move on to the one after it.
+ *
+ * RETURNED:	The event.
+ *
+ ***********************************************************************/
+
+EmButtonEvent EmTimeTravel::NextButtonEvent (Bool remove)
+{
+	return ::PrvNextInput (kTimeTravelButton, remove).fButton;
+}
+
+
+EmKeyEvent EmTimeTravel::NextKeyEvent (Bool remove)
+{
+	return ::PrvNextInput (kTimeTravelKey, remove).fKey;
+}
+
+
+EmPenEvent EmTimeTravel::NextPenEvent (Bool remove)
+{
+	return ::PrvNextInput (kTimeTravelPen, remove).fPen;
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 PrvNow
+// ---------------------------------------------------------------------------
+// The clock is EmVirtualTime's cycle count.  It's saved with each
+// snapshot, so restoring one turns it back too.
+
+uint64 PrvNow (void)
+{
+	return EmVirtualTime::GetCycles ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvDiscardHistory
+// ---------------------------------------------------------------------------
+// Forget all snapshots and logged input, and pick up any change to the
+// preferences.
+
+void PrvDiscardHistory (void)
+{
+	::PrvEndMove ();
+
+	EmSnapshotList::iterator	iter = gSnapshots.begin ();
+	while (iter != gSnapshots.end ())
+	{
+		delete *iter;
+		++iter;
+	}
+
+	gSnapshots.clear ();
+
+	Platform::DisposeMemory (gShadowRAM);
+	Platform::DisposeMemory (gShadowMetaRAM);
+	gShadowSize = 0;
+
+	gLog.clear ();
+	gLogNext	= 0;
+	gPolls		= 0;
+	gHorizon	= 0;
+
+	Preference<long>	intervalPref (kPrefKeyTimeTravelInterval);
+	Preference<long>	snapshotsPref (kPrefKeyTimeTravelSnapshots);
+
+	gInterval		= *intervalPref > 0 ? *intervalPref : 1;
+	gMaxSnapshots	= *snapshotsPref > 0 ? *snapshotsPref : 1;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvFindSnapshot
+// ---------------------------------------------------------------------------
+// Return the index of the last snapshot taken at or before the given
+// cycle, or -1 if there isn't one.
+
+int PrvFindSnapshot (uint64 when)
+{
+	int	index = (int) gSnapshots.size () - 1;
+
+	while (index >= 0 && gSnapshots[index]->fNow > when)
+	{
+		--index;
+	}
+
+	return index;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvRestore
+// ---------------------------------------------------------------------------
+// Put the device back the way it was when the given snapshot was taken,
+// and forget the snapshots after it.  Called either by the UI thread with
+// the CPU stopped, or by the CPU loop between instructions.
+
+void PrvRestore (int index)
+{
+	EmAssert (index >= 0 && index < (int) gSnapshots.size ());
+	EmAssert (gShadowRAM && gShadowSize == gRAMBank_Size);
+
+	EmSnapshot*	snapshot = gSnapshots[index];
+
+	// Roll the copies of RAM back to the snapshot, a snapshot at a time,
+	// and then make the real thing match them.
+
+	for (int ii = (int) gSnapshots.size () - 2; ii >= index; --ii)
+	{
+		::PrvApplySaved (gSnapshots[ii]->fRAM, gShadowRAM);
+		::PrvApplySaved (gSnapshots[ii]->fMetaRAM, gShadowMetaRAM);
+	}
+
+	::PrvCopyChanged (gShadowRAM, gRAM_Memory);
+	::PrvCopyChanged (gShadowMetaRAM, gRAM_MetaMemory);
+
+	// Restore everything else.  The debugger's own state (breakpoints and
+	// the like) stays as it is now.
+
+	Chunk	debugState;
+
+	{
+		EmStreamChunk	stream (debugState);
+		ChunkFile		chunkFile (stream);
+		SessionFile		sessionFile (chunkFile);
+
+		Debug::Save (sessionFile);
+	}
+
+	{
+		EmValueChanger<Bool>	restoring (gRestoring, true);
+
+		EmStreamChunk	stream (snapshot->fState);
+		ChunkFile		chunkFile (stream);
+		SessionFile		sessionFile (chunkFile);
+
+		sessionFile.SetSnapshot (true);
+
+		EmAssert (gSession);
+		gSession->Load (sessionFile);
+		gSession->SetNeedPostLoad (false);
+	}
+
+	{
+		EmStreamChunk	stream (debugState);
+		ChunkFile		chunkFile (stream);
+		SessionFile		sessionFile (chunkFile);
+
+		Debug::Load (sessionFile);
+	}
+
+	MetaMemory::ResyncPages ();
+	EmScreen::InvalidateAll ();
+
+	gCPU68K->SetCycleSlowlyCount (snapshot->fCycleSlowlyCount);
+
+	EmAssert (::PrvNow () == snapshot->fNow);
+
+	// Replay the input from here up to the furthest point we've been to.
+
+	if (gHorizon < gPolls)
+		gHorizon = gPolls;
+
+	gPolls		= snapshot->fPolls;
+	gLogNext	= 0;
+
+	while (gLogNext < gLog.size () && gLog[gLogNext].fPoll <= gPolls)
+	{
+		++gLogNext;
+	}
+
+	// Forget the snapshots after this one.  This one is now the latest,
+	// so it doesn't need its saved pages any more.
+
+	while ((int) gSnapshots.size () > index + 1)
+	{
+		delete gSnapshots.back ();
+		gSnapshots.pop_back ();
+	}
+
+	snapshot->fRAM = EmSavedPages ();
+	snapshot->fMetaRAM = EmSavedPages ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvUpdateShadow
+// ---------------------------------------------------------------------------
+// Copy the pages that changed into the shadow copy, adding what they used
+// to be to "saved" (if it's not NULL).
+
+void PrvUpdateShadow (const uint8* live, uint8* shadow, EmSavedPages* saved)
+{
+	for (uint32 offset = 0; offset < gShadowSize; offset += kMetaPageSize)
+	{
+		uint32	len = min ((uint32) kMetaPageSize, gShadowSize - offset);
+
+		if (memcmp (live + offset, shadow + offset, len) != 0)
+		{
+			if (saved)
+			{
+				saved->fPages.push_back (offset);
+				saved->fData.insert (saved->fData.end (), shadow + offset, shadow + offset + len);
+			}
+
+			memcpy (shadow + offset, live + offset, len);
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvApplySaved
+// ---------------------------------------------------------------------------
+
+void PrvApplySaved (const EmSavedPages& saved, uint8* shadow)
+{
+	const uint8*	data = saved.fData.empty () ? NULL : &saved.fData[0];
+
+	vector<uint32>::const_iterator	iter = saved.fPages.begin ();
+	while (iter != saved.fPages.end ())
+	{
+		uint32	offset	= *iter;
+		uint32	len		= min ((uint32) kMetaPageSize, gShadowSize - offset);
+
+		memcpy (shadow + offset, data, len);
+		data += len;
+
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvCopyChanged
+// ---------------------------------------------------------------------------
+// Copy only the pages that differ, so that untouched pages of a mapped
+// meta-memory image stay uncommitted.
+
+void PrvCopyChanged (const uint8* shadow, uint8* live)
+{
+	for (uint32 offset = 0; offset < gShadowSize; offset += kMetaPageSize)
+	{
+		uint32	len = min ((uint32) kMetaPageSize, gShadowSize - offset);
+
+		if (memcmp (live + offset, shadow + offset, len) != 0)
+		{
+			memcpy (live + offset, shadow + offset, len);
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvStartMove
+//		 PrvEndMove
+// ---------------------------------------------------------------------------
+
+void PrvStartMove (int mode)
+{
+	gMode = mode;
+
+	if (gCPU68K)
+		gCPU68K->SetTimeTravelChecks (true);
+}
+
+
+void PrvEndMove (void)
+{
+	gMode = kModeIdle;
+
+	if (gCPU68K)
+		gCPU68K->SetTimeTravelChecks (false);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvArrive
+// ---------------------------------------------------------------------------
+// Called by the CPU loop when we've reached the target.  Stop, and tell
+// the debugger where we are.
+
+Bool PrvArrive (void)
+{
+	::PrvEndMove ();
+
+	return Debug::EnterDebugger (kException_Trace, NULL) == kError_NoError;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvNextInput
+// ---------------------------------------------------------------------------
+
+const EmLoggedInput& PrvNextInput (int kind, Bool remove)
+{
+	static EmLoggedInput	none;
+
+	if (gLogNext >= gLog.size () || gLog[gLogNext].fKind != kind)
+	{
+		EmAssert (false);
+		return none;
+	}
+
+	const EmLoggedInput&	input = gLog[gLogNext];
+
+	if (remove)
+		++gLogNext;
+
+	return input;
+}
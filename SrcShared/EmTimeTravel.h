@@ -0,0 +1,140 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2000-2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmTimeTravel_h
+#define EmTimeTravel_h
+
+class SessionFile;
+struct EmButtonEvent;
+struct EmKeyEvent;
+struct EmPenEvent;
+
+/*
+	EmTimeTravel lets the external debugger move the emulated device
+	backwards in time: step back one instruction, run back to the last
+	time a watchpoint (see EmWatchpoints.h) was hit, or go to any point
+	in the recorded history by its cycle number.
+
+	While it's on, it takes a snapshot every so many CPU cycles (the
+	TimeTravelInterval preference) and keeps the last few of them (the
+	TimeTravelSnapshots preference).  A snapshot is the session state
+	saved to memory, minus the RAM and meta-memory images.  Those are kept
+	as one copy of RAM as of the latest snapshot, plus, for every older
+	snapshot, the 4K pages that changed before the next one.
+
+	The CPU loop is deterministic except for user input, so it also logs
+	every button, key, and pen event handed to the emulated device, along
+	with how many times the device had asked for one.  After going back,
+	the device is given the logged events instead of new ones until it
+	gets to where the log ends.  Anything that reads the host clock
+	(such as the real-time clock) is not covered by this, unless the
+	session keeps deterministic time (see EmVirtualTime.h).
+
+	Going back works by restoring the last snapshot before the target and
+	running forward to it.  Finding the instruction before the current
+	one, or the last watchpoint hit, takes a second pass: run forward to
+	the present once to find the target, then restore and run to it.
+	While it's moving like this, breakpoints, watchpoints, and error
+	reports are ignored, since they were already dealt with the first time
+	around.  Restoring a snapshot throws away the ones after it; they're
+	taken again on the way forward.
+
+	Breakpoints and other debugger state are not part of the history.  A
+	reset, or loading a session, starts a new history.
+
+	The debugger drives all of this with sysPktTimeTravelCmd packets (see
+	SystemPacket::TimeTravel).  Moves send the usual state packet when
+	they get where they're going.
+*/
+
+#define sysPktTimeTravelCmd		0x72
+#define sysPktTimeTravelRsp		0xF2
+
+	// Operations in a sysPktTimeTravelCmd packet.
+enum
+{
+	kTimeTravelOpQuery			= 0,
+	kTimeTravelOpTurnOn			= 1,
+	kTimeTravelOpTurnOff		= 2,
+	kTimeTravelOpRunToCycle		= 3,
+	kTimeTravelOpReverseStep	= 4,
+	kTimeTravelOpReverseContinue	= 5
+};
+
+	// Status codes in a sysPktTimeTravelRsp packet.
+enum
+{
+	kTimeTravelErrNone			= 0,
+	kTimeTravelErrFormat		= 1,	// Malformed packet or unknown operation.
+	kTimeTravelErrOff			= 2,	// Time travel is not turned on.
+	kTimeTravelErrNoHistory		= 3,	// No snapshot that far back.
+	kTimeTravelErrNoWatchpoints	= 4		// Reverse-continue with nothing to look for.
+};
+
+	// "kind" values for HasLoggedInput.
+enum
+{
+	kTimeTravelButton,
+	kTimeTravelKey,
+	kTimeTravelPen
+};
+
+class EmTimeTravel
+{
+	public:
+		static void 			Initialize			(void);
+		static void 			Reset				(void);
+		static void 			Load				(SessionFile&);
+		static void 			Dispose 			(void);
+
+		static void 			TurnOn				(Bool);
+		static Bool 			IsOn				(void);
+
+		static uint64			GetNow				(void);
+		static uint64			GetOldest			(void);
+		static int				GetNumSnapshots		(void);
+
+		// Called with the CPU stopped in the debugger.  They return a
+		// kTimeTravelErr code, and set "running" to true if the CPU needs
+		// to be resumed to get to the target.
+
+		static int				RunToCycle			(uint64 target, Bool& running);
+		static int				ReverseStep			(Bool& running);
+		static int				ReverseContinue		(Bool& running);
+
+		static Bool 			IsMoving			(void);
+
+		// Called by the CPU thread.
+
+		static void 			CycleSlowly			(void);
+		static void 			TakeSnapshot		(void);
+		static Bool 			CheckInstruction	(void);
+		static void 			NoteWatchHit		(void);
+
+		// Called by EmSession's HasFooEvent and GetFooEvent methods.
+		// HasLoggedInput returns false if the event should come from
+		// the live queue (and be passed to LogInput when it's taken).
+
+		static Bool 			HasLoggedInput		(int kind, Bool& has);
+		static Bool 			IsReplayingInput	(void);
+
+		static void 			LogInput			(const EmButtonEvent&);
+		static void 			LogInput			(const EmKeyEvent&);
+		static void 			LogInput			(const EmPenEvent&);
+
+		static EmButtonEvent	NextButtonEvent		(Bool remove);
+		static EmKeyEvent		NextKeyEvent		(Bool remove);
+		static EmPenEvent		NextPenEvent		(Bool remove);
+};
+
+#endif	// EmTimeTravel_h
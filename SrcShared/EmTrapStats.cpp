@@ -0,0 +1,618 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2000-2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmTrapStats.h"
+
+#include "EmCPU68K.h"			// gCPU68K
+#include "EmDirRef.h"			// EmDirRef
+#include "EmFileRef.h"			// EmFileRef
+#include "EmMemory.h"			// CEnableFullAccess
+#include "EmPalmFunction.h"		// GetTrapName, IsSystemTrap
+#include "EmSession.h"			// gSession, AddInstructionBreakHandlers
+#include "ErrorHandling.h"		// Errors::ThrowIfStdCError
+#include "Logging.h"			// LogAppendMsg, LogGetDirectory
+#include "MetaMemory.h"			// MarkInstructionBreak, UnmarkInstructionBreak
+#include "Platform.h"			// Platform::GetMilliseconds
+#include "PreferenceMgr.h"		// Preference, kPrefKeyTrapStatsTiming
+
+#include <algorithm>			// sort
+#include <errno.h>				// errno
+#include <stdio.h>				// FILE, fopen
+#include <string.h>				// memset
+
+#if PLATFORM_UNIX
+#include <time.h>				// clock_gettime
+#endif
+
+
+// ===========================================================================
+//		 EmTrapStats
+// ===========================================================================
+
+// One slot for each possible trap word from sysTrapBase on up.  System
+// traps fill the bottom half, library dispatch indexes the top half.
+
+const int	kNumTrapSlots		= 0x1000;
+
+// Most traps that are pending at any one time are nested in one another,
+// plus a few blocked in other tasks.  Anything beyond this is a call
+// that will never return (the task was deleted, or it longjmp'ed out
+// with ErrThrow), so drop the oldest.
+
+const size_t	kMaxPendingTraps	= 64;
+
+struct EmPendingTrap
+{
+	uint16		fSlot;
+	emuptr		fReturnPC;
+	emuptr		fSP;
+	uint32		fCycles;
+	uint64		fNanoseconds;
+};
+
+typedef vector<EmPendingTrap>	EmPendingTrapList;
+
+static EmTrapStatsType		gTrapStats[kNumTrapSlots];
+static uint16				gTrapRefNum[kNumTrapSlots];
+
+static EmPendingTrapList	gPendingTraps;
+static Bool					gTiming;
+
+static long					gDumpInterval;
+static uint32				gLastDump;
+
+
+static int					PrvSlot					(uint16 trapWord);
+static uint64				PrvGetNanoseconds		(void);
+static void 				PrvRecord				(const EmPendingTrap&, uint32 cycles, uint64 nanoseconds);
+static void 				PrvPushPending			(const EmPendingTrap&);
+static void 				PrvInstallInstructionBreaks	(void);
+static void 				PrvRemoveInstructionBreaks	(void);
+static void 				PrvHandleInstructionBreak	(void);
+static bool 				PrvMoreCalls			(int a, int b);
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTrapStats::Initialize
+ *
+ * DESCRIPTION: Standard initialization function.  Responsible for
+ *				initializing this sub-system when a new session is
+ *				created.  Will be followed by at least one call to
+ *				Reset or Load.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTrapStats::Initialize (void)
+{
+	EmAssert (gSession);
+
+	gSession->AddInstructionBreakHandlers (
+		PrvInstallInstructionBreaks,
+		PrvRemoveInstructionBreaks,
+		PrvHandleInstructionBreak);
+
+	EmTrapStats::Clear ();
+
+	Preference<bool>	timingPref (kPrefKeyTrapStatsTiming);
+	Preference<long>	intervalPref (kPrefKeyTrapStatsInterval);
+
+	gTiming			= *timingPref;
+	gDumpInterval	= *intervalPref;
+	gLastDump		= Platform::GetMilliseconds ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTrapStats::Reset
+ *
+ * DESCRIPTION:	Standard reset function.  Forgets about any traps
+ *				that were waiting to return; the stacks they would have
+ *				returned on are gone.  The tallies are left alone.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTrapStats::Reset (void)
+{
+	gPendingTraps.clear ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTrapStats::Dispose
+ *
+ * DESCRIPTION:	Standard dispose function.  Completely release any
+ *				resources acquired or allocated in Initialize and/or
+ *				Load.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTrapStats::Dispose (void)
+{
+	gPendingTraps.clear ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTrapStats::Clear
+ *
+ * DESCRIPTION:	Zero all the tallies.  Traps that are waiting to return
+ *				are still timed when they do.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTrapStats::Clear (void)
+{
+	memset (gTrapStats, 0, sizeof (gTrapStats));
+	memset (gTrapRefNum, 0, sizeof (gTrapRefNum));
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTrapStats::SetTiming
+ *
+ * DESCRIPTION:	Turn latency measurement on or off.  Call counts are
+ *				kept either way.
+ *
+ * PARAMETERS:	timing - true to start timing traps.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTrapStats::SetTiming (Bool timing)
+{
+	if (gTiming == timing)
+		return;
+
+	EmAssert (gSession);
+	gSession->RemoveInstructionBreaks ();
+
+	gPendingTraps.clear ();
+	gTiming = timing;
+
+	gSession->InstallInstructionBreaks ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTrapStats::GetTiming
+ *
+ * DESCRIPTION:	Return whether or not latency is being measured.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	True if traps are being timed.
+ *
+ ***********************************************************************/
+
+Bool EmTrapStats::GetTiming (void)
+{
+	return gTiming;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTrapStats::EnterTrap
+ *
+ * DESCRIPTION:	Count a call to the given trap and, if timing, arrange
+ *				to find out when it returns.  Called from
+ *				EmPalmOS::HandleSystemCall just before the trap's
+ *				patches are run.
+ *
+ * PARAMETERS:	context - the trap being called.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTrapStats::EnterTrap (const SystemCallContext& context)
+{
+	int	slot = ::PrvSlot (context.fTrapWord);
+
+	++gTrapStats[slot].fCalls;
+
+	if (!::IsSystemTrap (context.fTrapWord))
+	{
+		gTrapRefNum[slot] = (uint16) context.fExtra;
+	}
+
+	if (!gTiming)
+		return;
+
+	EmAssert (gCPU68K);
+
+	EmPendingTrap	pending;
+
+	pending.fSlot			= slot;
+	pending.fReturnPC		= context.fNextPC;
+	pending.fSP				= gCPU68K->GetSP ();
+	pending.fCycles			= gCPU68K->GetCycleCount ();
+	pending.fNanoseconds	= ::PrvGetNanoseconds ();
+
+	::PrvPushPending (pending);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTrapStats::SkipTrap
+ *
+ * DESCRIPTION:	Note that the trap just passed to EnterTrap was
+ *				completely handled by its headpatch, and so will not
+ *				be returning through the ROM.
+ *
+ * PARAMETERS:	context - the trap that was called.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTrapStats::SkipTrap (const SystemCallContext& context)
+{
+	if (!gTiming || gPendingTraps.empty ())
+		return;
+
+	const EmPendingTrap&	pending = gPendingTraps.back ();
+
+	if (pending.fReturnPC != context.fNextPC)
+		return;
+
+	EmAssert (gCPU68K);
+
+	::PrvRecord (pending,
+		gCPU68K->GetCycleCount () - pending.fCycles,
+		::PrvGetNanoseconds () - pending.fNanoseconds);
+
+	EmAssert (gSession);
+	gSession->RemoveInstructionBreaks ();
+
+	gPendingTraps.pop_back ();
+
+	gSession->InstallInstructionBreaks ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTrapStats::GetStats
+ *
+ * DESCRIPTION:	Return the tally for the given trap.
+ *
+ * PARAMETERS:	trapWord - the trap to look up.  For library traps,
+ *					the tally covers all libraries.
+ *
+ *				stats - receives the tally.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTrapStats::GetStats (uint16 trapWord, EmTrapStatsType& stats)
+{
+	stats = gTrapStats[::PrvSlot (trapWord)];
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTrapStats::Dump
+ *
+ * DESCRIPTION:	Write the tallies to a tab-delimited text file, one
+ *				line per trap that has been called, most-called first.
+ *				Must be called on the CPU thread, since naming library
+ *				traps may look into emulated memory.
+ *
+ * PARAMETERS:	ref - the file to write.
+ *
+ * RETURNED:	Nothing.  Throws an ErrCode if the file can't be
+ *				written.
+ *
+ ***********************************************************************/
+
+void EmTrapStats::Dump (const EmFileRef& ref)
+{
+	vector<int>	slots;
+
+	for (int slot = 0; slot < kNumTrapSlots; ++slot)
+	{
+		if (gTrapStats[slot].fCalls != 0)
+		{
+			slots.push_back (slot);
+		}
+	}
+
+	sort (slots.begin (), slots.end (), PrvMoreCalls);
+
+	FILE*	f = fopen (ref.GetFullPath ().c_str (), "w");
+	if (!f)
+	{
+		Errors::ThrowIfStdCError (errno);
+	}
+
+	fprintf (f, "trap\tcalls\ttimed\tcycles\tavg cycles\tmax cycles\thost usec\tavg host usec\tmax host usec\tname\n");
+
+	CEnableFullAccess	munge;
+
+	vector<int>::iterator	iter = slots.begin ();
+	while (iter != slots.end ())
+	{
+		const EmTrapStatsType&	stats = gTrapStats[*iter];
+
+		uint16	trapWord	= (uint16) (sysTrapBase + *iter);
+		uint32	refNum		= ::IsSystemTrap (trapWord) ? sysInvalidRefNum : gTrapRefNum[*iter];
+		uint32	timed		= stats.fTimedCalls ? stats.fTimedCalls : 1;
+
+		fprintf (f, "0x%04X\t%lu\t%lu\t%llu\t%lu\t%lu\t%llu\t%llu\t%llu\t%s\n",
+			(unsigned int) trapWord,
+			(unsigned long) stats.fCalls,
+			(unsigned long) stats.fTimedCalls,
+			stats.fCycles,
+			(unsigned long) (stats.fCycles / timed),
+			(unsigned long) stats.fMaxCycles,
+			stats.fNanoseconds / 1000,
+			stats.fNanoseconds / 1000 / timed,
+			stats.fMaxNanoseconds / 1000,
+			::GetTrapName (trapWord, refNum));
+
+		++iter;
+	}
+
+	int	err = ferror (f);
+	fclose (f);
+
+	if (err)
+	{
+		Errors::ThrowIfStdCError (EIO);
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTrapStats::GetDumpFile
+ *
+ * DESCRIPTION:	Return the file that periodic dumps are written to.
+ *				It goes where the log files go.  Each dump
+ *				overwrites the last; each one holds the totals so far.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	The file reference.
+ *
+ ***********************************************************************/
+
+EmFileRef EmTrapStats::GetDumpFile (void)
+{
+	return EmFileRef (::LogGetDirectory (), "TrapStats.txt");
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmTrapStats::DumpPeriodically
+ *
+ * DESCRIPTION:	If the TrapStatsInterval preference is set and that
+ *				many seconds have passed since the last time, write
+ *				the tallies to TrapStats.txt in the log directory.
+ *				Called from EmCPU68K::CycleSlowly.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmTrapStats::DumpPeriodically (void)
+{
+	if (gDumpInterval <= 0)
+		return;
+
+	uint32	now = Platform::GetMilliseconds ();
+
+	if (now - gLastDump < (uint32) gDumpInterval * 1000)
+		return;
+
+	gLastDump = now;
+
+	try
+	{
+		EmTrapStats::Dump (EmTrapStats::GetDumpFile ());
+	}
+	catch (ErrCode err)
+	{
+		// Don't keep trying (and failing) every few seconds.
+
+		LogAppendMsg ("EmTrapStats: unable to write trap statistics (error %ld); periodic dumps turned off.", (long) err);
+
+		gDumpInterval = 0;
+	}
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 PrvSlot
+// ---------------------------------------------------------------------------
+
+int PrvSlot (uint16 trapWord)
+{
+	return trapWord & (kNumTrapSlots - 1);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvGetNanoseconds
+// ---------------------------------------------------------------------------
+
+uint64 PrvGetNanoseconds (void)
+{
+#if PLATFORM_UNIX
+	struct timespec	ts;
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+
+	return (uint64) ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+	return (uint64) Platform::GetMilliseconds () * 1000000;
+#endif
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvRecord
+// ---------------------------------------------------------------------------
+
+void PrvRecord (const EmPendingTrap& pending, uint32 cycles, uint64 nanoseconds)
+{
+	EmTrapStatsType&	stats = gTrapStats[pending.fSlot];
+
+	++stats.fTimedCalls;
+
+	stats.fCycles		+= cycles;
+	stats.fNanoseconds	+= nanoseconds;
+
+	if (stats.fMaxCycles < cycles)
+		stats.fMaxCycles = cycles;
+
+	if (stats.fMaxNanoseconds < nanoseconds)
+		stats.fMaxNanoseconds = nanoseconds;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvPushPending
+// ---------------------------------------------------------------------------
+// Add a trap to the list of those waiting to return, and set an
+// instruction break on its return address.
+
+void PrvPushPending (const EmPendingTrap& pending)
+{
+	EmAssert (gSession);
+	gSession->RemoveInstructionBreaks ();
+
+	if (gPendingTraps.size () >= kMaxPendingTraps)
+	{
+		gPendingTraps.erase (gPendingTraps.begin ());
+	}
+
+	gPendingTraps.push_back (pending);
+
+	gSession->InstallInstructionBreaks ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvInstallInstructionBreaks
+// ---------------------------------------------------------------------------
+
+void PrvInstallInstructionBreaks (void)
+{
+	EmPendingTrapList::iterator	iter = gPendingTraps.begin ();
+
+	while (iter != gPendingTraps.end ())
+	{
+		MetaMemory::MarkInstructionBreak (iter->fReturnPC);
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvRemoveInstructionBreaks
+// ---------------------------------------------------------------------------
+
+void PrvRemoveInstructionBreaks (void)
+{
+	EmPendingTrapList::iterator	iter = gPendingTraps.begin ();
+
+	while (iter != gPendingTraps.end ())
+	{
+		MetaMemory::UnmarkInstructionBreak (iter->fReturnPC);
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvHandleInstructionBreak
+// ---------------------------------------------------------------------------
+// See if we've reached the return address of a trap we're timing.  The
+// stack pointer must also be back where it was when the trap was made;
+// otherwise, this is some other pass through the same code (recursion,
+// or another task).  Search from the end, where the most recent (and
+// most likely to be returning) calls are.
+
+void PrvHandleInstructionBreak (void)
+{
+	EmAssert (gCPU68K);
+
+	emuptr	pc = gCPU68K->GetPC ();
+	emuptr	sp = gCPU68K->GetSP ();
+
+	EmPendingTrapList::iterator	iter = gPendingTraps.end ();
+
+	while (iter != gPendingTraps.begin ())
+	{
+		--iter;
+
+		if (iter->fReturnPC == pc && iter->fSP == sp)
+		{
+			::PrvRecord (*iter,
+				gCPU68K->GetCycleCount () - iter->fCycles,
+				::PrvGetNanoseconds () - iter->fNanoseconds);
+
+			EmAssert (gSession);
+			gSession->RemoveInstructionBreaks ();
+
+			gPendingTraps.erase (iter);
+
+			gSession->InstallInstructionBreaks ();
+
+			return;
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvMoreCalls
+// ---------------------------------------------------------------------------
+
+bool PrvMoreCalls (int a, int b)
+{
+	return gTrapStats[a].fCalls > gTrapStats[b].fCalls;
+}
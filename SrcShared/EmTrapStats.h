@@ -0,0 +1,78 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2000-2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmTrapStats_h
+#define EmTrapStats_h
+
+class EmFileRef;
+struct SystemCallContext;
+
+/*
+	EmTrapStats keeps a running tally of the system and library traps
+	made by the emulated Palm OS.  It's a lightweight alternative to the
+	profiler for answering "which OS calls does this application lean on,
+	and how long do they take?"
+
+	Call counts are always kept; it costs one array increment per trap.
+	Latency (emulated cycles and host nanoseconds from the trap to its
+	return) is kept only while timing is on.  Timing works by setting an
+	instruction break on the return address of each trap, in the same way
+	that tailpatches do, so it never changes the emulated cycle count --
+	just the host time it takes to get there.
+
+	The statistics are kept in fixed arrays indexed by the low 12 bits of
+	the trap word.  Calls to library functions are pooled by dispatch
+	index, regardless of library; the dump names them after the most
+	recently called library.
+
+	Calls that Poser makes on its own behalf (when the session is nested)
+	are not counted.
+
+	The tally can be read and reset from Palm OS code (and so over RPC)
+	with the HostTrapStats* HostControl functions, and can be written to
+	a text file at a regular interval according to the TrapStatsInterval
+	preference.
+*/
+
+struct EmTrapStatsType
+{
+	uint32		fCalls;			// Number of times called.
+	uint32		fTimedCalls;	// Number of those that were timed.
+	uint64		fCycles;		// Total emulated cycles in timed calls.
+	uint32		fMaxCycles;		// Most emulated cycles for any one call.
+	uint64		fNanoseconds;	// Total host time in timed calls.
+	uint64		fMaxNanoseconds;// Most host time for any one call.
+};
+
+class EmTrapStats
+{
+	public:
+		static void 			Initialize			(void);
+		static void 			Reset				(void);
+		static void 			Dispose 			(void);
+
+		static void 			Clear				(void);
+		static void 			SetTiming			(Bool);
+		static Bool 			GetTiming			(void);
+
+		static void 			EnterTrap			(const SystemCallContext&);
+		static void 			SkipTrap			(const SystemCallContext&);
+
+		static void 			GetStats			(uint16 trapWord, EmTrapStatsType&);
+
+		static void 			Dump				(const EmFileRef&);
+		static EmFileRef		GetDumpFile 		(void);
+		static void 			DumpPeriodically	(void);
+};
+
+#endif	// EmTrapStats_h
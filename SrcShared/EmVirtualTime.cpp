@@ -0,0 +1,322 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2000-2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmVirtualTime.h"
+
+#include "ChunkFile.h"			// Chunk, EmStreamChunk
+#include "EmCPU68K.h"			// gCPU68K
+#include "Platform.h"			// Platform::GetMilliseconds
+#include "PreferenceMgr.h"		// Preference
+#include "SessionFile.h"		// SessionFile
+
+
+// ===========================================================================
+//		 EmVirtualTime
+// ===========================================================================
+
+	// Nominal speed of the Dragonball CPUs (16.58MHz).  The real clock
+	// rate can be changed by the OS; we don't follow it, so that time
+	// never jumps.
+const uint32	kCyclesPerMillisecond	= 16580;
+
+static Bool 	gOn;
+static time_t	gEpoch;
+
+	// The cycle count, widened to 64 bits.  It's brought up to date in
+	// CycleSlowly, long before the CPU's 32-bit count can wrap.
+static uint64	gNowBase;
+static uint32	gCountBase;
+
+
+static uint32	PrvCycleCount		(void);
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmVirtualTime::Initialize
+ *
+ * DESCRIPTION: Standard initialization function.  Responsible for
+ *				initializing this sub-system when a new session is
+ *				created.  Will be followed by at least one call to
+ *				Reset or Load.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmVirtualTime::Initialize (void)
+{
+	Preference<bool>	onPref (kPrefKeyDeterministicTime);
+	Preference<long>	epochPref (kPrefKeyDeterministicEpoch);
+
+	gOn			= *onPref;
+	gEpoch		= (time_t) *epochPref;
+	gNowBase	= 0;
+	gCountBase	= 0;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmVirtualTime::Reset
+ *
+ * DESCRIPTION: Standard reset function.  Sets the sub-system to a
+ *				default state.  This occurs not only on a Reset (as
+ *				from the menu item), but also when the sub-system
+ *				is first initialized (Reset is called after Initialize)
+ *				as well as when the system is re-loaded from an
+ *				insufficient session file.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmVirtualTime::Reset (void)
+{
+	// Resetting the device doesn't turn the clock back, but it does
+	// start the CPU's cycle count over.
+
+	gCountBase = ::PrvCycleCount ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmVirtualTime::Save
+ *
+ * DESCRIPTION: Standard save function.  Saves any sub-system state to
+ *				the given session file.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmVirtualTime::Save (SessionFile& f)
+{
+	const long	kCurrentVersion = 1;
+
+	Chunk			chunk;
+	EmStreamChunk	s (chunk);
+
+	s << kCurrentVersion;
+	s << (bool) gOn;
+	s << (int32) gEpoch;
+	s << EmVirtualTime::GetCycles ();
+
+	f.WriteVirtualTimeInfo (chunk);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmVirtualTime::Load
+ *
+ * DESCRIPTION: Standard load function.  Loads any sub-system state
+ *				from the given session file.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmVirtualTime::Load (SessionFile& f)
+{
+	Chunk	chunk;
+	if (f.ReadVirtualTimeInfo (chunk))
+	{
+		long			version;
+		EmStreamChunk	s (chunk);
+
+		s >> version;
+
+		if (version >= 1)
+		{
+			bool	on;
+			int32	epoch;
+
+			s >> on;
+			s >> epoch;
+			s >> gNowBase;
+
+			gOn		= on;
+			gEpoch	= (time_t) epoch;
+		}
+	}
+
+	gCountBase = ::PrvCycleCount ();
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmVirtualTime::Dispose
+ *
+ * DESCRIPTION: Standard dispose function.	Completely release any
+ *				resources acquired or allocated in Initialize and/or
+ *				Load.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmVirtualTime::Dispose (void)
+{
+	gOn = false;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmVirtualTime::IsOn
+ *
+ * DESCRIPTION: Return whether time comes from the CPU instead of the
+ *				host.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	True if so.
+ *
+ ***********************************************************************/
+
+Bool EmVirtualTime::IsOn (void)
+{
+	return gOn;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmVirtualTime::CycleSlowly
+ *
+ * DESCRIPTION: Called from EmCPU68K::CycleSlowly.  Keep the 64-bit
+ *				cycle count up to date.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmVirtualTime::CycleSlowly (void)
+{
+	uint32	count = ::PrvCycleCount ();
+
+	gNowBase	+= (uint32) (count - gCountBase);
+	gCountBase	= count;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmVirtualTime::GetCycles
+ *
+ * DESCRIPTION: Return the number of CPU cycles executed since the
+ *				session was created.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	The cycle count.
+ *
+ ***********************************************************************/
+
+uint64 EmVirtualTime::GetCycles (void)
+{
+	return gNowBase + (uint32) (::PrvCycleCount () - gCountBase);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmVirtualTime::GetMilliseconds
+ *
+ * DESCRIPTION: Drop-in replacement for Platform::GetMilliseconds, for
+ *				use where the result can affect the emulated device.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	A millisecond counter.  Only differences between two
+ *				values mean anything.
+ *
+ ***********************************************************************/
+
+uint32 EmVirtualTime::GetMilliseconds (void)
+{
+	if (!gOn)
+		return Platform::GetMilliseconds ();
+
+	return (uint32) (EmVirtualTime::GetCycles () / kCyclesPerMillisecond);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmVirtualTime::GetTime
+ *
+ * DESCRIPTION: Drop-in replacement for time (NULL).
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	The current time.
+ *
+ ***********************************************************************/
+
+time_t EmVirtualTime::GetTime (void)
+{
+	if (!gOn)
+		return time (NULL);
+
+	return gEpoch + (time_t) (EmVirtualTime::GetCycles () / (kCyclesPerMillisecond * 1000));
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmVirtualTime::GetLocalTime
+ *
+ * DESCRIPTION: Drop-in replacement for *localtime (&t).  In
+ *				deterministic mode, the time is not adjusted for the
+ *				host's time zone.
+ *
+ * PARAMETERS:	t - the time to convert.
+ *
+ * RETURNED:	The time broken down into its fields.
+ *
+ ***********************************************************************/
+
+struct tm EmVirtualTime::GetLocalTime (time_t t)
+{
+	if (!gOn)
+		return *localtime (&t);
+
+	return *gmtime (&t);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvCycleCount
+// ---------------------------------------------------------------------------
+
+uint32 PrvCycleCount (void)
+{
+	return gCPU68K ? gCPU68K->GetCycleCount () : 0;
+}
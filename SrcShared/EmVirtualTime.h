@@ -0,0 +1,63 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2000-2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmVirtualTime_h
+#define EmVirtualTime_h
+
+#include <time.h>				// time_t
+
+class SessionFile;
+
+/*
+	EmVirtualTime is where the emulated device gets the time of day and
+	the elapsed time from.  Normally, that's the host's clock.  In a
+	session created with the DeterministicTime preference on, it's the
+	number of CPU cycles executed instead, counted from a fixed date and
+	time (the DeterministicEpoch preference).  Running the same session
+	with the same input then gives the same results, no matter how fast
+	the host is or what time it is, which is what Gremlin replays, event
+	minimization, and time travel depend on.
+
+	In deterministic mode, times are given as UTC (there's no time zone
+	to leak in), and a millisecond is a fixed number of cycles.  The
+	clock is saved with the session, so it carries on from where it was
+	when the session is loaded again.
+
+	Timing that belongs to the host rather than the device (dialogs,
+	RPC timeouts, screen refresh) still uses Platform::GetMilliseconds.
+
+	The cycle count itself (GetCycles) is kept whether or not
+	deterministic time is on.  It's the one 64-bit cycle clock in the
+	emulator; EmTimeTravel uses it too.
+*/
+
+class EmVirtualTime
+{
+	public:
+		static void 			Initialize			(void);
+		static void 			Reset				(void);
+		static void 			Save				(SessionFile&);
+		static void 			Load				(SessionFile&);
+		static void 			Dispose 			(void);
+
+		static Bool 			IsOn				(void);
+
+		static void 			CycleSlowly			(void);
+
+		static uint64			GetCycles			(void);
+		static uint32			GetMilliseconds		(void);
+		static time_t			GetTime				(void);
+		static struct tm		GetLocalTime		(time_t);
+};
+
+#endif	// EmVirtualTime_h
@@ -0,0 +1,278 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2000-2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmWatchpoints.h"
+
+#include "DebugMgr.h"			// BreakpointCondition, Debug::DeleteBreakpointCondition
+#include "EmMemory.h"			// CEnableFullAccess
+#include "EmSession.h"			// gSession->ScheduleDeferredError
+#include "EmTimeTravel.h"		// EmTimeTravel::IsMoving, NoteWatchHit
+#include "ErrorHandling.h"		// EmDeferredErrWatchpoint
+
+#include <string.h>				// memset
+
+
+// ===========================================================================
+//		 EmWatchpoints
+// ===========================================================================
+
+const int		kNumWatchBanks	= 0x10000;
+
+struct EmWatchpoint
+{
+	int						fID;
+	emuptr					fBegin;
+	uint32					fSize;
+	int						fAccess;		// kWatchRead and/or kWatchWrite
+	BreakpointCondition*	fCondition;		// NULL if none
+};
+
+	// Kept sorted by fBegin, so that DoCheck can stop looking as soon
+	// as it reaches a watch starting after the access.
+typedef vector<EmWatchpoint>	EmWatchpointList;
+
+uint16						gWatchReadPages[kNumWatchBanks];
+uint16						gWatchWritePages[kNumWatchBanks];
+
+static EmWatchpointList		gWatchpoints;
+static int					gNextID = 1;
+
+
+static void 	PrvSetPages			(uint16* pages, emuptr begin, uint32 size);
+
+
+// ---------------------------------------------------------------------------
+//		 EmWatchpoints::Dispose
+// ---------------------------------------------------------------------------
+
+void EmWatchpoints::Dispose (void)
+{
+	EmWatchpoints::RemoveAll ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmWatchpoints::Add
+// ---------------------------------------------------------------------------
+// Watch the given range for the given kinds of access.  The watch takes
+// ownership of the condition.  Returns an ID for Remove, or zero if the
+// parameters are bad (in which case the condition is deleted).
+
+int EmWatchpoints::Add (emuptr addr, uint32 size, int access,
+						BreakpointCondition* condition)
+{
+	if (size == 0 || (access & (kWatchRead | kWatchWrite)) == 0 ||
+		addr + size - 1 < addr)
+	{
+		Debug::DeleteBreakpointCondition (condition);
+		return 0;
+	}
+
+	EmWatchpoint	watch;
+
+	watch.fID			= gNextID++;
+	watch.fBegin		= addr;
+	watch.fSize			= size;
+	watch.fAccess		= access;
+	watch.fCondition	= condition;
+
+	EmWatchpointList::iterator	iter = gWatchpoints.begin ();
+	while (iter != gWatchpoints.end () && iter->fBegin <= addr)
+	{
+		++iter;
+	}
+
+	gWatchpoints.insert (iter, watch);
+
+	EmWatchpoints::RebuildPages ();
+
+	return watch.fID;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmWatchpoints::Remove
+// ---------------------------------------------------------------------------
+
+void EmWatchpoints::Remove (int id)
+{
+	EmWatchpointList::iterator	iter = gWatchpoints.begin ();
+	while (iter != gWatchpoints.end ())
+	{
+		if (iter->fID == id)
+		{
+			Debug::DeleteBreakpointCondition (iter->fCondition);
+			gWatchpoints.erase (iter);
+
+			EmWatchpoints::RebuildPages ();
+			break;
+		}
+
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmWatchpoints::RemoveRange
+// ---------------------------------------------------------------------------
+// Remove all watches on exactly the given range.  Returns how many there
+// were.
+
+int EmWatchpoints::RemoveRange (emuptr addr, uint32 size)
+{
+	int		removed = 0;
+
+	EmWatchpointList::iterator	iter = gWatchpoints.begin ();
+	while (iter != gWatchpoints.end ())
+	{
+		if (iter->fBegin == addr && iter->fSize == size)
+		{
+			Debug::DeleteBreakpointCondition (iter->fCondition);
+			iter = gWatchpoints.erase (iter);
+			++removed;
+		}
+		else
+		{
+			++iter;
+		}
+	}
+
+	if (removed)
+	{
+		EmWatchpoints::RebuildPages ();
+	}
+
+	return removed;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmWatchpoints::RemoveAll
+// ---------------------------------------------------------------------------
+
+void EmWatchpoints::RemoveAll (void)
+{
+	EmWatchpointList::iterator	iter = gWatchpoints.begin ();
+	while (iter != gWatchpoints.end ())
+	{
+		Debug::DeleteBreakpointCondition (iter->fCondition);
+		++iter;
+	}
+
+	gWatchpoints.clear ();
+
+	EmWatchpoints::RebuildPages ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmWatchpoints::Count
+// ---------------------------------------------------------------------------
+
+int EmWatchpoints::Count (void)
+{
+	return (int) gWatchpoints.size ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmWatchpoints::DoCheck
+// ---------------------------------------------------------------------------
+// Called by CheckRead and CheckWrite when an access touches a page with a
+// watch on it.  Report the first watch that the access overlaps, if its
+// condition holds.
+
+void EmWatchpoints::DoCheck (emuptr address, int size, Bool forRead)
+{
+	// Don't report Poser's own accesses.  This also keeps conditions
+	// that read memory (see below) from coming back in here.
+
+	if (CEnableFullAccess::AccessOK ())
+		return;
+
+	int		access	= forRead ? kWatchRead : kWatchWrite;
+	emuptr	end		= address + size;
+
+	EmWatchpointList::iterator	iter = gWatchpoints.begin ();
+	while (iter != gWatchpoints.end () && iter->fBegin < end)
+	{
+		if ((iter->fAccess & access) != 0 &&
+			address < iter->fBegin + iter->fSize)
+		{
+			Bool	fire = true;
+
+			if (iter->fCondition)
+			{
+				CEnableFullAccess	munge;
+
+				fire = iter->fCondition->Evaluate ();
+			}
+
+			if (fire)
+			{
+				// While replaying history, hits are what reverse-continue
+				// is looking for, not something to report.
+
+				if (EmTimeTravel::IsMoving ())
+					EmTimeTravel::NoteWatchHit ();
+				else
+					gSession->ScheduleDeferredError (new EmDeferredErrWatchpoint (
+						address, size, iter->fBegin, iter->fSize, forRead));
+				break;
+			}
+		}
+
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmWatchpoints::RebuildPages
+// ---------------------------------------------------------------------------
+
+void EmWatchpoints::RebuildPages (void)
+{
+	memset (gWatchReadPages, 0, sizeof (gWatchReadPages));
+	memset (gWatchWritePages, 0, sizeof (gWatchWritePages));
+
+	EmWatchpointList::iterator	iter = gWatchpoints.begin ();
+	while (iter != gWatchpoints.end ())
+	{
+		if (iter->fAccess & kWatchRead)
+			::PrvSetPages (gWatchReadPages, iter->fBegin, iter->fSize);
+
+		if (iter->fAccess & kWatchWrite)
+			::PrvSetPages (gWatchWritePages, iter->fBegin, iter->fSize);
+
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvSetPages
+// ---------------------------------------------------------------------------
+
+void PrvSetPages (uint16* pages, emuptr begin, uint32 size)
+{
+	uint32	firstPage	= begin >> 12;
+	uint32	lastPage	= (begin + size - 1) >> 12;
+
+	for (uint32 page = firstPage; page <= lastPage; ++page)
+	{
+		pages[page >> 4] |= 1 << (page & 0x0F);
+	}
+}
@@ -0,0 +1,93 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2000-2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmWatchpoints_h
+#define EmWatchpoints_h
+
+struct BreakpointCondition;
+
+/*
+	EmWatchpoints keeps any number of watched address ranges.  Each one
+	can be watched for reads, writes, or both, and can have a breakpoint
+	condition (see DebugMgr.h) that must be true for it to fire.  When a
+	watched range is accessed, an EmDeferredErrWatchpoint is scheduled.
+
+	The RAM accessors call CheckRead and CheckWrite on every access.  To
+	keep that cheap, there's a bit for every 4K page of the address space
+	that says whether any watch touches it (one set of bits for reads and
+	one for writes).  Only accesses to pages with watches on them go on to
+	look through the list of watches; everything else costs two table
+	lookups.
+
+	Accesses Poser makes on its own behalf (under CEnableFullAccess) are
+	never reported.
+*/
+
+enum
+{
+	kWatchRead		= 0x01,
+	kWatchWrite		= 0x02
+};
+
+	// One uint16 per 64K bank, with one bit for each 4K page in it.
+extern uint16	gWatchReadPages[];
+extern uint16	gWatchWritePages[];
+
+class EmWatchpoints
+{
+	public:
+		static void 			Dispose 			(void);
+
+		static int				Add					(emuptr addr, uint32 size, int access,
+													 BreakpointCondition* condition);
+		static void 			Remove				(int id);
+		static int				RemoveRange			(emuptr addr, uint32 size);
+		static void 			RemoveAll			(void);
+		static int				Count				(void);
+
+		static void 			CheckRead			(emuptr address, int size);	// Inlined, defined below
+		static void 			CheckWrite			(emuptr address, int size);	// Inlined, defined below
+
+	private:
+		static Bool 			IsWatchedPage		(const uint16* pages, emuptr address);	// Inlined, defined below
+		static void 			DoCheck				(emuptr address, int size, Bool forRead);
+		static void 			RebuildPages		(void);
+};
+
+
+inline Bool EmWatchpoints::IsWatchedPage (const uint16* pages, emuptr address)
+{
+	return (pages[address >> 16] >> ((address >> 12) & 0x0F)) & 1;
+}
+
+
+inline void EmWatchpoints::CheckRead (emuptr address, int size)
+{
+	if (IsWatchedPage (gWatchReadPages, address) ||
+		IsWatchedPage (gWatchReadPages, address + size - 1))
+	{
+		EmWatchpoints::DoCheck (address, size, true);
+	}
+}
+
+
+inline void EmWatchpoints::CheckWrite (emuptr address, int size)
+{
+	if (IsWatchedPage (gWatchWritePages, address) ||
+		IsWatchedPage (gWatchWritePages, address + size - 1))
+	{
+		EmWatchpoints::DoCheck (address, size, false);
+	}
+}
+
+#endif	// EmWatchpoints_h
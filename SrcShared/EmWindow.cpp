@@ -536,64 +536,76 @@ void EmWindow::GetLCDContents (EmScreenUpdateInfo& info)
 
 void EmWindow::PaintScreen (Bool drawCase, Bool wholeLCD)
 {
-	EmScreenUpdateInfo	info;
+	EmScreenUpdateInfo	localInfo;
+	EmScreenFrame*		frame = NULL;
 	Bool				bufferDirty;
 	Bool				drawFrame = false;
 	Bool				drawLED = false;
 	Bool				drawLCD = false;
 	Bool				lcdOn;
 	Bool				backlightOn;
+	Bool				hasFrame;
 	uint16				ledState;
 
+	// If the CPU thread is publishing frames (and is running, so that it
+	// will keep doing so), take the newest one.  No need to stop the CPU.
+
+	if (EmScreen::IsPublishing () && gSession &&
+		gSession->GetSessionState () == kRunning)
 	{
-                //PHEM_Log_Msg("PaintScreen");
-		// Pause the CPU so that we can get the current hardware state.
+		frame = EmScreen::TakeFrame (bufferDirty);
 
-		EmSessionStopper	stopper (gSession, kStopNow);
+		lcdOn		= frame->fInfo.fLCDOn;
+		backlightOn	= frame->fBacklightOn;
+		hasFrame	= frame->fLCDHasFrame;
+		ledState	= frame->fLEDState;
 
-		if (!stopper.Stopped ())
-			return;
+		bufferDirty	= bufferDirty && frame->fBufferDirty;
 
-		// Determine if we have to force the redrawing of the background.
-		// We have to do that if the LCD or LEDs have turned off.
+		this->CheckHardwareState (lcdOn, backlightOn, hasFrame, ledState,
+			drawCase, drawFrame, drawLCD, drawLED);
 
-		lcdOn		= EmHAL::GetLCDScreenOn ();
-		backlightOn	= EmHAL::GetLCDBacklightOn ();
-		ledState	= EmHAL::GetLEDState ();
+		// A frame always holds the entire LCD image, so drawing all of
+		// it is just a matter of saying so.
 
-		if (!lcdOn && fOldLCDOn)
-		{
-			drawCase = true;
-		}
+		EmPoint	size = frame->fInfo.fImage.GetSize ();
 
-		if (!ledState && fOldLEDState)
+		if (wholeLCD || drawLCD)
 		{
-			drawCase = true;
-		}
+			frame->fInfo.fDirtyRegion	= EmRect (0, 0, size.fX, size.fY);
+			frame->fInfo.fFirstLine		= 0;
+			frame->fInfo.fLastLine		= size.fY;
 
-		// Determine if we have to draw the LCD or LED.  We'd have to do that
-		// if their state has changed or if we had to draw the background.
-
-		if (drawCase || (lcdOn != fOldLCDOn) || (backlightOn != fOldBacklightOn))
-		{
 			drawLCD		= lcdOn;
 		}
 
-		if (drawCase || (lcdOn != fOldLCDOn))
+		if (bufferDirty)
 		{
-			drawFrame	= lcdOn && EmHAL::GetLCDHasFrame ();
+			drawLCD		= lcdOn;
 		}
 
-                //PHEM_Log_Msg("some vars set");
-		if (drawCase || (ledState != fOldLEDState))
+		if (size.fX == 0 || size.fY == 0)
 		{
-			drawLED		= ledState != 0;
-                        PHEM_Enable_LED(drawLED);
+			drawLCD		= false;
 		}
+	}
+	else
+	{
+                //PHEM_Log_Msg("PaintScreen");
+		// Pause the CPU so that we can get the current hardware state.
 
-		fOldLCDOn		= lcdOn;
-		fOldBacklightOn	= backlightOn;
-		fOldLEDState	= ledState;
+		EmSessionStopper	stopper (gSession, kStopNow);
+
+		if (!stopper.Stopped ())
+			return;
+
+		lcdOn		= EmHAL::GetLCDScreenOn ();
+		backlightOn	= EmHAL::GetLCDBacklightOn ();
+		hasFrame	= EmHAL::GetLCDHasFrame ();
+		ledState	= EmHAL::GetLEDState ();
+
+		this->CheckHardwareState (lcdOn, backlightOn, hasFrame, ledState,
+			drawCase, drawFrame, drawLCD, drawLED);
 
 		// If we're going to be drawing the whole LCD, then invalidate
 		// the entire screen.
@@ -607,7 +619,7 @@ void EmWindow::PaintScreen (Bool drawCase, Bool wholeLCD)
 		// Get the current LCD state.
 
                 //PHEM_Log_Msg("GetBits");
-		bufferDirty = EmScreen::GetBits (info);
+		bufferDirty = EmScreen::GetBits (localInfo);
 
 		// If the buffer was dirty, that's another reason to draw the LCD.
 
@@ -619,13 +631,23 @@ void EmWindow::PaintScreen (Bool drawCase, Bool wholeLCD)
 		// If there is no width or height to the buffer, then that's a
 		// great reason to NOT draw the LCD.
 
-		EmPoint	size = info.fImage.GetSize ();
+		EmPoint	size = localInfo.fImage.GetSize ();
 		if (size.fX == 0 || size.fY == 0)
 		{
 			drawLCD		= false;
 		}
+
+		// If frames are being published, what we just fetched won't
+		// make it into the CPU thread's copy of the LCD.
+
+		if (EmScreen::IsPublishing ())
+		{
+			EmScreen::RequestFullFrame ();
+		}
 	}
 
+	const EmScreenUpdateInfo&	info = frame ? frame->fInfo : localInfo;
+
                 //PHEM_Log_Msg("Set up palette");
 	// Set up the graphics palette.
 
@@ -689,6 +711,54 @@ void EmWindow::PaintScreen (Bool drawCase, Bool wholeLCD)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmWindow::CheckHardwareState
+// ---------------------------------------------------------------------------
+// Compare the LCD and LED state against what we last drew, and determine
+// which parts of the window need to be redrawn as a result.
+
+void EmWindow::CheckHardwareState (Bool lcdOn, Bool backlightOn, Bool hasFrame,
+								   uint16 ledState, Bool& drawCase, Bool& drawFrame,
+								   Bool& drawLCD, Bool& drawLED)
+{
+	// Determine if we have to force the redrawing of the background.
+	// We have to do that if the LCD or LEDs have turned off.
+
+	if (!lcdOn && fOldLCDOn)
+	{
+		drawCase = true;
+	}
+
+	if (!ledState && fOldLEDState)
+	{
+		drawCase = true;
+	}
+
+	// Determine if we have to draw the LCD or LED.  We'd have to do that
+	// if their state has changed or if we had to draw the background.
+
+	if (drawCase || (lcdOn != fOldLCDOn) || (backlightOn != fOldBacklightOn))
+	{
+		drawLCD		= lcdOn;
+	}
+
+	if (drawCase || (lcdOn != fOldLCDOn))
+	{
+		drawFrame	= lcdOn && hasFrame;
+	}
+
+	if (drawCase || (ledState != fOldLEDState))
+	{
+		drawLED		= ledState != 0;
+		PHEM_Enable_LED(drawLED);
+	}
+
+	fOldLCDOn		= lcdOn;
+	fOldBacklightOn	= backlightOn;
+	fOldLEDState	= ledState;
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmWindow::PaintCase
 // ---------------------------------------------------------------------------
@@ -731,28 +801,44 @@ void EmWindow::PaintLCD (const EmScreenUpdateInfo& info)
 
 	EmRect	lcdRect = this->GetLCDBounds ();
 
-	// Limit the vertical range to the lines that have changed.
+	// Determine if the image needs to be scaled.
 
-	EmRect	destRect = ::SkinScaleDown (lcdRect);
+	EmPoint	before (1, 1);
+	EmPoint	after = ::SkinScaleUp (before);
 
-	destRect.fBottom	= destRect.fTop + info.fLastLine;
-	destRect.fTop		= destRect.fTop + info.fFirstLine;
+	// Paint each band of scanlines that changed.  If GetBits didn't
+	// break the update up, paint the whole changed range in one go.
 
-	destRect = ::SkinScaleUp (destRect);
+	EmRegion	dirty (info.fDirtyRegion);
 
-	// Get the bounds of the area we'll be blitting from.
+	if (dirty.IsEmpty ())
+	{
+		dirty = EmRect (0, info.fFirstLine, info.fImage.GetSize ().fX, info.fLastLine);
+	}
 
-	EmRect	srcRect (destRect);
-	srcRect -= lcdRect.TopLeft ();
+	EmRegionRectIterator	iter (dirty);
+	EmRect					band;
 
-	// Determine if the image needs to be scaled.
+	while (iter.Next (band))
+	{
+		// Limit the vertical range to the lines that have changed.
 
-	EmPoint	before (1, 1);
-	EmPoint	after = ::SkinScaleUp (before);
+		EmRect	destRect = ::SkinScaleDown (lcdRect);
+
+		destRect.fBottom	= destRect.fTop + band.fBottom;
+		destRect.fTop		= destRect.fTop + band.fTop;
 
-	// Setup is done. Let the host-specific routines handle the rest.
+		destRect = ::SkinScaleUp (destRect);
 
-	this->HostPaintLCD (info, srcRect, destRect, before.fX != after.fX);
+		// Get the bounds of the area we'll be blitting from.
+
+		EmRect	srcRect (destRect);
+		srcRect -= lcdRect.TopLeft ();
+
+		// Setup is done. Let the host-specific routines handle the rest.
+
+		this->HostPaintLCD (info, srcRect, destRect, before.fX != after.fX);
+	}
 }
 
 
@@ -78,6 +78,10 @@ class EmWindow
 
 	private:
 		void					PaintScreen			(Bool drawCase, Bool always);
+		void					CheckHardwareState	(Bool lcdOn, Bool backlightOn,
+													 Bool hasFrame, uint16 ledState,
+													 Bool& drawCase, Bool& drawFrame,
+													 Bool& drawLCD, Bool& drawLED);
 		void					PaintCase			(const EmScreenUpdateInfo& info);
 		void					PaintLCDFrame		(const EmScreenUpdateInfo& info);
 		void					PaintLCD			(const EmScreenUpdateInfo& info);
@@ -25,6 +25,7 @@
 #include "EmEventOutput.h"		// ErrorOccurred
 #include "EmEventPlayback.h"	// RecordErrorEvent
 #include "EmException.h"		// EmExceptionEnterDebugger
+#include "EmGDBStub.h"			// EmGDBStub::WatchHit
 #include "EmMinimize.h"			// EmMinimize::IsOn, NextMinimizer
 #include "EmPalmFunction.h"		// gLibErrorBase
 #include "EmPalmOS.h"			// GenerateStackCrawl
@@ -1731,10 +1732,11 @@ void Errors::ReportErrStepSpy (emuptr writeAddress,
 //		 Errors::ReportErrWatchpoint
 // ---------------------------------------------------------------------------
 
-void Errors::ReportErrWatchpoint (emuptr writeAddress,
-								  int writeBytes,
+void Errors::ReportErrWatchpoint (emuptr accessAddress,
+								  int accessBytes,
 								  emuptr watchAddress,
-								  uint32 watchBytes)
+								  uint32 watchBytes,
+								  Bool forRead)
 {
 	// Set the %app message variable.
 
@@ -1742,17 +1744,17 @@ void Errors::ReportErrWatchpoint (emuptr writeAddress,
 
 	// Set the %op message variable.
 
-	string	operation (Platform::GetString (kStr_WroteTo));
+	string	operation (Platform::GetString (forRead ? kStr_ReadFrom : kStr_WroteTo));
 	Errors::SetParameter ("%op", operation);
 
 	// Set the %mem message variable.
 
-	string	asString1 (::PrvAsHex8 (writeAddress));
+	string	asString1 (::PrvAsHex8 (accessAddress));
 	Errors::SetParameter ("%mem", asString1.c_str ());
 
 	// Set the %write_bytes message variable.
 
-	string	asString2 (::PrvAsDecimal (writeBytes));
+	string	asString2 (::PrvAsDecimal (accessBytes));
 	Errors::SetParameter ("%write_bytes", asString2.c_str ());
 
 	// Set the %watch_start message variable.
@@ -3366,15 +3368,17 @@ void EmDeferredErrStepSpy::Do (void)
 //		 EmDeferredErrWatchpoint
 // ---------------------------------------------------------------------------
 
-EmDeferredErrWatchpoint::EmDeferredErrWatchpoint (emuptr writeAddress,
-												 int writeBytes,
+EmDeferredErrWatchpoint::EmDeferredErrWatchpoint (emuptr accessAddress,
+												 int accessBytes,
 												 emuptr watchAddress,
-												 uint32 watchBytes) :
+												 uint32 watchBytes,
+												 Bool forRead) :
 	EmDeferredErr (),
-	fWriteAddress (writeAddress),
-	fWriteBytes (writeBytes),
+	fAccessAddress (accessAddress),
+	fAccessBytes (accessBytes),
 	fWatchAddress (watchAddress),
-	fWatchBytes (watchBytes)
+	fWatchBytes (watchBytes),
+	fForRead (forRead)
 {
 }
 
@@ -3384,5 +3388,13 @@ EmDeferredErrWatchpoint::~EmDeferredErrWatchpoint (void)
 
 void EmDeferredErrWatchpoint::Do (void)
 {
-	Errors::ReportErrWatchpoint (fWriteAddress, fWriteBytes, fWatchAddress, fWatchBytes);
+	// gdb set the watchpoint, so tell gdb instead of putting up a dialog.
+
+	if (EmGDBStub::WatchHit (fAccessAddress, fForRead))
+	{
+		EmExceptionEnterDebugger	e;
+		throw e;
+	}
+
+	Errors::ReportErrWatchpoint (fAccessAddress, fAccessBytes, fWatchAddress, fWatchBytes, fForRead);
 }
@@ -29,6 +29,7 @@
 #include "EmPatchState.h"		// META_CHECK calls EmPatchState::IsPCInMemMgr
 #include "EmScreen.h"			// EmScreen::MarkDirty
 #include "EmSession.h"			// gSession
+#include "EmWatchpoints.h"		// EmWatchpoints::CheckRead, CheckWrite
 #include "MetaMemory.h"			// MetaMemory
 #include "Profiling.h"			// WAITSTATES_DRAM
 
@@ -324,8 +325,15 @@ uint32 EmBankDRAM::GetLong (emuptr address)
 		AddressError (address, sizeof (uint32), true);
 	}
 
+	// Clean meta-memory pages have nothing to check.
+
 	register uint8*	metaAddress = InlineGetMetaAddress (address);
-	META_CHECK (metaAddress, address, GetLong, uint32, true);
+	Bool			metaClean = MetaMemory::IsCleanRAM (address, sizeof (uint32));
+
+	if (!metaClean)
+	{
+		META_CHECK (metaAddress, address, GetLong, uint32, true);
+	}
 
 	::PrvCheckBelowStackPointerAccess (address, sizeof (uint32), true);
 
@@ -340,6 +348,8 @@ uint32 EmBankDRAM::GetLong (emuptr address)
 	CYCLE_GETLONG (WAITSTATES_DRAM);
 #endif
 
+	EmWatchpoints::CheckRead (address, sizeof (uint32));
+
 	return EmMemDoGet32 (gRAM_Memory + address);
 }
 
@@ -363,7 +373,12 @@ uint32 EmBankDRAM::GetWord (emuptr address)
 	}
 
 	register uint8*	metaAddress = InlineGetMetaAddress (address);
-	META_CHECK (metaAddress, address, GetWord, uint16, true);
+	Bool			metaClean = MetaMemory::IsCleanRAM (address, sizeof (uint16));
+
+	if (!metaClean)
+	{
+		META_CHECK (metaAddress, address, GetWord, uint16, true);
+	}
 
 	::PrvCheckBelowStackPointerAccess (address, sizeof (uint16), true);
 
@@ -378,6 +393,8 @@ uint32 EmBankDRAM::GetWord (emuptr address)
 	CYCLE_GETWORD (WAITSTATES_DRAM);
 #endif
 
+	EmWatchpoints::CheckRead (address, sizeof (uint16));
+
 	return EmMemDoGet16 (gRAM_Memory + address);
 }
 
@@ -396,7 +413,12 @@ uint32 EmBankDRAM::GetByte (emuptr address)
 #endif
 
 	register uint8*	metaAddress = InlineGetMetaAddress (address);
-	META_CHECK (metaAddress, address, GetByte, uint8, true);
+	Bool			metaClean = MetaMemory::IsCleanRAM (address, sizeof (uint8));
+
+	if (!metaClean)
+	{
+		META_CHECK (metaAddress, address, GetByte, uint8, true);
+	}
 
 	::PrvCheckBelowStackPointerAccess (address, sizeof (uint8), true);
 
@@ -411,6 +433,8 @@ uint32 EmBankDRAM::GetByte (emuptr address)
 	CYCLE_GETBYTE (WAITSTATES_DRAM);
 #endif
 
+	EmWatchpoints::CheckRead (address, sizeof (uint8));
+
 	return EmMemDoGet8 (gRAM_Memory + address);
 }
 
@@ -439,7 +463,12 @@ void EmBankDRAM::SetLong (emuptr address, uint32 value)
 	}
 
 	register uint8*	metaAddress = InlineGetMetaAddress (address);
-	META_CHECK (metaAddress, address, SetLong, uint32, false);
+	Bool			metaClean = MetaMemory::IsCleanRAM (address, sizeof (uint32));
+
+	if (!metaClean)
+	{
+		META_CHECK (metaAddress, address, SetLong, uint32, false);
+	}
 
 	::PrvCheckBelowStackPointerAccess (address, sizeof (uint32), false);
 
@@ -450,7 +479,10 @@ void EmBankDRAM::SetLong (emuptr address, uint32 value)
 		InvalidAccess (address, sizeof (uint32), false);
 	}
 
-	::PrvScreenCheck (metaAddress, address, sizeof (uint32));
+	if (!metaClean)
+	{
+		::PrvScreenCheck (metaAddress, address, sizeof (uint32));
+	}
 
 #if (HAS_PROFILING)
 	CYCLE_PUTLONG (WAITSTATES_DRAM);
@@ -465,9 +497,10 @@ void EmBankDRAM::SetLong (emuptr address, uint32 value)
 #endif
 
 	// See if any interesting memory locations have changed.  If so,
-	// CheckStepSpy will report it.
+	// CheckStepSpy or CheckWrite will report it.
 
 	Debug::CheckStepSpy (address, sizeof (uint32));
+	EmWatchpoints::CheckWrite (address, sizeof (uint32));
 }
 
 
@@ -493,7 +526,12 @@ void EmBankDRAM::SetWord (emuptr address, uint32 value)
 	}
 
 	register uint8*	metaAddress = InlineGetMetaAddress (address);
-	META_CHECK (metaAddress, address, SetWord, uint16, false);
+	Bool			metaClean = MetaMemory::IsCleanRAM (address, sizeof (uint16));
+
+	if (!metaClean)
+	{
+		META_CHECK (metaAddress, address, SetWord, uint16, false);
+	}
 
 	::PrvCheckBelowStackPointerAccess (address, sizeof (uint16), false);
 
@@ -504,7 +542,10 @@ void EmBankDRAM::SetWord (emuptr address, uint32 value)
 		InvalidAccess (address, sizeof (uint16), false);
 	}
 
-	::PrvScreenCheck (metaAddress, address, sizeof (uint16));
+	if (!metaClean)
+	{
+		::PrvScreenCheck (metaAddress, address, sizeof (uint16));
+	}
 
 #if (HAS_PROFILING)
 	CYCLE_PUTWORD (WAITSTATES_DRAM);
@@ -519,9 +560,10 @@ void EmBankDRAM::SetWord (emuptr address, uint32 value)
 #endif
 
 	// See if any interesting memory locations have changed.  If so,
-	// CheckStepSpy will report it.
+	// CheckStepSpy or CheckWrite will report it.
 
 	Debug::CheckStepSpy (address, sizeof (uint16));
+	EmWatchpoints::CheckWrite (address, sizeof (uint16));
 }
 
 
@@ -542,7 +584,12 @@ void EmBankDRAM::SetByte (emuptr address, uint32 value)
 #endif
 
 	register uint8*	metaAddress = InlineGetMetaAddress (address);
-	META_CHECK (metaAddress, address, SetByte, uint8, false);
+	Bool			metaClean = MetaMemory::IsCleanRAM (address, sizeof (uint8));
+
+	if (!metaClean)
+	{
+		META_CHECK (metaAddress, address, SetByte, uint8, false);
+	}
 
 	::PrvCheckBelowStackPointerAccess (address, sizeof (uint8), false);
 
@@ -553,7 +600,10 @@ void EmBankDRAM::SetByte (emuptr address, uint32 value)
 		InvalidAccess (address, sizeof (uint8), false);
 	}
 
-	::PrvScreenCheck (metaAddress, address, sizeof (uint8));
+	if (!metaClean)
+	{
+		::PrvScreenCheck (metaAddress, address, sizeof (uint8));
+	}
 
 #if (HAS_PROFILING)
 	CYCLE_PUTBYTE (WAITSTATES_DRAM);
@@ -568,9 +618,10 @@ void EmBankDRAM::SetByte (emuptr address, uint32 value)
 #endif
 
 	// See if any interesting memory locations have changed.  If so,
-	// CheckStepSpy will report it.
+	// CheckStepSpy or CheckWrite will report it.
 
 	Debug::CheckStepSpy (address, sizeof (uint8));
+	EmWatchpoints::CheckWrite (address, sizeof (uint8));
 }
 
 
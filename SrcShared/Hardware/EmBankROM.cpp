@@ -21,15 +21,30 @@
 #include "EmMemory.h"			// Memory::InitializeBanks, EmMem_memset
 #include "EmPalmStructs.h"		// EmProxyCardHeaderType
 #include "EmSession.h"			// GetDevice, ScheduleDeferredError
+#include "MetaMemory.h"			// MetaMemory::AllocateMetaMemory
 #include "ErrorHandling.h"		// Errors::Throw
 #include "Miscellaneous.h"		// StWordSwapper, NextPowerOf2
 #include "Profiling.h"			// WAITSTATES_ROM
 #include "SessionFile.h"		// WriteROMFileReference
 #include "Strings.r.h"			// kStr_BadChecksum
 
+#if PLATFORM_UNIX
+#include "EmDirRef.h"			// EmDirRef::GetPrefsDirectory
+#include "EmFileRef.h"			// EmFileRef
+
+#include <fcntl.h>				// open, O_RDONLY
+#include <stdio.h>				// sprintf, rename
+#include <sys/mman.h>			// mmap, munmap
+#include <sys/stat.h>			// fstat
+#include <unistd.h>				// close, getpid, write
+#endif
+
 
 // Private function declarations
 
+static uint8*	PrvMapROMImage			(const uint8* image, uint32 size);
+static void		PrvDisposeMemory		(uint8*& p, uint32 size, Bool& mapped);
+
 
 class Card
 {
@@ -74,6 +89,15 @@ static uint32	gROMBank_Mask;
 static uint8*	gROM_Memory;
 static uint8*	gROM_MetaMemory;
 
+// Set if the above were obtained from mmap rather than from the heap.
+// The ROM image is then a private mapping of a byteswapped cache file
+// shared by all emulator processes running the same ROM; the meta
+// memory is an anonymous mapping whose pages are only committed by the
+// host once something tags them.
+
+static Bool		gROM_MemoryMapped;
+static Bool		gROM_MetaMemoryMapped;
+
 
 /***********************************************************************
  *
@@ -122,7 +146,7 @@ void EmBankROM::Initialize (EmStream& romStream)
 
 void EmBankROM::Reset (Bool /*hardwareReset*/)
 {
-	memset (gROM_MetaMemory, 0, gROMImage_Size);
+	MetaMemory::ClearMetaMemory (gROM_MetaMemory, gROMImage_Size, gROM_MetaMemoryMapped);
 }
 
 
@@ -141,12 +165,25 @@ void EmBankROM::Reset (Bool /*hardwareReset*/)
 
 void EmBankROM::Save (SessionFile& f)
 {
+	// The ROM's meta-memory is only marked up at boot time, so
+	// EmTimeTravel snapshots don't bother with it.
+
+	if (f.GetSnapshot ())
+		return;
+
 	EmAssert (gSession);
 	Configuration	cfg = gSession->GetConfiguration ();
 	f.WriteROMFileReference (cfg.fROMFile);
 
-	StWordSwapper	swapper1 (gROM_MetaMemory, gROMImage_Size);
-	f.WriteMetaROMImage (gROM_MetaMemory, gROMImage_Size);
+	// Byteswap a copy rather than the meta memory itself.  Swapping
+	// in place would write to (and so commit) every page of a lazily
+	// allocated meta memory image.
+
+	StMemory	metaImage (gROMImage_Size);
+	memcpy (metaImage.Get (), gROM_MetaMemory, gROMImage_Size);
+
+	ByteswapWords (metaImage.Get (), gROMImage_Size);
+	f.WriteMetaROMImage (metaImage.Get (), gROMImage_Size);
 }
 
 
@@ -171,9 +208,36 @@ void EmBankROM::Load (SessionFile& f)
 
 	EmAssert (gROM_MetaMemory != NULL);
 
-	if (f.ReadMetaROMImage (gROM_MetaMemory))
+	if (f.GetSnapshot ())
+		return;
+
+	StMemory	metaImage (gROMImage_Size);
+
+	if (f.ReadMetaROMImage (metaImage.Get ()))
 	{
-		ByteswapWords (gROM_MetaMemory, gROMImage_Size);
+		ByteswapWords (metaImage.Get (), gROMImage_Size);
+
+		// Only copy over the pages that have any bits set, so that
+		// untagged pages of a mapped meta memory image stay uncommitted.
+
+		const uint32	kChunkSize = 4096;
+		const uint8*	src = (const uint8*) metaImage.Get ();
+
+		MetaMemory::ClearMetaMemory (gROM_MetaMemory, gROMImage_Size, gROM_MetaMemoryMapped);
+
+		for (uint32 offset = 0; offset < gROMImage_Size; offset += kChunkSize)
+		{
+			uint32	len = min (kChunkSize, gROMImage_Size - offset);
+
+			for (uint32 ii = 0; ii < len; ++ii)
+			{
+				if (src[offset + ii] != 0)
+				{
+					memcpy (gROM_MetaMemory + offset, src + offset, len);
+					break;
+				}
+			}
+		}
 	}
 	else
 	{
@@ -198,8 +262,8 @@ void EmBankROM::Load (SessionFile& f)
 
 void EmBankROM::Dispose (void)
 {
-	Platform::DisposeMemory (gROM_Memory);
-	Platform::DisposeMemory (gROM_MetaMemory);
+	::PrvDisposeMemory (gROM_Memory, gROMImage_Size, gROM_MemoryMapped);
+	MetaMemory::DisposeMetaMemory (gROM_MetaMemory, gROMImage_Size, gROM_MetaMemoryMapped);
 }
 
 
@@ -567,6 +631,18 @@ uint8* EmBankROM::GetMetaAddress (emuptr address)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmBankROM::GetMemorySize
+// ---------------------------------------------------------------------------
+// Return the size of the ROM bank (the ROM image size rounded up to a power
+// of two).
+
+uint32 EmBankROM::GetMemorySize (void)
+{
+	return gROMBank_Size;
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmBankROM::AddOpcodeCycles
 // ---------------------------------------------------------------------------
@@ -700,7 +776,6 @@ void EmBankROM::LoadROM (EmStream& hROM)
 	// Read in the ROM image.
 
 	StMemory	romImage (gROMImage_Size);
-	StMemory	romMetaImage (gROMImage_Size);
 
 	hROM.SetMarker (0, kStreamFromStart);
 	hROM.GetBytes (romImage.Get () + bufferOffset, hROM.GetLength());
@@ -783,12 +858,24 @@ void EmBankROM::LoadROM (EmStream& hROM)
 	// variables for the CPU emulator to access.  Make sure that
 	// gROMBank_Size is a power-of-2.  The EmBankROM memory routines
 	// require this.
+	//
+	// If we can, back the ROM with a mapping of a shared cache file
+	// holding the byteswapped image so that all emulator instances
+	// running this ROM share the same physical pages.  Otherwise, fall
+	// back to keeping our private copy.
 
 	EmAssert (gROM_Memory == NULL);
 	EmAssert (gROM_MetaMemory == NULL);
 
-	gROM_Memory 	= (uint8*) romImage.Release ();
-	gROM_MetaMemory = (uint8*) romMetaImage.Release ();
+	gROM_Memory 		= ::PrvMapROMImage ((const uint8*) romImage.Get (), gROMImage_Size);
+	gROM_MemoryMapped	= gROM_Memory != NULL;
+
+	if (!gROM_MemoryMapped)
+	{
+		gROM_Memory = (uint8*) romImage.Release ();
+	}
+
+	gROM_MetaMemory = MetaMemory::AllocateMetaMemory (gROMImage_Size, gROM_MetaMemoryMapped);
 	gROMBank_Mask	= gROMBank_Size - 1;
 
 	// Guess the default ROM base address.
@@ -1453,6 +1540,183 @@ void EmBankFlash::AddOpcodeCycles (void)
 }
 
 
+#pragma mark -
+
+// ===========================================================================
+//		 ROM Memory Allocation
+// ===========================================================================
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvMapROMImage
+ *
+ * DESCRIPTION:	Map a copy of the given (validated and byteswapped) ROM
+ *				image from the ROM cache directory, creating the cache
+ *				file if needed.  The mapping is private, so any writes
+ *				made to it (as by the flash emulation) are copy-on-write
+ *				and are not seen by other processes or the cache file.
+ *
+ * PARAMETERS:	image - the ROM image in host memory.
+ *
+ *				size - the size of the ROM image.
+ *
+ * RETURNED:	The mapped image, or NULL if it could not be mapped.
+ *				In the latter case, the caller should use its own copy.
+ *
+ ***********************************************************************/
+
+#if PLATFORM_UNIX
+
+static uint8* PrvMapCacheFile (const string& path, const uint8* image, uint32 size)
+{
+	int	fd = open (path.c_str (), O_RDONLY);
+	if (fd < 0)
+		return NULL;
+
+	uint8*		result = NULL;
+	struct stat	st;
+
+	if (fstat (fd, &st) == 0 && st.st_size == (off_t) size)
+	{
+		void*	p = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+		if (p != MAP_FAILED)
+		{
+			// Guard against hash collisions and partially written files.
+
+			if (memcmp (p, image, size) == 0)
+				result = (uint8*) p;
+			else
+				munmap (p, size);
+		}
+	}
+
+	close (fd);
+
+	return result;
+}
+
+
+static Bool PrvWriteCacheFile (const string& path, const uint8* image, uint32 size)
+{
+	// Write to a temporary file and rename it into place so that other
+	// processes never see a partially written cache file.
+
+	char	suffix[32];
+	sprintf (suffix, ".%ld.tmp", (long) getpid ());
+
+	string	tempPath = path + suffix;
+	int		fd = open (tempPath.c_str (), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+	if (fd < 0)
+		return false;
+
+	const uint8*	p = image;
+	uint32			remaining = size;
+
+	while (remaining > 0)
+	{
+		ssize_t	written = write (fd, p, remaining);
+
+		if (written <= 0)
+			break;
+
+		p += written;
+		remaining -= written;
+	}
+
+	close (fd);
+
+	if (remaining > 0 || rename (tempPath.c_str (), path.c_str ()) != 0)
+	{
+		unlink (tempPath.c_str ());
+		return false;
+	}
+
+	return true;
+}
+
+#endif
+
+
+uint8* PrvMapROMImage (const uint8* image, uint32 size)
+{
+#if PLATFORM_UNIX
+	try
+	{
+		// Key the cache file on the size and a hash (FNV-1a) of the image.
+
+		uint32	hash = 2166136261U;
+
+		for (uint32 ii = 0; ii < size; ++ii)
+		{
+			hash = (hash ^ image[ii]) * 16777619U;
+		}
+
+		char	name[32];
+		sprintf (name, "%08lX-%08lX.rom", (unsigned long) size, (unsigned long) hash);
+
+		EmDirRef	cacheDir (EmDirRef::GetPrefsDirectory (), "ROMCache");
+		cacheDir.Create ();
+
+		EmFileRef	cacheFile (cacheDir, name);
+		string		path = cacheFile.GetFullPath ();
+
+		uint8*	result = ::PrvMapCacheFile (path, image, size);
+
+		if (!result && ::PrvWriteCacheFile (path, image, size))
+		{
+			result = ::PrvMapCacheFile (path, image, size);
+		}
+
+		return result;
+	}
+	catch (...)
+	{
+	}
+#else
+	UNUSED_PARAM (image)
+	UNUSED_PARAM (size)
+#endif
+
+	return NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvDisposeMemory
+ *
+ * DESCRIPTION:	Release memory allocated by PrvMapROMImage or the heap.
+ *
+ * PARAMETERS:	p - the memory to release.  Set to NULL on exit.
+ *
+ *				size - the size of the memory.
+ *
+ *				mapped - whether or not the memory was mapped.  Cleared
+ *					on exit.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvDisposeMemory (uint8*& p, uint32 size, Bool& mapped)
+{
+#if PLATFORM_UNIX
+	if (p && mapped)
+	{
+		munmap (p, size);
+		p = NULL;
+	}
+#else
+	UNUSED_PARAM (size)
+#endif
+
+	Platform::DisposeMemory (p);
+	mapped = false;
+}
+
+
 #pragma mark -
 
 // ===========================================================================
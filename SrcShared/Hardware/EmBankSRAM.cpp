@@ -20,8 +20,9 @@
 #include "EmMemory.h"			// gRAMBank_Size, gRAM_Memory, gMemoryAccess
 #include "EmScreen.h"			// EmScreen::MarkDirty
 #include "EmSession.h"			// GetDevice
+#include "EmWatchpoints.h"		// EmWatchpoints::CheckRead, CheckWrite
 #include "MetaMemory.h"			// MetaMemory::
-#include "Miscellaneous.h"		// StWordSwapper
+#include "Miscellaneous.h"		// StWordSwapper, StMemory
 #include "Profiling.h"			// WAITSTATES_SRAM
 #include "SessionFile.h"		// WriteRAMImage
 
@@ -61,6 +62,9 @@ uint32 		gRAMBank_Size;
 uint32 		gRAMBank_Mask;
 uint8* 		gRAM_Memory;
 uint8* 		gRAM_MetaMemory;
+EmMetaPage*	gRAM_MetaPages;
+
+static Bool	gRAM_MetaMemoryMapped;
 
 #if defined (_DEBUG)
 
@@ -125,6 +129,7 @@ void EmBankSRAM::Initialize (RAMSizeType ramSize)
 {
 	EmAssert (gRAM_Memory == NULL);
 	EmAssert (gRAM_MetaMemory == NULL);
+	EmAssert (gRAM_MetaPages == NULL);
 
 	if (ramSize > 0)
 	{
@@ -134,7 +139,13 @@ void EmBankSRAM::Initialize (RAMSizeType ramSize)
                 PHEM_Log_Place(gRAMBank_Size);
 		gRAMBank_Mask	= gRAMBank_Size - 1;
 		gRAM_Memory 	= (uint8*) Platform::AllocateMemoryClear (gRAMBank_Size);
-		gRAM_MetaMemory = (uint8*) Platform::AllocateMemoryClear (gRAMBank_Size);
+		gRAM_MetaMemory = MetaMemory::AllocateMetaMemory (gRAMBank_Size, gRAM_MetaMemoryMapped);
+
+		// One extra page summary, so that an access straddling the end
+		// of RAM can look at the page after it.
+
+		gRAM_MetaPages	= (EmMetaPage*) Platform::AllocateMemoryClear (
+							((gRAMBank_Size >> kMetaPageShift) + 1) * sizeof (EmMetaPage));
 
 #if defined (_DEBUG)
 		// In debug mode, define a global variable that points to the
@@ -181,7 +192,8 @@ void EmBankSRAM::Initialize (RAMSizeType ramSize)
 
 void EmBankSRAM::Reset (Bool /*hardwareReset*/)
 {
-	memset (gRAM_MetaMemory, 0, gRAMBank_Size);
+	MetaMemory::ClearMetaMemory (gRAM_MetaMemory, gRAMBank_Size, gRAM_MetaMemoryMapped);
+	MetaMemory::ResetPages ();
 }
 
 
@@ -200,11 +212,22 @@ void EmBankSRAM::Reset (Bool /*hardwareReset*/)
 
 void EmBankSRAM::Save (SessionFile& f)
 {
+	// EmTimeTravel keeps its own copies of RAM and meta-RAM.
+
+	if (f.GetSnapshot ())
+		return;
+
 	StWordSwapper	swapper1 (gRAM_Memory, gRAMBank_Size);
 	f.WriteRAMImage (gRAM_Memory, gRAMBank_Size);
 
-	StWordSwapper	swapper2 (gRAM_MetaMemory, gRAMBank_Size);
-	f.WriteMetaRAMImage (gRAM_MetaMemory, gRAMBank_Size);
+	// Byteswap a copy of the meta-memory, rather than swapping it in
+	// place, so that its untouched pages stay uncommitted.
+
+	StMemory	metaImage (gRAMBank_Size);
+	memcpy (metaImage.Get (), gRAM_MetaMemory, gRAMBank_Size);
+
+	ByteswapWords (metaImage.Get (), gRAMBank_Size);
+	f.WriteMetaRAMImage (metaImage.Get (), gRAMBank_Size);
 }
 
 
@@ -226,6 +249,9 @@ void EmBankSRAM::Load (SessionFile& f)
 	EmAssert (gRAM_Memory);
 	EmAssert (gRAM_MetaMemory);
 
+	if (f.GetSnapshot ())
+		return;
+
 	if (f.ReadRAMImage (gRAM_Memory))
 	{
 		ByteswapWords (gRAM_Memory, gRAMBank_Size);
@@ -235,9 +261,34 @@ void EmBankSRAM::Load (SessionFile& f)
 		f.SetCanReload (false);
 	}
 
-	if (f.ReadMetaRAMImage (gRAM_MetaMemory))
+	StMemory	metaImage (gRAMBank_Size);
+
+	if (f.ReadMetaRAMImage (metaImage.Get ()))
 	{
-		ByteswapWords (gRAM_MetaMemory, gRAMBank_Size);
+		ByteswapWords (metaImage.Get (), gRAMBank_Size);
+
+		// Only copy over the pages that have any bits set, so that
+		// untagged pages of a mapped meta memory image stay uncommitted.
+
+		const uint8*	src = (const uint8*) metaImage.Get ();
+
+		MetaMemory::ClearMetaMemory (gRAM_MetaMemory, gRAMBank_Size, gRAM_MetaMemoryMapped);
+
+		for (uint32 offset = 0; offset < gRAMBank_Size; offset += kMetaPageSize)
+		{
+			uint32	len = min ((uint32) kMetaPageSize, gRAMBank_Size - offset);
+
+			for (uint32 ii = 0; ii < len; ++ii)
+			{
+				if (src[offset + ii] != 0)
+				{
+					memcpy (gRAM_MetaMemory + offset, src + offset, len);
+					break;
+				}
+			}
+		}
+
+		MetaMemory::ResyncPages ();
 	}
 	else
 	{
@@ -263,7 +314,8 @@ void EmBankSRAM::Load (SessionFile& f)
 void EmBankSRAM::Dispose (void)
 {
 	Platform::DisposeMemory (gRAM_Memory);
-	Platform::DisposeMemory (gRAM_MetaMemory);
+	MetaMemory::DisposeMetaMemory (gRAM_MetaMemory, gRAMBank_Size, gRAM_MetaMemoryMapped);
+	Platform::DisposeMemory (gRAM_MetaPages);
 }
 
 
@@ -328,6 +380,8 @@ uint32 EmBankSRAM::GetLong (emuptr address)
 	CYCLE_GETLONG (WAITSTATES_SRAM);
 #endif
 
+	EmWatchpoints::CheckRead (address, sizeof (uint32));
+
 	address &= gRAMBank_Mask;
 
 	return EmMemDoGet32 (gRAM_Memory + address);
@@ -369,6 +423,8 @@ uint32 EmBankSRAM::GetWord (emuptr address)
 	CYCLE_GETWORD (WAITSTATES_SRAM);
 #endif
 
+	EmWatchpoints::CheckRead (address, sizeof (uint16));
+
 	address &= gRAMBank_Mask;
 
 	return EmMemDoGet16 (gRAM_Memory + address);
@@ -403,6 +459,8 @@ uint32 EmBankSRAM::GetByte (emuptr address)
 	CYCLE_GETBYTE (WAITSTATES_SRAM);
 #endif
 
+	EmWatchpoints::CheckRead (address, sizeof (uint8));
+
 	address &= gRAMBank_Mask;
 
 	return EmMemDoGet8 (gRAM_Memory + address);
@@ -456,9 +514,10 @@ void EmBankSRAM::SetLong (emuptr address, uint32 value)
 	EmMemDoPut32 (gRAM_Memory + phyAddress, value);
 
 	// See if any interesting memory locations have changed.  If so,
-	// CheckStepSpy will report it.
+	// CheckStepSpy or CheckWrite will report it.
 
 	Debug::CheckStepSpy (address, sizeof (uint32));
+	EmWatchpoints::CheckWrite (address, sizeof (uint32));
 }
 
 
@@ -507,9 +566,10 @@ void EmBankSRAM::SetWord (emuptr address, uint32 value)
 	EmMemDoPut16 (gRAM_Memory + phyAddress, value);
 
 	// See if any interesting memory locations have changed.  If so,
-	// CheckStepSpy will report it.
+	// CheckStepSpy or CheckWrite will report it.
 
 	Debug::CheckStepSpy (address, sizeof (uint16));
+	EmWatchpoints::CheckWrite (address, sizeof (uint16));
 }
 
 
@@ -551,9 +611,10 @@ void EmBankSRAM::SetByte (emuptr address, uint32 value)
 	EmMemDoPut8 (gRAM_Memory + phyAddress, value);
 
 	// See if any interesting memory locations have changed.  If so,
-	// CheckStepSpy will report it.
+	// CheckStepSpy or CheckWrite will report it.
 
 	Debug::CheckStepSpy (address, sizeof (uint8));
+	EmWatchpoints::CheckWrite (address, sizeof (uint8));
 }
 
 
@@ -15,6 +15,7 @@
 #define EmBankSRAM_h
 
 class SessionFile;
+struct EmMetaPage;
 
 extern emuptr	gMemoryStart;
 
@@ -23,6 +24,7 @@ extern uint32	gRAMBank_Size;
 extern uint32	gRAMBank_Mask;
 extern uint8*	gRAM_Memory;
 extern uint8*	gRAM_MetaMemory;
+extern EmMetaPage*	gRAM_MetaPages;		// See MetaMemory.h
 
 
 class EmBankSRAM
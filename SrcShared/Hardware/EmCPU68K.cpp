@@ -19,9 +19,15 @@
 #include "EmBankROM.h"			// EmBankROM::GetMemoryStart
 #include "EmEventPlayback.h"	// EmEventPlayback::ReplayingEvents
 #include "EmHAL.h"				// EmHAL::GetInterruptLevel
+#include "EmInstructionStats.h"	// EmInstructionStats::Count
 #include "EmMemory.h"			// CEnableFullAccess
 #include "EmMinimize.h"			// IsOn
+#include "EmScreen.h"			// EmScreen::PublishFrame
+#include "EmScreenCapture.h"	// EmScreenCapture::CaptureFrame
 #include "EmSession.h"			// HandleInstructionBreak
+#include "EmTimeTravel.h"		// EmTimeTravel::CheckInstruction
+#include "EmTrapStats.h"		// EmTrapStats::DumpPeriodically
+#include "EmVirtualTime.h"		// EmVirtualTime::CycleSlowly
 #include "Logging.h"			// LogAppendMsg
 #include "MetaMemory.h"			// IsCPUBreak
 #include "Platform.h"			// GetMilliseconds
@@ -53,6 +59,9 @@ perfRec perftbl[65536];
 // and avoid using the high bit just for safety.
 
 #define SPCFLAG_END_OF_CYCLE	(0x40000000)
+#define SPCFLAG_COUNT_INSTR		(0x20000000)
+#define SPCFLAG_NEW_FUNCTBL		(0x10000000)
+#define SPCFLAG_TIME_TRAVEL		(0x08000000)
 
 
 // Data needed by UAE.
@@ -64,7 +73,18 @@ int	movem_index1[256];						// (normally in newcpu.c)
 int	movem_index2[256];						// (normally in newcpu.c)
 int	movem_next[256];						// (normally in newcpu.c)
 
-cpuop_func*	cpufunctbl[65536];				// (normally in newcpu.c)
+// We keep two opcode handler tables: one built from the regular handlers,
+// and one built from the handlers in cpuemu_nocheck.c, which leave out the
+// stack pointer checks.  cpufunctbl points to the one in use.
+
+static cpuop_func*	gCheckedFuncTbl[65536];
+static cpuop_func*	gUncheckedFuncTbl[65536];
+
+cpuop_func**	cpufunctbl = gCheckedFuncTbl;	// (normally in newcpu.c)
+
+static void	PrvBuildFuncTable	(cpuop_func** functbl, struct cputbl* tbl);
+
+static uint8	gOpcodeMnemonic[65536];		// table68k[].mnemo, kept after table68k is freed.
 
 uint16	last_op_for_exception_3;			/* Opcode of faulting instruction */
 emuptr	last_addr_for_exception_3;			/* PC at fault time */
@@ -151,6 +171,9 @@ EmCPU68K::EmCPU68K (EmSession* session) :
 	EmCPU (session),
 	fLastTraceAddress (EmMemNULL),
 	fCycleCount (0),
+	fCycleSlowlyCount (0),
+	fCountInstructions (false),
+	fTimeTravelChecks (false),
 //	fExceptionHandlers (),
 	fHookJSR (),
 	fHookJSR_Ind (),
@@ -196,6 +219,7 @@ void EmCPU68K::Reset (Bool hardwareReset)
 {
 	fLastTraceAddress		= EmMemNULL;
 	fCycleCount				= 0;
+	fCycleSlowlyCount		= 0;
 
 #if REGISTER_HISTORY
 	fRegHistoryIndex		= 0;
@@ -239,6 +263,16 @@ void EmCPU68K::Reset (Bool hardwareReset)
 		regs.intmask	= 7;		// disable all interrupts
 		regs.vbr = regs.sfc = regs.dfc = 0;
 		regs.fpcr = regs.fpsr = regs.fpiar = 0;
+
+		if (fCountInstructions)
+		{
+			regs.spcflags |= SPCFLAG_COUNT_INSTR;
+		}
+
+		if (fTimeTravelChecks)
+		{
+			regs.spcflags |= SPCFLAG_TIME_TRAVEL;
+		}
 	}
 
 	Memory::CheckNewPC (m68k_getpc ());
@@ -293,7 +327,7 @@ void EmCPU68K::Execute (void)
 	defined(__powerpc) || defined(powerpc) || \
 	defined(__ppc__) || defined(ppc)
 
-	register int			counter			= 0;
+	register int			counter			= fCycleSlowlyCount;
 	register cpuop_func**	functable		= cpufunctbl;
 
 	register uint8**		pc_p_p			= &regs.pc_p;
@@ -309,7 +343,7 @@ void EmCPU68K::Execute (void)
 
 #elif defined(_MSC_VER) && defined(_M_IX86)
 
-	register int			counter			= 0;
+	register int			counter			= fCycleSlowlyCount;
 	register cpuop_func**	functable		= cpufunctbl;
 
 	#define pc_p			(regs.pc_p)
@@ -320,7 +354,7 @@ void EmCPU68K::Execute (void)
 
 #else
 
-	register int			counter			= 0;
+	register int			counter			= fCycleSlowlyCount;
 	register cpuop_func**	functable		= cpufunctbl;
 
 	#define pc_p			(regs.pc_p)
@@ -528,8 +562,18 @@ StoppedLoop:
 
 		if (spcflags)
 		{
+			// Let ExecuteSpecial see the counter, and change it if it
+			// restores a time travel snapshot.
+
+			fCycleSlowlyCount = counter;
+
 			if (this->ExecuteSpecial ())
 				break;
+
+			// Pick up any change to the handler table (see SetCheckStackPointer).
+
+			functable = cpufunctbl;
+			counter = fCycleSlowlyCount;
 		}
 
 #if HAS_PROFILING
@@ -609,6 +653,27 @@ Bool EmCPU68K::ExecuteSpecial (void)
 		return this->CheckForBreak ();
 	}
 
+	// If we're here because cpufunctbl was switched, there's nothing to do
+	// but clear the flag; Execute reloads its copy when we return.
+
+	regs.spcflags &= ~SPCFLAG_NEW_FUNCTBL;
+
+	// If we're here only because we're counting instructions or moving
+	// through time, do that for the instruction we're about to execute
+	// and get back to work.  This is the same as what we'd do at the
+	// bottom of this function, but without all of the other checks.
+
+	if ((regs.spcflags & ~(SPCFLAG_COUNT_INSTR | SPCFLAG_TIME_TRAVEL)) == 0)
+	{
+		if ((regs.spcflags & SPCFLAG_TIME_TRAVEL) && EmTimeTravel::CheckInstruction ())
+			return this->CheckForBreak ();
+
+		if (regs.spcflags & SPCFLAG_COUNT_INSTR)
+			EmInstructionStats::Count (m68k_getpc (), do_get_mem_word (regs.pc_p));
+
+		return false;
+	}
+
 	// Check for Reset first.  If this is set, don't do anything else.
 
 	if ((regs.spcflags & SPCFLAG_END_OF_CYCLE))
@@ -680,6 +745,20 @@ Bool EmCPU68K::ExecuteSpecial (void)
 			return true;
 	}
 
+	// Check and count the next instruction.  Do this last, in case we
+	// just switched to an interrupt handler.
+
+	if ((regs.spcflags & SPCFLAG_TIME_TRAVEL) && !(regs.spcflags & SPCFLAG_STOP))
+	{
+		if (EmTimeTravel::CheckInstruction ())
+			return this->CheckForBreak ();
+	}
+
+	if ((regs.spcflags & SPCFLAG_COUNT_INSTR) && !(regs.spcflags & SPCFLAG_STOP))
+	{
+		EmInstructionStats::Count (m68k_getpc (), do_get_mem_word (regs.pc_p));
+	}
+
 	return this->CheckForBreak ();
 }
 
@@ -859,6 +938,13 @@ Bool EmCPU68K::ExecuteStoppedLoop (void)
 	ProfilerSetStatus (oldStatus);
 #endif
 
+		// Keep the cycle count moving while we're asleep, so that it
+		// can still be used to say when something happened (see
+		// EmTimeTravel).  One "cycle" per time through the loop is as
+		// good as any, since that's how fast the timers run, too.
+
+		fCycleCount += 1;
+
 		// Perform periodic tasks.
 
 		CYCLE (true);
@@ -897,10 +983,30 @@ void EmCPU68K::CycleSlowly (Bool sleeping)
 {
 	EmHAL::CycleSlowly (sleeping);
 
+	// Take a time travel snapshot if it's time.
+
+	EmTimeTravel::CycleSlowly ();
+
+	// Keep the 64-bit cycle clock from wrapping.
+
+	EmVirtualTime::CycleSlowly ();
+
 	// Do some platform-specific stuff.
 
 	Platform::CycleSlowly ();
 
+	// Hand the UI a new LCD frame if it's time.
+
+	EmScreen::PublishFrame ();
+
+	// Add to the screen recording if there is one.
+
+	EmScreenCapture::CaptureFrame ();
+
+	// Write out the trap statistics if it's time.
+
+	EmTrapStats::DumpPeriodically ();
+
 #if HAS_OMNI_THREAD
 	// Check to see if some external thread has asked us to quit.
 
@@ -1601,6 +1707,19 @@ void EmCPU68K::SetRegisters (regstruct& registers)
 	regs = registers;
 	this->UpdateRegistersFromSR ();
 
+	// spcflags is not really a register; don't let a saved or edited
+	// copy turn instruction counting on or off.
+
+	if (fCountInstructions)
+		regs.spcflags |= SPCFLAG_COUNT_INSTR;
+	else
+		regs.spcflags &= ~SPCFLAG_COUNT_INSTR;
+
+	if (fTimeTravelChecks)
+		regs.spcflags |= SPCFLAG_TIME_TRAVEL;
+	else
+		regs.spcflags &= ~SPCFLAG_TIME_TRAVEL;
+
 	m68k_setpc (registers.pc);
 
 	this->CheckNewSP (kStackPointerChanged);
@@ -1715,6 +1834,145 @@ uint32 EmCPU68K::GetCycleCount (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::SetCountInstructions
+// ---------------------------------------------------------------------------
+// Instruction counting rides on the spcflags check at the bottom of the CPU
+// loop; while our flag is set, ExecuteSpecial gets called after every
+// instruction.
+
+void EmCPU68K::SetCountInstructions (Bool count)
+{
+	fCountInstructions = count;
+
+	if (fCountInstructions)
+		regs.spcflags |= SPCFLAG_COUNT_INSTR;
+	else
+		regs.spcflags &= ~SPCFLAG_COUNT_INSTR;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::GetCountInstructions
+// ---------------------------------------------------------------------------
+
+Bool EmCPU68K::GetCountInstructions (void)
+{
+	return fCountInstructions;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::SetTimeTravelChecks
+// ---------------------------------------------------------------------------
+// Like instruction counting, this makes ExecuteSpecial get called after
+// every instruction, so that EmTimeTravel can see where it's got to.
+
+void EmCPU68K::SetTimeTravelChecks (Bool check)
+{
+	fTimeTravelChecks = check;
+
+	if (fTimeTravelChecks)
+		regs.spcflags |= SPCFLAG_TIME_TRAVEL;
+	else
+		regs.spcflags &= ~SPCFLAG_TIME_TRAVEL;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::GetTimeTravelChecks
+// ---------------------------------------------------------------------------
+
+Bool EmCPU68K::GetTimeTravelChecks (void)
+{
+	return fTimeTravelChecks;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::GetCycleSlowlyCount
+// ---------------------------------------------------------------------------
+// The counter Execute uses to decide when to call CycleSlowly.  It's part
+// of a time travel snapshot; if it weren't, CycleSlowly (and so everything
+// it does) would happen at different times after a snapshot is restored.
+
+uint32 EmCPU68K::GetCycleSlowlyCount (void)
+{
+	return fCycleSlowlyCount;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::SetCycleSlowlyCount
+// ---------------------------------------------------------------------------
+
+void EmCPU68K::SetCycleSlowlyCount (uint32 count)
+{
+	fCycleSlowlyCount = count;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::SetCheckStackPointer
+// ---------------------------------------------------------------------------
+// Switch between the regular opcode handlers and the ones that don't check
+// changes to A7.  Without the checks, the current stack isn't tracked, so
+// stack overflows and accesses below the stack pointer go unreported; in
+// return, every instruction that touches A7 runs a little faster.
+//
+// Execute keeps cpufunctbl in a local, so we set a flag to make it stop
+// and reload it.
+
+void EmCPU68K::SetCheckStackPointer (Bool check)
+{
+	cpuop_func**	newTable = check ? gCheckedFuncTbl : gUncheckedFuncTbl;
+
+	if (cpufunctbl == newTable)
+		return;
+
+	cpufunctbl = newTable;
+	regs.spcflags |= SPCFLAG_NEW_FUNCTBL;
+
+	// Forget the current stack.  If the checks are off, the stack range
+	// would go stale at the next stack switch.  If they're back on, it's
+	// stale already; it will be picked up again the next time A7 is set.
+
+	gStackHigh				= EmMemEOM;
+	gStackLowWarn			= EmMemNULL;
+	gStackLow				= EmMemNULL;
+	gKernelStackOverflowed	= false;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::GetCheckStackPointer
+// ---------------------------------------------------------------------------
+
+Bool EmCPU68K::GetCheckStackPointer (void)
+{
+	return cpufunctbl == gCheckedFuncTbl;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::GetOpcodeName
+// ---------------------------------------------------------------------------
+// Return the UAE mnemonic ("MOVE", "Bcc", etc.) for the given opcode.
+
+const char* EmCPU68K::GetOpcodeName (EmOpcode68K opcode)
+{
+	int	mnemo = gOpcodeMnemonic[opcode & 0xFFFF];
+
+	for (int i = 0; lookuptab[i].name[0]; ++i)
+	{
+		if (lookuptab[i].mnemo == mnemo)
+			return lookuptab[i].name;
+	}
+
+	return "ILLEGAL";
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmCPU68K::BusError
 // ---------------------------------------------------------------------------
@@ -1788,21 +2046,43 @@ void EmCPU68K::InitializeUAETables (void)
 	read_table68k ();
 	do_merges ();
 
-	// The rest of this code is based on build_cpufunctbl in newcpu.c.
+	// Build both handler tables while we still have table68k.
 
+	::PrvBuildFuncTable (gCheckedFuncTbl, op_smalltbl_3);
+	::PrvBuildFuncTable (gUncheckedFuncTbl, op_smalltbl_3_nocheck);
+
+	for (i = 0; i < 65536; i++)
+	{
+		gOpcodeMnemonic[i] = table68k[i].mnemo;
+	}
+
+	// (hey readcpu doesn't free this guy!)
+
+	Platform::DisposeMemory (table68k);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvBuildFuncTable
+// ---------------------------------------------------------------------------
+// Fill in a 64K-entry opcode handler table from one of the tables generated
+// by gencpu.  Based on build_cpufunctbl in newcpu.c.
+
+void PrvBuildFuncTable (cpuop_func** functbl, struct cputbl* tbl)
+{
 	unsigned long	opcode;
-	struct cputbl*	tbl = op_smalltbl_3;
+	int				i;
 
 	for (opcode = 0; opcode < 65536; opcode++)
 	{
-		cpufunctbl[opcode] = op_illg;
+		functbl[opcode] = op_illg;
 	}
 
 	for (i = 0; tbl[i].handler != NULL; i++)
 	{
 		if (!tbl[i].specific)
 		{
-			cpufunctbl[tbl[i].opcode] = tbl[i].handler;
+			functbl[tbl[i].opcode] = tbl[i].handler;
 #if HAS_PROFILING
 			perftbl[tbl[i].opcode] = tbl[i].perf;
 #endif
@@ -1820,13 +2100,13 @@ void EmCPU68K::InitializeUAETables (void)
 
 		if (table68k[opcode].handler != -1)
 		{
-			f = cpufunctbl[table68k[opcode].handler];
+			f = functbl[table68k[opcode].handler];
 			if (f == op_illg)
 			{
 				abort ();
 			}
 
-			cpufunctbl[opcode] = f;
+			functbl[opcode] = f;
 #if HAS_PROFILING
 			perftbl[opcode] = perftbl[table68k[opcode].handler];
 #endif
@@ -1838,14 +2118,10 @@ void EmCPU68K::InitializeUAETables (void)
 	{
 		if (tbl[i].specific)
 		{
-			cpufunctbl[tbl[i].opcode] = tbl[i].handler;
+			functbl[tbl[i].opcode] = tbl[i].handler;
 #if HAS_PROFILING
 			perftbl[tbl[i].opcode] = tbl[i].perf;
 #endif
 		}
 	}
-
-	// (hey readcpu doesn't free this guy!)
-
-	Platform::DisposeMemory (table68k);
 }
@@ -292,6 +292,32 @@ class EmCPU68K : public EmCPU
 
 		uint32					GetCycleCount			(void);
 
+		// Per-instruction statistics.  When on, EmInstructionStats::Count
+		// is called with the PC and opcode of each instruction before it's
+		// executed.  Costs nothing when off.
+
+		void					SetCountInstructions	(Bool);
+		Bool					GetCountInstructions	(void);
+
+		// Time travel support.  When the checks are on,
+		// EmTimeTravel::CheckInstruction is called before each
+		// instruction.
+
+		void					SetTimeTravelChecks		(Bool);
+		Bool					GetTimeTravelChecks		(void);
+
+		uint32					GetCycleSlowlyCount		(void);
+		void					SetCycleSlowlyCount		(uint32);
+
+		static const char*		GetOpcodeName			(EmOpcode68K);
+
+		// Stack pointer checking.  When off, the CPU loop runs a set of
+		// opcode handlers that don't track stack switches or report stack
+		// overflows.
+
+		void					SetCheckStackPointer	(Bool);
+		Bool					GetCheckStackPointer	(void);
+
 		void					BusError				(emuptr address, long size, Bool forRead);
 		void					AddressError			(emuptr address, long size, Bool forRead);
 
@@ -309,6 +335,9 @@ class EmCPU68K : public EmCPU
 	private:
 		emuptr					fLastTraceAddress;
 		uint32					fCycleCount;
+		uint32					fCycleSlowlyCount;
+		Bool					fCountInstructions;
+		Bool					fTimeTravelChecks;
 		Hook68KExceptionList	fExceptionHandlers[kException_LastException];
 		Hook68KJSRList			fHookJSR;
 		Hook68KJSR_IndList		fHookJSR_Ind;
@@ -23,6 +23,8 @@
 #include "EmSession.h"			// gSession, GetDevice
 #include "MetaMemory.h"			// MetaMemory::Initialize
 
+#include <string.h>				// memcpy
+
 
 #if HAS_PROFILING
 #include "Profiling.h"			// gProfilingCounted
@@ -946,6 +948,69 @@ template emuptr	EmMem_memcpy<emuptr, const void*>	(emuptr dst, const void* src,
 template emuptr	EmMem_memcpy<emuptr, emuptr>		(emuptr dst, emuptr src, size_t len);
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	EmMem_GetBlock
+ *
+ * DESCRIPTION: Copy a block of emulated memory into a local buffer in
+ *				one go.  This is a "meta" access: it's made with access
+ *				checks turned off, the same as if the caller had used
+ *				CEnableFullAccess.  If the block lies entirely within
+ *				RAM or ROM, it's copied directly from the memory
+ *				backing that bank instead of a byte at a time through
+ *				the bank's accessors.
+ *
+ * PARAMETERS:	dst - local buffer to receive the data.
+ *
+ *				src - emulated address of the data.
+ *
+ *				len - number of bytes to copy.
+ *
+ * RETURNED:	dst.
+ *
+ ***********************************************************************/
+
+void*	EmMem_GetBlock (void* dst, emuptr src, size_t len)
+{
+	CEnableFullAccess	munge;
+
+	if (len == 0)
+		return dst;
+
+	// Only banks whose memory is a plain array can be read directly.
+	// Register banks have side effects, and flash banks can return
+	// status information instead of their contents.
+
+	EmAddressBank&	bank = EmMemGetBank (src);
+
+	Bool	direct =
+		&bank == &EmMemGetBank (src + len - 1) &&
+		(bank.xlateaddr == &EmBankDRAM::GetRealAddress ||
+		 bank.xlateaddr == &EmBankSRAM::GetRealAddress ||
+		 bank.xlateaddr == &EmBankROM::GetRealAddress) &&
+		bank.checkaddr (src, len);
+
+	if (!direct)
+	{
+		return EmMem_memcpy (dst, src, len);
+	}
+
+	const uint8*	p = bank.xlateaddr (src);
+	uint8*			q = (uint8*) dst;
+
+#if WORDSWAP_MEMORY
+	while (len--)
+	{
+		*q++ = EmMemDoGet8 ((void*) p++);
+	}
+#else
+	memcpy (q, p, len);
+#endif
+
+	return dst;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	EmMem_memmove
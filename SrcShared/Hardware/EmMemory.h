@@ -429,6 +429,8 @@ int		EmMem_memcmp(T1 src1, T2 src2, size_t len);
 template <class T1, class T2>
 T1		EmMem_memcpy (T1 dst, T2 src, size_t len);
 
+void*	EmMem_GetBlock (void* dst, emuptr src, size_t len);
+
 template <class T1, class T2>
 T1		EmMem_memmove (T1 dst, T2 src, size_t len);
 
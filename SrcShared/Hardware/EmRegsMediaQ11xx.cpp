@@ -30,6 +30,10 @@
 #define LOG_BLIT	0
 #define PRINTF_BLIT	if (!LOG_BLIT) ; else LogAppendMsg
 
+// Set to zero to send all BitBLT and line commands through the reference
+// per-pixel pipes instead of the host-memory fast paths.
+#define FAST_BLIT	1
+
 
 /* --------------------------------------------------------------------------- *\
 	MediaQ Graphics Engine overview and description
@@ -795,6 +799,12 @@ void PrvWriteRegister(uint8* p, uint32 value)
 #define kCommandBitBLT	2
 #define kCommandLine	4
 
+#define kBlitReference		0	// Per-pixel pipes (PrvIncBlitterRun)
+#define kBlitSolidFill		1	// Same output for every pixel
+#define kBlitPatternFill	2	// Mono pattern and/or ROP using the destination
+#define kBlitMonoExpand		3	// Mono source data from the FIFO
+#define kBlitScreenCopy		4	// SRCCOPY from display memory
+
 #define kAllRegisters	-1
 
 static const char*	kCommands[] =
@@ -949,6 +959,20 @@ inline Bool EmRegsMediaQ11xx::PrvGetYDoubling (void)
 	return (READ_REGISTER (gcREG[GC_CONTROL]) & GC_V_PIX_DBLNG) != 0;
 }
 
+// Host-memory counterpart to PrvGetPixelLocation for the unrotated case.
+// Valid only after PrvFastInit.
+
+inline uint8* EmRegsMediaQ11xx::PrvGetPixelPointer (uint16 x, uint16 y)
+{
+	return fVideoMem + fState.baseAddr + y * fState.destLineStride + x * fBytesPerPixel;
+}
+
+
+inline Bool EmRegsMediaQ11xx::PrvFastInClipX (uint16 x)
+{
+	return x >= fState.clipLeft && x < fState.clipRight;
+}
+
 
 // ---------------------------------------------------------------------------
 //		 EmRegsMediaQ11xx::EmRegsMediaQ11xx
@@ -980,7 +1004,12 @@ EmRegsMediaQ11xx::EmRegsMediaQ11xx (emuptr baseRegsAddr, emuptr baseVideoAddr) :
 	fXSrc (0),
 	fYSrc (0),
 	fXDest (0),
-	fYDest (0)
+	fYDest (0),
+	fBlitKind (kBlitReference),
+	fVideoMem (NULL),
+	fBytesPerPixel (0),
+	fFastMonoPattern (false),
+	fFastUsesDest (false)
 {
 #if LOG_LINE || LOG_BLIT
 	LogGetStdLog ()->SetLogSize (32 * 1024L * 1024L);
@@ -1616,7 +1645,7 @@ void EmRegsMediaQ11xx::GetLCDScanlines (EmScreenUpdateInfo& info)
 		// Set depth, size, and color table of EmPixMap.
 
 		info.fImage.SetSize (EmPoint (width, height));
-		info.fImage.SetFormat (kPixMapFormat24RGB);
+		info.fImage.SetFormat (kPixMapFormat16RGB565);
 
 		// Determine first and last scanlines to fetch.
 
@@ -1641,43 +1670,16 @@ void EmRegsMediaQ11xx::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 		int32	height = info.fLastLine - info.fFirstLine;
 
-		// Copy the pixels from source to dest.
+		// Copy the pixels from source to dest.  The frame buffer holds
+		// RRRRRGGG GGGBBBBB words, and emulated memory keeps each word
+		// in host order, so a scanline is already a native RGB565 row.
+		// Hand it over as-is; the host converts (or doesn't) as needed.
+
+		int32	copyBytes = width * 2;
 
 		for (int yy = 0; yy < height; ++yy)
 		{
-			for (int xx = 0; xx < width; ++xx)
-			{
-				uint8	p1 = EmMemDoGet8 (srcPtr++);	// GGGBBBBB
-				uint8	p2 = EmMemDoGet8 (srcPtr++);	// RRRRRGGG
-
-				// Merge the two together so that we get RRRRRGGG GGGBBBBB
-
-				uint16	p;
-
-				p = (p1 << 8) | p2;
-
-				// Shift the bits around, forming RRRRRrrr, GGGGGGgg, and
-				// BBBBBbbb values, where the lower-case bits are copies of
-				// the least significant bits in the upper-case bits.
-				//
-				// Note that all of this could also be done with three 64K
-				// lookup tables.  If speed is an issue, we might want to
-				// investigate that.
-
-				if (bpp == 1)
-				{
-					uint8	green = ((p >> 3) & 0xFC) | ((p >>  5) & 0x03);
-					*destPtr++ = green;
-					*destPtr++ = green;
-					*destPtr++ = green;
-				}
-				else
-				{
-					*destPtr++ = ((p >> 8) & 0xF8) | ((p >> 11) & 0x07);
-					*destPtr++ = ((p >> 3) & 0xFC) | ((p >>  5) & 0x03);
-					*destPtr++ = ((p << 3) & 0xF8) | ((p >>  0) & 0x07);
-				}
-			}
+			memcpy (destPtr, srcPtr, copyBytes);
 
 			srcPtr	= srcPtr0 += srcRowBytes;
 			destPtr	= destPtr0 += destRowBytes;
@@ -2778,6 +2780,12 @@ void EmRegsMediaQ11xx::PrvDoLine (void)
 	PRINTF_LINE ("	xAdjust:		%d", xAdjust);
 	PRINTF_LINE ("	yAdjust:		%d", yAdjust);
 
+	if (this->PrvFastLine (x, y, xAdjust, yAdjust, yIsMajor))
+	{
+		PRINTF_LINE ("	PrvDoLine:	drawn by PrvFastLine");
+		return;
+	}
+
 	// Based on which axis is the major axis, get pointers to
 	// the major and minor coordinates and the values that will
 	// be used to update them.
@@ -3741,6 +3749,8 @@ void EmRegsMediaQ11xx::PrvIncBlitterInit (void)
 	this->PrvSrcPipeInit ();
 	this->PrvDestPipeInit ();
 
+	fBlitKind = this->PrvFastBlitInit ();
+
 	PRINTF_BLIT ("	PrvIncBlitterInit:	&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&&");
 }
 
@@ -3754,6 +3764,12 @@ void EmRegsMediaQ11xx::PrvIncBlitterRun (void)
 	if (!fBlitInProgress)
 		return;
 
+	if (fBlitKind != kBlitReference)
+	{
+		this->PrvFastBlitRun ();
+		return;
+	}
+
 	static long	counter = 0;
 
 	PRINTF_BLIT ("	PrvIncBlitterRun:	**************************************************");
@@ -3818,6 +3834,530 @@ void EmRegsMediaQ11xx::PrvIncBlitterRun (void)
 }
 
 
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 EmRegsMediaQ11xx::PrvFastBlitInit
+// ---------------------------------------------------------------------------
+// Look at the GE command that was just set up and decide if one of the
+// row-at-a-time kernels in PrvFastBlitRun can perform it.  Those kernels
+// work directly on the frame buffer's host memory instead of going
+// through EmMemGet/EmMemPut and the pattern/source/dest pipes for every
+// pixel.  Anything they can't reproduce exactly (rotation, color source
+// data from the FIFO, transparency tests against the destination, etc.)
+// is left to the reference pipes in PrvIncBlitterRun.
+//
+// Must be called after the pipes have been initialized, as it picks up
+// the starting coordinates and pattern from them.
+
+int EmRegsMediaQ11xx::PrvFastBlitInit (void)
+{
+#if FAST_BLIT
+	if (fState.rotate90 || fState.width == 0 || fState.height == 0)
+		return kBlitReference;
+
+	if (!this->PrvFastInit ())
+		return kBlitReference;
+
+	int	xAdjust = fState.xDirection ? -1 : 1;
+	int	yAdjust = fState.yDirection ? -1 : 1;
+
+	if (!this->PrvFastRectInBounds (fXDest, fYDest, xAdjust, yAdjust,
+			fState.width, fState.height))
+		return kBlitReference;
+
+	// Straight copies within the display are what scrolling is made of.
+
+	if (fUsesSource && !fState.solidSourceColor && !fState.systemMemory)
+	{
+		if (fState.rasterOperation != ROP_SRCCOPY ||
+			fState.monoTransEnable || fState.colorTransEnable)
+			return kBlitReference;
+
+		if (!this->PrvFastRectInBounds (fXSrc, fYSrc, xAdjust, yAdjust,
+				fState.width, fState.height))
+			return kBlitReference;
+
+		PRINTF_BLIT ("	PrvFastBlitInit:	kBlitScreenCopy");
+
+		return kBlitScreenCopy;
+	}
+
+	// Everything else we handle takes its source and pattern values from
+	// at most two colors each, so that the output and transparency can
+	// be worked out up front for each combination.  Transparency tests
+	// that look at the destination pixel are not handled.
+
+	if (fState.colorTransEnable && fState.colorTransCmpSrc)
+		return kBlitReference;
+
+	Bool	monoSource		= false;
+	Bool	monoPattern		= false;
+
+	if (!fUsesSource)
+	{
+		fFastSource[0] = fFastSource[1] = 0;	// Same dummy as PrvSrcPipeNextPixel
+	}
+	else if (fState.solidSourceColor)
+	{
+		fFastSource[0] = fFastSource[1] = fState.fgColorMonoSrc;
+	}
+	else if (fState.monoSource)
+	{
+		// Source data from the FIFO, expanded into fg/bg pixels.
+
+		monoSource		= true;
+		fFastSource[0]	= fState.bgColorMonoSrc;
+		fFastSource[1]	= fState.fgColorMonoSrc;
+	}
+	else
+	{
+		return kBlitReference;
+	}
+
+	// PrvTransparent looks at the pattern value even if the ROP doesn't
+	// use it, in which case the pattern pipe holds whatever was left
+	// over from the previous command.  Don't try to reproduce that.
+
+	if (fUsesPattern)
+	{
+		if (fState.solidPattern)
+		{
+			fFastPattern[0] = fFastPattern[1] = fState.fgColorMonoPat;
+		}
+		else
+		{
+			monoPattern		= true;
+			fFastPattern[0]	= fState.bgColorMonoPat;
+			fFastPattern[1]	= fState.fgColorMonoPat;
+		}
+	}
+	else if (fState.monoTransEnable && fState.monoPattern)
+	{
+		return kBlitReference;
+	}
+	else
+	{
+		fFastPattern[0] = fFastPattern[1] = 0;
+	}
+
+	fFastMonoPattern	= monoPattern;
+	fFastUsesDest		= this->PrvUsesDest ();
+
+	for (int ss = 0; ss < 2; ++ss)
+	{
+		for (int pp = 0; pp < 2; ++pp)
+		{
+			fFastOutput[ss][pp] = fFastUsesDest ? 0 :
+				this->PrvAdjustPixel (fFastPattern[pp], fFastSource[ss], 0,
+					fState.rasterOperation);
+
+			fFastSkip[ss][pp] = this->PrvTransparent (fFastSource[ss], 0, fFastPattern[pp]);
+		}
+	}
+
+	if (monoSource)
+	{
+		PRINTF_BLIT ("	PrvFastBlitInit:	kBlitMonoExpand");
+
+		return kBlitMonoExpand;
+	}
+
+	if (monoPattern || fFastUsesDest)
+	{
+		PRINTF_BLIT ("	PrvFastBlitInit:	kBlitPatternFill");
+
+		return kBlitPatternFill;
+	}
+
+	PRINTF_BLIT ("	PrvFastBlitInit:	kBlitSolidFill");
+
+	return kBlitSolidFill;
+#else
+	return kBlitReference;
+#endif
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsMediaQ11xx::PrvFastBlitRun
+// ---------------------------------------------------------------------------
+// Counterpart to PrvIncBlitterRun for the command kinds picked out by
+// PrvFastBlitInit.  Works a scanline at a time.  If the source FIFO runs
+// dry in the middle of a line, the X positions of the pipes are brought
+// up to date so that the next call (from SourceFifoWrite) picks up where
+// we left off.  At the end of a line, PrvNextXY takes care of moving all
+// the pipes to the next one.
+
+void EmRegsMediaQ11xx::PrvFastBlitRun (void)
+{
+	int		xAdjust	= fState.xDirection ? -1 : 1;
+	long	step	= xAdjust * fBytesPerPixel;
+
+	while (fBlitInProgress)
+	{
+		uint16	count		= fState.width - fCurXOffset;
+		uint16	done		= 0;
+		uint8*	destP		= this->PrvGetPixelPointer (fXDest, fYDest);
+		Bool	rowClipped	= fState.clipEnable &&
+							  (fYDest < fState.clipTop || fYDest >= fState.clipBottom);
+
+		switch (fBlitKind)
+		{
+			case kBlitSolidFill:
+				if (!rowClipped && !fFastSkip[0][0])
+					this->PrvFastFillRow (destP, fXDest, xAdjust, count);
+				done = count;
+				break;
+
+			case kBlitPatternFill:
+			case kBlitMonoExpand:
+				done = this->PrvFastExpandRow (destP, fXDest, xAdjust, count, rowClipped);
+				break;
+
+			case kBlitScreenCopy:
+				if (!rowClipped)
+					this->PrvFastCopyRow (destP, this->PrvGetPixelPointer (fXSrc, fYSrc),
+						fXDest, xAdjust, count);
+				done = count;
+				break;
+
+			default:
+				EmAssert (false);
+				done = count;
+				break;
+		}
+
+		// Tell the LCD code what we touched.
+
+		if (done > 0)
+		{
+			emuptr	first	= this->PrvGetPixelLocation (fXDest, fYDest);
+			emuptr	low		= xAdjust > 0 ? first : first + (done - 1) * step;
+
+			EmScreen::MarkDirty (low, done * fBytesPerPixel);
+		}
+
+		// If we stalled waiting on the source FIFO, remember where we got to.
+
+		if (done < count)
+		{
+			PRINTF_BLIT ("	PrvFastBlitRun:	stalled...");
+
+			fCurXOffset	+= done;
+			fXDest		+= done * xAdjust;
+			fXSrc		+= done * xAdjust;
+			fXPattern	= (fXPattern + done) & 7;
+			break;
+		}
+
+		// Otherwise, move all the pipes to the next scanline.
+
+		fCurXOffset		= fState.width - 1;
+		fBlitInProgress	= this->PrvNextXY ();
+	}
+
+	if (!fBlitInProgress)
+	{
+		PRINTF_BLIT ("	PrvFastBlitRun:	Completed!");
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsMediaQ11xx::PrvFastFillRow
+// ---------------------------------------------------------------------------
+// Store a constant pixel value into "count" pixels starting at destP.
+
+void EmRegsMediaQ11xx::PrvFastFillRow (uint8* destP, uint16 x, int xAdjust, uint16 count)
+{
+	uint16	first	= 0;
+	uint16	last	= count;
+
+	// X only moves in one direction along the row, so clipping turns into
+	// trimming the ends.
+
+	if (fState.clipEnable)
+	{
+		while (first < last && !this->PrvFastInClipX (x + first * xAdjust))
+			++first;
+
+		while (last > first && !this->PrvFastInClipX (x + (last - 1) * xAdjust))
+			--last;
+	}
+
+	uint16	pixel	= fFastOutput[0][0];
+	long	step	= xAdjust * fBytesPerPixel;
+
+	destP += first * step;
+
+	if (fBytesPerPixel == 2)
+	{
+		for (uint16 ii = first; ii < last; ++ii, destP += step)
+			EmMemDoPut16 (destP, pixel);
+	}
+	else
+	{
+		for (uint16 ii = first; ii < last; ++ii, destP += step)
+			EmMemDoPut8 (destP, pixel);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsMediaQ11xx::PrvFastExpandRow
+// ---------------------------------------------------------------------------
+// Draw pixels whose source and pattern values are each one of two colors
+// (mono source data, mono pattern, or a constant), using the output and
+// transparency tables built by PrvFastBlitInit.  If the ROP involves the
+// destination, the output is computed per pixel.  Returns the number of
+// pixels processed, which is less than "count" if the source FIFO ran out.
+
+uint16 EmRegsMediaQ11xx::PrvFastExpandRow (uint8* destP, uint16 x, int xAdjust,
+										   uint16 count, Bool rowClipped)
+{
+	long			step		= xAdjust * fBytesPerPixel;
+	const uint16*	patternRow	= &fPatternPipe [fYPattern * 8];
+	uint16			xPattern	= fXPattern;
+	uint16			done;
+
+	for (done = 0; done < count; ++done, x += xAdjust, destP += step)
+	{
+		int	ss = 0;
+		int	pp = 0;
+
+		if (fBlitKind == kBlitMonoExpand)
+		{
+			Bool	stalled;
+			uint16	source = this->PrvSrcPipeNextPixel (stalled);
+
+			if (stalled)
+				break;
+
+			ss = source == fState.fgColorMonoSrc;
+		}
+
+		if (fFastMonoPattern)
+		{
+			pp = patternRow [xPattern] == fState.fgColorMonoPat;
+		}
+
+		xPattern = (xPattern + 1) & 7;
+
+		if (fFastSkip[ss][pp] || rowClipped ||
+			(fState.clipEnable && !this->PrvFastInClipX (x)))
+			continue;
+
+		if (fBytesPerPixel == 2)
+		{
+			uint16	output = fFastUsesDest ?
+				this->PrvAdjustPixel (fFastPattern[pp], fFastSource[ss],
+					EmMemDoGet16 (destP), fState.rasterOperation) :
+				fFastOutput[ss][pp];
+
+			EmMemDoPut16 (destP, output);
+		}
+		else
+		{
+			uint16	output = fFastUsesDest ?
+				this->PrvAdjustPixel (fFastPattern[pp], fFastSource[ss],
+					EmMemDoGet8 (destP), fState.rasterOperation) :
+				fFastOutput[ss][pp];
+
+			EmMemDoPut8 (destP, output);
+		}
+	}
+
+	return done;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsMediaQ11xx::PrvFastCopyRow
+// ---------------------------------------------------------------------------
+// Copy "count" pixels from srcP to destP.  The reference blitter reads and
+// writes one pixel at a time in the blit direction, so if the two ranges
+// overlap in a way where that's not the same as a memmove, we do it the
+// same way.
+
+void EmRegsMediaQ11xx::PrvFastCopyRow (uint8* destP, uint8* srcP, uint16 x,
+									   int xAdjust, uint16 count)
+{
+	long	step		= xAdjust * fBytesPerPixel;
+	long	numBytes	= count * fBytesPerPixel;
+
+	Bool	forwardSafe	= xAdjust > 0 ? destP <= srcP : destP >= srcP;
+	Bool	overlaps	= destP < srcP ? srcP - destP < numBytes : destP - srcP < numBytes;
+
+	if (!fState.clipEnable && fBytesPerPixel == 2 && (forwardSafe || !overlaps))
+	{
+		uint8*	destLow	= xAdjust > 0 ? destP : destP + (count - 1) * step;
+		uint8*	srcLow	= xAdjust > 0 ? srcP : srcP + (count - 1) * step;
+
+		memmove (destLow, srcLow, numBytes);
+		return;
+	}
+
+	for (uint16 ii = 0; ii < count; ++ii, x += xAdjust, destP += step, srcP += step)
+	{
+		if (fState.clipEnable && !this->PrvFastInClipX (x))
+			continue;
+
+		if (fBytesPerPixel == 2)
+			EmMemDoPut16 (destP, EmMemDoGet16 (srcP));
+		else
+			EmMemDoPut8 (destP, EmMemDoGet8 (srcP));
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsMediaQ11xx::PrvFastLine
+// ---------------------------------------------------------------------------
+// Host-memory version of the Bresenham loop in PrvDoLine.  Returns false
+// (having drawn nothing) if the line can't be handled here.
+
+Bool EmRegsMediaQ11xx::PrvFastLine (uint16 x, uint16 y, int xAdjust, int yAdjust,
+									uint16 yIsMajor)
+{
+#if FAST_BLIT
+	if (fState.rotate90 || !this->PrvFastInit ())
+		return false;
+
+	uint16	numPoints = fState.majorLength + (fState.drawLastPixel ? 1 : 0);
+
+	if (numPoints == 0)
+		return true;
+
+	// The minor axis moves at most once per point, so the line fits in
+	// the square with the major length on each side.
+
+	if (!this->PrvFastRectInBounds (x, y, xAdjust, yAdjust, numPoints, numPoints))
+		return false;
+
+	long	xStep		= xAdjust * fBytesPerPixel;
+	long	yStep		= yAdjust * (long) fState.destLineStride;
+	long	majorStep	= yIsMajor ? yStep : xStep;
+	long	minorStep	= yIsMajor ? xStep : yStep;
+
+	uint16	pen			= fState.fgColorMonoPat;
+	uint8	rop			= fState.rasterOperation;
+	Bool	usesDest	= this->PrvUsesDest ();
+	uint16	constant	= this->PrvAdjustPixel (pen, 0, 0, rop);
+
+	uint8*	destP		= this->PrvGetPixelPointer (x, y);
+	uint8*	lowP		= destP;
+	uint8*	highP		= destP;
+	int		error		= 0;
+
+	for (uint16 count = 0; count < numPoints; ++count)
+	{
+		if (fBytesPerPixel == 2)
+		{
+			uint16	output = usesDest ? this->PrvAdjustPixel (pen, 0, EmMemDoGet16 (destP), rop) : constant;
+			EmMemDoPut16 (destP, output);
+		}
+		else
+		{
+			uint16	output = usesDest ? this->PrvAdjustPixel (pen, 0, EmMemDoGet8 (destP), rop) : constant;
+			EmMemDoPut8 (destP, output);
+		}
+
+		if (destP < lowP)
+			lowP = destP;
+
+		if (destP > highP)
+			highP = destP;
+
+		// The last pixel is drawn without stepping past it.
+
+		if (count == fState.majorLength)
+			break;
+
+		destP += majorStep;
+		error += 2 * fState.deltaMinor;
+
+		if (error > fState.deltaMajor)
+		{
+			destP += minorStep;
+			error -= 2 * fState.deltaMajor;
+		}
+	}
+
+	uint8*	videoP = this->PrvGetPixelPointer (0, 0);
+	EmScreen::MarkDirty (this->PrvGetPixelLocation (0, 0) + (lowP - videoP),
+		(highP - lowP) + fBytesPerPixel);
+
+	return true;
+#else
+	UNUSED_PARAM (x);
+	UNUSED_PARAM (y);
+	UNUSED_PARAM (xAdjust);
+	UNUSED_PARAM (yAdjust);
+	UNUSED_PARAM (yIsMajor);
+
+	return false;
+#endif
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsMediaQ11xx::PrvFastInit
+// ---------------------------------------------------------------------------
+// Get the host address of the frame buffer and the pixel size for the
+// current command.
+
+Bool EmRegsMediaQ11xx::PrvFastInit (void)
+{
+	switch (fState.colorDepth)
+	{
+		case kColorDepth8:
+			fBytesPerPixel = 1;
+			break;
+
+		case kColorDepth16:
+			fBytesPerPixel = 2;
+			break;
+
+		default:
+			return false;
+	}
+
+	fVideoMem = EmMemGetRealAddress (this->PrvGetVideoBase ());
+
+	return fVideoMem != NULL;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsMediaQ11xx::PrvFastRectInBounds
+// ---------------------------------------------------------------------------
+// Return whether the width x height block of pixels starting at x,y and
+// extending in the given directions lies within the frame buffer.  The
+// coordinates are 16-bit, so also make sure they don't wrap around along
+// the way, which would make the block discontiguous.
+
+Bool EmRegsMediaQ11xx::PrvFastRectInBounds (uint16 x, uint16 y, int xAdjust, int yAdjust,
+											uint16 width, uint16 height)
+{
+	long	left	= xAdjust > 0 ? x : (long) x - (width - 1);
+	long	right	= xAdjust > 0 ? (long) x + (width - 1) : x;
+	long	top		= yAdjust > 0 ? y : (long) y - (height - 1);
+	long	bottom	= yAdjust > 0 ? (long) y + (height - 1) : y;
+
+	if (left < 0 || top < 0 || right > 0xFFFF || bottom > 0xFFFF)
+		return false;
+
+	// Addresses grow with both x and y, so the top-left and bottom-right
+	// pixels are the extremes.
+
+	long	first	= fState.baseAddr + top * fState.destLineStride + left * fBytesPerPixel;
+	long	last	= fState.baseAddr + bottom * fState.destLineStride + right * fBytesPerPixel;
+
+	return first >= 0 && last + fBytesPerPixel <= MMIO_OFFSET;
+}
+
+
 #pragma mark -
 
 // ---------------------------------------------------------------------------
@@ -4735,6 +5275,27 @@ Bool EmRegsMediaQ11xx::PrvUsesSource (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmRegsMediaQ11xx::PrvUsesDest
+// ---------------------------------------------------------------------------
+// Return whether or not the specified rasterOperation will require the
+// current destination pixel value.  Same idea as PrvUsesPattern and
+// PrvUsesSource: if b0 == b1, b2 == b3, b4 == b5, and b6 == b7, then D has
+// not figured into the result.  Shifting a copy of the ROP right by one
+// and XORing it with the original puts those comparisons in bits 0, 2,
+// 4, and 6, so we mask with 0x55.
+
+Bool EmRegsMediaQ11xx::PrvUsesDest (void)
+{
+	uint8	rop		= fState.rasterOperation;
+	uint8	shifted	= rop >> 1;
+	uint8	xored	= rop ^ shifted;
+	uint8	masked	= xored & 0x55;
+
+	return masked != 0;
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmRegsMediaQ11xx::PrvExpandMono8
 // ---------------------------------------------------------------------------
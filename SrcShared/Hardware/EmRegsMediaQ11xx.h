@@ -267,6 +267,26 @@ class EmRegsMediaQ11xx : public EmRegs, public EmHALHandler
 		void					PrvIncBlitterInit		(void);
 		void					PrvIncBlitterRun		(void);
 
+		int						PrvFastBlitInit			(void);
+		void					PrvFastBlitRun			(void);
+		void					PrvFastFillRow			(uint8* destP, uint16 x,
+														 int xAdjust, uint16 count);
+		uint16					PrvFastExpandRow		(uint8* destP, uint16 x,
+														 int xAdjust, uint16 count,
+														 Bool rowClipped);
+		void					PrvFastCopyRow			(uint8* destP, uint8* srcP,
+														 uint16 x, int xAdjust,
+														 uint16 count);
+		Bool					PrvFastLine				(uint16 x, uint16 y,
+														 int xAdjust, int yAdjust,
+														 uint16 yIsMajor);
+		Bool					PrvFastInit				(void);
+		Bool					PrvFastRectInBounds		(uint16 x, uint16 y,
+														 int xAdjust, int yAdjust,
+														 uint16 width, uint16 height);
+		uint8*					PrvGetPixelPointer		(uint16 x, uint16 y);
+		Bool					PrvFastInClipX			(uint16 x);
+
 		void					PrvPatternPipeInit		(void);
 		uint16					PrvPatternPipeNextPixel	(void);
 		void					PrvPatternPipeNextX		(void);
@@ -291,6 +311,7 @@ class EmRegsMediaQ11xx : public EmRegs, public EmHALHandler
 
 		Bool					PrvUsesPattern			(void);
 		Bool					PrvUsesSource			(void);
+		Bool					PrvUsesDest				(void);
 		void					PrvExpandMono8			(uint8 bits, uint16* results,
 														 uint16 fgColor, uint16 bgColor);
 		void					PrvExpandMono32			(uint32 bits, uint16* results,
@@ -346,6 +367,22 @@ class EmRegsMediaQ11xx : public EmRegs, public EmHALHandler
 
 		uint16					fXDest;
 		uint16					fYDest;
+
+			// Fast path data.  fBlitKind says which of the PrvFastBlitRun
+			// kernels (if any) is handling the current BitBLT.  The
+			// fFastOutput and fFastSkip tables hold the output pixel and
+			// transparency for each combination of background/foreground
+			// source and pattern values.
+
+		int						fBlitKind;
+		uint8*					fVideoMem;
+		int						fBytesPerPixel;
+		Bool					fFastMonoPattern;
+		Bool					fFastUsesDest;
+		uint16					fFastSource[2];
+		uint16					fFastPattern[2];
+		uint16					fFastOutput[2][2];
+		Bool					fFastSkip[2][2];
 };
 
 #endif // EmRegsMediaQ11xx_h
@@ -542,7 +542,7 @@ void EmRegsSED1376VisorPrism::GetLCDScanlines (EmScreenUpdateInfo& info)
 		// Set depth, size, and color table of EmPixMap.
 
 		info.fImage.SetSize (EmPoint (width, height));
-		info.fImage.SetFormat (kPixMapFormat24RGB);
+		info.fImage.SetFormat (kPixMapFormat16RGB565);
 
 		// Determine first and last scanlines to fetch.
 
@@ -567,44 +567,40 @@ void EmRegsSED1376VisorPrism::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 		int32	height = info.fLastLine - info.fFirstLine;
 
-		// Copy the pixels from source to dest.
+		// Copy the pixels from source to dest.  Pixels are RRRRRGGG
+		// GGGBBBBB words; emulated memory keeps each word in host order,
+		// so when the controller's byte-swap bit is set the word is
+		// already a native RGB565 value and only needs to be stored.
+		// Otherwise the two bytes are the other way around.
 
 		for (int yy = 0; yy < height; ++yy)
 		{
-			for (int xx = 0; xx < width; ++xx)
-			{
-				uint8	p1 = EmMemDoGet8 (srcPtr++);	// GGGBBBBB
-				uint8	p2 = EmMemDoGet8 (srcPtr++);	// RRRRRGGG
+			uint16*	srcPix	= (uint16*) srcPtr;
+			uint16*	destPix	= (uint16*) destPtr;
 
-				// Merge the two together so that we get RRRRRGGG GGGBBBBB
+			if (byteSwapped && !mono)
+			{
+				memcpy (destPix, srcPix, width * 2);
+			}
+			else
+			{
+				for (int xx = 0; xx < width; ++xx)
+				{
+					uint16	p = EmMemDoGet16 (srcPix++);
 
-				uint16	p;
+					if (!byteSwapped)
+						p = (p << 8) | (p >> 8);
 
-				if (!byteSwapped)
-					p = (p2 << 8) | p1;
-				else
-					p = (p1 << 8) | p2;
+					// In mono mode only the green bits count; replicate
+					// them into all three channels.
 
-				// Shift the bits around, forming RRRRRrrr, GGGGGGgg, and
-				// BBBBBbbb values, where the lower-case bits are copies of
-				// the least significant bits in the upper-case bits.
-				//
-				// Note that all of this could also be done with three 64K
-				// lookup tables.  If speed is an issue, we might want to
-				// investigate that.
+					if (mono)
+					{
+						uint16	green = (p >> 5) & 0x3F;
+						p = ((green >> 1) << 11) | (green << 5) | (green >> 1);
+					}
 
-				if (mono)
-				{
-					uint8	green = ((p >> 3) & 0xFC) | ((p >>  5) & 0x03);
-					*destPtr++ = green;
-					*destPtr++ = green;
-					*destPtr++ = green;
-				}
-				else
-				{
-					*destPtr++ = ((p >> 8) & 0xF8) | ((p >> 11) & 0x07);
-					*destPtr++ = ((p >> 3) & 0xFC) | ((p >>  5) & 0x03);
-					*destPtr++ = ((p << 3) & 0xF8) | ((p >>  0) & 0x07);
+					*destPix++ = p;
 				}
 			}
 
@@ -782,7 +778,7 @@ void EmRegsSED1376PalmGeneric::GetLCDScanlines (EmScreenUpdateInfo& info)
 		// Set depth, size, and color table of EmPixMap.
 
 		info.fImage.SetSize (EmPoint (width, height));
-		info.fImage.SetFormat (kPixMapFormat24RGB);
+		info.fImage.SetFormat (kPixMapFormat16RGB565);
 
 		// Determine first and last scanlines to fetch.
 
@@ -807,44 +803,40 @@ void EmRegsSED1376PalmGeneric::GetLCDScanlines (EmScreenUpdateInfo& info)
 
 		int32	height = info.fLastLine - info.fFirstLine;
 
-		// Copy the pixels from source to dest.
+		// Copy the pixels from source to dest.  Pixels are RRRRRGGG
+		// GGGBBBBB words; emulated memory keeps each word in host order,
+		// so when the controller's byte-swap bit is set the word is
+		// already a native RGB565 value and only needs to be stored.
+		// Otherwise the two bytes are the other way around.
 
 		for (int yy = 0; yy < height; ++yy)
 		{
-			for (int xx = 0; xx < width; ++xx)
-			{
-				uint8	p1 = EmMemDoGet8 (srcPtr++);	// GGGBBBBB
-				uint8	p2 = EmMemDoGet8 (srcPtr++);	// RRRRRGGG
+			uint16*	srcPix	= (uint16*) srcPtr;
+			uint16*	destPix	= (uint16*) destPtr;
 
-				// Merge the two together so that we get RRRRRGGG GGGBBBBB
+			if (byteSwapped && !mono)
+			{
+				memcpy (destPix, srcPix, width * 2);
+			}
+			else
+			{
+				for (int xx = 0; xx < width; ++xx)
+				{
+					uint16	p = EmMemDoGet16 (srcPix++);
 
-				uint16	p;
+					if (!byteSwapped)
+						p = (p << 8) | (p >> 8);
 
-				if (!byteSwapped)
-					p = (p2 << 8) | p1;
-				else
-					p = (p1 << 8) | p2;
+					// In mono mode only the green bits count; replicate
+					// them into all three channels.
 
-				// Shift the bits around, forming RRRRRrrr, GGGGGGgg, and
-				// BBBBBbbb values, where the lower-case bits are copies of
-				// the least significant bits in the upper-case bits.
-				//
-				// Note that all of this could also be done with three 64K
-				// lookup tables.  If speed is an issue, we might want to
-				// investigate that.
+					if (mono)
+					{
+						uint16	green = (p >> 5) & 0x3F;
+						p = ((green >> 1) << 11) | (green << 5) | (green >> 1);
+					}
 
-				if (mono)
-				{
-					uint8	green = ((p >> 3) & 0xFC) | ((p >>  5) & 0x03);
-					*destPtr++ = green;
-					*destPtr++ = green;
-					*destPtr++ = green;
-				}
-				else
-				{
-					*destPtr++ = ((p >> 8) & 0xF8) | ((p >> 11) & 0x07);
-					*destPtr++ = ((p >> 3) & 0xFC) | ((p >>  5) & 0x03);
-					*destPtr++ = ((p << 3) & 0xF8) | ((p >>  0) & 0x07);
+					*destPix++ = p;
 				}
 			}
 
@@ -104,6 +104,15 @@ void EmRegsVZHandEra330::Initialize(void)
     SD.Initialize();
 }
 
+void EmRegsVZHandEra330::Save (SessionFile& f)
+{
+    EmRegsVZ::Save(f);
+
+    // The SD card's contents live in its disk image; flush its cache.
+
+    SD.Flush();
+}
+
 void EmRegsVZHandEra330::Dispose (void)
 {
     EmRegsVZ::Dispose();
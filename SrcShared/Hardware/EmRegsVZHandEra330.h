@@ -83,6 +83,7 @@ class EmRegsVZHandEra330 : public EmRegsVZ
   		virtual					~EmRegsVZHandEra330		(void);
 
 		virtual void			Initialize				(void);
+		virtual void			Save					(SessionFile&);
 		virtual void			Dispose					(void);
 
         virtual Bool			GetLCDScreenOn			(void);
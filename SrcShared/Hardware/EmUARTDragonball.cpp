@@ -14,7 +14,9 @@
 #include "EmCommon.h"
 #include "EmUARTDragonball.h"
 
+#include "ChunkFile.h"			// Chunk
 #include "EmHAL.h"				// EmHAL, EmUARTDeviceType
+#include "EmIOJournal.h"		// EmIOJournal::Poll, Record, Replay
 #include "EmTransportSerial.h"	// EmTransportSerial
 #include "Logging.h"			// LogAppendMsg
 #include "Preferences.h"		// gEmuPrefs
@@ -440,12 +442,20 @@ void EmUARTDragonball::UpdateState (State& state, Bool refreshRxData)
 {
 	EmAssert (fState.UART_TYPE == state.UART_TYPE);
 
-	// Update the RxFIFO if there's been any buffered data.
+	// Update the RxFIFO if there's been any buffered data.  When replaying
+	// Gremlin events, the data comes from the I/O journal instead, at the
+	// same point it arrived the first time around.
 
+	uint32			poll = EmIOJournal::Poll (kIOJournalSerialRead);
 	EmTransport*	transport = this->GetTransport ();
-	if (transport)
+
+	if (EmIOJournal::Replaying ())
+	{
+		this->ReplayRxFIFO (poll);
+	}
+	else if (transport)
 	{
-		this->ReceiveRxFIFO (transport);
+		this->ReceiveRxFIFO (transport, poll);
 	}
 
 	// === RX_FIFO_FULL ===
@@ -628,16 +638,11 @@ void EmUARTDragonball::TransmitTxFIFO (EmTransport* transport)
 		// Write out any outgoing bytes.
 
 		ErrCode	err = errNone;
-		char	buffer[kMaxFifoSize];
-		long	spaceInTxFIFO = fTxFIFO.GetUsed ();
+		uint8	buffer[kMaxFifoSize];
+		long	spaceInTxFIFO = fTxFIFO.Get (buffer, kMaxFifoSize);
 
 		if (spaceInTxFIFO > 0)
 		{
-			for (long ii = 0; ii < spaceInTxFIFO; ++ii)
-			{
-				buffer[ii] = fTxFIFO.Get ();
-			}
-
 			if (LogSerialData ())
 				LogAppendData (buffer, spaceInTxFIFO, "UART: Transmitted data:");
 			else
@@ -657,13 +662,14 @@ void EmUARTDragonball::TransmitTxFIFO (EmTransport* transport)
  *				the host serial port.  Assumes that the serial port is
  *				open.
  *
- * PARAMETERS:	None
+ * PARAMETERS:	transport - the host serial port.
+ *				poll - EmIOJournal count to record the data under.
  *
  * RETURNED:	Nothing
  *
  ***********************************************************************/
 
-void EmUARTDragonball::ReceiveRxFIFO (EmTransport* transport)
+void EmUARTDragonball::ReceiveRxFIFO (EmTransport* transport, uint32 poll)
 {
 	EmAssert (transport);
 
@@ -672,7 +678,7 @@ void EmUARTDragonball::ReceiveRxFIFO (EmTransport* transport)
 		// Buffer up any incoming bytes.
 
 		ErrCode	err = errNone;
-		char	buffer[kMaxFifoSize];
+		uint8	buffer[kMaxFifoSize];
 		long	spaceInRxFIFO = fRxFIFO.GetFree ();
 
 		// See how many bytes are waiting.
@@ -724,16 +730,49 @@ void EmUARTDragonball::ReceiveRxFIFO (EmTransport* transport)
 				else
 					PRINTF ("UART: Received %ld serial bytes.", bytesToBuffer);
 
-				for (long ii = 0; ii < bytesToBuffer; ++ii)
-				{
-					fRxFIFO.Put (buffer[ii]);
-				}	// end loop that puts bytes into FIFO
+				// Move the whole burst into the FIFO at once.  UpdateState
+				// will then see the new fill level and raise the RX
+				// interrupts (DATA_READY, or RX_FIFO_HALF/FULL once the
+				// level marker is reached) for the lot.
+
+				fRxFIFO.Put (buffer, bytesToBuffer);
+
+				EmIOJournal::Record (kIOJournalSerialRead, poll, bytesToBuffer,
+									0, buffer, bytesToBuffer);
 			}	// end no-error-from-EmTransport::Read
 		}	// end BytesInBuffer-returned-non-zero
 	}	// end is-serial-port-open
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	EmUARTDragonball::ReplayRxFIFO
+ *
+ * DESCRIPTION:	Fills the RX FIFO with whatever ReceiveRxFIFO put in it
+ *				at this point when Gremlin events were being recorded.
+ *
+ * PARAMETERS:	poll - EmIOJournal count the data was recorded under.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmUARTDragonball::ReplayRxFIFO (uint32 poll)
+{
+	int32	result;
+	int32	err;
+	Chunk	data;
+
+	if (EmIOJournal::Replay (kIOJournalSerialRead, poll, result, err, data))
+	{
+		long	len = min (data.GetLength (), (long) fRxFIFO.GetFree ());
+
+		fRxFIFO.Put ((uint8*) data.GetPointer (), (int) len);
+	}
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	EmUARTDragonball::GetTransport
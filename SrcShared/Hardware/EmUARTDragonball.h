@@ -131,7 +131,8 @@ class EmUARTDragonball
 		void					UpdateState			(State&, Bool refreshRxData);
 
 		void					TransmitTxFIFO		(EmTransport*);
-		void					ReceiveRxFIFO		(EmTransport*);
+		void					ReceiveRxFIFO		(EmTransport*, uint32 poll);
+		void					ReplayRxFIFO		(uint32 poll);
 
 		EmTransport*			GetTransport		(void);
 
@@ -68,6 +68,14 @@ void EmRegsCFAta::Dispose(void)
     DiskIO.Dispose();
 }
 
+// ---------------------------------------------------------------------------
+//		 EmRegsCFAta::Flush
+// ---------------------------------------------------------------------------
+void EmRegsCFAta::Flush(void)
+{
+    DiskIO.Flush();
+}
+
 //----------------------------------------------------------------------------
 // Status and Alternate Status Registers Offsets 7h and Eh
 //
@@ -74,6 +74,10 @@ void EmRegsCFMemCard::Reset (Bool /*hardwareReset*/)
 // ---------------------------------------------------------------------------
 void EmRegsCFMemCard::Save (SessionFile& /*f*/)
 {
+	// The card's contents live in the disk image, not the session file.
+	// Just make sure that the image is up to date.
+
+	Ata.Flush();
 }
 
 
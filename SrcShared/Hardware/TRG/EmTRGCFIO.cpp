@@ -73,6 +73,14 @@ void EmCFIO::Dispose (void)
     DiskIO.Dispose();
 }
 
+// ---------------------------------------------------------------------------
+//		 EmCFIO::Flush
+// ---------------------------------------------------------------------------
+void EmCFIO::Flush (void)
+{
+    DiskIO.Flush();
+}
+
 
 // ---------------------------------------------------------------------------
 //		 EmCFIO::ReadSector
@@ -179,6 +187,11 @@ void EmCFIO::StartRead(DiskIOParams * params)
 	State.NumSectorsCompleted = 0;
 	State.SectorIndex    = 0;
 	State.Error  = 0;
+
+	// Read the whole transfer (or as much as fits in the cache) at once;
+	// ReadNextDataByte then gets the sectors from the cache.
+
+	DiskIO.Prefetch(State.Lba, State.NumSectorsRequested);
 	State.Status = ReadSector();
 }
 
@@ -63,6 +63,7 @@ public:
 	// EmRegs overrides
 	void			Initialize(EmDiskTypeID DiskTypeID);
 	void			Dispose(void);
+	void			Flush(void);
 	void            Reset(void);
 	void			StartDriveID(void);
 	void			ReadNextDataByte(uint8 * val);
@@ -18,24 +18,63 @@
  * This class handles the generic low level disk access.
  ************************************************************************/
 #include <stdio.h>
+#include <string.h>				// memcpy, memset
 
-#include "EmCommon.h"
-#include "EmTRGDiskIO.h"
+#include "PreferenceMgr.h"		// Preference, kPrefKeyTRGDiskOverlay
 
 #define CFFILE_NAME   "trgdrv.dat"
 #define SDFILE_NAME   "trgdrvsd.dat"
 
 #define SECTOR_SIZE   512
 
+// The cache is direct-mapped: sector N lives in slot N % kCacheSectors.
+// Consecutive sectors land in consecutive slots, so a run of them can be
+// read or written back with one call.  These are uint32s, like the sector
+// numbers and counts they're compared with.
+
+static const uint32 kCacheSectors = 128;
+static const uint32 kReadAhead = 8;
+
+// Cache slot flags.
+
+#define CACHE_VALID   0x01
+#define CACHE_DIRTY   0x02
+
+// The first sector of an overlay file holds this signature, followed by
+// the number of sectors in the disk (big-endian).  The overlay map comes
+// next, then the sectors themselves, at the same positions they'd have
+// in the disk image.
+
+#define OVERLAY_SUFFIX     ".cow"
+#define OVERLAY_SIGNATURE  "PoseCOW1"
+#define OVERLAY_SIG_SIZE   8
+
+#define IN_OVERLAY(lba)   ((m_overlayMap[(lba) >> 3] & (1 << ((lba) & 7))) != 0)
+
+static Bool PrvIsEmptySector (const EmSector *sector);
+
 
 EmTRGDiskIO::EmTRGDiskIO()
 {
     m_driveNo = UNKNOWN_DRIVE;
+    m_numSectors = 0;
+
+    m_fp = NULL;
+    m_overlayFp = NULL;
+    m_overlayMap = NULL;
+    m_overlayMapSize = 0;
+    m_overlayDataStart = 0;
+    m_overlayMapDirty = false;
+
+    m_cacheLba = NULL;
+    m_cacheFlags = NULL;
+    m_cacheData = NULL;
 }
 
 
 EmTRGDiskIO::~EmTRGDiskIO()
 {
+    Dispose();
 }
 
 
@@ -57,79 +96,349 @@ char * EmTRGDiskIO::GetFilePath(int driveNo)
 #endif
 }
 
-int EmTRGDiskIO::Format(void)
+// ---------------------------------------------------------------------------
+// Open the disk image (creating it if needed) and keep it open until
+// Dispose.  Returns 0 on success, -1 on error.
+// ---------------------------------------------------------------------------
+int EmTRGDiskIO::Open(void)
 {
-    EmSector *buffer;
-    uint32    num, lba;
-    FILE      *fp;
+    if (m_fp != NULL)
+        return 0;
+
+    Preference<bool> overlay(kPrefKeyTRGDiskOverlay);
+
+    const char *path = GetFilePath(m_driveNo);
+    long        size;
+
+    m_numSectors = m_currDisk.GetNumSectors(m_diskTypeID);
+    size = (long) m_numSectors * SECTOR_SIZE;
+
+    // An image that's too short to hold the disk gets re-formatted, just
+    // as one that doesn't exist yet.
+
+    m_fp = fopen(path, *overlay ? "rb" : "r+b");
+    if (m_fp != NULL &&
+        (fseek(m_fp, 0, SEEK_END) != 0 || ftell(m_fp) < size))
+    {
+        fclose(m_fp);
+        m_fp = NULL;
+    }
+
+    if (m_fp == NULL)
+    {
+        FILE *fp = fopen(path, "w+b");
+        if (fp == NULL)
+            return -1;
+
+        if (Format(fp) != 0)
+        {
+            fclose(fp);
+            return -1;
+        }
+
+        if (*overlay)
+        {
+            fclose(fp);
+            if ((fp = fopen(path, "rb")) == NULL)
+                return -1;
+        }
+
+        m_fp = fp;
+    }
+
+    if (*overlay && OpenOverlay(path) != 0)
+    {
+        Close();
+        return -1;
+    }
+
+    m_cacheLba = new uint32[kCacheSectors];
+    m_cacheFlags = new uint8[kCacheSectors];
+    m_cacheData = new uint8[kCacheSectors * SECTOR_SIZE];
+
+    memset(m_cacheFlags, 0, kCacheSectors);
+
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Open the overlay for the image at the given path, or start a new one if
+// there isn't one (or it's for a different size of disk).
+// ---------------------------------------------------------------------------
+int EmTRGDiskIO::OpenOverlay(const char *path)
+{
+    string  overlayPath = string(path) + OVERLAY_SUFFIX;
+    uint8   header[SECTOR_SIZE];
+    uint8   expected[SECTOR_SIZE];
+
+    m_overlayMapSize = (m_numSectors + 7) / 8;
+    m_overlayDataStart = SECTOR_SIZE +
+        ((m_overlayMapSize + SECTOR_SIZE - 1) / SECTOR_SIZE) * SECTOR_SIZE;
+    m_overlayMap = new uint8[m_overlayMapSize];
+    m_overlayMapDirty = false;
+
+    memset(expected, 0, sizeof(expected));
+    memcpy(expected, OVERLAY_SIGNATURE, OVERLAY_SIG_SIZE);
+    expected[OVERLAY_SIG_SIZE + 0] = (uint8) (m_numSectors >> 24);
+    expected[OVERLAY_SIG_SIZE + 1] = (uint8) (m_numSectors >> 16);
+    expected[OVERLAY_SIG_SIZE + 2] = (uint8) (m_numSectors >> 8);
+    expected[OVERLAY_SIG_SIZE + 3] = (uint8) (m_numSectors);
+
+    if ((m_overlayFp = fopen(overlayPath.c_str(), "r+b")) != NULL)
+    {
+        if (fread(header, SECTOR_SIZE, 1, m_overlayFp) == 1 &&
+            memcmp(header, expected, SECTOR_SIZE) == 0 &&
+            fread(m_overlayMap, m_overlayMapSize, 1, m_overlayFp) == 1)
+        {
+            return 0;
+        }
 
-   	fp = fopen(GetFilePath(m_driveNo), "wb");
-    if (fp == NULL)
+        fclose(m_overlayFp);
+    }
+
+    if ((m_overlayFp = fopen(overlayPath.c_str(), "w+b")) == NULL)
+        return -1;
+
+    memset(m_overlayMap, 0, m_overlayMapSize);
+
+    if (fwrite(expected, SECTOR_SIZE, 1, m_overlayFp) != 1 ||
+        fwrite(m_overlayMap, m_overlayMapSize, 1, m_overlayFp) != 1)
+    {
         return -1;
+    }
+
+    return 0;
+}
+
+void EmTRGDiskIO::Close(void)
+{
+    if (m_fp != NULL)
+        fclose(m_fp);
+    if (m_overlayFp != NULL)
+        fclose(m_overlayFp);
+
+    delete [] m_overlayMap;
+    delete [] m_cacheLba;
+    delete [] m_cacheFlags;
+    delete [] m_cacheData;
+
+    m_fp = NULL;
+    m_overlayFp = NULL;
+    m_overlayMap = NULL;
+    m_cacheLba = NULL;
+    m_cacheFlags = NULL;
+    m_cacheData = NULL;
+}
+
+// ---------------------------------------------------------------------------
+// Write a freshly formatted disk to the given file.  Empty sectors are
+// skipped, so the file is sparse on file systems that support it.
+// ---------------------------------------------------------------------------
+int EmTRGDiskIO::Format(FILE *fp)
+{
+    EmSector *buffer;
+    uint32    num, lba;
+    int       result = 0;
 
     buffer = new EmSector;
 	num = m_currDisk.GetNumSectors(m_diskTypeID);
 	for (lba=0; lba<num; lba++)
 	{
-		m_currDisk.GetSector(m_diskTypeID, lba, buffer);		                   
+		m_currDisk.GetSector(m_diskTypeID, lba, buffer);
+
+		// Always write the last sector; it sets the size of the file.
+		if (lba != num - 1 && PrvIsEmptySector(buffer))
+			continue;
 
 		// The most probable error condition is
 		// attempting to write to a full drive ... it could also
 		// be write-protected, or on a disconnected network drive.
-		if (fwrite(buffer, SECTOR_SIZE, 1, fp) == 0)
+		if (fseek(fp, (long) lba * SECTOR_SIZE, SEEK_SET) != 0 ||
+			fwrite(buffer, SECTOR_SIZE, 1, fp) == 0)
         {
-            delete buffer;
-            fclose(fp);
-			return -1;
+            result = -1;
+            break;
         }
 	}
     delete buffer;
 
-	return 0;
+    if (result == 0 && fflush(fp) != 0)
+        result = -1;
+
+    return result;
 }
 
-int EmTRGDiskIO::Read(uint32 sectorNum, void *buffer)
+// ---------------------------------------------------------------------------
+// Read a run of sectors from the image (or the overlay), bypassing the
+// cache.
+// ---------------------------------------------------------------------------
+int EmTRGDiskIO::Read(uint32 sectorNum, uint32 count, void *buffer)
 {
-    FILE *fp;
+    uint8 *dest = (uint8 *) buffer;
 
-    if ((fp = fopen(GetFilePath(m_driveNo), "rb")) == NULL)
-        return -1;
-
-    if (fseek(fp, sectorNum * SECTOR_SIZE, SEEK_SET) == -1)
+    while (count > 0)
     {
-        fclose(fp);
-        return -1;
+        // Find the run of sectors that all come from the same file.
+
+        Bool    inOverlay = m_overlayMap != NULL && IN_OVERLAY(sectorNum);
+        uint32  run = 1;
+
+        while (run < count &&
+               (m_overlayMap != NULL && IN_OVERLAY(sectorNum + run)) == inOverlay)
+        {
+            run++;
+        }
+
+        FILE   *fp = inOverlay ? m_overlayFp : m_fp;
+        long    offset = (long) sectorNum * SECTOR_SIZE;
+
+        if (inOverlay)
+            offset += m_overlayDataStart;
+
+        if (fseek(fp, offset, SEEK_SET) != 0)
+            return -1;
+
+        if (fread(dest, SECTOR_SIZE, run, fp) != run)
+            return -1;
+
+        sectorNum += run;
+        count -= run;
+        dest += run * SECTOR_SIZE;
     }
 
-    if (fread(buffer, SECTOR_SIZE, 1, fp) != 1)
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Write a run of sectors to the image (or the overlay), bypassing the
+// cache.
+// ---------------------------------------------------------------------------
+int EmTRGDiskIO::Write(uint32 sectorNum, uint32 count, const void *buffer)
+{
+    FILE   *fp = m_fp;
+    long    offset = (long) sectorNum * SECTOR_SIZE;
+
+    if (m_overlayFp != NULL)
     {
-        fclose(fp);
+        fp = m_overlayFp;
+        offset += m_overlayDataStart;
+    }
+
+    if (fseek(fp, offset, SEEK_SET) != 0)
         return -1;
+
+    if (fwrite(buffer, SECTOR_SIZE, count, fp) != count)
+        return -1;
+
+    if (m_overlayFp != NULL)
+    {
+        uint32 lba;
+
+        for (lba = sectorNum; lba < sectorNum + count; lba++)
+            m_overlayMap[lba >> 3] |= (uint8) (1 << (lba & 7));
+
+        m_overlayMapDirty = true;
     }
-    fclose(fp);
 
     return 0;
 }
 
-int EmTRGDiskIO::Write(uint32 sectorNum, void *buffer)
+// ---------------------------------------------------------------------------
+// Make sure that the given sectors are in the cache, reading any that
+// aren't with as few calls as possible.  Reads at most a cache-full.
+// ---------------------------------------------------------------------------
+int EmTRGDiskIO::Fill(uint32 sectorNum, uint32 count)
 {
-    FILE *fp;
+    uint32 i, j, k, slot;
 
-    if ((fp = fopen(GetFilePath(m_driveNo), "r+b")) == NULL)
+    if (sectorNum >= m_numSectors)
         return -1;
 
-    if (fseek(fp, sectorNum * SECTOR_SIZE, SEEK_SET) == -1)
+    if (count > kCacheSectors)
+        count = kCacheSectors;
+
+    if (count > m_numSectors - sectorNum)
+        count = m_numSectors - sectorNum;
+
+    i = 0;
+    while (i < count)
     {
-        fclose(fp);
-        return -1;
+        slot = (sectorNum + i) % kCacheSectors;
+
+        if ((m_cacheFlags[slot] & CACHE_VALID) && m_cacheLba[slot] == sectorNum + i)
+        {
+            i++;
+            continue;
+        }
+
+        // Find the run of missing sectors starting here.  Stop at the end
+        // of the cache, so that the run is contiguous in m_cacheData.
+
+        j = i + 1;
+        while (j < count && (sectorNum + j) % kCacheSectors != 0)
+        {
+            k = (sectorNum + j) % kCacheSectors;
+            if ((m_cacheFlags[k] & CACHE_VALID) && m_cacheLba[k] == sectorNum + j)
+                break;
+            j++;
+        }
+
+        // Write back whatever we're about to replace, then read the run.
+
+        if (WriteBack(slot, j - i) != 0)
+            return -1;
+
+        if (Read(sectorNum + i, j - i, m_cacheData + slot * SECTOR_SIZE) != 0)
+        {
+            memset(m_cacheFlags + slot, 0, j - i);
+            return -1;
+        }
+
+        for (k = 0; k < j - i; k++)
+        {
+            m_cacheLba[slot + k] = sectorNum + i + k;
+            m_cacheFlags[slot + k] = CACHE_VALID;
+        }
+
+        i = j;
     }
 
-    if (fwrite(buffer, SECTOR_SIZE, 1, fp) != 1)
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Write any dirty sectors in the given range of cache slots, coalescing
+// runs of consecutive sectors.
+// ---------------------------------------------------------------------------
+int EmTRGDiskIO::WriteBack(uint32 slot, uint32 count)
+{
+    uint32 end = slot + count;
+    uint32 i = slot;
+    uint32 j, k;
+
+    while (i < end)
     {
-        fclose(fp);
-        return -1;
+        if ((m_cacheFlags[i] & CACHE_DIRTY) == 0)
+        {
+            i++;
+            continue;
+        }
+
+        j = i + 1;
+        while (j < end && (m_cacheFlags[j] & CACHE_DIRTY) &&
+               m_cacheLba[j] == m_cacheLba[i] + (j - i))
+        {
+            j++;
+        }
+
+        if (Write(m_cacheLba[i], j - i, m_cacheData + i * SECTOR_SIZE) != 0)
+            return -1;
+
+        for (k = i; k < j; k++)
+            m_cacheFlags[k] &= ~CACHE_DIRTY;
+
+        i = j;
     }
-    fclose(fp);
 
     return 0;
 }
@@ -143,32 +452,144 @@ void EmTRGDiskIO::Initialize(EmDiskTypeID DiskTypeID, int driveNo)
 
 void EmTRGDiskIO::Dispose(void)
 {
+    Flush();
+    Close();
 }
 
-int EmTRGDiskIO::ReadSector(uint32 sectorNum, void *buffer)
+// ---------------------------------------------------------------------------
+// Write all dirty sectors (and the overlay map) out to disk.
+// ---------------------------------------------------------------------------
+int EmTRGDiskIO::Flush(void)
 {
-    int retval;
+    int retval = 0;
 
-    if ((retval = Read(sectorNum, buffer)) != 0)
+    if (m_fp == NULL)
+        return 0;
+
+    if (WriteBack(0, kCacheSectors) != 0)
+        retval = -1;
+
+    if (m_overlayFp != NULL && m_overlayMapDirty)
     {
-        Format();
-        retval = Read(sectorNum, buffer);
+        if (fseek(m_overlayFp, SECTOR_SIZE, SEEK_SET) != 0 ||
+            fwrite(m_overlayMap, m_overlayMapSize, 1, m_overlayFp) != 1)
+        {
+            retval = -1;
+        }
+        else
+        {
+            m_overlayMapDirty = false;
+        }
     }
 
+    if (fflush(m_overlayFp != NULL ? m_overlayFp : m_fp) != 0)
+        retval = -1;
+
     return retval;
 }
 
+int EmTRGDiskIO::ReadSector(uint32 sectorNum, void *buffer)
+{
+    return ReadSectors(sectorNum, 1, buffer);
+}
+
 
 
 int EmTRGDiskIO::WriteSector(uint32 sectorNum, void *buffer)
 {
-    int retval;
+    return WriteSectors(sectorNum, 1, buffer);
+}
+
+int EmTRGDiskIO::ReadSectors(uint32 sectorNum, uint32 count, void *buffer)
+{
+    uint8  *dest = (uint8 *) buffer;
+    uint32  chunk, i;
+
+    if (Open() != 0)
+        return -1;
+
+    if (sectorNum >= m_numSectors || count > m_numSectors - sectorNum)
+        return -1;
 
-    if ((retval = Write(sectorNum, buffer)) != 0)
+    while (count > 0)
     {
-        Format();
-        retval = Write(sectorNum, buffer);
+        chunk = count < kCacheSectors ? count : kCacheSectors;
+
+        // Read a little ahead; the SD card in particular is read one
+        // sector at a time.
+
+        if (Fill(sectorNum, chunk < kReadAhead ? kReadAhead : chunk) != 0)
+            return -1;
+
+        for (i = 0; i < chunk; i++)
+        {
+            memcpy(dest + i * SECTOR_SIZE,
+                   m_cacheData + ((sectorNum + i) % kCacheSectors) * SECTOR_SIZE,
+                   SECTOR_SIZE);
+        }
+
+        sectorNum += chunk;
+        count -= chunk;
+        dest += chunk * SECTOR_SIZE;
     }
 
-    return retval;
+    return 0;
+}
+
+int EmTRGDiskIO::WriteSectors(uint32 sectorNum, uint32 count, const void *buffer)
+{
+    const uint8 *src = (const uint8 *) buffer;
+    uint32       i, slot;
+
+    if (Open() != 0)
+        return -1;
+
+    if (sectorNum >= m_numSectors || count > m_numSectors - sectorNum)
+        return -1;
+
+    for (i = 0; i < count; i++)
+    {
+        slot = (sectorNum + i) % kCacheSectors;
+
+        // If the slot holds a different dirty sector, write it back.  Write
+        // back the rest of the cache after it too: if this is a long write,
+        // we're about to replace those, and this way they go in one call.
+
+        if ((m_cacheFlags[slot] & CACHE_DIRTY) && m_cacheLba[slot] != sectorNum + i)
+        {
+            if (WriteBack(slot, kCacheSectors - slot) != 0)
+                return -1;
+        }
+
+        memcpy(m_cacheData + slot * SECTOR_SIZE, src + i * SECTOR_SIZE, SECTOR_SIZE);
+        m_cacheLba[slot] = sectorNum + i;
+        m_cacheFlags[slot] = CACHE_VALID | CACHE_DIRTY;
+    }
+
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Read the given sectors into the cache ahead of a multi-sector transfer.
+// ---------------------------------------------------------------------------
+int EmTRGDiskIO::Prefetch(uint32 sectorNum, uint32 count)
+{
+    if (Open() != 0)
+        return -1;
+
+    return Fill(sectorNum, count);
+}
+
+
+Bool PrvIsEmptySector(const EmSector *sector)
+{
+    int i;
+
+    for (i = 0; i < SECTOR_SIZE; i++)
+    {
+        if (sector->Bytes[i] != 0)
+            return false;
+    }
+
+    return true;
 }
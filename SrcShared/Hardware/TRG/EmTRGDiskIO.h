@@ -16,28 +16,58 @@
 
 /************************************************************************
  * This class handles the generic low level disk access.
+ *
+ * The disk image is opened on first access and kept open until Dispose.
+ * Sectors go through a small write-back cache; dirty sectors are written
+ * to the image when they're evicted, or when Flush is called (which the
+ * owning EmRegs does when the session is saved).
+ *
+ * If the TRGDiskOverlay preference is on, the image is opened read-only
+ * and sectors written by the emulated device go to a copy-on-write
+ * overlay file next to it (the image name plus ".cow").  The overlay is
+ * a sparse file: only the sectors that were written take up space.
  ************************************************************************/
 #include "EmTRGCFDefs.h"
 #include "EmTRGDiskType.h"
 
+#include <stdio.h>				// FILE
+
 #define UNKNOWN_DRIVE 0
 #define CF_DRIVE  1
 #define SD_DRIVE  2
 
 #define SECTOR_SIZE 512
 
-class EmTRGDiskIO 
+class EmTRGDiskIO
 {
 private:
     int             m_driveNo;
     EmDiskTypeID    m_diskTypeID;
 	EmCurrDiskType	m_currDisk;
+    uint32          m_numSectors;
+
+    FILE           *m_fp;
+    FILE           *m_overlayFp;
+    uint8          *m_overlayMap;       // One bit per sector; set if it's in the overlay.
+    uint32          m_overlayMapSize;
+    long            m_overlayDataStart;
+    Bool            m_overlayMapDirty;
+
+    uint32         *m_cacheLba;
+    uint8          *m_cacheFlags;
+    uint8          *m_cacheData;
 
-    int     Format(void);
+    int     Open(void);
+    void    Close(void);
+    int     Format(FILE *fp);
+    int     OpenOverlay(const char *path);
     char   *GetFilePath(int driveNo);
 
-    int     Read(uint32 sectorNum, void *buffer);
-    int     Write(uint32 sectorNum, void *buffer);
+    int     Read(uint32 sectorNum, uint32 count, void *buffer);
+    int     Write(uint32 sectorNum, uint32 count, const void *buffer);
+
+    int     Fill(uint32 sectorNum, uint32 count);
+    int     WriteBack(uint32 slot, uint32 count);
 
 public:
     EmTRGDiskIO(void);
@@ -45,9 +75,14 @@ public:
 
     void Initialize(EmDiskTypeID DiskTypeID, int driveNo);
     void Dispose(void);
+    int  Flush(void);
 
     int  ReadSector(uint32 sectorNum, void *buffer);
     int  WriteSector(uint32 sectorNum, void *buffer);
+
+    int  ReadSectors(uint32 sectorNum, uint32 count, void *buffer);
+    int  WriteSectors(uint32 sectorNum, uint32 count, const void *buffer);
+    int  Prefetch(uint32 sectorNum, uint32 count);
 };
 
 #endif	/* EmTRGDiskIO_h */
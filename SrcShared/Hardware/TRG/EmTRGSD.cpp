@@ -93,6 +93,14 @@ void EmTRGSD::Dispose(void)
     DiskIO.Dispose();
 }
 
+// ---------------------------------------------------------------------------
+//		 EmTRGSD::Flush
+// ---------------------------------------------------------------------------
+void EmTRGSD::Flush(void)
+{
+    DiskIO.Flush();
+}
+
 
 // ---------------------------------------------------------------------------
 //		 EmTRGSD::CompleteCommand
@@ -57,6 +57,7 @@ class EmTRGSD
 
         void Initialize(void);
         void Dispose(void);
+        void Flush(void);
 
 	    void ExchangeBits(uint16 txData, uint16 *rxData, uint16 Bits);
 };
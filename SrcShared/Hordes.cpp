@@ -21,6 +21,7 @@
 #include "EmMapFile.h"			// EmMapFile::Write, etc.
 #include "EmMinimize.h"			// EmMinimize::IsDone
 #include "EmPatchState.h"		// EmPatchState::UIInitialized
+#include "EmScreenCapture.h"	// EmScreenCapture::SaveStill, StartRecording
 #include "EmSession.h"			// gSession, ScheduleResumeHordesFromFile
 #include "EmStreamFile.h"		// kCreateOrOpenForWrite
 #include "ErrorHandling.h"		// Errors::ThrowIfPalmError
@@ -70,6 +71,8 @@ static EmDirRef		gGremlinDir;
 Bool				gWarningHappened;
 Bool				gErrorHappened;
 
+static void			PrvStartRecording (void);
+
 
 ////////////////////////////////////////////////////////////////////////////////////////
 // HORDES METHODS
@@ -252,6 +255,8 @@ Hordes::New(const HordeInfo& info)
 
 	Hordes::StartLog ();
 
+	::PrvStartRecording ();
+
 	LogAppendMsg ("New Gremlin #%ld started anew to %ld events",
 					gremInfo.fNumber, gremInfo.fSteps);
 
@@ -617,6 +622,8 @@ Hordes::EndHordes (void)
 
 	LogDump ();
 
+	EmScreenCapture::StopRecording ();
+
 	Hordes::TurnOn (false);
 
 	LogClear();
@@ -705,6 +712,8 @@ Hordes::StartGremlinFromLoadedRootState (void)
 
 	gTheGremlin.New (gremInfo);
 
+	::PrvStartRecording ();
+
 	LogAppendMsg ("New Gremlin #%ld started from root state to %ld events",
 					gCurrentGremlin, gremInfo.fSteps);
 }
@@ -744,6 +753,8 @@ Hordes::StartGremlinFromLoadedSuspendedState (void)
 		gCurrentGremlin, newUntil);
 
 	Hordes::TurnOn(true);
+
+	::PrvStartRecording ();
 }
 
 
@@ -873,6 +884,17 @@ Hordes::ErrorEncountered (void)
 
 	Hordes::AutoSaveState ();
 
+	// Save a picture of the screen, too, so that the failure can be
+	// looked at without re-running the Gremlin.
+
+	try
+	{
+		EmScreenCapture::SaveStill (Hordes::SuggestFileRef (kHordeScreenFile));
+	}
+	catch (ErrCode)
+	{
+	}
+
 	LogAppendMsg ("=== ERROR: Gremlin #%ld terminated in error at event #%ld\n",
 		errorGremlin, errorEvent);
 
@@ -1083,6 +1105,8 @@ Hordes::Resume()
 		gTheGremlin.RestoreFinalUntil ();
 
 		gTheGremlin.Resume ();
+
+		::PrvStartRecording ();
 	}
 }
 
@@ -1107,6 +1131,8 @@ Hordes::Stop (void)
 	StubAppGremlinsOff ();
 
 	gTheGremlin.Stop ();
+
+	EmScreenCapture::StopRecording ();
 }
 
 
@@ -1125,6 +1151,8 @@ Hordes::Stop (void)
  *					kHordeRootFile
  *					kHordeSuspendFile
  *					kHordeAutoCurrentFile
+ *					kHordeScreenFile
+ *					kHordeRecordingFile
  *
  *					kHordeSuspendFile	-	last file in a gremlin thread
  *
@@ -1143,6 +1171,8 @@ string Hordes::SuggestFileName (HordeFileType category, uint32 num)
 	static const char kStrAutoSaveFile[]		= "Gremlin_%03ld_Event_%08ld.psf";
 	static const char kStrEventFile[]			= "Gremlin_%03ld_Events.pev";
 	static const char kStrMinimalEventFile []	= "Gremlin_%03ld_Interim_Event_File_%08ld.pev";
+	static const char kStrScreenFile[]			= "Gremlin_%03ld_Event_%08ld.png";
+	static const char kStrRecordingFile[]		= "Gremlin_%03ld_Event_%08ld.y4m";
 
 	char fileName[64];
 
@@ -1197,6 +1227,20 @@ string Hordes::SuggestFileName (HordeFileType category, uint32 num)
 			sprintf (fileName, kStrMinimalEventFile, gremlinNumber, time);
 			break;
 
+		case kHordeScreenFile:
+
+			gremlinNumber = Hordes::GremlinNumber ();
+			eventCounter = Hordes::EventCounter ();
+			sprintf (fileName, kStrScreenFile, gremlinNumber, eventCounter);
+			break;
+
+		case kHordeRecordingFile:
+
+			gremlinNumber = Hordes::GremlinNumber ();
+			eventCounter = Hordes::EventCounter ();
+			sprintf (fileName, kStrRecordingFile, gremlinNumber, eventCounter);
+			break;
+
 		default:
 
 			*fileName = '\0';
@@ -1222,6 +1266,8 @@ string Hordes::SuggestFileName (HordeFileType category, uint32 num)
  *					kHordeRootFile
  *					kHordeSuspendFile
  *					kHordeAutoCurrentFile
+ *					kHordeScreenFile
+ *					kHordeRecordingFile
  *
  *					kHordeSuspendFile	-	last file in a gremlin thread
  *
@@ -2438,3 +2484,39 @@ string Hordes::TranslateErrorCode (UInt32 errCode)
 	return "";
 }
 
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvStartRecording
+ *
+ * DESCRIPTION: If the RecordGremlinScreen preference is set, start
+ *				recording the LCD for the Gremlin that's about to run.
+ *				Each stretch of a Gremlin gets its own file, named for
+ *				the Gremlin and the event it starts at; the recording
+ *				ends in Hordes::Stop.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	none
+ *
+ ***********************************************************************/
+
+void
+PrvStartRecording (void)
+{
+	Preference<bool>	pref (kPrefKeyRecordGremlinScreen);
+
+	if (!*pref)
+		return;
+
+	try
+	{
+		EmScreenCapture::StartRecording (Hordes::SuggestFileRef (kHordeRecordingFile));
+	}
+	catch (ErrCode)
+	{
+		LogAppendMsg ("Unable to record the screen for Gremlin #%ld",
+			Hordes::GremlinNumber ());
+	}
+}
@@ -26,7 +26,9 @@ enum HordeFileType
 	kHordeSuspendFile		= 0x02,
 	kHordeEventFile			= 0x03,
 	kHordeMinimalEventFile	= 0x04,
-	kHordeAutoCurrentFile	= 0x05
+	kHordeAutoCurrentFile	= 0x05,
+	kHordeScreenFile		= 0x06,
+	kHordeRecordingFile		= 0x07
 };
 
 
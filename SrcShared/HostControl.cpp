@@ -15,6 +15,7 @@
 #include "HostControl.h"
 #include "HostControlPrv.h"
 
+#include "ChunkFile.h"			// Chunk
 #include "DebugMgr.h"			// gDebuggerGlobals
 #include "EmApplication.h"		// gApplication, ScheduleQuit
 #include "EmBankMapped.h"		// EmBankMapped::GetEmulatedAddress
@@ -26,6 +27,8 @@
 #include "EmExgMgr.h"			// EmExgMgr::GetExgMgr
 #include "EmFileImport.h"		// EmFileImport::LoadPalmFileList
 #include "EmFileRef.h"			// EmFileRefList
+#include "EmIOJournal.h"		// EmIOJournal::Poll, Record, Replay
+#include "EmInstructionStats.h"	// EmInstructionStats::Start, Stop, Clear, Dump
 #include "EmMemory.h"			// EmMem_strlen, EmMem_strcpy
 #include "EmPalmStructs.h"		// EmAliasErr
 #include "EmPatchState.h"		// EmPatchState::UIInitialized
@@ -33,6 +36,9 @@
 #include "EmSession.h"			// ResumeByExternal
 #include "EmStreamFile.h"		// EmStreamFile
 #include "EmStructs.h"			// StringList, ByteList
+#include "EmTrapStats.h"		// EmTrapStats::Clear, SetTiming, Dump, GetStats
+#include "EmVirtualTime.h"		// EmVirtualTime::IsOn, GetMilliseconds, GetTime
+#include "EmWatchpoints.h"		// EmWatchpoints::Add, RemoveRange, RemoveAll
 #include "Hordes.h"				// Hordes::IsOn
 #include "LoadApplication.h"	// SavePalmFile
 #include "Logging.h"			// LogFile
@@ -768,6 +774,238 @@ static void _HostProfileGetCycles (void)
 #endif
 
 
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 _HostTrapStatsReset
+// ---------------------------------------------------------------------------
+
+static void _HostTrapStatsReset (void)
+{
+	// HostErrType HostTrapStatsReset (void)
+
+	CALLED_SETUP_HC ("HostErrType", "void");
+
+	// Call the function.
+
+	EmTrapStats::Clear ();
+
+	// Return the result.
+
+	PUT_RESULT_VAL (HostErrType, hostErrNone);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 _HostTrapStatsTiming
+// ---------------------------------------------------------------------------
+
+static void _HostTrapStatsTiming (void)
+{
+	// HostErrType HostTrapStatsTiming (HostBoolType timing)
+
+	CALLED_SETUP_HC ("HostErrType", "HostBoolType timing");
+
+	// Get the caller's parameters.
+
+	CALLED_GET_PARAM_VAL (HostBoolType, timing);
+
+	// Call the function.
+
+	EmTrapStats::SetTiming (timing != 0);
+
+	// Return the result.
+
+	PUT_RESULT_VAL (HostErrType, hostErrNone);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 _HostTrapStatsDump
+// ---------------------------------------------------------------------------
+
+static void _HostTrapStatsDump (void)
+{
+	// HostErrType HostTrapStatsDump (const char* filenameP)
+
+	CALLED_SETUP_HC ("HostErrType", "const char* filenameP");
+
+	// Get the caller's parameters.
+
+	CALLED_GET_PARAM_STR (char, filenameP);
+
+	// Call the function.  With no file name, write the same file
+	// that the periodic dumps go to.
+
+	const char*	fileName = filenameP;
+
+	try
+	{
+		EmTrapStats::Dump (fileName ? EmFileRef (fileName) : EmTrapStats::GetDumpFile ());
+	}
+	catch (ErrCode)
+	{
+		PUT_RESULT_VAL (HostErrType, hostErrDiskError);
+		return;
+	}
+
+	// Return the result.
+
+	PUT_RESULT_VAL (HostErrType, hostErrNone);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 _HostTrapStatsGetCalls
+// ---------------------------------------------------------------------------
+
+static void _HostTrapStatsGetCalls (void)
+{
+	// long HostTrapStatsGetCalls (UInt16 trapWord)
+
+	CALLED_SETUP_HC ("long", "UInt16 trapWord");
+
+	// Get the caller's parameters.
+
+	CALLED_GET_PARAM_VAL (UInt16, trapWord);
+
+	// Call the function.
+
+	EmTrapStatsType	stats;
+	EmTrapStats::GetStats (trapWord, stats);
+
+	// Return the result.
+
+	PUT_RESULT_VAL (long, stats.fCalls);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 _HostTrapStatsGetCycles
+// ---------------------------------------------------------------------------
+
+static void _HostTrapStatsGetCycles (void)
+{
+	// long HostTrapStatsGetCycles (UInt16 trapWord)
+
+	CALLED_SETUP_HC ("long", "UInt16 trapWord");
+
+	// Get the caller's parameters.
+
+	CALLED_GET_PARAM_VAL (UInt16, trapWord);
+
+	// Call the function.
+
+	EmTrapStatsType	stats;
+	EmTrapStats::GetStats (trapWord, stats);
+
+	// Return the result.  Saturate rather than wrap.
+
+	uint64	cycles = stats.fCycles;
+	if (cycles > 0x7FFFFFFF)
+		cycles = 0x7FFFFFFF;
+
+	PUT_RESULT_VAL (long, (long) cycles);
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 _HostInstrStatsStart
+// ---------------------------------------------------------------------------
+
+static void _HostInstrStatsStart (void)
+{
+	// HostErrType HostInstrStatsStart (void)
+
+	CALLED_SETUP_HC ("HostErrType", "void");
+
+	// Call the function.
+
+	EmInstructionStats::Start ();
+
+	// Return the result.
+
+	PUT_RESULT_VAL (HostErrType, hostErrNone);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 _HostInstrStatsStop
+// ---------------------------------------------------------------------------
+
+static void _HostInstrStatsStop (void)
+{
+	// HostErrType HostInstrStatsStop (void)
+
+	CALLED_SETUP_HC ("HostErrType", "void");
+
+	// Call the function.
+
+	EmInstructionStats::Stop ();
+
+	// Return the result.
+
+	PUT_RESULT_VAL (HostErrType, hostErrNone);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 _HostInstrStatsReset
+// ---------------------------------------------------------------------------
+
+static void _HostInstrStatsReset (void)
+{
+	// HostErrType HostInstrStatsReset (void)
+
+	CALLED_SETUP_HC ("HostErrType", "void");
+
+	// Call the function.
+
+	EmInstructionStats::Clear ();
+
+	// Return the result.
+
+	PUT_RESULT_VAL (HostErrType, hostErrNone);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 _HostInstrStatsDump
+// ---------------------------------------------------------------------------
+
+static void _HostInstrStatsDump (void)
+{
+	// HostErrType HostInstrStatsDump (const char* filenameP)
+
+	CALLED_SETUP_HC ("HostErrType", "const char* filenameP");
+
+	// Get the caller's parameters.
+
+	CALLED_GET_PARAM_STR (char, filenameP);
+
+	// Call the function.  With no file name, write InstructionStats.txt
+	// in the log directory.
+
+	const char*	fileName = filenameP;
+
+	try
+	{
+		EmInstructionStats::Dump (fileName ? EmFileRef (fileName) : EmInstructionStats::GetDumpFile ());
+	}
+	catch (ErrCode)
+	{
+		PUT_RESULT_VAL (HostErrType, hostErrDiskError);
+		return;
+	}
+
+	// Return the result.
+
+	PUT_RESULT_VAL (HostErrType, hostErrNone);
+}
+
+
 #pragma mark -
 
 // ---------------------------------------------------------------------------
@@ -1264,6 +1502,33 @@ static void _HostFRead (void)
 	CALLED_GET_PARAM_PTR (void, buffer, size * count, Marshal::kOutput);
 	CALLED_GET_PARAM_FILE (fileP);
 
+	// When replaying Gremlin events, hand back what was read the first
+	// time around, whether or not the file is there now.
+
+	uint32	when = EmIOJournal::Poll (kIOJournalHostFRead);
+
+	if (EmIOJournal::Replaying () && buffer != EmMemNULL)
+	{
+		int32	result;
+		int32	err;
+		Chunk	data;
+
+		if (!EmIOJournal::Replay (kIOJournalHostFRead, when, result, err, data))
+		{
+			result = 0;
+		}
+
+		if (result)
+		{
+			void*	p = buffer;
+			memcpy (p, data.GetPointer (), min (data.GetLength (), size * count));
+			CALLED_PUT_PARAM_REF (buffer);
+		}
+
+		PUT_RESULT_VAL (long, result);
+		return;
+	}
+
 	// Check the parameters.
 
 	if (!fh || buffer == EmMemNULL)
@@ -1284,6 +1549,9 @@ static void _HostFRead (void)
 		CALLED_PUT_PARAM_REF (buffer);
 	}
 
+	EmIOJournal::Record (kIOJournalHostFRead, when, result, 0,
+						(void*) buffer, result * size);
+
 	// Return the result.
 
 	PUT_RESULT_VAL (long, result);
@@ -1631,9 +1899,35 @@ static void _HostGetEnv (void)
 		return;
 	}
 
-	// Call the function.
+	// Call the function.  The value is journaled (with its terminating
+	// NULL, so that an empty value can be told from a missing one), and
+	// when replaying Gremlin events, the host's environment isn't looked at.
+
+	uint32	when = EmIOJournal::Poll (kIOJournalHostGetEnv);
+	char*	value;
 
-	char*	value = getenv (nameP);
+	if (EmIOJournal::Replaying ())
+	{
+		int32	result;
+		int32	err;
+		Chunk	data;
+
+		value = NULL;
+
+		if (EmIOJournal::Replay (kIOJournalHostGetEnv, when, result, err, data) &&
+			data.GetLength () > 0)
+		{
+			value = (char*) data.GetPointer ();
+		}
+
+		::PrvReturnString (value, sub);
+		return;
+	}
+
+	value = getenv (nameP);
+
+	EmIOJournal::Record (kIOJournalHostGetEnv, when, value != NULL, 0,
+						value, value ? strlen (value) + 1 : 0);
 
 	// Return the result.
 
@@ -1770,6 +2064,9 @@ static void _HostClock (void)
 
 	clock_t	result = clock ();
 
+	if (EmVirtualTime::IsOn ())
+		result = (clock_t) ((uint64) EmVirtualTime::GetMilliseconds () * CLOCKS_PER_SEC / 1000);
+
 	// Return the result.
 
 	PUT_RESULT_VAL (HostClockType, result);
@@ -1859,9 +2156,9 @@ static void _HostLocalTime (void)
 
 	// Call the function.
 
-	struct tm*	result = localtime (&myTime);
+	struct tm	result = EmVirtualTime::GetLocalTime (myTime);
 
-	::PrvHostTmFromTm (gLocalTime, *result);
+	::PrvHostTmFromTm (gLocalTime, result);
 
 	// Return the result.
 
@@ -1953,8 +2250,8 @@ static void _HostTime (void)
 
 	// Call the function.
 
-	time_t	result2;
-	time_t	result = time (&result2);
+	time_t	result2 = EmVirtualTime::GetTime ();
+	time_t	result = result2;
 
 	if (timeP)
 	{
@@ -3988,6 +4285,8 @@ static void _HostDbgSetDataBreak (void)
 		gDebuggerGlobals.watchBytes = size;
 	}
 
+	Debug::SyncDataBreak ();
+
 	// Return the result.
 
 	PUT_RESULT_VAL (HostErrType, errNone);
@@ -4018,6 +4317,114 @@ static void _HostDbgClearDataBreak (void)
 		gDebuggerGlobals.watchBytes = 0;
 	}
 
+	Debug::SyncDataBreak ();
+
+	// Return the result.
+
+	PUT_RESULT_VAL (HostErrType, errNone);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 _HostDbgAddWatchpoint
+// ---------------------------------------------------------------------------
+
+static void _HostDbgAddWatchpoint (void)
+{
+	// HostErr HostDbgAddWatchpoint (UInt32 addr, UInt32 size, UInt32 flags, const char* condition)
+
+	CALLED_SETUP_HC ("HostErr", "UInt32 addr, UInt32 size, UInt32 flags, const char* condition");
+
+	// Get the caller's parameters.
+
+	CALLED_GET_PARAM_VAL (UInt32, addr);
+	CALLED_GET_PARAM_VAL (UInt32, size);
+	CALLED_GET_PARAM_VAL (UInt32, flags);
+	CALLED_GET_PARAM_STR (char, condition);
+
+	// Check the parameters.  The condition is optional, but if there
+	// is one, it has to make sense.
+
+	const char*				conditionP = condition;
+	BreakpointCondition*	bc = NULL;
+
+	if (conditionP && *conditionP)
+	{
+		bc = Debug::NewBreakpointCondition (conditionP);
+
+		if (!bc)
+		{
+			PUT_RESULT_VAL (HostErrType, hostErrInvalidParameter);
+			return;
+		}
+	}
+
+	// Add the watchpoint.
+
+	if (EmWatchpoints::Add (addr, size, flags, bc) == 0)
+	{
+		PUT_RESULT_VAL (HostErrType, hostErrInvalidParameter);
+		return;
+	}
+
+	// Return the result.
+
+	PUT_RESULT_VAL (HostErrType, errNone);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 _HostDbgRemoveWatchpoint
+// ---------------------------------------------------------------------------
+
+static void _HostDbgRemoveWatchpoint (void)
+{
+	// HostErr HostDbgRemoveWatchpoint (UInt32 addr, UInt32 size)
+
+	CALLED_SETUP_HC ("HostErr", "UInt32 addr, UInt32 size");
+
+	// Get the caller's parameters.
+
+	CALLED_GET_PARAM_VAL (UInt32, addr);
+	CALLED_GET_PARAM_VAL (UInt32, size);
+
+	// Remove the watchpoints on that range.  A zero range removes them
+	// all.  Either way, if the data break set by HostDbgSetDataBreak (or
+	// the debugger) is among them, clear it too, so that the debugger
+	// doesn't think it's still armed.
+
+	if (addr == 0 && size == 0)
+	{
+		EmWatchpoints::RemoveAll ();
+
+		gDebuggerGlobals.watchEnabled = false;
+		gDebuggerGlobals.watchAddr = 0;
+		gDebuggerGlobals.watchBytes = 0;
+
+		Debug::SyncDataBreak ();
+	}
+	else
+	{
+		Bool	isDataBreak =	gDebuggerGlobals.watchEnabled &&
+								gDebuggerGlobals.watchAddr == addr &&
+								gDebuggerGlobals.watchBytes == size;
+
+		if (EmWatchpoints::RemoveRange (addr, size) == 0)
+		{
+			PUT_RESULT_VAL (HostErrType, hostErrInvalidParameter);
+			return;
+		}
+
+		if (isDataBreak)
+		{
+			gDebuggerGlobals.watchEnabled = false;
+			gDebuggerGlobals.watchAddr = 0;
+			gDebuggerGlobals.watchBytes = 0;
+
+			Debug::SyncDataBreak ();
+		}
+	}
+
 	// Return the result.
 
 	PUT_RESULT_VAL (HostErrType, errNone);
@@ -4740,6 +5147,17 @@ void Host::Initialize	(void)
 	gHandlerTable [hostSelectorProfileGetCycles]		= _HostProfileGetCycles;
 #endif
 
+	gHandlerTable [hostSelectorTrapStatsReset]			= _HostTrapStatsReset;
+	gHandlerTable [hostSelectorTrapStatsTiming]			= _HostTrapStatsTiming;
+	gHandlerTable [hostSelectorTrapStatsDump]			= _HostTrapStatsDump;
+	gHandlerTable [hostSelectorTrapStatsGetCalls]		= _HostTrapStatsGetCalls;
+	gHandlerTable [hostSelectorTrapStatsGetCycles]		= _HostTrapStatsGetCycles;
+
+	gHandlerTable [hostSelectorInstrStatsStart]			= _HostInstrStatsStart;
+	gHandlerTable [hostSelectorInstrStatsStop]			= _HostInstrStatsStop;
+	gHandlerTable [hostSelectorInstrStatsReset]			= _HostInstrStatsReset;
+	gHandlerTable [hostSelectorInstrStatsDump]			= _HostInstrStatsDump;
+
 	gHandlerTable [hostSelectorErrNo]					= _HostErrNo;
 
 	gHandlerTable [hostSelectorFClose]					= _HostFClose;
@@ -4850,6 +5268,8 @@ void Host::Initialize	(void)
 
 	gHandlerTable [hostSelectorDbgSetDataBreak]			= _HostDbgSetDataBreak;
 	gHandlerTable [hostSelectorDbgClearDataBreak]		= _HostDbgClearDataBreak;
+	gHandlerTable [hostSelectorDbgAddWatchpoint]		= _HostDbgAddWatchpoint;
+	gHandlerTable [hostSelectorDbgRemoveWatchpoint]		= _HostDbgRemoveWatchpoint;
 
 	gHandlerTable [hostSelectorSlotMax]					= _HostSlotMax;
 	gHandlerTable [hostSelectorSlotRoot]				= _HostSlotRoot;
@@ -73,6 +73,23 @@ extern "C" {
 #define hostSelectorProfileGetCycles		0x0206
 
 
+	// Trap statistics selectors
+
+#define hostSelectorTrapStatsReset			0x0280
+#define hostSelectorTrapStatsTiming			0x0281
+#define hostSelectorTrapStatsDump			0x0282
+#define hostSelectorTrapStatsGetCalls		0x0283
+#define hostSelectorTrapStatsGetCycles		0x0284
+
+
+	// Instruction statistics selectors
+
+#define hostSelectorInstrStatsStart			0x0290
+#define hostSelectorInstrStatsStop			0x0291
+#define hostSelectorInstrStatsReset			0x0292
+#define hostSelectorInstrStatsDump			0x0293
+
+
 	// Std C Library wrapper selectors
 
 #define hostSelectorErrNo					0x0300
@@ -250,6 +267,8 @@ extern "C" {
 
 #define hostSelectorDbgSetDataBreak			0x0980		// mcc 13 june 2001
 #define hostSelectorDbgClearDataBreak		0x0981		// mcc 13 june 2001
+#define hostSelectorDbgAddWatchpoint		0x0982
+#define hostSelectorDbgRemoveWatchpoint		0x0983
 
 
 	// Slot support
@@ -510,6 +529,12 @@ enum	// HostGet/SetFileAttr flags, matching EmFileAttr flags
 	hostFileAttrSystem = 4
 };
 
+enum	// HostDbgAddWatchpoint flags, matching EmWatchpoints flags
+{
+	hostWatchRead = 1,
+	hostWatchWrite = 2
+};
+
 // Use these to call FtrGet to see if you're running under the
 // Palm OS Emulator.  If not, FtrGet will return ftrErrNoSuchFeature.
 
@@ -591,6 +616,43 @@ long				HostProfileGetCycles(void)
 						HOST_TRAP(hostSelectorProfileGetCycles);
 
 
+/* ==================================================================== */
+/* Trap statistics-related calls										*/
+/* ==================================================================== */
+
+HostErrType			HostTrapStatsReset(void)
+						HOST_TRAP(hostSelectorTrapStatsReset);
+
+HostErrType			HostTrapStatsTiming(HostBoolType timing)
+						HOST_TRAP(hostSelectorTrapStatsTiming);
+
+HostErrType			HostTrapStatsDump(const char* filenameP)
+						HOST_TRAP(hostSelectorTrapStatsDump);
+
+long				HostTrapStatsGetCalls(UInt16 trapWord)
+						HOST_TRAP(hostSelectorTrapStatsGetCalls);
+
+long				HostTrapStatsGetCycles(UInt16 trapWord)
+						HOST_TRAP(hostSelectorTrapStatsGetCycles);
+
+
+/* ==================================================================== */
+/* Instruction statistics-related calls									*/
+/* ==================================================================== */
+
+HostErrType			HostInstrStatsStart(void)
+						HOST_TRAP(hostSelectorInstrStatsStart);
+
+HostErrType			HostInstrStatsStop(void)
+						HOST_TRAP(hostSelectorInstrStatsStop);
+
+HostErrType			HostInstrStatsReset(void)
+						HOST_TRAP(hostSelectorInstrStatsReset);
+
+HostErrType			HostInstrStatsDump(const char* filenameP)
+						HOST_TRAP(hostSelectorInstrStatsDump);
+
+
 /* ==================================================================== */
 /* Std C Library-related calls											*/
 /* ==================================================================== */
@@ -909,6 +971,12 @@ HostErr				HostDbgSetDataBreak (UInt32 addr, UInt32 size)
 HostErr				HostDbgClearDataBreak (void)
 						HOST_TRAP(hostSelectorDbgClearDataBreak);
 
+HostErr				HostDbgAddWatchpoint (UInt32 addr, UInt32 size, UInt32 flags, const char* condition)
+						HOST_TRAP(hostSelectorDbgAddWatchpoint);
+
+HostErr				HostDbgRemoveWatchpoint (UInt32 addr, UInt32 size)
+						HOST_TRAP(hostSelectorDbgRemoveWatchpoint);
+
 
 /* ==================================================================== */
 /* Slot related calls													*/
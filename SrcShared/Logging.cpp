@@ -43,6 +43,32 @@ LogStream*	LogGetStdLog (void)
 }
 
 
+// Figure out where to put log files and other reports.  If a Gremlin
+// Horde is running, then put them in the directory created to hold
+// Gremlin output files.  Otherwise, use the directory the user specified
+// in the preferences.  If no such directory was specified, use the
+// Emulator's directory.
+
+EmDirRef LogGetDirectory (void)
+{
+	Preference<EmDirRef>	logDirPref (kPrefKeyLogDefaultDir);
+
+	EmDirRef	defaultDir	= *logDirPref;
+
+	if (Hordes::IsOn ())
+	{
+		return Hordes::GetGremlinDirectory ();
+	}
+
+	if (defaultDir.Create (), defaultDir.Exists ())
+	{
+		return defaultDir;
+	}
+
+	return EmDirRef::GetEmulatorDirectory ();
+}
+
+
 static void PrvPrefsChanged (PrefKeyType key, void*)
 {
 #define UPDATE_ONE_PREF(name)								\
@@ -794,31 +820,9 @@ EmFileRef LogStreamInner::CreateFileReference (void)
 	EmFileRef	result;
 	char		buffer[32];
 
-	// Figure out where to put the log file.  If a Gremlin Horde is
-	// running, then put the log file in the directory created to
-	// hold Gremlin output files.  Otherwise, use the directory the
-	// use specified in the preferences.  If no such directory was
-	// specified, use the Emulator's directory.
-
-	Preference<EmDirRef>	logDirPref (kPrefKeyLogDefaultDir);
+	// Figure out where to put the log file.
 
-	EmDirRef	defaultDir	= *logDirPref;
-	EmDirRef	poserDir	= EmDirRef::GetEmulatorDirectory ();
-	EmDirRef	gremlinDir	= Hordes::GetGremlinDirectory ();
-	EmDirRef	logDir;
-
-	if (Hordes::IsOn ())
-	{
-		logDir = gremlinDir;
-	}
-	else if (defaultDir.Create (), defaultDir.Exists ())
-	{
-		logDir = defaultDir;
-	}
-	else
-	{
-		logDir = poserDir;
-	}
+	EmDirRef	logDir = ::LogGetDirectory ();
 
 	// If being forced to write to a new file, look for an unused
 	// file name.
@@ -109,6 +109,7 @@ void		LogEvtGetPen				(Int16, Int16, Boolean);
 void		LogEvtGetSysEvent			(const EventType& event, Int32 timeout);
 
 LogStream*	LogGetStdLog				(void);
+EmDirRef	LogGetDirectory				(void);
 void		LogStartup					(void);
 void		LogShutdown					(void);
 
@@ -23,6 +23,8 @@
 #include <netinet/in.h>			// ntohl, ntohs
 #endif
 
+#include <string.h>				// memcpy, memset
+
 // -------------------------
 // ----- Binary buffer -----
 // -------------------------
@@ -203,7 +205,10 @@ void Marshal::GetEventType (emuptr p, EventType& dest)
 
 	if (p)
 	{
-		EmAliasEventType<PAS>	src(p);
+		// Read the whole event at once and pick it apart locally.
+
+		EmProxyEventType	src;
+		src.Fetch (p);
 
 		dest.eType		= src.eType;
 		dest.penDown	= src.penDown;
@@ -462,7 +467,7 @@ void Marshal::GetEventType (emuptr p, EventType& dest)
 				{
 					// We don't know what's in here, so let's just blockmove it.
 
-					EmMem_memcpy (	(void*) dest.data.generic.datum,
+					memcpy (		(void*) dest.data.generic.datum,
 									src.data.generic.datum.GetPtr (),
 									16);
 				}
@@ -33,6 +33,14 @@
 #include <algorithm>			// find
 #include <ctype.h>				// islower
 
+#if PLATFORM_UNIX
+#include <sys/mman.h>			// mmap, munmap
+
+#if !defined (MAP_ANONYMOUS) && defined (MAP_ANON)
+#define MAP_ANONYMOUS	MAP_ANON
+#endif
+#endif
+
 struct EmTaggedPalmChunk : public EmPalmChunk
 {
 	EmTaggedPalmChunk (void) {}
@@ -154,6 +162,202 @@ void MetaMemory::Dispose (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 MetaMemory::AllocateMetaMemory
+// ---------------------------------------------------------------------------
+//	Allocate a zero-filled block of meta-memory.  On hosts that support it,
+//	map it instead of allocating it, so that the host only commits the pages
+//	that actually get bits set in them.  Most pages never do.
+
+uint8* MetaMemory::AllocateMetaMemory (uint32 size, Bool& mapped)
+{
+#if PLATFORM_UNIX && defined (MAP_ANONYMOUS)
+	void*	p = mmap (NULL, size, PROT_READ | PROT_WRITE,
+					MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (p != MAP_FAILED)
+	{
+		mapped = true;
+		return (uint8*) p;
+	}
+#endif
+
+	mapped = false;
+	return (uint8*) Platform::AllocateMemoryClear (size);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 MetaMemory::ClearMetaMemory
+// ---------------------------------------------------------------------------
+//	Clear all meta-memory bits.  For mapped meta-memory, replace the pages
+//	with fresh zero-fill pages instead of writing zeros (which would commit
+//	every page).
+
+void MetaMemory::ClearMetaMemory (uint8* meta, uint32 size, Bool mapped)
+{
+#if PLATFORM_UNIX && defined (MAP_ANONYMOUS)
+	if (mapped)
+	{
+		void*	p = mmap (meta, size, PROT_READ | PROT_WRITE,
+						MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+
+		if (p != MAP_FAILED)
+			return;
+	}
+#else
+	UNUSED_PARAM (mapped)
+#endif
+
+	memset (meta, 0, size);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 MetaMemory::DisposeMetaMemory
+// ---------------------------------------------------------------------------
+
+void MetaMemory::DisposeMetaMemory (uint8*& meta, uint32 size, Bool& mapped)
+{
+#if PLATFORM_UNIX
+	if (meta && mapped)
+	{
+		munmap (meta, size);
+		meta = NULL;
+	}
+#else
+	UNUSED_PARAM (size)
+#endif
+
+	Platform::DisposeMemory (meta);
+	mapped = false;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 MetaMemory::ResetPages
+// ---------------------------------------------------------------------------
+//	Mark all RAM meta-memory pages as clean.  Called after the RAM
+//	meta-memory has been cleared.
+
+void MetaMemory::ResetPages (void)
+{
+	if (gRAM_MetaPages == NULL)
+		return;
+
+	uint32	numPages = (gRAMBank_Size >> kMetaPageShift) + 1;
+
+	memset (gRAM_MetaPages, 0, numPages * sizeof (EmMetaPage));
+}
+
+
+// ---------------------------------------------------------------------------
+//		 MetaMemory::ResyncPages
+// ---------------------------------------------------------------------------
+//	Rebuild the RAM page summary from the meta-memory itself.  Called after
+//	the RAM meta-memory has been loaded from a session file.
+
+void MetaMemory::ResyncPages (void)
+{
+	if (gRAM_MetaPages == NULL)
+		return;
+
+	MetaMemory::ResetPages ();
+
+	for (uint32 offset = 0; offset < gRAMBank_Size; offset += kMetaPageSize)
+	{
+		uint32		len		= min ((uint32) kMetaPageSize, gRAMBank_Size - offset);
+		uint8*		p		= gRAM_MetaMemory + offset;
+		EmMetaPage&	page	= gRAM_MetaPages[offset >> kMetaPageShift];
+
+		page.fState = p[0] ? kMetaPageUniform : kMetaPageClean;
+		page.fValue = p[0];
+
+		for (uint32 ii = 1; ii < len; ++ii)
+		{
+			if (p[ii] != page.fValue)
+			{
+				page.fState = kMetaPageDetailed;
+				break;
+			}
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 MetaMemory::MarkUnmarkPages
+// ---------------------------------------------------------------------------
+//	Apply (*p & andValue) | orValue to the given range of RAM meta-memory,
+//	keeping the page summary up to date.  Pages that are clean or uniform
+//	are only touched if their bits actually change, and whole pages are
+//	simply filled.  Returns false if the range isn't RAM meta-memory, in
+//	which case the caller should update it itself.
+
+Bool MetaMemory::MarkUnmarkPages (uint8* startP, uint8* endP,
+							uint8 andValue, uint8 orValue)
+{
+	if (gRAM_MetaPages == NULL ||
+		startP < gRAM_MetaMemory || endP > gRAM_MetaMemory + gRAMBank_Size)
+	{
+		return false;
+	}
+
+	uint32	offset	= startP - gRAM_MetaMemory;
+	uint32	end		= endP - gRAM_MetaMemory;
+
+	while (offset < end)
+	{
+		uint32		pageStart	= offset & ~kMetaPageMask;
+		uint32		pageEnd		= min (pageStart + kMetaPageSize, gRAMBank_Size);
+		uint32		runEnd		= min (pageEnd, end);
+		Bool		wholePage	= offset == pageStart && runEnd == pageEnd;
+		EmMetaPage&	page		= gRAM_MetaPages[pageStart >> kMetaPageShift];
+		uint8*		p			= gRAM_MetaMemory + offset;
+		uint8*		runEndP		= gRAM_MetaMemory + runEnd;
+
+		if (page.fState != kMetaPageDetailed || (wholePage && andValue == 0x00))
+		{
+			uint8	newValue = (page.fValue & andValue) | orValue;
+
+			if (page.fState != kMetaPageDetailed && newValue == page.fValue)
+			{
+				// Nothing changes on this page.
+			}
+			else if (wholePage)
+			{
+				memset (p, newValue, runEnd - offset);
+
+				page.fState = newValue ? kMetaPageUniform : kMetaPageClean;
+				page.fValue = newValue;
+			}
+			else
+			{
+				while (p < runEndP)
+				{
+					*p = (*p & andValue) | orValue;
+					++p;
+				}
+
+				page.fState = kMetaPageDetailed;
+			}
+		}
+		else
+		{
+			while (p < runEndP)
+			{
+				*p = (*p & andValue) | orValue;
+				++p;
+			}
+		}
+
+		offset = runEnd;
+	}
+
+	return true;
+}
+
+
 #if FOR_LATER
 // ---------------------------------------------------------------------------
 //		 MetaMemory::MarkUninitialized
@@ -806,6 +1010,11 @@ void MetaMemory::MarkRange (emuptr start, emuptr end, uint8 v)
 	EmAssert (endP >= startP);
 	EmAssert (endP - startP == (ptrdiff_t) (end - start));
 
+	// RAM meta-memory is updated a page at a time.
+
+	if (MarkUnmarkPages (startP, endP, 0xFF, v))
+		return;
+
 #if 1
 	// Optimization: if there are no middle longs to fill, just
 	// do everything a byte at a time.
@@ -814,7 +1023,7 @@ void MetaMemory::MarkRange (emuptr start, emuptr end, uint8 v)
 	{
 		while (p < endP)
 		{
-			*p++ &= v;
+			*p++ |= v;
 		}
 	}
 	else
@@ -888,6 +1097,11 @@ void MetaMemory::UnmarkRange (emuptr start, emuptr end, uint8 v)
 
 	v = ~v;
 
+	// RAM meta-memory is updated a page at a time.
+
+	if (MarkUnmarkPages (startP, endP, v, 0x00))
+		return;
+
 #if 1
 	// Optimization: if there are no middle longs to fill, just
 	// do everything a byte at a time.
@@ -969,6 +1183,9 @@ void MetaMemory::MarkUnmarkRange (emuptr start, emuptr end,
 	EmAssert (endP >= startP);
 	EmAssert (endP - startP == (ptrdiff_t) (end - start));
 
+	if (MarkUnmarkPages (startP, endP, andValue, orValue))
+		return;
+
 	if (andValue == 0xFF)
 	{
 		while (p < endP)
@@ -14,11 +14,42 @@
 #ifndef _METAMEMORY_H_
 #define _METAMEMORY_H_
 
+#include "EmBankSRAM.h"			// gRAM_MetaMemory, gRAM_MetaPages
 #include "EmMemory.h"			// EmMemGetMetaAddress
 #include "EmPalmHeap.h"			// EmPalmHeap, EmPalmChunkList
 #include "ErrorHandling.h"		// Errors::EAccessType
 
 
+// RAM meta-memory is summarized a page at a time.  A "clean" page has no
+// bits set at all, and a "uniform" page has the same bits (fValue) set in
+// every byte.  Either way, the page itself need never be touched: the range
+// marking functions update the summary instead, and the DRAM accessors skip
+// their per-byte checks on clean pages.  Only "detailed" pages have to be
+// examined byte by byte.
+//
+// The summary is conservative: a detailed page may turn out to be clean.
+
+enum
+{
+	kMetaPageShift		= 12,
+	kMetaPageSize		= 1 << kMetaPageShift,
+	kMetaPageMask		= kMetaPageSize - 1
+};
+
+enum
+{
+	kMetaPageClean,
+	kMetaPageUniform,
+	kMetaPageDetailed
+};
+
+struct EmMetaPage
+{
+	uint8	fState;
+	uint8	fValue;
+};
+
+
 class MetaMemory
 {
 	public:
@@ -28,6 +59,20 @@ class MetaMemory
 		static void				Load					(SessionFile&);
 		static void				Dispose					(void);
 
+		// Allocate and release meta-memory.  Where the host supports it,
+		// meta-memory is mapped such that pages are only committed when
+		// they're first written to.
+
+		static uint8*			AllocateMetaMemory		(uint32 size, Bool& mapped);
+		static void				ClearMetaMemory			(uint8* meta, uint32 size, Bool mapped);
+		static void				DisposeMetaMemory		(uint8*& meta, uint32 size, Bool& mapped);
+
+		// Maintain the RAM page summary (see EmMetaPage above).
+
+		static void				ResetPages				(void);
+		static void				ResyncPages				(void);
+		static Bool				IsCleanRAM				(emuptr address, uint32 size);	// Inlined, defined below
+
 		// Called to mark and unmark some areas of memory.
 
 		static void				MarkTotalAccess			(emuptr begin, emuptr end);
@@ -177,6 +222,9 @@ class MetaMemory
 		static void				UnmarkRange				(emuptr start, emuptr end, uint8 v);
 		static void				MarkUnmarkRange			(emuptr start, emuptr end,
 														 uint8 andValue, uint8 orValue);
+		static Bool				MarkUnmarkPages			(uint8* startP, uint8* endP,
+														 uint8 andValue, uint8 orValue);
+		static void				NoteRAMChange			(uint8* metaAddress);	// Inlined, defined below
 
 		static void				SyncOneChunk			(const EmPalmChunk& chunk);
 
@@ -428,6 +476,31 @@ inline Bool MetaMemory::IsCPUBreak (uint8* metaLocation)
 }
 
 
+// Returns whether or not the given range of RAM (as an offset from the
+// start of RAM) lies on clean meta-memory pages.  A range can straddle
+// two pages, so check both ends.
+
+inline Bool MetaMemory::IsCleanRAM (emuptr address, uint32 size)
+{
+	return
+		gRAM_MetaPages[address >> kMetaPageShift].fState == kMetaPageClean &&
+		gRAM_MetaPages[(address + size - 1) >> kMetaPageShift].fState == kMetaPageClean;
+}
+
+
+// Called after a byte of meta-memory has been changed directly (instead of
+// through MarkUnmarkRange).  If it's RAM meta-memory, its page can no
+// longer be summarized.
+
+inline void MetaMemory::NoteRAMChange (uint8* metaAddress)
+{
+	if (metaAddress >= gRAM_MetaMemory && metaAddress < gRAM_MetaMemory + gRAMBank_Size)
+	{
+		gRAM_MetaPages[(metaAddress - gRAM_MetaMemory) >> kMetaPageShift].fState = kMetaPageDetailed;
+	}
+}
+
+
 #define META_CHECK(metaAddress, address, op, size, forRead)		\
 do {															\
 	if (Memory::IsPCInRAM ())									\
@@ -628,6 +701,8 @@ inline void MetaMemory::MarkInstructionBreak (emuptr opcodeLocation)
 	uint8*	ptr = EmMemGetMetaAddress (opcodeLocation);
 
 	*ptr |= kInstructionBreak;
+
+	NoteRAMChange (ptr);
 }
 
 
@@ -641,7 +716,12 @@ inline void MetaMemory::UnmarkInstructionBreak (emuptr opcodeLocation)
 
 	uint8*	ptr = EmMemGetMetaAddress (opcodeLocation);
 
-	*ptr &= ~kInstructionBreak;
+	if ((*ptr & kInstructionBreak) != 0)
+	{
+		*ptr &= ~kInstructionBreak;
+
+		NoteRAMChange (ptr);
+	}
 }
 
 
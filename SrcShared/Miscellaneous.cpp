@@ -25,6 +25,7 @@
 #include "EmPatchState.h"		// EmPatchState::OSMajorVersion
 #include "EmSession.h"			// ScheduleDeferredError
 #include "EmStreamFile.h"		// EmStreamFile, kOpenExistingForRead
+#include "EmVirtualTime.h"		// EmVirtualTime::GetTime, GetLocalTime
 #include "ErrorHandling.h"		// Errors::Throw
 #include "Logging.h"			// LogDump
 #include "Platform.h"			// Platform::AllocateMemory
@@ -2445,8 +2446,8 @@ void GetHostTime (long* hour, long* min, long* sec)
 	time_t t;
 	struct tm tm;
 	
-	time (&t);
-	tm = *localtime (&t);
+	t = EmVirtualTime::GetTime ();
+	tm = EmVirtualTime::GetLocalTime (t);
 	
 	*hour = tm.tm_hour; 	// 0...23
 	*min =	tm.tm_min;		// 0...59
@@ -2471,8 +2472,8 @@ void GetHostDate (long* year, long* month, long* day)
 	time_t t;
 	struct tm tm;
 	
-	time (&t);
-	tm = *localtime (&t);
+	t = EmVirtualTime::GetTime ();
+	tm = EmVirtualTime::GetLocalTime (t);
 	
 	*year =  tm.tm_year + 1900; 	// 1904...2040
 	*month = tm.tm_mon + 1; 		// 1...12
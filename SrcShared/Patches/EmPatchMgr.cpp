@@ -59,6 +59,10 @@ extern IEmPatchLoader*		gTheLoaderIP;
 //	Private globals and constants
 // ======================================================================
 
+//Dispatch table for system function patches
+//
+static EmPatchDispatchTable	gSysPatchTable;
+
 //Table of currently Patched shared libraries
 //
 static PatchedLibIndex		gPatchedLibs;
@@ -116,6 +120,18 @@ void EmPatchMgr::Initialize (void)
 		gPatchMapIP->LoadAll ();
 	}
 
+	// Flatten the system function patches into a table we can index
+	// by trap number.
+
+	IEmPatchModule*	sysPatchModuleIP = NULL;
+
+	if (gPatchMapIP != NULL)
+	{
+		gPatchMapIP->GetModuleByName (string ("~system"), sysPatchModuleIP);
+	}
+
+	gSysPatchTable.Build (sysPatchModuleIP);
+
 	EmPatchState::Initialize ();
 }
 
@@ -282,6 +298,7 @@ void EmPatchMgr::Dispose (void)
 {
 	gInstalledTailpatches.clear ();
 	gPatchedLibs.clear ();
+	gSysPatchTable.Clear ();
 
 	EmPatchState::Dispose ();
 
@@ -432,6 +449,80 @@ void EmPatchMgr::PostLoad (void)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	EmPatchDispatchTable::Build
+ *
+ * DESCRIPTION:	Copy the head- and tailpatches out of the given patch
+ *				module into flat tables indexed by trap number, and
+ *				note which traps have either.
+ *
+ * PARAMETERS:	moduleIP - patch module to copy.  May be NULL, in which
+ *					case the table is left empty.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void EmPatchDispatchTable::Build (IEmPatchModule* moduleIP)
+{
+	this->Clear ();
+
+	if (moduleIP == NULL)
+		return;
+
+	// Patch modules report kPatchErrInvalidIndex past the end of their
+	// tables.  Stop there, or at the end of the trap number space.
+
+	const uint16	kMaxTraps = SysTrapIndex (sysLibTrapBase);
+
+	for (uint16 index = 0; index < kMaxTraps; ++index)
+	{
+		HeadpatchProc	hp;
+		TailpatchProc	tp;
+
+		Err	hErr = moduleIP->GetHeadpatch (index, hp);
+		Err	tErr = moduleIP->GetTailpatch (index, tp);
+
+		if (hErr == kPatchErrInvalidIndex && tErr == kPatchErrInvalidIndex)
+			break;
+
+		fHeadpatches.push_back (hErr == kPatchErrNone ? hp : NULL);
+		fTailpatches.push_back (tErr == kPatchErrNone ? tp : NULL);
+	}
+
+	fPatchedBits.resize ((fHeadpatches.size () + 31) / 32, 0);
+
+	for (size_t ii = 0; ii < fHeadpatches.size (); ++ii)
+	{
+		if (fHeadpatches[ii] || fTailpatches[ii])
+		{
+			fPatchedBits[ii >> 5] |= 1UL << (ii & 0x1F);
+		}
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPatchDispatchTable::Clear
+ *
+ * DESCRIPTION:	Empty the table.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void EmPatchDispatchTable::Clear (void)
+{
+	fHeadpatches.clear ();
+	fTailpatches.clear ();
+	fPatchedBits.clear ();
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	EmPatchMgr::GetLibPatchTable
@@ -496,6 +587,15 @@ CallROMType EmPatchMgr::HandleSystemCall (const SystemCallContext& context)
 		EmPatchMgr::PostLoad ();
 	}
 
+	// Most system functions aren't patched.  Get those out of the way
+	// with a single bit test.
+
+	if (::IsSystemTrap (context.fTrapWord) &&
+		!gSysPatchTable.IsPatched (context.fTrapIndex))
+	{
+		return kExecuteROM;
+	}
+
 	HeadpatchProc	hp;
 	TailpatchProc	tp;
 	EmPatchMgr::GetPatches (context, hp, tp);
@@ -529,14 +629,9 @@ void EmPatchMgr::GetPatches (	const SystemCallContext& context,
 
 	if (::IsSystemTrap (context.fTrapWord))
 	{
-		static IEmPatchModule *sysPatchModuleIP = NULL;
-		
-		if (sysPatchModuleIP == NULL && gPatchMapIP != NULL)
-		{
-			gPatchMapIP->GetModuleByName (string ("~system"), sysPatchModuleIP);
-		}
-		
-		patchModuleIP = sysPatchModuleIP;
+		hp = gSysPatchTable.GetHeadpatch (context.fTrapIndex);
+		tp = gSysPatchTable.GetTailpatch (context.fTrapIndex);
+		return;
 	}
 	
 	else if (context.fExtra == kMagicRefNum) // See comments in HtalLibSendReply.
@@ -551,10 +646,20 @@ void EmPatchMgr::GetPatches (	const SystemCallContext& context,
 		patchModuleIP = htalPatchModuleIP;
 	}
 
-	// Otherwise, see if this is a call to a patched library
+	// Otherwise, see if this is a call to a patched library.  Its
+	// patches were flattened into a dispatch table when we first
+	// looked it up.
 	else
 	{
-		patchModuleIP = GetLibPatchTable (context.fExtra);
+		if (GetLibPatchTable (context.fExtra) != NULL)
+		{
+			const EmPatchDispatchTable&	table =
+				gPatchedLibs[context.fExtra].GetDispatchTable ();
+
+			hp = table.GetHeadpatch (context.fTrapIndex);
+			tp = table.GetTailpatch (context.fTrapIndex);
+			return;
+		}
 	}
 
 	// Now that we've got the right patch table for this module, see if
@@ -714,11 +819,12 @@ void EmPatchMgr::RemoveInstructionBreaks (void)
 void EmPatchMgr::SetupForTailpatch (TailpatchProc tp, const SystemCallContext& context)
 {
 	// See if this function is already tailpatched.  If so, merely increment
-	// the use-count field.
+	// the use-count field.  Search from the end, where the most recent
+	// (and most likely to be re-entered) calls are.
 
-	TailPatchIndex::iterator	iter = gInstalledTailpatches.begin ();
+	TailPatchIndex::reverse_iterator	iter = gInstalledTailpatches.rbegin ();
 
-	while (iter != gInstalledTailpatches.end ())
+	while (iter != gInstalledTailpatches.rend ())
 	{
 		if (iter->fContext.fNextPC == context.fNextPC)
 		{
@@ -765,12 +871,15 @@ TailpatchProc EmPatchMgr::RecoverFromTailpatch (emuptr startPC)
 
 	emuptr patchPC = startPC;
 
-	// Find the PC.
+	// Find the PC.  Trap calls nest, so the one returning is almost
+	// always the most recently installed; search from the end.
 
-	TailPatchIndex::iterator	iter = gInstalledTailpatches.begin ();
+	TailPatchIndex::iterator	iter = gInstalledTailpatches.end ();
 
-	while (iter != gInstalledTailpatches.end ())
+	while (iter != gInstalledTailpatches.begin ())
 	{
+		--iter;
+
 		if (iter->fContext.fNextPC == patchPC)
 		{
 			TailpatchProc	result = iter->fTailpatch;
@@ -790,8 +899,6 @@ TailpatchProc EmPatchMgr::RecoverFromTailpatch (emuptr startPC)
 
 			return result;
 		}
-
-		++iter;
 	}
 
 	return NULL;
@@ -35,6 +35,44 @@ struct ProtoPatchTableEntry
 };
 
 
+// ===========================================================================
+//		EmPatchDispatchTable
+// ===========================================================================
+// Flattened copy of the head- and tailpatches in a patch module, indexed
+// by zero-based trap number, along with a bitmap of the traps that have
+// either one.  Looking up a trap here takes a bit test and, if that
+// succeeds, two array accesses instead of two virtual calls into the
+// module.
+
+class EmPatchDispatchTable
+{
+	public:
+		void					Build (IEmPatchModule* moduleIP);
+		void					Clear (void);
+
+		bool					IsPatched (uint16 index) const
+								{
+									return index < fHeadpatches.size () &&
+										(fPatchedBits[index >> 5] & (1UL << (index & 0x1F))) != 0;
+								}
+
+		HeadpatchProc			GetHeadpatch (uint16 index) const
+								{
+									return this->IsPatched (index) ? fHeadpatches[index] : NULL;
+								}
+
+		TailpatchProc			GetTailpatch (uint16 index) const
+								{
+									return this->IsPatched (index) ? fTailpatches[index] : NULL;
+								}
+
+	private:
+		vector<HeadpatchProc>	fHeadpatches;
+		vector<TailpatchProc>	fTailpatches;
+		vector<uint32>			fPatchedBits;
+};
+
+
 // ===========================================================================
 //		InstalledLibPatchEntry
 // ===========================================================================
@@ -67,11 +105,18 @@ class InstalledLibPatchEntry
 		void					SetPatchTableP (IEmPatchModule* tableP)
 								{
 									fTableP = tableP;
+									fDispatch.Build (tableP);
+								}
+
+		const EmPatchDispatchTable&	GetDispatchTable (void) const
+								{
+									return fDispatch;
 								}
 
 	private:
 		bool					fIsDirty;
 		IEmPatchModule*			fTableP;
+		EmPatchDispatchTable	fDispatch;
 };
 
 typedef vector<InstalledLibPatchEntry> PatchedLibIndex;
@@ -16,6 +16,8 @@
 
 #include "PreferenceMgr.h"		// Preference
 #include "Byteswapping.h"		// Canonical
+#include "ChunkFile.h"			// Chunk
+#include "EmIOJournal.h"		// EmIOJournal::Poll, Record, Replay
 #include "Logging.h"			// LogAppendMsg
 #include "Miscellaneous.h"		// StMemory
 #include "Platform.h"			// AllocateMemory
@@ -55,6 +57,24 @@
 #include <sys/filio.h>			// FIONBIO
 #endif
 
+// On Linux (and so Android), all host sockets handed out to NetLib are
+// serviced by a single epoll reactor thread.  Elsewhere, we fall back to
+// blocking sockets and a select() per call.
+
+#if PLATFORM_UNIX && HAS_OMNI_THREAD && defined (__linux__)
+#define HAS_NETLIB_REACTOR	1
+#else
+#define HAS_NETLIB_REACTOR	0
+#endif
+
+#if HAS_NETLIB_REACTOR
+#include "EmThreadSafeQueue.h"	// EmByteRing
+#include "omnithread.h"			// omni_thread, omni_mutex, omni_condition
+#include <fcntl.h>				// fcntl, O_NONBLOCK
+#include <poll.h>				// poll
+#include <sys/epoll.h>			// epoll_create, epoll_ctl, epoll_wait
+#endif
+
 #define PRINTF	if (!LogNetLib ()) ; else LogAppendMsg
 
 // ===== COPIED FROM NETPRV.H =====
@@ -180,6 +200,97 @@ static Err		PrvGetTranslatedHError (void);
 #endif
 static Err		PrvTranslateError (uint32 err);
 
+static Err		PrvWaitForSocket (NetSocketRef sRef, SOCKET s, Bool forWrite, Int32 timeout);
+
+// The host side of the calls that EmIOJournal records and replays.
+
+static Int16	PrvHostSocketConnect	(UInt16 libRefNum,
+										 NetSocketRef sRef,
+										 NetSocketAddrType* sockAddrP,
+										 Int16 addrLen,
+										 Int32 timeout,
+										 Err* errP);
+static Int16	PrvHostSendPB			(UInt16 libRefNum,
+										 NetSocketRef sRef,
+										 NetIOParamType* pbP,
+										 UInt16 sendFlags,
+										 Int32 timeout,
+										 Err* errP);
+static Int16	PrvHostReceivePB		(UInt16 libRefNum,
+										 NetSocketRef sRef,
+										 NetIOParamType* pbP,
+										 UInt16 rcvFlags,
+										 Int32 timeout,
+										 Err* errP);
+static Int16	PrvHostSelect			(UInt16 libRefNum,
+										 UInt16 netWidth,
+										 NetFDSetType* netReadFDs,
+										 NetFDSetType* netWriteFDs,
+										 NetFDSetType* netExceptFDs,
+										 Int32 netTimeout,
+										 Err* errP);
+
+// NetLib timeouts are in system ticks.
+
+const long		kSysTicksPerSecond		= 100;	// !!! Should really call SysTicksPerSecond.
+
+#if HAS_NETLIB_REACTOR
+
+// Per-socket state shared between the CPU thread and the reactor thread.
+// Connected stream sockets get a receive ring that the reactor fills as data
+// arrives, so that receives and NetLibSelect are satisfied from memory.  All
+// other waits sleep on gReactorCondition, which the reactor broadcasts every
+// time any socket changes state.  Fields written by the reactor are only
+// touched with gReactorMutex held.
+
+struct EmNetLibSocket
+{
+	uint32		fSerial;		// Tags epoll events for this use of the slot.
+	Bool		fManaged;		// Registered with the reactor; host socket is non-blocking.
+	Bool		fStream;		// SOCK_STREAM
+	Bool		fListening;		// NetLibSocketListen has been called.
+	Bool		fNonBlocking;	// Palm application set netSocketOptSockNonBlocking.
+	Bool		fThrottled;		// Ring filled up; reactor stopped draining the socket.
+	Bool		fEOF;			// Peer closed the connection.
+	int			fError;			// Deferred errno from the reactor's recv.
+	EmByteRing*	fRing;			// Receive buffer; NULL until connected.
+};
+
+const long		kReceiveRingSize		= 32 * 1024;
+const uint64	kReactorWakeToken		= ~(uint64) 0;
+
+static EmNetLibSocket	gSocketState[netMaxNumSockets];
+static omni_mutex		gReactorMutex;
+static omni_condition	gReactorCondition (&gReactorMutex);
+static omni_thread*		gReactorThread;
+static int				gReactorFD = -1;
+static int				gReactorWakePipe[2] = { -1, -1 };
+static uint32			gReactorGeneration;
+static uint32			gReactorSerial;
+static Bool				gReactorQuit;
+
+static Bool		PrvReactorStart			(void);
+static void		PrvReactorStop			(void);
+static void		PrvReactorWake			(void);
+static void*	PrvReactorThread		(void*);
+static void		PrvReactorAdd			(int index);
+static void		PrvReactorRemove		(int index);
+static void		PrvReactorPromote		(int index);
+static void		PrvReactorFill			(int index);
+static long		PrvReactorReceive		(int index, void* buffer, long len, Bool peek, Err* errP);
+static uint32	PrvReactorGetGeneration	(void);
+static Bool		PrvReactorWaitChange	(uint32 generation, const unsigned long* deadline);
+static short	PrvSocketPoll			(int index, short events);
+static void		PrvGetDeadline			(Int32 timeout, unsigned long* deadline);
+static Int16	PrvReactorSelect		(UInt16 netWidth,
+										 NetFDSetType* netReadFDs,
+										 NetFDSetType* netWriteFDs,
+										 NetFDSetType* netExceptFDs,
+										 Int32 netTimeout,
+										 Err* errP);
+
+#endif	// HAS_NETLIB_REACTOR
+
 
 
 /***********************************************************************
@@ -269,11 +380,18 @@ void Platform_NetLib::Dispose		(void)
 	{
 		if (gSockets[ii] != INVALID_SOCKET)
 		{
+#if HAS_NETLIB_REACTOR
+			::PrvReactorRemove (ii);
+#endif
 			closesocket (gSockets[ii]);
 			gSockets[ii] = INVALID_SOCKET;
 		}
 	}
 
+#if HAS_NETLIB_REACTOR
+	::PrvReactorStop ();
+#endif
+
 	gOpenCount = 0;
 }
 
@@ -644,6 +762,20 @@ Int16 Platform_NetLib::SocketOptionSet(UInt16 libRefNum,
 		else
 			param = 1;
 
+#if HAS_NETLIB_REACTOR
+		// Sockets owned by the reactor are always non-blocking on the host
+		// side; just remember what the application asked for so that we
+		// know whether to wait on its behalf.
+
+		EmNetLibSocket&	state = gSocketState[sRef - netMinSocketRefNum];
+
+		if (state.fManaged)
+		{
+			state.fNonBlocking = param != 0;
+			result = 0;
+		}
+		else
+#endif
 		result = ioctlsocket (s, FIONBIO, &param);
 	}
 	else
@@ -779,9 +911,50 @@ Int16 Platform_NetLib::SocketConnect(UInt16 libRefNum,
 										Int16 addrLen,
 										Int32 timeout,
 										Err* errP)
+{
+	// Whether the connection went through depends on the other end, so
+	// it's journaled (see EmIOJournal.h).  When replaying, the host socket
+	// is never connected; sends, receives, and selects on it are replayed
+	// as well.
+
+	uint32	when = EmIOJournal::Poll (kIOJournalNetConnect);
+
+	if (EmIOJournal::Replaying ())
+	{
+		int32	result;
+		int32	err;
+		Chunk	data;
+
+		if (!EmIOJournal::Replay (kIOJournalNetConnect, when, result, err, data))
+		{
+			*errP = netErrTimeout;
+			return -1;
+		}
+
+		*errP = (Err) err;
+		return (Int16) result;
+	}
+
+	Int16	result = ::PrvHostSocketConnect (libRefNum, sRef, sockAddrP,
+								addrLen, timeout, errP);
+
+	EmIOJournal::Record (kIOJournalNetConnect, when, result, *errP);
+
+	return result;
+}
+
+
+Int16 PrvHostSocketConnect(UInt16 libRefNum,
+							NetSocketRef sRef,
+							NetSocketAddrType* sockAddrP,
+							Int16 addrLen,
+							Int32 timeout,
+							Err* errP)
 {
 	UNUSED_PARAM(libRefNum)
+#if !HAS_NETLIB_REACTOR
 	UNUSED_PARAM(timeout)
+#endif
 
 	SOCKET		s;
 	sockaddr	name;
@@ -796,6 +969,40 @@ Int16 Platform_NetLib::SocketConnect(UInt16 libRefNum,
 
 	int	result	= connect (s, &name, namelen);
 
+#if HAS_NETLIB_REACTOR
+	// The host socket is non-blocking.  If the application's socket isn't,
+	// wait (up to the caller's timeout) for the handshake to complete.
+
+	EmNetLibSocket&	state = gSocketState[sRef - netMinSocketRefNum];
+
+	if (result && state.fManaged && !state.fNonBlocking && ::PrvGetError () == EINPROGRESS)
+	{
+		Err	err = ::PrvWaitForSocket (sRef, s, true, timeout);
+
+		if (err)
+		{
+			*errP = err;
+			return -1;
+		}
+
+		int			soError		= 0;
+		socklen_t	soErrorLen	= sizeof (soError);
+
+		if (getsockopt (s, SOL_SOCKET, SO_ERROR, &soError, &soErrorLen) == 0 && soError)
+		{
+			*errP = PrvTranslateError (soError);
+			return -1;
+		}
+
+		result = 0;
+	}
+
+	if (result == 0)
+	{
+		::PrvReactorPromote (sRef - netMinSocketRefNum);
+	}
+#endif
+
 	if (result)
 	{
 		// Work around Windows 2000 bug.  According to Mark Baysinger
@@ -883,6 +1090,10 @@ Int16 Platform_NetLib::SocketListen(UInt16 libRefNum,
 		return -1;
 	}
 
+#if HAS_NETLIB_REACTOR
+	gSocketState[sRef - netMinSocketRefNum].fListening = true;
+#endif
+
 	*errP = 0;
 	return result;
 }
@@ -901,7 +1112,6 @@ Int16 Platform_NetLib::SocketAccept(UInt16 libRefNum,
 									Err* errP)
 {
 	UNUSED_PARAM(libRefNum)
-	UNUSED_PARAM(timeout)
 
 	SOCKET		s;
 	sockaddr	addr;
@@ -913,6 +1123,16 @@ Int16 Platform_NetLib::SocketAccept(UInt16 libRefNum,
 		return -1;
 	}
 
+	// Wait for a connection request (up to the caller's timeout).
+
+	Err	err = ::PrvWaitForSocket (sRef, s, false, timeout);
+
+	if (err)
+	{
+		*errP = err;
+		return -1;
+	}
+
 	int	new_s = accept (s, &addr, &addrlen);
 
 	if (new_s == INVALID_SOCKET)
@@ -1077,6 +1297,48 @@ Int16 Platform_NetLib::SendPB(UInt16 libRefNum,
 								UInt16 sendFlags,
 								Int32 timeout,
 								Err* errP)
+{
+	// How much got sent depends on the other end.  When replaying, nothing
+	// goes out; the caller gets what happened the first time around, or,
+	// failing that, is told that everything was sent.
+
+	uint32	when = EmIOJournal::Poll (kIOJournalNetSend);
+
+	if (EmIOJournal::Replaying ())
+	{
+		int32	result;
+		int32	err;
+		Chunk	data;
+
+		if (!EmIOJournal::Replay (kIOJournalNetSend, when, result, err, data))
+		{
+			result	= 0;
+			err		= 0;
+
+			for (UInt16 ii = 0; ii < pbP->iovLen; ++ii)
+			{
+				result += pbP->iov[ii].bufLen;
+			}
+		}
+
+		*errP = (Err) err;
+		return (Int16) result;
+	}
+
+	Int16	result = ::PrvHostSendPB (libRefNum, sRef, pbP, sendFlags, timeout, errP);
+
+	EmIOJournal::Record (kIOJournalNetSend, when, result, *errP);
+
+	return result;
+}
+
+
+Int16 PrvHostSendPB(UInt16 libRefNum,
+					NetSocketRef sRef,
+					NetIOParamType* pbP,
+					UInt16 sendFlags,
+					Int32 timeout,
+					Err* errP)
 {
 	UNUSED_PARAM(libRefNum)
 
@@ -1093,37 +1355,12 @@ Int16 Platform_NetLib::SendPB(UInt16 libRefNum,
 
 	// Wait till the socket is ready to send.
 
-	if (timeout >= 0)
-	{
-		fd_set	hostWriteFDs;
-		struct timeval hostTimeout;
-		struct timeval *hTp = NULL;
-
-		FD_ZERO(&hostWriteFDs);
-		FD_SET(s, &hostWriteFDs);
-
-		// Convert ticks to microseconds.
-
-		const uint64	kMicrosecondsPerSecond	= 1000000;
-		const uint64	kSysTicksPerSecond		= 100;	// !!! Should really call SysTicksPerSecond.
-
-		uint64	usecs = timeout * kMicrosecondsPerSecond / kSysTicksPerSecond;
+	Err	err = ::PrvWaitForSocket (sRef, s, true, timeout);
 
-		hostTimeout.tv_sec = usecs / kMicrosecondsPerSecond;
-		hostTimeout.tv_usec = usecs % kMicrosecondsPerSecond;
-		hTp = &hostTimeout;
-
-		result = select (s + 1, NULL, &hostWriteFDs, NULL, hTp);
-		if (result == SOCKET_ERROR)
-		{
-			*errP = PrvGetTranslatedError ();
-			return -1;
-		}
-		else if (!result)
-		{
-			*errP = netErrTimeout;
-			return -1;
-		}
+	if (err)
+	{
+		*errP = err;
+		return -1;
 	}
 
 	// Collapse the scatter-write array into a single big buffer.
@@ -1171,7 +1408,52 @@ Int16 Platform_NetLib::SendPB(UInt16 libRefNum,
 	// to send".  And the GUSI sources back this up.  So we just use sendto in
 	// all cases.
 
+#if HAS_NETLIB_REACTOR
+	// The host socket is non-blocking, so the send may be only partially
+	// accepted.  An application using a blocking socket expects all of its
+	// data to go out, so keep sending as room appears until it has.
+
+	EmNetLibSocket&	state	= gSocketState[sRef - netMinSocketRefNum];
+	long			sent	= 0;
+
+	for (;;)
+	{
+		result = sendto (s, bigBuffer.Get() + sent, bigBufferSize - sent, flags, nameP, namelen);
+
+		if (!state.fManaged || state.fNonBlocking)
+			break;
+
+		if (result == SOCKET_ERROR)
+		{
+			if (::PrvGetError () != EAGAIN)
+				break;
+		}
+		else if ((sent += result) >= bigBufferSize)
+		{
+			break;
+		}
+
+		err = ::PrvWaitForSocket (sRef, s, true, timeout);
+
+		if (err)
+		{
+			if (sent == 0)
+			{
+				*errP = err;
+				return -1;
+			}
+
+			break;
+		}
+	}
+
+	if (sent > 0)
+	{
+		result = sent;
+	}
+#else
 	result = sendto (s, bigBuffer.Get(), bigBufferSize, flags, nameP, namelen);
+#endif
 
 	// If there was an error, translate and return it.
 
@@ -1247,6 +1529,97 @@ Int16 Platform_NetLib::ReceivePB(UInt16 libRefNum,
 									UInt16 rcvFlags,
 									Int32 timeout,
 									Err* errP)
+{
+	// What arrives, and from where, is journaled (see EmIOJournal.h).  The
+	// record holds the sender's address (if asked for) followed by the
+	// data, laid end to end across the iov array.
+
+	uint32	when = EmIOJournal::Poll (kIOJournalNetReceive);
+
+	if (EmIOJournal::Replaying ())
+	{
+		int32	result;
+		int32	err;
+		Chunk	data;
+
+		if (!EmIOJournal::Replay (kIOJournalNetReceive, when, result, err, data))
+		{
+			*errP = netErrTimeout;
+			return -1;
+		}
+
+		if (result < 0)
+		{
+			*errP = (Err) err;
+			return -1;
+		}
+
+		const UInt8*	p = (const UInt8*) data.GetPointer ();
+		UInt16			addrLen;
+
+		memcpy (&addrLen, p, sizeof (addrLen));
+		p += sizeof (addrLen);
+
+		if (pbP->addrP)
+		{
+			memcpy (pbP->addrP, p, min (addrLen, pbP->addrLen));
+			pbP->addrLen = addrLen;
+		}
+
+		p += addrLen;
+
+		long	left = result;
+		for (UInt16 ii = 0; ii < pbP->iovLen && left > 0; ++ii)
+		{
+			long	len = min (left, (long) pbP->iov[ii].bufLen);
+
+			memcpy (pbP->iov[ii].bufP, p, len);
+			p += len;
+			left -= len;
+		}
+
+		*errP = 0;
+		return (Int16) result;
+	}
+
+	Int16	result = ::PrvHostReceivePB (libRefNum, sRef, pbP, rcvFlags, timeout, errP);
+
+	if (EmIOJournal::Recording ())
+	{
+		UInt16	addrLen = (pbP->addrP && result >= 0) ? pbP->addrLen : 0;
+		long	dataLen = result > 0 ? result : 0;
+		Chunk	data (sizeof (addrLen) + addrLen + dataLen);
+		UInt8*	p = (UInt8*) data.GetPointer ();
+
+		memcpy (p, &addrLen, sizeof (addrLen));
+		p += sizeof (addrLen);
+
+		memcpy (p, pbP->addrP, addrLen);
+		p += addrLen;
+
+		for (UInt16 ii = 0; ii < pbP->iovLen && dataLen > 0; ++ii)
+		{
+			long	len = min (dataLen, (long) pbP->iov[ii].bufLen);
+
+			memcpy (p, pbP->iov[ii].bufP, len);
+			p += len;
+			dataLen -= len;
+		}
+
+		EmIOJournal::Record (kIOJournalNetReceive, when, result, *errP,
+							data.GetPointer (), data.GetLength ());
+	}
+
+	return result;
+}
+
+
+Int16 PrvHostReceivePB(UInt16 libRefNum,
+						NetSocketRef sRef,
+						NetIOParamType* pbP,
+						UInt16 rcvFlags,
+						Int32 timeout,
+						Err* errP)
 {
 	UNUSED_PARAM(libRefNum)
 
@@ -1261,39 +1634,20 @@ Int16 Platform_NetLib::ReceivePB(UInt16 libRefNum,
 		return -1;
 	}
 
-	// Wait till the socket is ready to receive.
-
-	if (timeout >= 0)
-	{
-		fd_set	hostReadFDs;
-		struct timeval hostTimeout;
-		struct timeval *hTp = NULL;
-
-		FD_ZERO(&hostReadFDs);
-		FD_SET(s, &hostReadFDs);
-
-		// Convert ticks to microseconds.
+#if HAS_NETLIB_REACTOR
+	// If the socket has connected since we last looked, start buffering it.
 
-		const uint64	kMicrosecondsPerSecond	= 1000000;
-		const uint64	kSysTicksPerSecond		= 100;	// !!! Should really call SysTicksPerSecond.
+	::PrvReactorPromote (sRef - netMinSocketRefNum);
+#endif
 
-		uint64	usecs = timeout * kMicrosecondsPerSecond / kSysTicksPerSecond;
+	// Wait till the socket is ready to receive.
 
-		hostTimeout.tv_sec = usecs / kMicrosecondsPerSecond;
-		hostTimeout.tv_usec = usecs % kMicrosecondsPerSecond;
-		hTp = &hostTimeout;
+	Err	err = ::PrvWaitForSocket (sRef, s, false, timeout);
 
-		result = select (s + 1, &hostReadFDs, NULL, NULL, hTp);
-		if (result == SOCKET_ERROR)
-		{
-			*errP = PrvGetTranslatedError ();
-			return -1;
-		}
-		else if (!result)
-		{
-			*errP = netErrTimeout;
-			return -1;
-		}
+	if (err)
+	{
+		*errP = err;
+		return -1;
 	}
 
 	// Collapse the gather-read array into a single big buffer.
@@ -1339,7 +1693,54 @@ Int16 Platform_NetLib::ReceivePB(UInt16 libRefNum,
 	// according to my Linux man page, recv() is the same as recvfrom() but with
 	// a NULL name parameter.  So we just use recvfrom in all cases.
 
+#if HAS_NETLIB_REACTOR
+	// Connected stream sockets are read from the ring the reactor keeps
+	// topped up.  Out-of-band data still comes straight from the socket.
+
+	EmNetLibSocket&	state = gSocketState[sRef - netMinSocketRefNum];
+
+	if (state.fRing && (flags & MSG_OOB) == 0)
+	{
+		result = ::PrvReactorReceive (sRef - netMinSocketRefNum, bigBuffer.Get (),
+						bigBufferSize, (flags & MSG_PEEK) != 0, errP);
+
+		if (result < 0)
+		{
+			return -1;
+		}
+
+		if (nameP && getpeername (s, nameP, &namelen) != 0)
+		{
+			memset (nameP, 0, namelen);
+		}
+	}
+	else
+	{
+		for (;;)
+		{
+			result = recvfrom (s, bigBuffer.Get (), bigBufferSize, flags, nameP, &namelen);
+
+			if (result != SOCKET_ERROR || !state.fManaged ||
+				state.fNonBlocking || ::PrvGetError () != EAGAIN)
+			{
+				break;
+			}
+
+			// Readiness was spurious (a datagram with a bad checksum,
+			// say).  Wait for the next one.
+
+			err = ::PrvWaitForSocket (sRef, s, false, timeout);
+
+			if (err)
+			{
+				*errP = err;
+				return -1;
+			}
+		}
+	}
+#else
 	result = recvfrom (s, bigBuffer.Get (), bigBufferSize, flags, nameP, &namelen);
+#endif
 
 	// If there was an error, translate and return it.
 
@@ -1602,9 +2003,79 @@ Int16 Platform_NetLib::Select(UInt16 libRefNum,
 								NetFDSetType* netExceptFDs,
 								Int32 netTimeout,
 								Err* errP)
+{
+	// Which sockets were ready is journaled (see EmIOJournal.h).  When
+	// replaying and there's no record, it's as if the select timed out.
+
+	uint32	when = EmIOJournal::Poll (kIOJournalNetSelect);
+
+	NetFDSetType*	sets[3] = { netReadFDs, netWriteFDs, netExceptFDs };
+
+	if (EmIOJournal::Replaying ())
+	{
+		int32			result;
+		int32			err;
+		Chunk			data;
+		NetFDSetType	ready[3] = { 0, 0, 0 };
+
+		if (EmIOJournal::Replay (kIOJournalNetSelect, when, result, err, data))
+		{
+			memcpy (ready, data.GetPointer (), min ((long) sizeof (ready), data.GetLength ()));
+		}
+		else
+		{
+			result	= 0;
+			err		= 0;
+		}
+
+		for (int ii = 0; ii < 3; ++ii)
+		{
+			if (sets[ii])
+				*sets[ii] = ready[ii];
+		}
+
+		*errP = (Err) err;
+		return (Int16) result;
+	}
+
+	Int16	result = ::PrvHostSelect (libRefNum, netWidth, netReadFDs,
+								netWriteFDs, netExceptFDs, netTimeout, errP);
+
+	if (EmIOJournal::Recording ())
+	{
+		NetFDSetType	ready[3];
+
+		for (int ii = 0; ii < 3; ++ii)
+		{
+			ready[ii] = sets[ii] ? *sets[ii] : 0;
+		}
+
+		EmIOJournal::Record (kIOJournalNetSelect, when, result, *errP,
+							ready, sizeof (ready));
+	}
+
+	return result;
+}
+
+
+Int16 PrvHostSelect(UInt16 libRefNum,
+					UInt16 netWidth,
+					NetFDSetType* netReadFDs,
+					NetFDSetType* netWriteFDs,
+					NetFDSetType* netExceptFDs,
+					Int32 netTimeout,
+					Err* errP)
 {
 	UNUSED_PARAM(libRefNum)
 
+#if HAS_NETLIB_REACTOR
+	if (gReactorThread)
+	{
+		return ::PrvReactorSelect (netWidth, netReadFDs, netWriteFDs,
+						netExceptFDs, netTimeout, errP);
+	}
+#endif
+
 	fd_set	hostReadFDs;
 	fd_set	hostWriteFDs;
 	fd_set	hostExceptFDs;
@@ -1703,6 +2174,15 @@ Bool	RememberSocketsRef			(const SOCKET					inSocket,
 		{
 			gSockets[ii] = inSocket;
 			outSocket = ii + netMinSocketRefNum;
+
+#if HAS_NETLIB_REACTOR
+			if (::PrvReactorStart ())
+			{
+				::PrvReactorAdd (ii);
+				::PrvReactorPromote (ii);
+			}
+#endif
+
 			return true;
 		}
 	}
@@ -1727,6 +2207,10 @@ Bool	ForgetSocketsRef			(NetSocketRef					sRef)
 {
 	if (sRef >= netMinSocketRefNum && sRef <= netMaxSocketRefNum)
 	{
+#if HAS_NETLIB_REACTOR
+		::PrvReactorRemove (sRef - netMinSocketRefNum);
+#endif
+
 		gSockets [sRef - netMinSocketRefNum] = INVALID_SOCKET;
 		return true;
 	}
@@ -2781,6 +3265,774 @@ Bool SocketsToNetLibScalarOption	(/*const*/ char*&	inOptVal,
 }
 
 										 
+/***********************************************************************
+ *
+ * FUNCTION:	PrvWaitForSocket
+ *
+ * DESCRIPTION:	Wait for a socket to become readable or writable, for
+ *				up to "timeout" ticks.  Sockets owned by the reactor
+ *				sleep until it reports a change in state; others use
+ *				select() and only wait if there's a timeout, leaving
+ *				the I/O call itself to block otherwise.
+ *
+ * PARAMETERS:	sRef - NetLib socket reference.
+ *
+ *				s - the host socket for sRef.
+ *
+ *				forWrite - true to wait for room to send, false to
+ *					wait for data to receive.
+ *
+ *				timeout - in ticks; -1 means forever and 0 means
+ *					don't wait.
+ *
+ * RETURNED:	0 if ready, netErrTimeout or some other NetLib error
+ *				otherwise.
+ *
+ ***********************************************************************/
+
+Err PrvWaitForSocket (NetSocketRef sRef, SOCKET s, Bool forWrite, Int32 timeout)
+{
+#if HAS_NETLIB_REACTOR
+	int				index	= sRef - netMinSocketRefNum;
+	EmNetLibSocket&	state	= gSocketState[index];
+
+	if (state.fManaged)
+	{
+		// A non-blocking socket with no timeout doesn't wait at all; the
+		// I/O call reports netErrWouldBlock if need be.
+
+		if (state.fNonBlocking && timeout < 0)
+			return 0;
+
+		unsigned long	deadline[2];
+		::PrvGetDeadline (timeout, deadline);
+
+		for (;;)
+		{
+			// Sample the generation before looking at the socket, so that
+			// a change sneaking in between the two still wakes us up.
+
+			uint32	generation = ::PrvReactorGetGeneration ();
+
+			if (::PrvSocketPoll (index, forWrite ? POLLOUT : POLLIN))
+				return 0;
+
+			if (timeout == 0 ||
+				!::PrvReactorWaitChange (generation, timeout > 0 ? deadline : NULL))
+				return netErrTimeout;
+		}
+	}
+#else
+	UNUSED_PARAM(sRef)
+#endif
+
+	if (timeout < 0)
+		return 0;
+
+	fd_set	hostFDs;
+	FD_ZERO(&hostFDs);
+	FD_SET(s, &hostFDs);
+
+	// Convert ticks to microseconds.
+
+	const uint64	kMicrosecondsPerSecond	= 1000000;
+
+	uint64	usecs = timeout * kMicrosecondsPerSecond / kSysTicksPerSecond;
+
+	struct timeval	hostTimeout;
+	hostTimeout.tv_sec = usecs / kMicrosecondsPerSecond;
+	hostTimeout.tv_usec = usecs % kMicrosecondsPerSecond;
+
+	int	result = select (s + 1,
+						forWrite ? NULL : &hostFDs,
+						forWrite ? &hostFDs : NULL,
+						NULL, &hostTimeout);
+
+	if (result == SOCKET_ERROR)
+		return PrvGetTranslatedError ();
+
+	if (!result)
+		return netErrTimeout;
+
+	return 0;
+}
+
+
+#if HAS_NETLIB_REACTOR
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorStart
+ *
+ * DESCRIPTION:	Create the epoll set and start the reactor thread, if
+ *				that hasn't been done already.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	True if the reactor is running.
+ *
+ ***********************************************************************/
+
+Bool PrvReactorStart (void)
+{
+	if (gReactorThread)
+		return true;
+
+	gReactorFD = epoll_create (netMaxNumSockets + 1);
+	if (gReactorFD < 0)
+		return false;
+
+	if (pipe (gReactorWakePipe) != 0)
+	{
+		close (gReactorFD);
+		gReactorFD = -1;
+		return false;
+	}
+
+	fcntl (gReactorWakePipe[0], F_SETFL, O_NONBLOCK);
+	fcntl (gReactorWakePipe[1], F_SETFL, O_NONBLOCK);
+
+	epoll_event	event;
+	event.events	= EPOLLIN;
+	event.data.u64	= kReactorWakeToken;
+	epoll_ctl (gReactorFD, EPOLL_CTL_ADD, gReactorWakePipe[0], &event);
+
+	gReactorQuit = false;
+
+	// Created with a function returning void*, so the thread is joinable.
+
+	gReactorThread = new omni_thread (&PrvReactorThread);
+	gReactorThread->start ();
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorStop
+ *
+ * DESCRIPTION:	Shut down the reactor thread and release its resources.
+ *				All sockets should have been removed first.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void PrvReactorStop (void)
+{
+	if (!gReactorThread)
+		return;
+
+	{
+		omni_mutex_lock	lock (gReactorMutex);
+		gReactorQuit = true;
+	}
+
+	::PrvReactorWake ();
+
+	gReactorThread->join (NULL);
+	gReactorThread = NULL;
+
+	close (gReactorFD);
+	close (gReactorWakePipe[0]);
+	close (gReactorWakePipe[1]);
+
+	gReactorFD = -1;
+	gReactorWakePipe[0] = -1;
+	gReactorWakePipe[1] = -1;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorWake
+ *
+ * DESCRIPTION:	Knock the reactor thread out of epoll_wait.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void PrvReactorWake (void)
+{
+	char	token = 0;
+	ssize_t	result = write (gReactorWakePipe[1], &token, 1);
+	UNUSED_PARAM(result)
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorThread
+ *
+ * DESCRIPTION:	Body of the reactor thread.  Waits for activity on any
+ *				NetLib socket, drains connected stream sockets into
+ *				their receive rings, and wakes up anyone waiting in
+ *				PrvReactorWaitChange.
+ *
+ * PARAMETERS:	unused
+ *
+ * RETURNED:	NULL
+ *
+ ***********************************************************************/
+
+void* PrvReactorThread (void*)
+{
+	epoll_event	events[netMaxNumSockets + 1];
+
+	for (;;)
+	{
+		int	count = epoll_wait (gReactorFD, events, countof (events), -1);
+
+		if (count < 0 && errno != EINTR)
+			break;
+
+		omni_mutex_lock	lock (gReactorMutex);
+
+		if (gReactorQuit)
+			break;
+
+		for (int ii = 0; ii < count; ++ii)
+		{
+			uint64	token = events[ii].data.u64;
+
+			if (token == kReactorWakeToken)
+			{
+				char	buffer[16];
+				while (read (gReactorWakePipe[0], buffer, sizeof (buffer)) > 0)
+					;
+				continue;
+			}
+
+			// Events for a slot that has since been closed (and perhaps
+			// reused) carry a stale serial number; ignore them.
+
+			uint32	index	= (uint32) token;
+			uint32	serial	= (uint32) (token >> 32);
+
+			if (index < netMaxNumSockets && gSocketState[index].fSerial == serial)
+			{
+				::PrvReactorFill (index);
+			}
+		}
+
+		++gReactorGeneration;
+		gReactorCondition.broadcast ();
+	}
+
+	return NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorAdd
+ *
+ * DESCRIPTION:	Hand a newly remembered socket over to the reactor.  The
+ *				host socket is made non-blocking and registered for
+ *				edge-triggered notification.
+ *
+ * PARAMETERS:	index - slot in gSockets.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void PrvReactorAdd (int index)
+{
+	SOCKET			s		= gSockets[index];
+	EmNetLibSocket&	state	= gSocketState[index];
+
+	int			type	= 0;
+	socklen_t	typeLen	= sizeof (type);
+	getsockopt (s, SOL_SOCKET, SO_TYPE, &type, &typeLen);
+
+	omni_mutex_lock	lock (gReactorMutex);
+
+	state.fSerial		= ++gReactorSerial;
+	state.fManaged		= false;
+	state.fStream		= type == SOCK_STREAM;
+	state.fListening	= false;
+	state.fNonBlocking	= false;
+	state.fThrottled	= false;
+	state.fEOF			= false;
+	state.fError		= 0;
+	state.fRing			= NULL;
+
+	int	flags = fcntl (s, F_GETFL, 0);
+
+	if (flags == -1 || fcntl (s, F_SETFL, flags | O_NONBLOCK) == -1)
+		return;
+
+	epoll_event	event;
+	event.events	= EPOLLIN | EPOLLOUT | EPOLLPRI | EPOLLET;
+	event.data.u64	= ((uint64) state.fSerial << 32) | (uint32) index;
+
+	if (epoll_ctl (gReactorFD, EPOLL_CTL_ADD, s, &event) != 0)
+	{
+		// Leave it as an ordinary blocking socket.
+
+		fcntl (s, F_SETFL, flags);
+		return;
+	}
+
+	state.fManaged = true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorRemove
+ *
+ * DESCRIPTION:	Take a socket away from the reactor and discard any
+ *				data buffered for it.
+ *
+ * PARAMETERS:	index - slot in gSockets.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void PrvReactorRemove (int index)
+{
+	EmNetLibSocket&	state = gSocketState[index];
+
+	omni_mutex_lock	lock (gReactorMutex);
+
+	if (state.fManaged)
+	{
+		// The socket may already be closed, which removes it from the
+		// epoll set by itself; that's OK.
+
+		epoll_event	event;
+		epoll_ctl (gReactorFD, EPOLL_CTL_DEL, gSockets[index], &event);
+	}
+
+	delete state.fRing;
+
+	state.fSerial	= 0;
+	state.fManaged	= false;
+	state.fRing		= NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorPromote
+ *
+ * DESCRIPTION:	Once a managed stream socket is connected, give it a
+ *				receive ring and start buffering incoming data.
+ *
+ * PARAMETERS:	index - slot in gSockets.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void PrvReactorPromote (int index)
+{
+	EmNetLibSocket&	state = gSocketState[index];
+
+	if (!state.fManaged || !state.fStream || state.fListening || state.fRing)
+		return;
+
+	sockaddr	addr;
+	socklen_t	addrLen = sizeof (addr);
+
+	if (getpeername (gSockets[index], &addr, &addrLen) != 0)
+		return;
+
+	omni_mutex_lock	lock (gReactorMutex);
+
+	state.fRing = new EmByteRing (kReceiveRingSize);
+
+	// Any data that arrived before now won't generate another edge, so
+	// pick it up here.
+
+	::PrvReactorFill (index);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorFill
+ *
+ * DESCRIPTION:	Move data from a buffered socket into its ring until
+ *				the socket is drained or the ring is full.  Must be
+ *				called with gReactorMutex held; this is the only place
+ *				that writes to the rings.
+ *
+ * PARAMETERS:	index - slot in gSockets.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void PrvReactorFill (int index)
+{
+	EmNetLibSocket&	state = gSocketState[index];
+
+	if (!state.fRing || state.fEOF || state.fError)
+		return;
+
+	state.fThrottled = false;
+
+	uint8	buffer[4096];
+
+	for (;;)
+	{
+		long	room = state.fRing->GetFree ();
+
+		if (room == 0)
+		{
+			// Edge-triggered, so we won't hear about this socket again
+			// until the CPU thread makes room and calls us back.
+
+			state.fThrottled = true;
+			break;
+		}
+
+		ssize_t	len = recv (gSockets[index], buffer, min (room, (long) sizeof (buffer)), 0);
+
+		if (len > 0)
+		{
+			state.fRing->Put (buffer, len);
+			continue;
+		}
+
+		if (len == 0)
+		{
+			state.fEOF = true;
+		}
+		else if (errno == EINTR)
+		{
+			continue;
+		}
+		else if (errno != EAGAIN && errno != EWOULDBLOCK)
+		{
+			state.fError = errno;
+		}
+
+		break;
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorReceive
+ *
+ * DESCRIPTION:	Read data from a buffered socket's receive ring.
+ *
+ * PARAMETERS:	index - slot in gSockets.
+ *
+ *				buffer, len - where to put the data.
+ *
+ *				peek - true to leave the data in the ring.
+ *
+ *				errP - receives the NetLib error, if any.
+ *
+ * RETURNED:	Number of bytes read, 0 at end of file, or -1 on error.
+ *
+ ***********************************************************************/
+
+long PrvReactorReceive (int index, void* buffer, long len, Bool peek, Err* errP)
+{
+	EmNetLibSocket&	state = gSocketState[index];
+
+	long	result = peek
+		? state.fRing->Peek (buffer, len)
+		: state.fRing->Get (buffer, len);
+
+	omni_mutex_lock	lock (gReactorMutex);
+
+	if (result > 0)
+	{
+		// If the reactor stopped draining the socket because the ring was
+		// full, carry on now that there's room.
+
+		if (state.fThrottled)
+			::PrvReactorFill (index);
+	}
+	else if (len > 0)
+	{
+		// Nothing buffered.  Look again now that the reactor is locked
+		// out, so that data it posted just before an EOF or error isn't
+		// mistaken for the end of the stream.
+
+		result = peek
+			? state.fRing->Peek (buffer, len)
+			: state.fRing->Get (buffer, len);
+
+		if (result == 0 && state.fError)
+		{
+			*errP = PrvTranslateError (state.fError);
+			return -1;
+		}
+
+		if (result == 0 && !state.fEOF)
+		{
+			*errP = PrvTranslateError (EWOULDBLOCK);
+			return -1;
+		}
+	}
+
+	*errP = 0;
+	return result;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorGetGeneration
+ *
+ * DESCRIPTION:	Return the reactor's change counter, which is bumped
+ *				every time it handles socket activity.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	The current generation.
+ *
+ ***********************************************************************/
+
+uint32 PrvReactorGetGeneration (void)
+{
+	omni_mutex_lock	lock (gReactorMutex);
+	return gReactorGeneration;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorWaitChange
+ *
+ * DESCRIPTION:	Sleep until the reactor moves past the given generation
+ *				or the deadline passes.
+ *
+ * PARAMETERS:	generation - value from PrvReactorGetGeneration.
+ *
+ *				deadline - absolute time (seconds, nanoseconds) as
+ *					returned by PrvGetDeadline, or NULL to wait forever.
+ *
+ * RETURNED:	False if the deadline passed first.
+ *
+ ***********************************************************************/
+
+Bool PrvReactorWaitChange (uint32 generation, const unsigned long* deadline)
+{
+	omni_mutex_lock	lock (gReactorMutex);
+
+	while (gReactorGeneration == generation)
+	{
+		if (!deadline)
+		{
+			gReactorCondition.wait ();
+		}
+		else if (!gReactorCondition.timedwait (deadline[0], deadline[1]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvSocketPoll
+ *
+ * DESCRIPTION:	Check, without waiting, which of the given poll() events
+ *				are ready on a socket.  Buffered sockets are readable
+ *				when their ring has data, or at end of file or error.
+ *				Like select(), a socket with an error or hangup is both
+ *				readable and writable.
+ *
+ * PARAMETERS:	index - slot in gSockets.
+ *
+ *				events - some combination of POLLIN, POLLOUT, POLLPRI.
+ *
+ * RETURNED:	The subset of events that are ready.
+ *
+ ***********************************************************************/
+
+short PrvSocketPoll (int index, short events)
+{
+	EmNetLibSocket&	state = gSocketState[index];
+	short			ready = 0;
+
+	if (state.fRing && (events & POLLIN))
+	{
+		omni_mutex_lock	lock (gReactorMutex);
+
+		// Don't wait on the reactor to pick up data it's about to see.
+
+		if (state.fRing->GetUsed () == 0)
+			::PrvReactorFill (index);
+
+		if (state.fRing->GetUsed () > 0 || state.fEOF || state.fError)
+			ready |= POLLIN;
+
+		events &= ~POLLIN;
+	}
+
+	if (events)
+	{
+		pollfd	pfd;
+		pfd.fd		= gSockets[index];
+		pfd.events	= events;
+		pfd.revents	= 0;
+
+		if (poll (&pfd, 1, 0) > 0)
+		{
+			short	revents = pfd.revents;
+
+			if (revents & (POLLERR | POLLHUP))
+				revents |= events & (POLLIN | POLLOUT);
+
+			ready |= revents & events;
+		}
+	}
+
+	return ready;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvGetDeadline
+ *
+ * DESCRIPTION:	Convert a NetLib timeout to an absolute time suitable
+ *				for omni_condition::timedwait.
+ *
+ * PARAMETERS:	timeout - in ticks.  Ignored if not positive.
+ *
+ *				deadline - receives seconds and nanoseconds.
+ *
+ * RETURNED:	nothing
+ *
+ ***********************************************************************/
+
+void PrvGetDeadline (Int32 timeout, unsigned long* deadline)
+{
+	deadline[0] = deadline[1] = 0;
+
+	if (timeout > 0)
+	{
+		omni_thread::get_time (&deadline[0], &deadline[1],
+			timeout / kSysTicksPerSecond,
+			(timeout % kSysTicksPerSecond) * (1000000000 / kSysTicksPerSecond));
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvReactorSelect
+ *
+ * DESCRIPTION:	NetLibSelect for sockets owned by the reactor.  Rather
+ *				than building host fd_sets and calling select(), poll
+ *				each requested socket and sleep on the reactor between
+ *				passes until something is ready or the timeout expires.
+ *
+ * PARAMETERS:	As for Platform_NetLib::Select.
+ *
+ * RETURNED:	Number of ready sockets, 0 on timeout.
+ *
+ ***********************************************************************/
+
+Int16 PrvReactorSelect (UInt16 netWidth,
+						NetFDSetType* netReadFDs,
+						NetFDSetType* netWriteFDs,
+						NetFDSetType* netExceptFDs,
+						Int32 netTimeout,
+						Err* errP)
+{
+	NetFDSetType	wantRead	= netReadFDs ? *netReadFDs : 0;
+	NetFDSetType	wantWrite	= netWriteFDs ? *netWriteFDs : 0;
+	NetFDSetType	wantExcept	= netExceptFDs ? *netExceptFDs : 0;
+
+	unsigned long	deadline[2];
+	::PrvGetDeadline (netTimeout, deadline);
+
+	for (;;)
+	{
+		uint32			generation	= ::PrvReactorGetGeneration ();
+		NetFDSetType	readyRead	= 0;
+		NetFDSetType	readyWrite	= 0;
+		NetFDSetType	readyExcept	= 0;
+		Int16			result		= 0;
+
+		for (int ii = 0; ii < netMaxNumSockets; ++ii)
+		{
+			NetSocketRef	sRef = ii + netMinSocketRefNum;
+
+			if (sRef >= netWidth || gSockets[ii] == INVALID_SOCKET)
+				continue;
+
+			short	events = 0;
+
+			if (netFDIsSet (sRef, &wantRead))
+				events |= POLLIN;
+
+			if (netFDIsSet (sRef, &wantWrite))
+				events |= POLLOUT;
+
+			if (netFDIsSet (sRef, &wantExcept))
+				events |= POLLPRI;
+
+			if (!events)
+				continue;
+
+			::PrvReactorPromote (ii);
+
+			short	ready = ::PrvSocketPoll (ii, events);
+
+			if (ready & POLLIN)
+			{
+				netFDSet (sRef, &readyRead);
+				++result;
+			}
+
+			if (ready & POLLOUT)
+			{
+				netFDSet (sRef, &readyWrite);
+				++result;
+			}
+
+			if (ready & POLLPRI)
+			{
+				netFDSet (sRef, &readyExcept);
+				++result;
+			}
+		}
+
+		if (result > 0 || netTimeout == 0 ||
+			!::PrvReactorWaitChange (generation, netTimeout > 0 ? deadline : NULL))
+		{
+			if (netReadFDs)
+				*netReadFDs = readyRead;
+
+			if (netWriteFDs)
+				*netWriteFDs = readyWrite;
+
+			if (netExceptFDs)
+				*netExceptFDs = readyExcept;
+
+			*errP = 0;
+			return result;
+		}
+	}
+}
+
+#endif	// HAS_NETLIB_REACTOR
+
+
 /***********************************************************************
  *
  * FUNCTION:	PrvGetError
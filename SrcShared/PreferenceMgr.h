@@ -360,6 +360,10 @@ extern EmulatorPreferences* gEmuPrefs;
 																				\
 	DO_TO_PREF(DebuggerSocketPort,	long,				(6414))					\
 	DO_TO_PREF(RPCSocketPort,		long,				(6415))					\
+	DO_TO_PREF(GDBSocketPort,		long,				(0))						\
+																				\
+	DO_TO_PREF(TrapStatsTiming,		bool,				(false))				\
+	DO_TO_PREF(TrapStatsInterval,	long,				(0))					\
 																				\
 	DO_TO_PREF(WarnAboutSkinsDir,	bool,				(false))					\
 																				\
@@ -370,6 +374,16 @@ extern EmulatorPreferences* gEmuPrefs;
 	DO_TO_PREF(FillResizedBlocks,	bool,				(false))				\
 	DO_TO_PREF(FillDisposedBlocks,	bool,				(false))				\
 	DO_TO_PREF(FillStack,			bool,				(false))				\
+	DO_TO_PREF(CheckStackPointer,	bool,				(true))					\
+																				\
+	DO_TO_PREF(TRGDiskOverlay,		bool,				(false))				\
+																				\
+	DO_TO_PREF(TimeTravel,			bool,				(false))				\
+	DO_TO_PREF(TimeTravelInterval,	long,				(16 * 1024L * 1024L))	\
+	DO_TO_PREF(TimeTravelSnapshots,	long,				(32))					\
+																				\
+	DO_TO_PREF(DeterministicTime,	bool,				(false))				\
+	DO_TO_PREF(DeterministicEpoch,	long,				(1009843200))			\
 																				\
 	DO_TO_PREF(LastConfiguration,	Configuration,		(EmDevice ("PalmIII"), 1024, EmFileRef()))	\
 																				\
@@ -387,6 +401,7 @@ extern EmulatorPreferences* gEmuPrefs;
 	DO_TO_PREF(DimWhenInactive,		bool,				(true))					\
 	DO_TO_PREF(ShowDebugMode,		bool,				(false))					\
 	DO_TO_PREF(ShowGremlinMode,		bool,				(false))					\
+	DO_TO_PREF(RecordGremlinScreen,	bool,				(false))				\
 	DO_TO_PREF(StayOnTop,			bool,				(false))				\
 																				\
 	DO_TO_PREF(WarningOff,			EmErrorHandlingOption,	(kShow))			\
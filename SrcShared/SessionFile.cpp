@@ -40,6 +40,7 @@
 SessionFile::SessionFile (ChunkFile& f) :
 	fFile (f),
 	fCanReload (false),
+	fSnapshot (false),
 	fCfg (),
 	fReadBugFixes (false),
 	fChangedBugFixes (false),
@@ -876,6 +877,44 @@ Bool SessionFile::GetCanReload (void)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	SessionFile::SetSnapshot
+ *
+ * DESCRIPTION:	Mark this file as an EmTimeTravel snapshot.  Sub-systems
+ *				that keep their own copies of the memory images skip
+ *				them, and nothing is compressed.
+ *
+ * PARAMETERS:	val - true if this is a snapshot.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void SessionFile::SetSnapshot (Bool val)
+{
+	fSnapshot = val;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	SessionFile::GetSnapshot
+ *
+ * DESCRIPTION:	Return whether this file is an EmTimeTravel snapshot.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	True if so.
+ *
+ ***********************************************************************/
+
+Bool SessionFile::GetSnapshot (void)
+{
+	return fSnapshot;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	SessionFile::FixBug
@@ -948,6 +987,9 @@ Bool SessionFile::IncludesBugFix (BugFix val)
 Bool SessionFile::ReadChunk (ChunkFile::Tag tag, void* image,
 							 CompressionType compType)
 {
+	if (fSnapshot)
+		compType = kNoCompression;
+
 	// Get the size of the chunk.
 
 	long	chunkSize = fFile.FindChunk (tag);
@@ -1005,6 +1047,9 @@ Bool SessionFile::ReadChunk (ChunkFile::Tag tag, void* image,
 Bool SessionFile::ReadChunk (ChunkFile::Tag tag, Chunk& chunk,
 							 CompressionType compType)
 {
+	if (fSnapshot)
+		compType = kNoCompression;
+
 	// Get the size of the chunk.
 
 	long	chunkSize = fFile.FindChunk (tag);
@@ -1084,6 +1129,12 @@ Bool SessionFile::ReadChunk (ChunkFile::Tag tag, Chunk& chunk,
 void SessionFile::WriteChunk (ChunkFile::Tag tag, uint32 size,
 				const void* image, CompressionType compType)
 {
+	// Snapshots are written and read back often, so speed matters
+	// more than size.
+
+	if (fSnapshot)
+		compType = kNoCompression;
+
 	// No compression to be used; just write the data out as-is.
 
 	if (compType == kNoCompression)
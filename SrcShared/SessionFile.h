@@ -71,6 +71,8 @@ class SessionFile
 
 		Bool					ReadGremlinInfo			(Chunk& chunk) { return fFile.ReadChunk (kGremlinInfo, chunk); }
 		Bool					ReadGremlinHistory		(Chunk& chunk) { return this->ReadChunk (kGremlinHistory, chunk, kGzipCompression); }
+		Bool					ReadGremlinBlocks		(Chunk& chunk) { return fFile.ReadChunk (kGremlinBlocks, chunk); }
+		Bool					ReadIOJournal			(Chunk& chunk) { return this->ReadChunk (kIOJournal, chunk, kGzipCompression); }
 		Bool					ReadDebugInfo			(Chunk& chunk) { return fFile.ReadChunk (kDebugInfo, chunk); }
 		Bool					ReadMetaInfo			(Chunk& chunk) { return fFile.ReadChunk (kMetaInfo, chunk); }
 		Bool					ReadPatchInfo			(Chunk& chunk) { return fFile.ReadChunk (kPatchInfo, chunk); }
@@ -78,6 +80,7 @@ class SessionFile
 		Bool					ReadLoggingInfo			(Chunk& chunk) { return fFile.ReadChunk (kLoggingInfo, chunk); }
 		Bool					ReadStackInfo			(Chunk& chunk) { return fFile.ReadChunk (kStackInfo, chunk); }
 		Bool					ReadHeapInfo			(Chunk& chunk) { return fFile.ReadChunk (kHeapInfo, chunk); }
+		Bool					ReadVirtualTimeInfo		(Chunk& chunk) { return fFile.ReadChunk (kVirtualTimeInfo, chunk); }
 
 		Bool					ReadPlatformInfo		(Chunk& chunk) { return fFile.ReadChunk (kPlatformInfo, chunk); }
 		Bool					ReadPlatformInfoMac		(Chunk& chunk) { return fFile.ReadChunk (kPlatformMac, chunk); }
@@ -119,6 +122,8 @@ class SessionFile
 
 		void					WriteGremlinInfo		(const Chunk& chunk) { fFile.WriteChunk (kGremlinInfo, chunk); }
 		void					WriteGremlinHistory		(const Chunk& chunk) { this->WriteChunk (kGremlinHistory, chunk, kGzipCompression); }
+		void					WriteGremlinBlocks		(const Chunk& chunk) { fFile.WriteChunk (kGremlinBlocks, chunk); }
+		void					WriteIOJournal			(const Chunk& chunk) { this->WriteChunk (kIOJournal, chunk, kGzipCompression); }
 		void					WriteDebugInfo			(const Chunk& chunk) { fFile.WriteChunk (kDebugInfo, chunk); }
 		void					WriteMetaInfo			(const Chunk& chunk) { fFile.WriteChunk (kMetaInfo, chunk); }
 		void					WritePatchInfo			(const Chunk& chunk) { fFile.WriteChunk (kPatchInfo, chunk); }
@@ -126,6 +131,7 @@ class SessionFile
 		void					WriteLoggingInfo		(const Chunk& chunk) { fFile.WriteChunk (kLoggingInfo, chunk); }
 		void					WriteStackInfo			(const Chunk& chunk) { fFile.WriteChunk (kStackInfo, chunk); }
 		void					WriteHeapInfo			(const Chunk& chunk) { fFile.WriteChunk (kHeapInfo, chunk); }
+		void					WriteVirtualTimeInfo	(const Chunk& chunk) { fFile.WriteChunk (kVirtualTimeInfo, chunk); }
 
 		void					WritePlatformInfo		(const Chunk& chunk) { fFile.WriteChunk (kPlatformInfo, chunk); }
 		void					WritePlatformInfoMac	(const Chunk& chunk) { fFile.WriteChunk (kPlatformMac, chunk); }
@@ -153,6 +159,12 @@ class SessionFile
 		void					SetCanReload			(Bool);
 		Bool					GetCanReload			(void);
 
+		// A snapshot is a session saved to memory for EmTimeTravel.  It
+		// leaves out the ROM and RAM images, and isn't compressed.
+
+		void					SetSnapshot				(Bool);
+		Bool					GetSnapshot				(void);
+
 		void					FixBug					(BugFix);
 		Bool					IncludesBugFix			(BugFix);
 
@@ -185,6 +197,10 @@ class SessionFile
 		friend Bool Platform::ReadROMFileReference (ChunkFile&, EmFileRef&);
 		friend void Platform::WriteROMFileReference (ChunkFile&, const EmFileRef&);
 
+		// EmMinimize::SaveMinimalEvents needs the event history and I/O
+		// journal tags in order to leave them out when copying an event file.
+		friend class EmMinimize;
+
 		enum
 		{
 			kDeviceType			= 'DTyp',	// Device type (Pilot 1000, PalmPilot, Palm III, etc.)
@@ -218,6 +234,8 @@ class SessionFile
 
 			kGremlinInfo		= 'grem',	// Gremlin state
 			kGremlinHistory		= 'hist',	// Gremlin event history
+			kGremlinBlocks		= 'hblk',	// Gremlin event history, as separately compressed blocks
+			kIOJournal			= 'iojr',	// Host I/O results recorded along with the event history
 			kDebugInfo			= 'dbug',	// Debug state
 			kMetaInfo			= 'meta',	// MetaMemory state
 			kPatchInfo			= 'ptch',	// Trappatch state
@@ -225,6 +243,7 @@ class SessionFile
 			kLoggingInfo		= 'log ',	// Standard LogStream data
 			kStackInfo			= 'stak',	// List of currently known stacks
 			kHeapInfo			= 'heap',	// Heap state
+			kVirtualTimeInfo	= 'vtim',	// EmVirtualTime state
 
 			kPlatformInfo		= 'plat',	// Information managed by the Platform sub-system that has analogs on all platforms.
 			kPlatformMac		= 'mac ',	// Mac-specific information
@@ -248,6 +267,7 @@ class SessionFile
 	private:
 		ChunkFile&				fFile;
 		Bool					fCanReload;
+		Bool					fSnapshot;
 		Configuration			fCfg;
 		bool					fReadBugFixes;
 		bool					fChangedBugFixes;
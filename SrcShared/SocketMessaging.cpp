@@ -47,6 +47,21 @@
 #include <string.h>
 #endif
 
+// On Linux (and so Android), a dedicated thread waits on all sockets with
+// epoll and idles each one as soon as it becomes ready, rather than having
+// the UI thread poll every socket from its idle loop.
+
+#if PLATFORM_UNIX && HAS_OMNI_THREAD && defined (__linux__)
+#define HAS_SOCKET_EVENT_THREAD	1
+#else
+#define HAS_SOCKET_EVENT_THREAD	0
+#endif
+
+#if HAS_SOCKET_EVENT_THREAD
+#include <fcntl.h>				// fcntl, O_NONBLOCK
+#include <sys/epoll.h>			// epoll_create, epoll_ctl, epoll_wait
+#endif
+
 // ---------------------------------------------------------------------------
 //		 Stuff
 // ---------------------------------------------------------------------------
@@ -62,6 +77,27 @@ typedef vector<CSocket*>	SocketList;
 static SocketList			gSockets;
 static SocketList			gSocketsToBeAdded;
 
+// Sockets can be created on any thread, so guard the lists of new ones.
+
+static omni_mutex			gSocketsToBeAddedMutex;
+
+#if HAS_SOCKET_EVENT_THREAD
+static SocketList			gSocketsToBeHandedOver;
+
+// Upper bound on how long the event thread goes without looking for
+// sockets that were created or (re)opened since it last looked.
+
+const int					kEventThreadTimeout = 100;	// msecs
+
+static omni_thread*			gEventThread;
+static int					gEventFD = -1;
+static int					gEventWakePipe[2] = { -1, -1 };
+static volatile Bool		gEventThreadQuit;
+
+static void					PrvWakeEventThread	(void);
+
+#endif
+
 
 /***********************************************************************
  *
@@ -79,6 +115,40 @@ static SocketList			gSocketsToBeAdded;
 
 void CSocket::Startup (void)
 {
+#if HAS_SOCKET_EVENT_THREAD
+	EmAssert (!gEventThread);
+
+	gEventFD = epoll_create (16);
+	if (gEventFD < 0)
+	{
+		PRINTF ("CSocket::Startup: epoll_create failed: %d; falling back to IdleAll", errno);
+		return;
+	}
+
+	if (pipe (gEventWakePipe) != 0)
+	{
+		close (gEventFD);
+		gEventFD = -1;
+		return;
+	}
+
+	fcntl (gEventWakePipe[0], F_SETFL, O_NONBLOCK);
+	fcntl (gEventWakePipe[1], F_SETFL, O_NONBLOCK);
+
+	// The wake pipe is tagged with a NULL socket pointer.
+
+	epoll_event	event;
+	event.events	= EPOLLIN;
+	event.data.ptr	= NULL;
+	epoll_ctl (gEventFD, EPOLL_CTL_ADD, gEventWakePipe[0], &event);
+
+	gEventThreadQuit = false;
+
+	// Created with a function returning void*, so the thread is joinable.
+
+	gEventThread = new omni_thread (&CSocket::EventThread);
+	gEventThread->start ();
+#endif
 }
 
 
@@ -97,6 +167,8 @@ void CSocket::Startup (void)
 
 void CSocket::Shutdown (void)
 {
+	CSocket::StopEventThread ();
+
 	// Add any sockets waiting to be added to gSockets.
 
 	CSocket::AddPending ();
@@ -122,6 +194,50 @@ void CSocket::Shutdown (void)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	CSocket::StopEventThread
+ *
+ * DESCRIPTION: Stop the thread that idles sockets as they become ready.
+ *				Call this before tearing down anything that socket
+ *				callbacks might touch.  After this, sockets are once
+ *				again idled by IdleAll.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void CSocket::StopEventThread (void)
+{
+#if HAS_SOCKET_EVENT_THREAD
+	if (!gEventThread)
+		return;
+
+	gEventThreadQuit = true;
+	::PrvWakeEventThread ();
+
+	gEventThread->join (NULL);
+	gEventThread = NULL;
+
+	close (gEventFD);
+	close (gEventWakePipe[0]);
+	close (gEventWakePipe[1]);
+
+	gEventFD = -1;
+	gEventWakePipe[0] = -1;
+	gEventWakePipe[1] = -1;
+
+	omni_mutex_lock	lock (gSocketsToBeAddedMutex);
+
+	gSocketsToBeAdded.insert (gSocketsToBeAdded.end (),
+		gSocketsToBeHandedOver.begin (), gSocketsToBeHandedOver.end ());
+	gSocketsToBeHandedOver.clear ();
+#endif
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	CSocket::IdleAll
@@ -136,6 +252,29 @@ void CSocket::Shutdown (void)
 
 ErrCode CSocket::IdleAll (void)
 {
+#if HAS_SOCKET_EVENT_THREAD
+	// The event thread idles sockets as soon as they become ready.  All
+	// that's left for us is to pass along any sockets created on this
+	// (or any other) thread since the last time.
+
+	if (gEventThread)
+	{
+		{
+			omni_mutex_lock	lock (gSocketsToBeAddedMutex);
+
+			if (gSocketsToBeHandedOver.empty ())
+				return errNone;
+
+			gSocketsToBeAdded.insert (gSocketsToBeAdded.end (),
+				gSocketsToBeHandedOver.begin (), gSocketsToBeHandedOver.end ());
+			gSocketsToBeHandedOver.clear ();
+		}
+
+		::PrvWakeEventThread ();
+		return errNone;
+	}
+#endif
+
 	// Prevent recursion
 	static Boolean	inIdleAll;
 	if (inIdleAll)
@@ -193,6 +332,8 @@ ErrCode CSocket::IdleAll (void)
 
 void CSocket::AddPending (void)
 {
+	omni_mutex_lock	lock (gSocketsToBeAddedMutex);
+
 	SocketList::iterator	iter = gSocketsToBeAdded.begin ();
 	while (iter != gSocketsToBeAdded.end ())
 	{
@@ -227,6 +368,17 @@ void CSocket::DeletePending (void)
 	{
 		if ((*iter)->Deleted ())
 		{
+#if HAS_SOCKET_EVENT_THREAD
+			// Make sure the event thread can't hand us this object
+			// again, in case its socket was never closed.
+
+			if (gEventFD >= 0 && (*iter)->fWatchedSocket != INVALID_SOCKET)
+			{
+				epoll_event	event;
+				epoll_ctl (gEventFD, EPOLL_CTL_DEL, (*iter)->fWatchedSocket, &event);
+			}
+#endif
+
 			delete *iter;
 			iter = gSockets.erase(iter);
 			continue;
@@ -237,6 +389,144 @@ void CSocket::DeletePending (void)
 }
 
 
+#if HAS_SOCKET_EVENT_THREAD
+
+/***********************************************************************
+ *
+ * FUNCTION:    CSocket::EventThread
+ *
+ * DESCRIPTION: Body of the event thread.  Waits with epoll for any
+ *				watched socket to become ready, and idles just the
+ *				sockets that did, so that incoming connections and
+ *				packets are handled without waiting for the UI
+ *				thread's next idle pass.
+ *
+ * PARAMETERS:  Unused.
+ *
+ * RETURNED:    NULL.
+ *
+ ***********************************************************************/
+
+void* CSocket::EventThread (void*)
+{
+	epoll_event	events[16];
+
+	while (!gEventThreadQuit)
+	{
+		CSocket::AddPending ();
+		CSocket::DeletePending ();
+		CSocket::WatchAll ();
+
+		int	count = epoll_wait (gEventFD, events, countof (events), kEventThreadTimeout);
+
+		for (int ii = 0; ii < count && !gEventThreadQuit; ++ii)
+		{
+			CSocket*	s = (CSocket*) events[ii].data.ptr;
+
+			if (!s)
+			{
+				char	buffer[16];
+				while (read (gEventWakePipe[0], buffer, sizeof (buffer)) > 0)
+					;
+				continue;
+			}
+
+			// Objects are only deleted by DeletePending, above, so this
+			// pointer is good even if the socket was just closed.
+
+			if (s->Deleted ())
+				continue;
+
+			try
+			{
+				s->Idle ();
+			}
+			catch (...)
+			{
+				PRINTF ("CSocket::EventThread: exception idling socket 0x%08X", s);
+			}
+		}
+	}
+
+	return NULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:    CSocket::WatchAll
+ *
+ * DESCRIPTION: Bring the epoll set up to date with the host sockets of
+ *				all live CSockets.  Sockets that were closed have
+ *				already dropped out of the set by themselves.
+ *
+ * PARAMETERS:  None
+ *
+ * RETURNED:    Nothing
+ *
+ ***********************************************************************/
+
+void CSocket::WatchAll (void)
+{
+	SocketList::iterator	iter = gSockets.begin ();
+
+	while (iter != gSockets.end ())
+	{
+		CSocket*	s = *iter++;
+
+		if (s->Deleted ())
+			continue;
+
+		SOCKET	hostSocket = s->GetEventSocket ();
+
+		if (hostSocket == s->fWatchedSocket)
+			continue;
+
+		s->fWatchedSocket = INVALID_SOCKET;
+
+		if (hostSocket == INVALID_SOCKET)
+			continue;
+
+		epoll_event	event;
+		event.events	= EPOLLIN;
+		event.data.ptr	= s;
+
+		if (epoll_ctl (gEventFD, EPOLL_CTL_ADD, hostSocket, &event) == 0 ||
+			(errno == EEXIST && epoll_ctl (gEventFD, EPOLL_CTL_MOD, hostSocket, &event) == 0))
+		{
+			s->fWatchedSocket = hostSocket;
+		}
+		else
+		{
+			PRINTF ("CSocket::WatchAll: epoll_ctl failed for socket 0x%08X: %d", s, errno);
+		}
+	}
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:    PrvWakeEventThread
+ *
+ * DESCRIPTION: Knock the event thread out of epoll_wait so that it
+ *				picks up new sockets (or notices it's time to quit).
+ *
+ * PARAMETERS:  None
+ *
+ * RETURNED:    Nothing
+ *
+ ***********************************************************************/
+
+void PrvWakeEventThread (void)
+{
+	char	token = 0;
+	ssize_t	result = write (gEventWakePipe[1], &token, 1);
+	UNUSED_PARAM(result)
+}
+
+#endif	// HAS_SOCKET_EVENT_THREAD
+
+
 /***********************************************************************
  *
  * FUNCTION:	CSocket::CSocket
@@ -250,8 +540,22 @@ void CSocket::DeletePending (void)
  ***********************************************************************/
 
 CSocket::CSocket (void) :
+	fWatchedSocket (INVALID_SOCKET),
 	fDeleted (false)
 {
+	omni_mutex_lock	lock (gSocketsToBeAddedMutex);
+
+#if HAS_SOCKET_EVENT_THREAD
+	// Objects created on other threads are handed to the event thread by
+	// IdleAll, by which time their constructors are certain to have run.
+
+	if (gEventThread && omni_thread::self () != gEventThread)
+	{
+		gSocketsToBeHandedOver.push_back (this);
+		return;
+	}
+#endif
+
 	gSocketsToBeAdded.push_back (this);
 }
 
@@ -312,6 +616,26 @@ Bool CSocket::Deleted (void) const
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:    CSocket::GetEventSocket
+ *
+ * DESCRIPTION: Return the host socket the event thread should watch on
+ *				behalf of this object.
+ *
+ * PARAMETERS:  None
+ *
+ * RETURNED:    The socket, or INVALID_SOCKET to not be idled by the
+ *				event thread.
+ *
+ ***********************************************************************/
+
+SOCKET CSocket::GetEventSocket (void)
+{
+	return INVALID_SOCKET;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	CSocket::ShortPacketHack
@@ -534,6 +858,7 @@ ErrCode CTCPSocket::Close (void)
 	}
 
 	fSocketState = kSocketState_Unconnected;
+	fWatchedSocket = INVALID_SOCKET;
 
 	// Tell the callback function that the socket is now disconnected
 	// (and not even listening).  Send out this notification at this
@@ -584,6 +909,32 @@ ErrCode CTCPSocket::Idle (void)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	CTCPSocket::GetEventSocket
+ *
+ * DESCRIPTION: Return the socket to watch for activity: the connected
+ *				socket if we have one (for incoming data), or else the
+ *				listening socket (for incoming connections).
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	The socket, or INVALID_SOCKET if we're not open.
+ *
+ ***********************************************************************/
+
+SOCKET CTCPSocket::GetEventSocket (void)
+{
+	if (fSocketState == kSocketState_Connected)
+		return fConnectedSocket;
+
+	if (fSocketState == kSocketState_Listening)
+		return fListeningSocket;
+
+	return INVALID_SOCKET;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	CTCPSocket::Write
@@ -27,6 +27,7 @@ class CSocket
 	public:
 		static void 			Startup 			(void);
 		static void 			Shutdown			(void);
+		static void 			StopEventThread		(void);
 		static ErrCode			IdleAll 			(void);
 
 	public:
@@ -46,6 +47,10 @@ class CSocket
 		virtual Bool			HasUnreadData		(long timeout) = 0;
 		virtual ErrCode 		Idle				(void) = 0;
 
+		// The host socket whose readiness means this object needs
+		// to be idled, or INVALID_SOCKET if none.
+		virtual SOCKET			GetEventSocket		(void);
+
 		virtual Bool			ShortPacketHack 	(void);
 		virtual Bool			ByteswapHack		(void);
 
@@ -55,6 +60,14 @@ class CSocket
 		static void				AddPending			(void);
 		static void				DeletePending		(void);
 
+		static void*			EventThread			(void*);
+		static void				WatchAll			(void);
+
+		// The socket last registered with the event thread.  Reset
+		// this when closing the host socket, in case the same
+		// descriptor number is handed out again.
+		SOCKET					fWatchedSocket;
+
 	private:
 		Bool					fDeleted;
 };
@@ -71,6 +84,7 @@ class CTCPSocket : public CSocket
 		virtual ErrCode 		Read				(void* buffer, long sizeOfBuffer, long* amtRead);
 		virtual Bool			HasUnreadData		(long timeout);
 		virtual ErrCode 		Idle				(void);
+		virtual SOCKET			GetEventSocket		(void);
 
 		Bool					ConnectPending		(void);
 		ErrCode 				AcceptConnection	(void);
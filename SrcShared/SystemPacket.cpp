@@ -25,6 +25,7 @@
 #include "EmPalmStructs.h"		// EmSysPktRPCType, etc
 #include "EmRPC.h"				// slkSocketRPC
 #include "EmSession.h"			// EmSession::Reset
+#include "EmTimeTravel.h"		// EmTimeTravel::RunToCycle, etc.
 #include "HostControl.h"		// hostSelectorWaitForIdle
 #include "Logging.h"			// LogAppendMsg
 #include "Platform.h"			// Platform::ExitDebugger
@@ -79,6 +80,7 @@
 			sysPktFindCmd
 			sysPktGetTrapConditionsCmd
 			sysPktSetTrapConditionsCmd
+			sysPktTimeTravelCmd
 
 		Console
 			sysPktRPCCmd
@@ -88,6 +90,7 @@
 			sysPktWriteMemCmd
 			sysPktRPCCmd
 			sysPktRPC2Cmd
+			sysPktRPCBatchCmd
 
 	The Console and RPC sockets will always handle the packet they receive
 	(assuming that the UI thread has first synchronized with the CPU thread
@@ -177,6 +180,55 @@
 #define PRINTF	if (!LogHLDebugger ()) ; else LogAppendMsg
 
 
+// Operation codes.
+
+enum
+{
+	kBatchOpCall		= 1,
+	kBatchOpReadMem		= 2,
+	kBatchOpWriteMem	= 3
+};
+
+// Chain flags and parameter kinds.
+
+#define kBatchChainAddress		0x01
+#define kBatchChainLength		0x02
+
+#define kBatchParamChained		2
+
+#define kBatchRefA0				0x8000
+#define kBatchRefIteration		0x7FFF
+
+// Status codes returned in the response.
+
+enum
+{
+	kBatchErrNone		= 0,
+	kBatchErrFormat		= 1,	// Malformed or unsupported operation.
+	kBatchErrChain		= 2,	// Reference to a result not yet produced.
+	kBatchErrOverflow	= 3		// Response full; resend to continue.
+};
+
+const UInt16	kBatchMaxOps		= 64;
+const long		kBatchMaxResponse	= 0x8000;
+const long		kBatchHeaderSize	= 8;
+
+
+struct EmBatchState
+{
+	UInt32	fD0[kBatchMaxOps];
+	UInt32	fA0[kBatchMaxOps];
+	UInt16	fOpIndex;
+	UInt16	fIteration;
+	Bool	fBadChain;
+};
+
+
+static UInt32	PrvBatchValue			(const char* p, Bool chained, EmBatchState& state);
+static void		PrvBatchPut32			(char*& p, UInt32 value);
+static void		PrvUpdateLowMemChecksum	(emuptr address);
+
+
 /***********************************************************************
  *
  * FUNCTION:	SystemPacket::SendState
@@ -336,47 +388,7 @@ ErrCode SystemPacket::WriteMem (SLP& slp)
 		EmMem_memcpy (dest, src, len);
 	}
 
-	// If we just altered low memory, recalculate the low-memory checksum.
-	// Make sure we're on a ROM that has this field!  Determine this by
-	// seeing that the address of sysLowMemChecksum is below the memCardInfo
-	// fields that come after the FixedGlobals.
-	//
-	// !!! This chunk of code should be in some more generally accessible location.
-
-	if (offsetof (LowMemType, fixed.globals.sysLowMemChecksum) < EmLowMem_GetGlobal (memCardInfoP))
-	{
-		if ((emuptr) packet.address < (emuptr) 0x100)
-		{
-			UInt32		checksum	= 0;
-			emuptr		csP		= EmMemNULL;
-
-			// First, calculate the checksum
-
-			while (csP < (emuptr) 0x100)
-			{
-				UInt32	data = EmMemGet32 (csP);
-
-				// Don't do these trap vectors since they change whenever the
-				// debugger is set to break on any a-trap or breakpoint.
-
-				if (csP == offsetof (M68KExcTableType, trapN[sysDispatchTrapNum]))
-					data = 0;
-
-				if (csP == offsetof (M68KExcTableType, trapN[sysDbgBreakpointTrapNum]))
-					data = 0;
-
-				if (csP == offsetof (M68KExcTableType, trace))
-					data = 0;
-
-				checksum += data;
-				csP += 4;
-			}
-
-			// Save new checksum
-
-			EmLowMem_SetGlobal (sysLowMemChecksum, checksum);
-		}
-	}
+	::PrvUpdateLowMemChecksum (dest);
 
 	EXIT_CODE ("WriteMem", sysPktWriteMemRsp);
 }
@@ -810,6 +822,434 @@ ErrCode SystemPacket::RPC2 (SLP& slp)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	SystemPacket::RPCBatch
+ *
+ * DESCRIPTION: Execute a sequence of trap calls and memory accesses
+ *				while the CPU is stopped for a single packet, returning
+ *				all of the results in one response.  Scripts that used
+ *				to make one round trip per call (for instance, to walk
+ *				the records of a database) can describe the whole walk
+ *				in one packet.
+ *
+ *				The request body is:
+ *
+ *					UInt8	command			(sysPktRPCBatchCmd)
+ *					UInt8	_filler
+ *					UInt16	numOps			operations per iteration
+ *					UInt16	numIterations	times to run the operations
+ *					UInt16	firstIteration	initial iteration counter
+ *					<numOps operations>
+ *
+ *				Each operation starts with a UInt8 opcode and a UInt8
+ *				"chain" flags byte:
+ *
+ *					kBatchOpCall:
+ *						UInt16	trapWord
+ *						UInt8	DRegMask, ARegMask
+ *						UInt8	DChainMask, AChainMask
+ *						UInt32	register values, D-registers first
+ *						UInt16	numParams
+ *						<params, as in sysPktRPC2Cmd>
+ *
+ *					kBatchOpReadMem:
+ *						UInt32	address		(kBatchChainAddress)
+ *						UInt32	numBytes	(kBatchChainLength)
+ *
+ *					kBatchOpWriteMem:
+ *						UInt32	address		(kBatchChainAddress)
+ *						UInt16	numBytes
+ *						<numBytes of data, padded to even length>
+ *
+ *				Any 32-bit value whose chain bit is set (including a
+ *				register whose bit is set in DChainMask or AChainMask,
+ *				and a parameter whose "byRef" field is kBatchParamChained)
+ *				is instead a reference to an earlier result in the same
+ *				iteration: a UInt16 source followed by an Int16 that is
+ *				added to the value found there.  The source is the index
+ *				of an earlier operation, with kBatchRefA0 set to select
+ *				its A0 result instead of D0, or kBatchRefIteration to
+ *				select the iteration counter.  Memory operations report
+ *				their address as "A0" and their length as "D0".
+ *
+ *				The response body is:
+ *
+ *					UInt8	command			(sysPktRPCBatchRsp)
+ *					UInt8	_filler
+ *					UInt16	status			kBatchErr...
+ *					UInt16	iterationsDone	complete iterations
+ *					UInt16	opsDone			operations done in the
+ *											iteration that stopped
+ *					<results>
+ *
+ *				Calls return UInt32 D0 and A0, followed by the contents
+ *				of any by-reference parameters.  Reads return a UInt32
+ *				length and that many bytes (padded to even length).
+ *				Writes return the UInt32 length written.  If the next
+ *				result will not fit in the response, the batch stops
+ *				*before* that operation with kBatchErrOverflow, and
+ *				the client can resume by resending the packet with an
+ *				adjusted firstIteration.
+ *
+ * PARAMETERS:	slp - the packet and the socket it came in on.
+ *
+ * RETURNED:	Errors from sending the response.
+ *
+ ***********************************************************************/
+
+ErrCode SystemPacket::RPCBatch (SLP& slp)
+{
+	PRINTF ("Entering SystemPacket::RPCBatch.");
+
+	// Work on a copy of the request.  By-reference parameters are mapped
+	// into emulated memory from it, and are refreshed from the original
+	// at the start of every iteration so that one iteration's output
+	// doesn't become the next one's input.
+
+	long		bodySize = slp.Header ().bodySize;
+	if (bodySize > (long) sysPktMaxBodySize)
+		bodySize = sysPktMaxBodySize;
+
+	const char*	request = (const char*) slp.Body ().GetPtr ();
+	char		work[sysPktMaxBodySize];
+	const char*	workEnd = work + bodySize;
+
+	memset (work, 0, sizeof (work));
+	memcpy (work, request, bodySize);
+
+	StMemoryMapper	mapper (work, sizeof (work));
+
+	StMemory	buffer (kBatchMaxResponse);
+	char*		responseP	= buffer.Get ();
+	char*		resultP		= responseP + kBatchHeaderSize;
+	char*		resultEnd	= responseP + kBatchMaxResponse;
+
+	UInt16		status		= kBatchErrNone;
+	UInt16		numOps		= 0;
+	UInt16		numIter		= 0;
+	UInt16		iterDone	= 0;
+
+	EmBatchState	state;
+	state.fOpIndex		= 0;
+	state.fIteration	= 0;
+	state.fBadChain		= false;
+
+	if (bodySize < kBatchHeaderSize)
+	{
+		status = kBatchErrFormat;
+	}
+	else
+	{
+		numOps				= EmAliasUInt16<LAS> (work + 2);
+		numIter				= EmAliasUInt16<LAS> (work + 4);
+		state.fIteration	= EmAliasUInt16<LAS> (work + 6);
+
+		if (numOps > kBatchMaxOps)
+			status = kBatchErrFormat;
+	}
+
+	while (status == kBatchErrNone && iterDone < numIter)
+	{
+		if (iterDone > 0)
+			memcpy (work, request, bodySize);
+
+		const char*	opP = work + kBatchHeaderSize;
+
+		for (state.fOpIndex = 0; state.fOpIndex < numOps; ++state.fOpIndex)
+		{
+			if (opP + 2 > workEnd)
+			{
+				status = kBatchErrFormat;
+				break;
+			}
+
+			UInt8	opcode	= EmAliasUInt8<LAS> ((void*) (opP + 0));
+			UInt8	flags	= EmAliasUInt8<LAS> ((void*) (opP + 1));
+			UInt32	d0		= 0;
+			UInt32	a0		= 0;
+
+			opP += 2;
+
+			if (opcode == kBatchOpCall)
+			{
+				if (opP + 6 > workEnd)
+				{
+					status = kBatchErrFormat;
+					break;
+				}
+
+				UInt16	trapWord	= EmAliasUInt16<LAS> ((void*) (opP + 0));
+				UInt8	dRegMask	= EmAliasUInt8<LAS> ((void*) (opP + 2));
+				UInt8	aRegMask	= EmAliasUInt8<LAS> ((void*) (opP + 3));
+				UInt8	dChainMask	= EmAliasUInt8<LAS> ((void*) (opP + 4));
+				UInt8	aChainMask	= EmAliasUInt8<LAS> ((void*) (opP + 5));
+
+				opP += 6;
+
+				// SysReset never returns, so there's no way to continue
+				// the batch after it.  Send it as a plain RPC packet.
+
+				if (trapWord == sysTrapSysReset)
+				{
+					status = kBatchErrFormat;
+					break;
+				}
+
+				// Walk the parameters once to validate them and size
+				// the result before changing any emulated state.
+
+				const char*	regsP		= opP;
+				int			numRegs		= ::CountBits (dRegMask) + ::CountBits (aRegMask);
+				const char*	paramsP		= regsP + numRegs * sizeof (UInt32);
+				long		resultSize	= 2 * sizeof (UInt32);
+
+				if (paramsP + sizeof (UInt16) > workEnd)
+				{
+					status = kBatchErrFormat;
+					break;
+				}
+
+				UInt16		numParams	= EmAliasUInt16<LAS> ((void*) paramsP);
+				const char*	paramP		= paramsP + sizeof (UInt16);
+
+				for (UInt16 ii = 0; ii < numParams && status == kBatchErrNone; ++ii)
+				{
+					EmAliasSysPktRPCParamType<LAS>	param ((void*) paramP);
+
+					const char*	next = ((const char*) param.asByte.GetPtr ()) + ((param.size + 1) & ~1);
+
+					if (next > workEnd ||
+						(param.byRef == kBatchParamChained && param.size != 4))
+					{
+						status = kBatchErrFormat;
+					}
+					else if (param.byRef == 1)
+					{
+						resultSize += (param.size + 1) & ~1;
+					}
+
+					paramP = next;
+				}
+
+				if (status != kBatchErrNone)
+					break;
+
+				if (resultP + resultSize > resultEnd)
+				{
+					status = kBatchErrOverflow;
+					break;
+				}
+
+				ATrap	trap;
+
+				// Set up the registers, D-registers first as in RPC2.
+
+				for (int regNum = 0; regNum < 8; ++regNum)
+				{
+					if ((dRegMask & (1 << regNum)) != 0)
+					{
+						trap.SetNewDReg (regNum, ::PrvBatchValue (regsP,
+							(dChainMask & (1 << regNum)) != 0, state));
+						regsP += sizeof (UInt32);
+					}
+				}
+
+				for (int regNum = 0; regNum < 8; ++regNum)
+				{
+					if ((aRegMask & (1 << regNum)) != 0)
+					{
+						trap.SetNewAReg (regNum, ::PrvBatchValue (regsP,
+							(aChainMask & (1 << regNum)) != 0, state));
+						regsP += sizeof (UInt32);
+					}
+				}
+
+				// Push the stack-based parameters.
+
+				paramP = paramsP + sizeof (UInt16);
+
+				for (UInt16 jj = 0; jj < numParams; ++jj)
+				{
+					EmAliasSysPktRPCParamType<LAS>	param ((void*) paramP);
+
+					if (param.byRef == kBatchParamChained)
+					{
+						trap.PushLong (::PrvBatchValue ((const char*) param.asByte.GetPtr (), true, state));
+					}
+					else if (param.byRef)
+					{
+						trap.PushLong (EmBankMapped::GetEmulatedAddress (param.asByte.GetPtr ()));
+					}
+					else
+					{
+						if (param.size == 1)
+						{
+							trap.PushByte (param.asByte);
+						}
+						else if (param.size == 2)
+						{
+							trap.PushWord (param.asShort);
+						}
+						else if (param.size == 4)
+						{
+							trap.PushLong (param.asLong);
+						}
+					}
+
+					paramP = ((const char*) param.asByte.GetPtr ()) + ((param.size + 1) & ~1);
+				}
+
+				if (state.fBadChain)
+				{
+					status = kBatchErrChain;
+					break;
+				}
+
+				// Call the trap.
+
+				trap.Call (trapWord);
+
+				d0 = trap.GetD0 ();
+				a0 = trap.GetA0 ();
+
+				::PrvBatchPut32 (resultP, d0);
+				::PrvBatchPut32 (resultP, a0);
+
+				// Return the by-reference parameters.
+
+				paramP = paramsP + sizeof (UInt16);
+
+				for (UInt16 kk = 0; kk < numParams; ++kk)
+				{
+					EmAliasSysPktRPCParamType<LAS>	param ((void*) paramP);
+					long	size = (param.size + 1) & ~1;
+
+					if (param.byRef == 1)
+					{
+						memcpy (resultP, param.asByte.GetPtr (), size);
+						resultP += size;
+					}
+
+					paramP = ((const char*) param.asByte.GetPtr ()) + size;
+				}
+
+				opP = paramP;
+			}
+			else if (opcode == kBatchOpReadMem)
+			{
+				if (opP + 8 > workEnd)
+				{
+					status = kBatchErrFormat;
+					break;
+				}
+
+				emuptr	src	= ::PrvBatchValue (opP + 0, (flags & kBatchChainAddress) != 0, state);
+				UInt32	len	= ::PrvBatchValue (opP + 4, (flags & kBatchChainLength) != 0, state);
+
+				opP += 8;
+
+				if (state.fBadChain)
+				{
+					status = kBatchErrChain;
+					break;
+				}
+
+				if (len > (UInt32) kBatchMaxResponse ||
+					resultP + sizeof (UInt32) + ((len + 1) & ~1) > resultEnd)
+				{
+					status = kBatchErrOverflow;
+					break;
+				}
+
+				::PrvBatchPut32 (resultP, len);
+
+				memset (resultP, 0xFF, (len + 1) & ~1);	// Clear buffer in case of failure.
+
+				if (len > 0 && EmMemCheckAddress (src, 1) && EmMemCheckAddress (src + len - 1, 1))
+				{
+					EmMem_memcpy ((void*) resultP, src, len);
+				}
+
+				resultP += (len + 1) & ~1;
+
+				d0 = len;
+				a0 = src;
+			}
+			else if (opcode == kBatchOpWriteMem)
+			{
+				if (opP + 6 > workEnd)
+				{
+					status = kBatchErrFormat;
+					break;
+				}
+
+				emuptr	dest	= ::PrvBatchValue (opP + 0, (flags & kBatchChainAddress) != 0, state);
+				UInt16	len		= EmAliasUInt16<LAS> ((void*) (opP + 4));
+				const char*	src	= opP + 6;
+
+				opP = src + ((len + 1) & ~1);
+
+				if (opP > workEnd)
+				{
+					status = kBatchErrFormat;
+					break;
+				}
+
+				if (state.fBadChain)
+				{
+					status = kBatchErrChain;
+					break;
+				}
+
+				if (resultP + sizeof (UInt32) > resultEnd)
+				{
+					status = kBatchErrOverflow;
+					break;
+				}
+
+				if (len > 0 && EmMemCheckAddress (dest, 1) && EmMemCheckAddress (dest + len - 1, 1))
+				{
+					EmMem_memcpy (dest, (const void*) src, len);
+					::PrvUpdateLowMemChecksum (dest);
+				}
+
+				::PrvBatchPut32 (resultP, len);
+
+				d0 = len;
+				a0 = dest;
+			}
+			else
+			{
+				status = kBatchErrFormat;
+				break;
+			}
+
+			state.fD0[state.fOpIndex] = d0;
+			state.fA0[state.fOpIndex] = a0;
+		}
+
+		if (status != kBatchErrNone)
+			break;
+
+		++iterDone;
+		++state.fIteration;
+	}
+
+	EmAliasUInt8<LAS> (responseP + 0)	= sysPktRPCBatchRsp;
+	EmAliasUInt8<LAS> (responseP + 1)	= 0;
+	EmAliasUInt16<LAS> (responseP + 2)	= status;
+	EmAliasUInt16<LAS> (responseP + 4)	= iterDone;
+	EmAliasUInt16<LAS> (responseP + 6)	= status == kBatchErrNone ? 0 : state.fOpIndex;
+
+	ErrCode result = SystemPacket::SendPacket (slp, responseP, resultP - responseP);
+
+	PRINTF ("Exiting SystemPacket::RPCBatch.");
+
+	return result;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	SystemPacket::GetBreakpoints
@@ -1073,6 +1513,152 @@ ErrCode SystemPacket::SetTrapConditions (SLP& slp)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	SystemPacket::TimeTravel
+ *
+ * DESCRIPTION: Query or control the time travel history (see
+ *				EmTimeTravel.h).
+ *
+ *				The request body is:
+ *
+ *					UInt8	command			(sysPktTimeTravelCmd)
+ *					UInt8	_filler
+ *					UInt16	operation		kTimeTravelOp...
+ *					UInt32	cycleHi			kTimeTravelOpRunToCycle
+ *					UInt32	cycleLo			only
+ *
+ *				The response body is:
+ *
+ *					UInt8	command			(sysPktTimeTravelRsp)
+ *					UInt8	_filler
+ *					UInt16	status			kTimeTravelErr...
+ *					UInt16	running			non-zero if the CPU was
+ *											resumed to get there
+ *					UInt16	numSnapshots
+ *					UInt32	nowHi, nowLo	current cycle
+ *					UInt32	oldestHi, oldestLo	earliest cycle that
+ *											can be gone back to
+ *
+ *				If the CPU was resumed, a state packet is sent when it
+ *				gets to the target, as if it had stopped at a
+ *				breakpoint.  If the target was reached without running
+ *				(for instance, running back to the cycle of a snapshot),
+ *				the state packet is sent right after the response.
+ *
+ * PARAMETERS:	slp - the packet and the socket it came in on.
+ *
+ * RETURNED:	Errors from sending the response.
+ *
+ ***********************************************************************/
+
+ErrCode SystemPacket::TimeTravel (SLP& slp)
+{
+	PRINTF ("Entering SystemPacket::TimeTravel.");
+
+	long		bodySize	= slp.Header ().bodySize;
+	const char*	request		= (const char*) slp.Body ().GetPtr ();
+
+	UInt16		status		= kTimeTravelErrNone;
+	Bool		running		= false;
+	Bool		moved		= false;
+
+	if (bodySize < 4)
+	{
+		status = kTimeTravelErrFormat;
+	}
+	else
+	{
+		UInt16	op = EmAliasUInt16<LAS> ((void*) (request + 2));
+
+		switch (op)
+		{
+			case kTimeTravelOpQuery:
+				break;
+
+			case kTimeTravelOpTurnOn:
+				EmTimeTravel::TurnOn (true);
+				break;
+
+			case kTimeTravelOpTurnOff:
+				EmTimeTravel::TurnOn (false);
+				break;
+
+			case kTimeTravelOpRunToCycle:
+				if (bodySize < 12)
+				{
+					status = kTimeTravelErrFormat;
+				}
+				else
+				{
+					uint64	hi = EmAliasUInt32<LAS> ((void*) (request + 4));
+					uint64	lo = EmAliasUInt32<LAS> ((void*) (request + 8));
+
+					status = EmTimeTravel::RunToCycle ((hi << 32) | lo, running);
+					moved = true;
+				}
+				break;
+
+			case kTimeTravelOpReverseStep:
+				status = EmTimeTravel::ReverseStep (running);
+				moved = true;
+				break;
+
+			case kTimeTravelOpReverseContinue:
+				status = EmTimeTravel::ReverseContinue (running);
+				moved = true;
+				break;
+
+			default:
+				status = kTimeTravelErrFormat;
+				break;
+		}
+	}
+
+	uint64	now		= EmTimeTravel::GetNow ();
+	uint64	oldest	= EmTimeTravel::GetOldest ();
+	char	response[24];
+
+	EmAliasUInt8<LAS> (response + 0)	= sysPktTimeTravelRsp;
+	EmAliasUInt8<LAS> (response + 1)	= 0;
+	EmAliasUInt16<LAS> (response + 2)	= status;
+	EmAliasUInt16<LAS> (response + 4)	= running ? 1 : 0;
+	EmAliasUInt16<LAS> (response + 6)	= EmTimeTravel::GetNumSnapshots ();
+	EmAliasUInt32<LAS> (response + 8)	= (UInt32) (now >> 32);
+	EmAliasUInt32<LAS> (response + 12)	= (UInt32) now;
+	EmAliasUInt32<LAS> (response + 16)	= (UInt32) (oldest >> 32);
+	EmAliasUInt32<LAS> (response + 20)	= (UInt32) oldest;
+
+	ErrCode result = SystemPacket::SendPacket (slp, response, sizeof (response));
+
+	if (result == errNone && running)
+	{
+		// Resume the CPU as for a Continue packet.  Breakpoints are
+		// ignored on the way, so don't arrange to skip the one we're on.
+
+		result = Debug::ExitDebugger ();
+		gDebuggerGlobals.continueOverBP = false;
+
+		if (result == errNone)
+		{
+			Platform::ExitDebugger ();
+		}
+	}
+	else if (result == errNone && moved && status == kTimeTravelErrNone)
+	{
+		// We got there without running.  Tell the debugger what the
+		// registers look like now.
+
+		gDebuggerGlobals.excType = (UInt16) (kException_Trace * 4);
+		result = SystemPacket::SendState (slp);
+	}
+
+	PRINTF ("Exiting SystemPacket::TimeTravel.");
+
+	return result;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	SystemPacket::SendMessage
@@ -1280,3 +1866,130 @@ void SystemPacket::SetRegs (const M68KRegsType& debuggerRegs)
 	else
 		m68k_areg (regs, 7) = debuggerRegs.ssp;
 }
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvBatchValue
+ *
+ * DESCRIPTION: Return the 32-bit value at "p" in a sysPktRPCBatchCmd
+ *				packet, following it to an earlier result if it's a
+ *				chain reference.  References to results that haven't
+ *				been produced yet set state.fBadChain.
+ *
+ * PARAMETERS:	p - pointer to the value in the packet.
+ *
+ *				chained - true if the value is a chain reference.
+ *
+ *				state - the results of the batch so far.
+ *
+ * RETURNED:	The resolved value.
+ *
+ ***********************************************************************/
+
+UInt32 PrvBatchValue (const char* p, Bool chained, EmBatchState& state)
+{
+	EmAliasUInt32<LAS>	value ((void*) p);
+
+	if (!chained)
+		return value;
+
+	UInt32	ref		= value;
+	UInt16	source	= (UInt16) (ref >> 16);
+	Int16	adjust	= (Int16) (ref & 0x0FFFF);
+
+	if (source == kBatchRefIteration)
+		return (UInt32) state.fIteration + adjust;
+
+	UInt16	index	= source & ~kBatchRefA0;
+
+	if (index >= state.fOpIndex)
+	{
+		state.fBadChain = true;
+		return 0;
+	}
+
+	UInt32	result	= (source & kBatchRefA0) ? state.fA0[index] : state.fD0[index];
+
+	return result + adjust;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvBatchPut32
+ *
+ * DESCRIPTION: Append a 32-bit value to a sysPktRPCBatchRsp packet.
+ *
+ * PARAMETERS:	p - insertion point, advanced past the value.
+ *
+ *				value - the value to append.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvBatchPut32 (char*& p, UInt32 value)
+{
+	EmAliasUInt32<LAS>	dest (p);
+	dest = value;
+	p += sizeof (UInt32);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvUpdateLowMemChecksum
+ *
+ * DESCRIPTION: If we just altered low memory, recalculate the low-memory
+ *				checksum.
+ *
+ * PARAMETERS:	address - the start of the range that was written.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvUpdateLowMemChecksum (emuptr address)
+{
+	// Make sure we're on a ROM that has this field!  Determine this by
+	// seeing that the address of sysLowMemChecksum is below the memCardInfo
+	// fields that come after the FixedGlobals.
+	//
+	// !!! This chunk of code should be in some more generally accessible location.
+
+	if (offsetof (LowMemType, fixed.globals.sysLowMemChecksum) < EmLowMem_GetGlobal (memCardInfoP))
+	{
+		if (address < (emuptr) 0x100)
+		{
+			UInt32		checksum	= 0;
+			emuptr		csP		= EmMemNULL;
+
+			// First, calculate the checksum
+
+			while (csP < (emuptr) 0x100)
+			{
+				UInt32	data = EmMemGet32 (csP);
+
+				// Don't do these trap vectors since they change whenever the
+				// debugger is set to break on any a-trap or breakpoint.
+
+				if (csP == offsetof (M68KExcTableType, trapN[sysDispatchTrapNum]))
+					data = 0;
+
+				if (csP == offsetof (M68KExcTableType, trapN[sysDbgBreakpointTrapNum]))
+					data = 0;
+
+				if (csP == offsetof (M68KExcTableType, trace))
+					data = 0;
+
+				checksum += data;
+				csP += 4;
+			}
+
+			// Save new checksum
+
+			EmLowMem_SetGlobal (sysLowMemChecksum, checksum);
+		}
+	}
+}
@@ -30,6 +30,7 @@ class SystemPacket
 		static ErrCode			Continue			(SLP&);
 		static ErrCode			RPC 				(SLP&);
 		static ErrCode			RPC2 				(SLP&);
+		static ErrCode			RPCBatch			(SLP&);
 		static ErrCode			GetBreakpoints		(SLP&);
 		static ErrCode			SetBreakpoints		(SLP&);
 		static ErrCode			ToggleBreak 		(SLP&);
@@ -38,15 +39,18 @@ class SystemPacket
 		static ErrCode			Find				(SLP&);
 		static ErrCode			GetTrapConditions	(SLP&);
 		static ErrCode			SetTrapConditions	(SLP&);
+		static ErrCode			TimeTravel			(SLP&);
 
 		static ErrCode			SendMessage			(SLP&, const char*);
 
-	private:
-		static ErrCode			SendResponse		(SLP&, UInt8 code);
-		static ErrCode			SendPacket			(SLP&, const void* body, long bodySize);
+		// Also used by EmGDBStub.
 
 		static void 			GetRegs 			(M68KRegsType&);
 		static void 			SetRegs 			(const M68KRegsType&);
+
+	private:
+		static ErrCode			SendResponse		(SLP&, UInt8 code);
+		static ErrCode			SendPacket			(SLP&, const void* body, long bodySize);
 };
 
 #endif	// SYSTEMPACKET_H_
@@ -27,6 +27,17 @@ extern uae_u32	gStackLowWarn;
 extern uae_u32	gStackLow;
 extern uae_u32	gKernelStackOverflowed;
 
+#if CPUOP_NO_STACK_CHECKS
+
+// Used when compiling the handler set that doesn't track stacks
+// (see cpuemu_nocheck.c).
+
+#define CHECK_STACK_POINTER_ASSIGNMENT()	do { } while (0)
+#define CHECK_STACK_POINTER_DECREMENT()		do { } while (0)
+#define CHECK_STACK_POINTER_INCREMENT()		do { } while (0)
+
+#else
+
 #define CHECK_STACK_POINTER_ASSIGNMENT()		\
 do {											\
 	Software_CheckStackPointerAssignment ();	\
@@ -50,6 +61,8 @@ do {											\
 		Software_CheckKernelStack ();			\
 } while (0)
 
+#endif
+
 // Called in RTD handler
 #define compiler_flush_jsr_stack() do { ; } while (0)
 
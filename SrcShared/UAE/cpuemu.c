@@ -15,7 +15,7 @@
 #endif
 
 #ifdef PART_1
-unsigned long REGPARAM2 op_0_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_0_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -28,7 +28,7 @@ unsigned long REGPARAM2 op_0_3(uae_u32 opcode) /* OR */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_10_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_10_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -42,7 +42,7 @@ unsigned long REGPARAM2 op_10_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_18_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_18_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -57,7 +57,7 @@ unsigned long REGPARAM2 op_18_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_20_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_20_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -73,7 +73,7 @@ unsigned long REGPARAM2 op_20_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_28_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_28_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -87,7 +87,7 @@ unsigned long REGPARAM2 op_28_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_30_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_30_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -101,7 +101,7 @@ unsigned long REGPARAM2 op_30_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_38_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_38_3)(uae_u32 opcode) /* OR */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -114,7 +114,7 @@ unsigned long REGPARAM2 op_38_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_39_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_39_3)(uae_u32 opcode) /* OR */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_ilong(4);
@@ -127,7 +127,7 @@ unsigned long REGPARAM2 op_39_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_3c_3(uae_u32 opcode) /* ORSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_3c_3)(uae_u32 opcode) /* ORSR */
 {
 {	MakeSR();
 {	uae_s16 src = get_iword(2);
@@ -137,7 +137,7 @@ unsigned long REGPARAM2 op_3c_3(uae_u32 opcode) /* ORSR */
 }}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_40_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_40_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -150,7 +150,7 @@ unsigned long REGPARAM2 op_40_3(uae_u32 opcode) /* OR */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_50_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_50_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -164,7 +164,7 @@ unsigned long REGPARAM2 op_50_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_58_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_58_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -179,7 +179,7 @@ unsigned long REGPARAM2 op_58_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_60_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_60_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -195,7 +195,7 @@ unsigned long REGPARAM2 op_60_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_68_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_68_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -209,7 +209,7 @@ unsigned long REGPARAM2 op_68_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_70_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_70_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -223,7 +223,7 @@ unsigned long REGPARAM2 op_70_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_78_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_78_3)(uae_u32 opcode) /* OR */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -236,7 +236,7 @@ unsigned long REGPARAM2 op_78_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_79_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_79_3)(uae_u32 opcode) /* OR */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
@@ -249,7 +249,7 @@ unsigned long REGPARAM2 op_79_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_7c_3(uae_u32 opcode) /* ORSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_7c_3)(uae_u32 opcode) /* ORSR */
 {
 {if (!regs.s) { Exception(8,0); goto endlabel18; }
 {	MakeSR();
@@ -260,7 +260,7 @@ unsigned long REGPARAM2 op_7c_3(uae_u32 opcode) /* ORSR */
 endlabel18: ;
 return 4;
 }
-unsigned long REGPARAM2 op_80_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_80_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -273,7 +273,7 @@ unsigned long REGPARAM2 op_80_3(uae_u32 opcode) /* OR */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_90_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_90_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -287,7 +287,7 @@ unsigned long REGPARAM2 op_90_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_98_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_98_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -302,7 +302,7 @@ unsigned long REGPARAM2 op_98_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_a0_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a0_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -318,7 +318,7 @@ unsigned long REGPARAM2 op_a0_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_a8_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a8_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -332,7 +332,7 @@ unsigned long REGPARAM2 op_a8_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_b0_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -346,7 +346,7 @@ unsigned long REGPARAM2 op_b0_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_b8_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b8_3)(uae_u32 opcode) /* OR */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
@@ -359,7 +359,7 @@ unsigned long REGPARAM2 op_b8_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_b9_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b9_3)(uae_u32 opcode) /* OR */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_ilong(6);
@@ -372,7 +372,7 @@ unsigned long REGPARAM2 op_b9_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(10);
 return 18;
 }
-unsigned long REGPARAM2 op_100_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_100_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -383,7 +383,7 @@ unsigned long REGPARAM2 op_100_3(uae_u32 opcode) /* BTST */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_108_3(uae_u32 opcode) /* MVPMR */
+unsigned long REGPARAM2 CPUOP_NAME(op_108_3)(uae_u32 opcode) /* MVPMR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -393,7 +393,7 @@ unsigned long REGPARAM2 op_108_3(uae_u32 opcode) /* MVPMR */
 }}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_110_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_110_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -405,7 +405,7 @@ unsigned long REGPARAM2 op_110_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_118_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_118_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -418,7 +418,7 @@ unsigned long REGPARAM2 op_118_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_120_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_120_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -432,7 +432,7 @@ unsigned long REGPARAM2 op_120_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_128_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_128_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -444,7 +444,7 @@ unsigned long REGPARAM2 op_128_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_130_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_130_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -456,7 +456,7 @@ unsigned long REGPARAM2 op_130_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_138_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_138_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -467,7 +467,7 @@ unsigned long REGPARAM2 op_138_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_139_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_139_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -478,7 +478,7 @@ unsigned long REGPARAM2 op_139_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_13a_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_13a_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = 2;
@@ -491,7 +491,7 @@ unsigned long REGPARAM2 op_13a_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_13b_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_13b_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = 3;
@@ -504,7 +504,7 @@ unsigned long REGPARAM2 op_13b_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_13c_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_13c_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -514,7 +514,7 @@ unsigned long REGPARAM2 op_13c_3(uae_u32 opcode) /* BTST */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_140_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_140_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -527,7 +527,7 @@ unsigned long REGPARAM2 op_140_3(uae_u32 opcode) /* BCHG */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_148_3(uae_u32 opcode) /* MVPMR */
+unsigned long REGPARAM2 CPUOP_NAME(op_148_3)(uae_u32 opcode) /* MVPMR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -538,7 +538,7 @@ unsigned long REGPARAM2 op_148_3(uae_u32 opcode) /* MVPMR */
 }}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_150_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_150_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -552,7 +552,7 @@ unsigned long REGPARAM2 op_150_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_158_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_158_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -567,7 +567,7 @@ unsigned long REGPARAM2 op_158_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_160_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_160_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -583,7 +583,7 @@ unsigned long REGPARAM2 op_160_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_168_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_168_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -597,7 +597,7 @@ unsigned long REGPARAM2 op_168_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_170_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_170_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -611,7 +611,7 @@ unsigned long REGPARAM2 op_170_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_178_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_178_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -624,7 +624,7 @@ unsigned long REGPARAM2 op_178_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_179_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_179_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -637,7 +637,7 @@ unsigned long REGPARAM2 op_179_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_17a_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_17a_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = 2;
@@ -652,7 +652,7 @@ unsigned long REGPARAM2 op_17a_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_17b_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_17b_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = 3;
@@ -667,7 +667,7 @@ unsigned long REGPARAM2 op_17b_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_180_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_180_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -680,7 +680,7 @@ unsigned long REGPARAM2 op_180_3(uae_u32 opcode) /* BCLR */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_188_3(uae_u32 opcode) /* MVPRM */
+unsigned long REGPARAM2 CPUOP_NAME(op_188_3)(uae_u32 opcode) /* MVPRM */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -690,7 +690,7 @@ unsigned long REGPARAM2 op_188_3(uae_u32 opcode) /* MVPRM */
 }}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_190_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_190_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -704,7 +704,7 @@ unsigned long REGPARAM2 op_190_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_198_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_198_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -719,7 +719,7 @@ unsigned long REGPARAM2 op_198_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_1a0_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_1a0_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -735,7 +735,7 @@ unsigned long REGPARAM2 op_1a0_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_1a8_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_1a8_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -749,7 +749,7 @@ unsigned long REGPARAM2 op_1a8_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1b0_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_1b0_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -763,7 +763,7 @@ unsigned long REGPARAM2 op_1b0_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1b8_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_1b8_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -776,7 +776,7 @@ unsigned long REGPARAM2 op_1b8_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1b9_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_1b9_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -789,7 +789,7 @@ unsigned long REGPARAM2 op_1b9_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_1ba_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_1ba_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = 2;
@@ -804,7 +804,7 @@ unsigned long REGPARAM2 op_1ba_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1bb_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_1bb_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = 3;
@@ -819,7 +819,7 @@ unsigned long REGPARAM2 op_1bb_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1c0_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_1c0_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -832,7 +832,7 @@ unsigned long REGPARAM2 op_1c0_3(uae_u32 opcode) /* BSET */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_1c8_3(uae_u32 opcode) /* MVPRM */
+unsigned long REGPARAM2 CPUOP_NAME(op_1c8_3)(uae_u32 opcode) /* MVPRM */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -843,7 +843,7 @@ unsigned long REGPARAM2 op_1c8_3(uae_u32 opcode) /* MVPRM */
 }}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_1d0_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_1d0_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -857,7 +857,7 @@ unsigned long REGPARAM2 op_1d0_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_1d8_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_1d8_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -872,7 +872,7 @@ unsigned long REGPARAM2 op_1d8_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_1e0_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_1e0_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -888,7 +888,7 @@ unsigned long REGPARAM2 op_1e0_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_1e8_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_1e8_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -902,7 +902,7 @@ unsigned long REGPARAM2 op_1e8_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1f0_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_1f0_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -916,7 +916,7 @@ unsigned long REGPARAM2 op_1f0_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1f8_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_1f8_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -929,7 +929,7 @@ unsigned long REGPARAM2 op_1f8_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1f9_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_1f9_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -942,7 +942,7 @@ unsigned long REGPARAM2 op_1f9_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_1fa_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_1fa_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = 2;
@@ -957,7 +957,7 @@ unsigned long REGPARAM2 op_1fa_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1fb_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_1fb_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = 3;
@@ -972,7 +972,7 @@ unsigned long REGPARAM2 op_1fb_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_200_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_200_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -985,7 +985,7 @@ unsigned long REGPARAM2 op_200_3(uae_u32 opcode) /* AND */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_210_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_210_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -999,7 +999,7 @@ unsigned long REGPARAM2 op_210_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_218_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_218_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1014,7 +1014,7 @@ unsigned long REGPARAM2 op_218_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_220_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_220_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1030,7 +1030,7 @@ unsigned long REGPARAM2 op_220_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_228_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_228_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1044,7 +1044,7 @@ unsigned long REGPARAM2 op_228_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_230_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_230_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1058,7 +1058,7 @@ unsigned long REGPARAM2 op_230_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_238_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_238_3)(uae_u32 opcode) /* AND */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -1071,7 +1071,7 @@ unsigned long REGPARAM2 op_238_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_239_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_239_3)(uae_u32 opcode) /* AND */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_ilong(4);
@@ -1084,7 +1084,7 @@ unsigned long REGPARAM2 op_239_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_23c_3(uae_u32 opcode) /* ANDSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_23c_3)(uae_u32 opcode) /* ANDSR */
 {
 {	MakeSR();
 {	uae_s16 src = get_iword(2);
@@ -1094,7 +1094,7 @@ unsigned long REGPARAM2 op_23c_3(uae_u32 opcode) /* ANDSR */
 }}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_240_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_240_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1107,7 +1107,7 @@ unsigned long REGPARAM2 op_240_3(uae_u32 opcode) /* AND */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_250_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_250_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1121,7 +1121,7 @@ unsigned long REGPARAM2 op_250_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_258_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_258_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1136,7 +1136,7 @@ unsigned long REGPARAM2 op_258_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_260_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_260_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1152,7 +1152,7 @@ unsigned long REGPARAM2 op_260_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_268_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_268_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1166,7 +1166,7 @@ unsigned long REGPARAM2 op_268_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_270_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_270_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1180,7 +1180,7 @@ unsigned long REGPARAM2 op_270_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_278_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_278_3)(uae_u32 opcode) /* AND */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -1193,7 +1193,7 @@ unsigned long REGPARAM2 op_278_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_279_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_279_3)(uae_u32 opcode) /* AND */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
@@ -1206,7 +1206,7 @@ unsigned long REGPARAM2 op_279_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_27c_3(uae_u32 opcode) /* ANDSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_27c_3)(uae_u32 opcode) /* ANDSR */
 {
 {if (!regs.s) { Exception(8,0); goto endlabel89; }
 {	MakeSR();
@@ -1217,7 +1217,7 @@ unsigned long REGPARAM2 op_27c_3(uae_u32 opcode) /* ANDSR */
 endlabel89: ;
 return 4;
 }
-unsigned long REGPARAM2 op_280_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_280_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -1230,7 +1230,7 @@ unsigned long REGPARAM2 op_280_3(uae_u32 opcode) /* AND */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_290_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_290_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -1244,7 +1244,7 @@ unsigned long REGPARAM2 op_290_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_298_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_298_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -1259,7 +1259,7 @@ unsigned long REGPARAM2 op_298_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_2a0_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_2a0_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -1275,7 +1275,7 @@ unsigned long REGPARAM2 op_2a0_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_2a8_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_2a8_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -1289,7 +1289,7 @@ unsigned long REGPARAM2 op_2a8_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_2b0_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_2b0_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -1303,7 +1303,7 @@ unsigned long REGPARAM2 op_2b0_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_2b8_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_2b8_3)(uae_u32 opcode) /* AND */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
@@ -1316,7 +1316,7 @@ unsigned long REGPARAM2 op_2b8_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_2b9_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_2b9_3)(uae_u32 opcode) /* AND */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_ilong(6);
@@ -1329,7 +1329,7 @@ unsigned long REGPARAM2 op_2b9_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(10);
 return 18;
 }
-unsigned long REGPARAM2 op_400_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_400_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1347,7 +1347,7 @@ unsigned long REGPARAM2 op_400_3(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_410_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_410_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1366,7 +1366,7 @@ unsigned long REGPARAM2 op_410_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_418_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_418_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1386,7 +1386,7 @@ unsigned long REGPARAM2 op_418_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_420_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_420_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1407,7 +1407,7 @@ unsigned long REGPARAM2 op_420_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_428_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_428_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1426,7 +1426,7 @@ unsigned long REGPARAM2 op_428_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_430_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_430_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1445,7 +1445,7 @@ unsigned long REGPARAM2 op_430_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_438_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_438_3)(uae_u32 opcode) /* SUB */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -1463,7 +1463,7 @@ unsigned long REGPARAM2 op_438_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_439_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_439_3)(uae_u32 opcode) /* SUB */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_ilong(4);
@@ -1481,7 +1481,7 @@ unsigned long REGPARAM2 op_439_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_440_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_440_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1499,7 +1499,7 @@ unsigned long REGPARAM2 op_440_3(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_450_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_450_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1518,7 +1518,7 @@ unsigned long REGPARAM2 op_450_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_458_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_458_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1538,7 +1538,7 @@ unsigned long REGPARAM2 op_458_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_460_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_460_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1559,7 +1559,7 @@ unsigned long REGPARAM2 op_460_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_468_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_468_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1578,7 +1578,7 @@ unsigned long REGPARAM2 op_468_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_470_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_470_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1597,7 +1597,7 @@ unsigned long REGPARAM2 op_470_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_478_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_478_3)(uae_u32 opcode) /* SUB */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -1615,7 +1615,7 @@ unsigned long REGPARAM2 op_478_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_479_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_479_3)(uae_u32 opcode) /* SUB */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
@@ -1633,7 +1633,7 @@ unsigned long REGPARAM2 op_479_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_480_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_480_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -1651,7 +1651,7 @@ unsigned long REGPARAM2 op_480_3(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_490_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_490_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -1670,7 +1670,7 @@ unsigned long REGPARAM2 op_490_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_498_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_498_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -1690,7 +1690,7 @@ unsigned long REGPARAM2 op_498_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_4a0_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a0_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -1711,7 +1711,7 @@ unsigned long REGPARAM2 op_4a0_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_4a8_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a8_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -1730,7 +1730,7 @@ unsigned long REGPARAM2 op_4a8_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_4b0_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_4b0_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -1749,7 +1749,7 @@ unsigned long REGPARAM2 op_4b0_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_4b8_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_4b8_3)(uae_u32 opcode) /* SUB */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
@@ -1767,7 +1767,7 @@ unsigned long REGPARAM2 op_4b8_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_4b9_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_4b9_3)(uae_u32 opcode) /* SUB */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_ilong(6);
@@ -1785,7 +1785,7 @@ unsigned long REGPARAM2 op_4b9_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(10);
 return 18;
 }
-unsigned long REGPARAM2 op_600_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_600_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1803,7 +1803,7 @@ unsigned long REGPARAM2 op_600_3(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_610_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_610_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1822,7 +1822,7 @@ unsigned long REGPARAM2 op_610_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_618_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_618_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1842,7 +1842,7 @@ unsigned long REGPARAM2 op_618_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_620_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_620_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1863,7 +1863,7 @@ unsigned long REGPARAM2 op_620_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_628_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_628_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1882,7 +1882,7 @@ unsigned long REGPARAM2 op_628_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_630_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_630_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -1901,7 +1901,7 @@ unsigned long REGPARAM2 op_630_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_638_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_638_3)(uae_u32 opcode) /* ADD */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -1919,7 +1919,7 @@ unsigned long REGPARAM2 op_638_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_639_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_639_3)(uae_u32 opcode) /* ADD */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_ilong(4);
@@ -1937,7 +1937,7 @@ unsigned long REGPARAM2 op_639_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_640_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_640_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1955,7 +1955,7 @@ unsigned long REGPARAM2 op_640_3(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_650_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_650_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1974,7 +1974,7 @@ unsigned long REGPARAM2 op_650_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_658_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_658_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -1994,7 +1994,7 @@ unsigned long REGPARAM2 op_658_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_660_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_660_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2015,7 +2015,7 @@ unsigned long REGPARAM2 op_660_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_668_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_668_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2034,7 +2034,7 @@ unsigned long REGPARAM2 op_668_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_670_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_670_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2053,7 +2053,7 @@ unsigned long REGPARAM2 op_670_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_678_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_678_3)(uae_u32 opcode) /* ADD */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -2071,7 +2071,7 @@ unsigned long REGPARAM2 op_678_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_679_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_679_3)(uae_u32 opcode) /* ADD */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
@@ -2089,7 +2089,7 @@ unsigned long REGPARAM2 op_679_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_680_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_680_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -2107,7 +2107,7 @@ unsigned long REGPARAM2 op_680_3(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_690_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_690_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -2126,7 +2126,7 @@ unsigned long REGPARAM2 op_690_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_698_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_698_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -2146,7 +2146,7 @@ unsigned long REGPARAM2 op_698_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_6a0_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_6a0_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -2167,7 +2167,7 @@ unsigned long REGPARAM2 op_6a0_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_6a8_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_6a8_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -2186,7 +2186,7 @@ unsigned long REGPARAM2 op_6a8_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_6b0_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_6b0_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -2205,7 +2205,7 @@ unsigned long REGPARAM2 op_6b0_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_6b8_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_6b8_3)(uae_u32 opcode) /* ADD */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
@@ -2223,7 +2223,7 @@ unsigned long REGPARAM2 op_6b8_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_6b9_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_6b9_3)(uae_u32 opcode) /* ADD */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_ilong(6);
@@ -2241,7 +2241,7 @@ unsigned long REGPARAM2 op_6b9_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(10);
 return 18;
 }
-unsigned long REGPARAM2 op_800_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_800_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2251,7 +2251,7 @@ unsigned long REGPARAM2 op_800_3(uae_u32 opcode) /* BTST */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_810_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_810_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2262,7 +2262,7 @@ unsigned long REGPARAM2 op_810_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_818_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_818_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2274,7 +2274,7 @@ unsigned long REGPARAM2 op_818_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_820_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_820_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2287,7 +2287,7 @@ unsigned long REGPARAM2 op_820_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_828_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_828_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2298,7 +2298,7 @@ unsigned long REGPARAM2 op_828_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_830_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_830_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2309,7 +2309,7 @@ unsigned long REGPARAM2 op_830_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_838_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_838_3)(uae_u32 opcode) /* BTST */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -2319,7 +2319,7 @@ unsigned long REGPARAM2 op_838_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_839_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_839_3)(uae_u32 opcode) /* BTST */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
@@ -2329,7 +2329,7 @@ unsigned long REGPARAM2 op_839_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(8);
 return 10;
 }
-unsigned long REGPARAM2 op_83a_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_83a_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = 2;
 {{	uae_s16 src = get_iword(2);
@@ -2341,7 +2341,7 @@ unsigned long REGPARAM2 op_83a_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_83b_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_83b_3)(uae_u32 opcode) /* BTST */
 {
 	uae_u32 dstreg = 3;
 {{	uae_s16 src = get_iword(2);
@@ -2353,7 +2353,7 @@ unsigned long REGPARAM2 op_83b_3(uae_u32 opcode) /* BTST */
 }}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_83c_3(uae_u32 opcode) /* BTST */
+unsigned long REGPARAM2 CPUOP_NAME(op_83c_3)(uae_u32 opcode) /* BTST */
 {
 {{	uae_s16 src = get_iword(2);
 {	uae_s8 dst = get_ibyte(4);
@@ -2362,7 +2362,7 @@ unsigned long REGPARAM2 op_83c_3(uae_u32 opcode) /* BTST */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_840_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_840_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2374,7 +2374,7 @@ unsigned long REGPARAM2 op_840_3(uae_u32 opcode) /* BCHG */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_850_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_850_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2387,7 +2387,7 @@ unsigned long REGPARAM2 op_850_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_858_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_858_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2401,7 +2401,7 @@ unsigned long REGPARAM2 op_858_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_860_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_860_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2416,7 +2416,7 @@ unsigned long REGPARAM2 op_860_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_868_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_868_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2429,7 +2429,7 @@ unsigned long REGPARAM2 op_868_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_870_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_870_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2442,7 +2442,7 @@ unsigned long REGPARAM2 op_870_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_878_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_878_3)(uae_u32 opcode) /* BCHG */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -2454,7 +2454,7 @@ unsigned long REGPARAM2 op_878_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_879_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_879_3)(uae_u32 opcode) /* BCHG */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
@@ -2466,7 +2466,7 @@ unsigned long REGPARAM2 op_879_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_87a_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_87a_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 dstreg = 2;
 {{	uae_s16 src = get_iword(2);
@@ -2480,7 +2480,7 @@ unsigned long REGPARAM2 op_87a_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_87b_3(uae_u32 opcode) /* BCHG */
+unsigned long REGPARAM2 CPUOP_NAME(op_87b_3)(uae_u32 opcode) /* BCHG */
 {
 	uae_u32 dstreg = 3;
 {{	uae_s16 src = get_iword(2);
@@ -2494,7 +2494,7 @@ unsigned long REGPARAM2 op_87b_3(uae_u32 opcode) /* BCHG */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_880_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_880_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2506,7 +2506,7 @@ unsigned long REGPARAM2 op_880_3(uae_u32 opcode) /* BCLR */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_890_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_890_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2519,7 +2519,7 @@ unsigned long REGPARAM2 op_890_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_898_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_898_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2533,7 +2533,7 @@ unsigned long REGPARAM2 op_898_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_8a0_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8a0_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2548,7 +2548,7 @@ unsigned long REGPARAM2 op_8a0_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_8a8_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8a8_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2561,7 +2561,7 @@ unsigned long REGPARAM2 op_8a8_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_8b0_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8b0_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2574,7 +2574,7 @@ unsigned long REGPARAM2 op_8b0_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_8b8_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8b8_3)(uae_u32 opcode) /* BCLR */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -2586,7 +2586,7 @@ unsigned long REGPARAM2 op_8b8_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_8b9_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8b9_3)(uae_u32 opcode) /* BCLR */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
@@ -2598,7 +2598,7 @@ unsigned long REGPARAM2 op_8b9_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_8ba_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8ba_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 dstreg = 2;
 {{	uae_s16 src = get_iword(2);
@@ -2612,7 +2612,7 @@ unsigned long REGPARAM2 op_8ba_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_8bb_3(uae_u32 opcode) /* BCLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8bb_3)(uae_u32 opcode) /* BCLR */
 {
 	uae_u32 dstreg = 3;
 {{	uae_s16 src = get_iword(2);
@@ -2626,7 +2626,7 @@ unsigned long REGPARAM2 op_8bb_3(uae_u32 opcode) /* BCLR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_8c0_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_8c0_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2638,7 +2638,7 @@ unsigned long REGPARAM2 op_8c0_3(uae_u32 opcode) /* BSET */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_8d0_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_8d0_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2651,7 +2651,7 @@ unsigned long REGPARAM2 op_8d0_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_8d8_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_8d8_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2665,7 +2665,7 @@ unsigned long REGPARAM2 op_8d8_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_8e0_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_8e0_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2680,7 +2680,7 @@ unsigned long REGPARAM2 op_8e0_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_8e8_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_8e8_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2693,7 +2693,7 @@ unsigned long REGPARAM2 op_8e8_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_8f0_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_8f0_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2706,7 +2706,7 @@ unsigned long REGPARAM2 op_8f0_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_8f8_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_8f8_3)(uae_u32 opcode) /* BSET */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -2718,7 +2718,7 @@ unsigned long REGPARAM2 op_8f8_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_8f9_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_8f9_3)(uae_u32 opcode) /* BSET */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
@@ -2730,7 +2730,7 @@ unsigned long REGPARAM2 op_8f9_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_8fa_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_8fa_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 dstreg = 2;
 {{	uae_s16 src = get_iword(2);
@@ -2744,7 +2744,7 @@ unsigned long REGPARAM2 op_8fa_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_8fb_3(uae_u32 opcode) /* BSET */
+unsigned long REGPARAM2 CPUOP_NAME(op_8fb_3)(uae_u32 opcode) /* BSET */
 {
 	uae_u32 dstreg = 3;
 {{	uae_s16 src = get_iword(2);
@@ -2758,7 +2758,7 @@ unsigned long REGPARAM2 op_8fb_3(uae_u32 opcode) /* BSET */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_a00_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a00_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -2771,7 +2771,7 @@ unsigned long REGPARAM2 op_a00_3(uae_u32 opcode) /* EOR */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_a10_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a10_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -2785,7 +2785,7 @@ unsigned long REGPARAM2 op_a10_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_a18_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a18_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -2800,7 +2800,7 @@ unsigned long REGPARAM2 op_a18_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_a20_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a20_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -2816,7 +2816,7 @@ unsigned long REGPARAM2 op_a20_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_a28_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a28_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -2830,7 +2830,7 @@ unsigned long REGPARAM2 op_a28_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_a30_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a30_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -2844,7 +2844,7 @@ unsigned long REGPARAM2 op_a30_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_a38_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a38_3)(uae_u32 opcode) /* EOR */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -2857,7 +2857,7 @@ unsigned long REGPARAM2 op_a38_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_a39_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a39_3)(uae_u32 opcode) /* EOR */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_ilong(4);
@@ -2870,7 +2870,7 @@ unsigned long REGPARAM2 op_a39_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_a3c_3(uae_u32 opcode) /* EORSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a3c_3)(uae_u32 opcode) /* EORSR */
 {
 {	MakeSR();
 {	uae_s16 src = get_iword(2);
@@ -2880,7 +2880,7 @@ unsigned long REGPARAM2 op_a3c_3(uae_u32 opcode) /* EORSR */
 }}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_a40_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a40_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2893,7 +2893,7 @@ unsigned long REGPARAM2 op_a40_3(uae_u32 opcode) /* EOR */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_a50_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a50_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2907,7 +2907,7 @@ unsigned long REGPARAM2 op_a50_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_a58_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a58_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2922,7 +2922,7 @@ unsigned long REGPARAM2 op_a58_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_a60_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a60_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2938,7 +2938,7 @@ unsigned long REGPARAM2 op_a60_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_a68_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a68_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2952,7 +2952,7 @@ unsigned long REGPARAM2 op_a68_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_a70_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a70_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -2969,7 +2969,7 @@ return 10;
 #endif
 
 #ifdef PART_2
-unsigned long REGPARAM2 op_a78_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a78_3)(uae_u32 opcode) /* EOR */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -2982,7 +2982,7 @@ unsigned long REGPARAM2 op_a78_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_a79_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a79_3)(uae_u32 opcode) /* EOR */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
@@ -2995,7 +2995,7 @@ unsigned long REGPARAM2 op_a79_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_a7c_3(uae_u32 opcode) /* EORSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a7c_3)(uae_u32 opcode) /* EORSR */
 {
 {if (!regs.s) { Exception(8,0); goto endlabel204; }
 {	MakeSR();
@@ -3006,7 +3006,7 @@ unsigned long REGPARAM2 op_a7c_3(uae_u32 opcode) /* EORSR */
 endlabel204: ;
 return 4;
 }
-unsigned long REGPARAM2 op_a80_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a80_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -3019,7 +3019,7 @@ unsigned long REGPARAM2 op_a80_3(uae_u32 opcode) /* EOR */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_a90_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a90_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -3033,7 +3033,7 @@ unsigned long REGPARAM2 op_a90_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_a98_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_a98_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -3048,7 +3048,7 @@ unsigned long REGPARAM2 op_a98_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_aa0_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_aa0_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -3064,7 +3064,7 @@ unsigned long REGPARAM2 op_aa0_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_aa8_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_aa8_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -3078,7 +3078,7 @@ unsigned long REGPARAM2 op_aa8_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_ab0_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_ab0_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -3092,7 +3092,7 @@ unsigned long REGPARAM2 op_ab0_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_ab8_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_ab8_3)(uae_u32 opcode) /* EOR */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
@@ -3105,7 +3105,7 @@ unsigned long REGPARAM2 op_ab8_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_ab9_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_ab9_3)(uae_u32 opcode) /* EOR */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_ilong(6);
@@ -3118,7 +3118,7 @@ unsigned long REGPARAM2 op_ab9_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(10);
 return 18;
 }
-unsigned long REGPARAM2 op_c00_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c00_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -3134,7 +3134,7 @@ unsigned long REGPARAM2 op_c00_3(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_c10_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c10_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -3151,7 +3151,7 @@ unsigned long REGPARAM2 op_c10_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c18_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c18_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -3169,7 +3169,7 @@ unsigned long REGPARAM2 op_c18_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c20_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c20_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -3188,7 +3188,7 @@ unsigned long REGPARAM2 op_c20_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c28_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c28_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -3205,7 +3205,7 @@ unsigned long REGPARAM2 op_c28_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_c30_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c30_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -3222,7 +3222,7 @@ unsigned long REGPARAM2 op_c30_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_c38_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c38_3)(uae_u32 opcode) /* CMP */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -3238,7 +3238,7 @@ unsigned long REGPARAM2 op_c38_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_c39_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c39_3)(uae_u32 opcode) /* CMP */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_ilong(4);
@@ -3254,7 +3254,7 @@ unsigned long REGPARAM2 op_c39_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(8);
 return 10;
 }
-unsigned long REGPARAM2 op_c3a_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c3a_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 2;
 {{	uae_s8 src = get_ibyte(2);
@@ -3272,7 +3272,7 @@ unsigned long REGPARAM2 op_c3a_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_c3b_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c3b_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 3;
 {{	uae_s8 src = get_ibyte(2);
@@ -3290,7 +3290,7 @@ unsigned long REGPARAM2 op_c3b_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_c40_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c40_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -3306,7 +3306,7 @@ unsigned long REGPARAM2 op_c40_3(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_c50_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c50_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -3323,7 +3323,7 @@ unsigned long REGPARAM2 op_c50_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c58_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c58_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -3341,7 +3341,7 @@ unsigned long REGPARAM2 op_c58_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c60_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c60_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -3360,7 +3360,7 @@ unsigned long REGPARAM2 op_c60_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c68_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c68_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -3377,7 +3377,7 @@ unsigned long REGPARAM2 op_c68_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_c70_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c70_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = get_iword(2);
@@ -3394,7 +3394,7 @@ unsigned long REGPARAM2 op_c70_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_c78_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c78_3)(uae_u32 opcode) /* CMP */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -3410,7 +3410,7 @@ unsigned long REGPARAM2 op_c78_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_c79_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c79_3)(uae_u32 opcode) /* CMP */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
@@ -3426,7 +3426,7 @@ unsigned long REGPARAM2 op_c79_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(8);
 return 10;
 }
-unsigned long REGPARAM2 op_c7a_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c7a_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 2;
 {{	uae_s16 src = get_iword(2);
@@ -3444,7 +3444,7 @@ unsigned long REGPARAM2 op_c7a_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_c7b_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c7b_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 3;
 {{	uae_s16 src = get_iword(2);
@@ -3462,7 +3462,7 @@ unsigned long REGPARAM2 op_c7b_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_c80_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c80_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -3478,7 +3478,7 @@ unsigned long REGPARAM2 op_c80_3(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_c90_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c90_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -3495,7 +3495,7 @@ unsigned long REGPARAM2 op_c90_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_c98_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_c98_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -3513,7 +3513,7 @@ unsigned long REGPARAM2 op_c98_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_ca0_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_ca0_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -3532,7 +3532,7 @@ unsigned long REGPARAM2 op_ca0_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_ca8_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_ca8_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -3549,7 +3549,7 @@ unsigned long REGPARAM2 op_ca8_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_cb0_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_cb0_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -3566,7 +3566,7 @@ unsigned long REGPARAM2 op_cb0_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_cb8_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_cb8_3)(uae_u32 opcode) /* CMP */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
@@ -3582,7 +3582,7 @@ unsigned long REGPARAM2 op_cb8_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_cb9_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_cb9_3)(uae_u32 opcode) /* CMP */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_ilong(6);
@@ -3598,7 +3598,7 @@ unsigned long REGPARAM2 op_cb9_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(10);
 return 14;
 }
-unsigned long REGPARAM2 op_cba_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_cba_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 2;
 {{	uae_s32 src = get_ilong(2);
@@ -3616,7 +3616,7 @@ unsigned long REGPARAM2 op_cba_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_cbb_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_cbb_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = 3;
 {{	uae_s32 src = get_ilong(2);
@@ -3634,7 +3634,7 @@ unsigned long REGPARAM2 op_cbb_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_1000_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1000_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3646,7 +3646,7 @@ unsigned long REGPARAM2 op_1000_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_1010_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1010_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3659,7 +3659,7 @@ unsigned long REGPARAM2 op_1010_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_1018_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1018_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3673,7 +3673,7 @@ unsigned long REGPARAM2 op_1018_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_1020_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1020_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3688,7 +3688,7 @@ unsigned long REGPARAM2 op_1020_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_1028_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1028_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3701,7 +3701,7 @@ unsigned long REGPARAM2 op_1028_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_1030_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1030_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3714,7 +3714,7 @@ unsigned long REGPARAM2 op_1030_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_1038_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1038_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -3726,7 +3726,7 @@ unsigned long REGPARAM2 op_1038_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_1039_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1039_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -3738,7 +3738,7 @@ unsigned long REGPARAM2 op_1039_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_103a_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_103a_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -3751,7 +3751,7 @@ unsigned long REGPARAM2 op_103a_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_103b_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_103b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -3764,7 +3764,7 @@ unsigned long REGPARAM2 op_103b_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_103c_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_103c_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -3775,7 +3775,7 @@ unsigned long REGPARAM2 op_103c_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_1080_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1080_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3788,7 +3788,7 @@ unsigned long REGPARAM2 op_1080_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_1090_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1090_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3802,7 +3802,7 @@ unsigned long REGPARAM2 op_1090_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_1098_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1098_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3817,7 +3817,7 @@ unsigned long REGPARAM2 op_1098_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_10a0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10a0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3833,7 +3833,7 @@ unsigned long REGPARAM2 op_10a0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_10a8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10a8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3847,7 +3847,7 @@ unsigned long REGPARAM2 op_10a8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_10b0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10b0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3861,7 +3861,7 @@ unsigned long REGPARAM2 op_10b0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_10b8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10b8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -3874,7 +3874,7 @@ unsigned long REGPARAM2 op_10b8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_10b9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10b9_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -3887,7 +3887,7 @@ unsigned long REGPARAM2 op_10b9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_10ba_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10ba_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -3901,7 +3901,7 @@ unsigned long REGPARAM2 op_10ba_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_10bb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10bb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -3915,7 +3915,7 @@ unsigned long REGPARAM2 op_10bb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_10bc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10bc_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -3927,7 +3927,7 @@ unsigned long REGPARAM2 op_10bc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_10c0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10c0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3941,7 +3941,7 @@ unsigned long REGPARAM2 op_10c0_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_10d0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10d0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3956,7 +3956,7 @@ unsigned long REGPARAM2 op_10d0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_10d8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10d8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3972,7 +3972,7 @@ unsigned long REGPARAM2 op_10d8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_10e0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10e0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -3989,7 +3989,7 @@ unsigned long REGPARAM2 op_10e0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_10e8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10e8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4004,7 +4004,7 @@ unsigned long REGPARAM2 op_10e8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_10f0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4019,7 +4019,7 @@ unsigned long REGPARAM2 op_10f0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_10f8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10f8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -4033,7 +4033,7 @@ unsigned long REGPARAM2 op_10f8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_10f9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10f9_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -4047,7 +4047,7 @@ unsigned long REGPARAM2 op_10f9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_10fa_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10fa_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -4062,7 +4062,7 @@ unsigned long REGPARAM2 op_10fa_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_10fb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10fb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -4077,7 +4077,7 @@ unsigned long REGPARAM2 op_10fb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_10fc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_10fc_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -4090,7 +4090,7 @@ unsigned long REGPARAM2 op_10fc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_1100_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1100_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4105,7 +4105,7 @@ unsigned long REGPARAM2 op_1100_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_1110_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1110_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4121,7 +4121,7 @@ unsigned long REGPARAM2 op_1110_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_1118_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1118_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4138,7 +4138,7 @@ unsigned long REGPARAM2 op_1118_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_1120_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1120_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4156,7 +4156,7 @@ unsigned long REGPARAM2 op_1120_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_1128_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1128_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4172,7 +4172,7 @@ unsigned long REGPARAM2 op_1128_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1130_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1130_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4188,7 +4188,7 @@ unsigned long REGPARAM2 op_1130_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1138_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1138_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -4203,7 +4203,7 @@ unsigned long REGPARAM2 op_1138_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1139_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1139_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -4218,7 +4218,7 @@ unsigned long REGPARAM2 op_1139_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_113a_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_113a_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -4234,7 +4234,7 @@ unsigned long REGPARAM2 op_113a_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_113b_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_113b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -4250,7 +4250,7 @@ unsigned long REGPARAM2 op_113b_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_113c_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_113c_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -4264,7 +4264,7 @@ unsigned long REGPARAM2 op_113c_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_1140_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1140_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4277,7 +4277,7 @@ unsigned long REGPARAM2 op_1140_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_1150_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1150_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4291,7 +4291,7 @@ unsigned long REGPARAM2 op_1150_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1158_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1158_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4306,7 +4306,7 @@ unsigned long REGPARAM2 op_1158_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1160_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1160_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4322,7 +4322,7 @@ unsigned long REGPARAM2 op_1160_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1168_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1168_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4336,7 +4336,7 @@ unsigned long REGPARAM2 op_1168_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_1170_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1170_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4350,7 +4350,7 @@ unsigned long REGPARAM2 op_1170_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_1178_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1178_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -4363,7 +4363,7 @@ unsigned long REGPARAM2 op_1178_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_1179_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1179_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -4376,7 +4376,7 @@ unsigned long REGPARAM2 op_1179_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_117a_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_117a_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -4390,7 +4390,7 @@ unsigned long REGPARAM2 op_117a_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_117b_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_117b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -4404,7 +4404,7 @@ unsigned long REGPARAM2 op_117b_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_117c_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_117c_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -4416,7 +4416,7 @@ unsigned long REGPARAM2 op_117c_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_1180_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1180_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4429,7 +4429,7 @@ unsigned long REGPARAM2 op_1180_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_1190_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1190_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4443,7 +4443,7 @@ unsigned long REGPARAM2 op_1190_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_1198_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_1198_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4458,7 +4458,7 @@ unsigned long REGPARAM2 op_1198_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_11a0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11a0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4474,7 +4474,7 @@ unsigned long REGPARAM2 op_11a0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_11a8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11a8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4488,7 +4488,7 @@ unsigned long REGPARAM2 op_11a8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_11b0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11b0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4502,7 +4502,7 @@ unsigned long REGPARAM2 op_11b0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_11b8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11b8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -4515,7 +4515,7 @@ unsigned long REGPARAM2 op_11b8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_11b9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11b9_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -4528,7 +4528,7 @@ unsigned long REGPARAM2 op_11b9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_11ba_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11ba_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -4542,7 +4542,7 @@ unsigned long REGPARAM2 op_11ba_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_11bb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11bb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -4556,7 +4556,7 @@ unsigned long REGPARAM2 op_11bb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_11bc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11bc_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -4568,7 +4568,7 @@ unsigned long REGPARAM2 op_11bc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_11c0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11c0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -4580,7 +4580,7 @@ unsigned long REGPARAM2 op_11c0_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_11d0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11d0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -4593,7 +4593,7 @@ unsigned long REGPARAM2 op_11d0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_11d8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11d8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -4607,7 +4607,7 @@ unsigned long REGPARAM2 op_11d8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_11e0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11e0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -4622,7 +4622,7 @@ unsigned long REGPARAM2 op_11e0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_11e8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11e8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -4635,7 +4635,7 @@ unsigned long REGPARAM2 op_11e8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_11f0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -4648,7 +4648,7 @@ unsigned long REGPARAM2 op_11f0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_11f8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11f8_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
@@ -4660,7 +4660,7 @@ unsigned long REGPARAM2 op_11f8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_11f9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11f9_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
@@ -4672,7 +4672,7 @@ unsigned long REGPARAM2 op_11f9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_11fa_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11fa_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
@@ -4685,7 +4685,7 @@ unsigned long REGPARAM2 op_11fa_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_11fb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11fb_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
@@ -4698,7 +4698,7 @@ unsigned long REGPARAM2 op_11fb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_11fc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_11fc_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -4709,7 +4709,7 @@ unsigned long REGPARAM2 op_11fc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_13c0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_13c0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -4721,7 +4721,7 @@ unsigned long REGPARAM2 op_13c0_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_13d0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_13d0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -4734,7 +4734,7 @@ unsigned long REGPARAM2 op_13d0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_13d8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_13d8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -4748,7 +4748,7 @@ unsigned long REGPARAM2 op_13d8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_13e0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_13e0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -4763,7 +4763,7 @@ unsigned long REGPARAM2 op_13e0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_13e8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_13e8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -4776,7 +4776,7 @@ unsigned long REGPARAM2 op_13e8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_13f0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_13f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -4789,7 +4789,7 @@ unsigned long REGPARAM2 op_13f0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_13f8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_13f8_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
@@ -4801,7 +4801,7 @@ unsigned long REGPARAM2 op_13f8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_13f9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_13f9_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
@@ -4813,7 +4813,7 @@ unsigned long REGPARAM2 op_13f9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(10);
 return 14;
 }
-unsigned long REGPARAM2 op_13fa_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_13fa_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
@@ -4826,7 +4826,7 @@ unsigned long REGPARAM2 op_13fa_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_13fb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_13fb_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
@@ -4839,7 +4839,7 @@ unsigned long REGPARAM2 op_13fb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_13fc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_13fc_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_ilong(4);
@@ -4850,7 +4850,7 @@ unsigned long REGPARAM2 op_13fc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(8);
 return 10;
 }
-unsigned long REGPARAM2 op_2000_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2000_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4862,7 +4862,7 @@ unsigned long REGPARAM2 op_2000_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_2008_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2008_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4874,7 +4874,7 @@ unsigned long REGPARAM2 op_2008_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_2010_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2010_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4887,7 +4887,7 @@ unsigned long REGPARAM2 op_2010_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_2018_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2018_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4901,7 +4901,7 @@ unsigned long REGPARAM2 op_2018_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_2020_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2020_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4916,7 +4916,7 @@ unsigned long REGPARAM2 op_2020_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_2028_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2028_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4929,7 +4929,7 @@ unsigned long REGPARAM2 op_2028_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_2030_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2030_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -4942,7 +4942,7 @@ unsigned long REGPARAM2 op_2030_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_2038_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2038_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -4954,7 +4954,7 @@ unsigned long REGPARAM2 op_2038_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_2039_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2039_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -4966,7 +4966,7 @@ unsigned long REGPARAM2 op_2039_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_203a_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_203a_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -4979,7 +4979,7 @@ unsigned long REGPARAM2 op_203a_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_203b_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_203b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -4992,7 +4992,7 @@ unsigned long REGPARAM2 op_203b_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_203c_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_203c_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -5003,7 +5003,7 @@ unsigned long REGPARAM2 op_203c_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_2040_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_2040_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5014,7 +5014,7 @@ unsigned long REGPARAM2 op_2040_3(uae_u32 opcode) /* MOVEA */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_2048_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_2048_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5025,7 +5025,7 @@ unsigned long REGPARAM2 op_2048_3(uae_u32 opcode) /* MOVEA */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_2050_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_2050_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5037,7 +5037,7 @@ unsigned long REGPARAM2 op_2050_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_2058_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_2058_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5050,7 +5050,7 @@ unsigned long REGPARAM2 op_2058_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_2060_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_2060_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5064,7 +5064,7 @@ unsigned long REGPARAM2 op_2060_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_2068_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_2068_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5076,7 +5076,7 @@ unsigned long REGPARAM2 op_2068_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_2070_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_2070_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5088,7 +5088,7 @@ unsigned long REGPARAM2 op_2070_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_2078_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_2078_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -5099,7 +5099,7 @@ unsigned long REGPARAM2 op_2078_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_2079_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_2079_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -5110,7 +5110,7 @@ unsigned long REGPARAM2 op_2079_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_207a_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_207a_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -5122,7 +5122,7 @@ unsigned long REGPARAM2 op_207a_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_207b_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_207b_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -5134,7 +5134,7 @@ unsigned long REGPARAM2 op_207b_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_207c_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_207c_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -5144,7 +5144,7 @@ unsigned long REGPARAM2 op_207c_3(uae_u32 opcode) /* MOVEA */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_2080_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2080_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5157,7 +5157,7 @@ unsigned long REGPARAM2 op_2080_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_2088_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2088_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5170,7 +5170,7 @@ unsigned long REGPARAM2 op_2088_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_2090_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2090_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5184,7 +5184,7 @@ unsigned long REGPARAM2 op_2090_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_2098_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2098_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5199,7 +5199,7 @@ unsigned long REGPARAM2 op_2098_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_20a0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20a0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5215,7 +5215,7 @@ unsigned long REGPARAM2 op_20a0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_20a8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20a8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5229,7 +5229,7 @@ unsigned long REGPARAM2 op_20a8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_20b0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20b0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5243,7 +5243,7 @@ unsigned long REGPARAM2 op_20b0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_20b8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20b8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -5256,7 +5256,7 @@ unsigned long REGPARAM2 op_20b8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_20b9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20b9_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -5269,7 +5269,7 @@ unsigned long REGPARAM2 op_20b9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_20ba_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20ba_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -5283,7 +5283,7 @@ unsigned long REGPARAM2 op_20ba_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_20bb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20bb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -5297,7 +5297,7 @@ unsigned long REGPARAM2 op_20bb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_20bc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20bc_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -5309,7 +5309,7 @@ unsigned long REGPARAM2 op_20bc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_20c0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20c0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5323,7 +5323,7 @@ unsigned long REGPARAM2 op_20c0_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_20c8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20c8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5337,7 +5337,7 @@ unsigned long REGPARAM2 op_20c8_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_20d0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20d0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5352,7 +5352,7 @@ unsigned long REGPARAM2 op_20d0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_20d8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20d8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5368,7 +5368,7 @@ unsigned long REGPARAM2 op_20d8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_20e0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20e0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5385,7 +5385,7 @@ unsigned long REGPARAM2 op_20e0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_20e8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20e8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5400,7 +5400,7 @@ unsigned long REGPARAM2 op_20e8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_20f0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5415,7 +5415,7 @@ unsigned long REGPARAM2 op_20f0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_20f8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20f8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -5429,7 +5429,7 @@ unsigned long REGPARAM2 op_20f8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_20f9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20f9_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -5443,7 +5443,7 @@ unsigned long REGPARAM2 op_20f9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_20fa_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20fa_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -5458,7 +5458,7 @@ unsigned long REGPARAM2 op_20fa_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_20fb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20fb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -5473,7 +5473,7 @@ unsigned long REGPARAM2 op_20fb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_20fc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_20fc_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -5486,7 +5486,7 @@ unsigned long REGPARAM2 op_20fc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_2100_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2100_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5501,7 +5501,7 @@ unsigned long REGPARAM2 op_2100_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_2108_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2108_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5516,7 +5516,7 @@ unsigned long REGPARAM2 op_2108_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_2110_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2110_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5532,7 +5532,7 @@ unsigned long REGPARAM2 op_2110_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_2118_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2118_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5549,7 +5549,7 @@ unsigned long REGPARAM2 op_2118_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_2120_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2120_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5567,7 +5567,7 @@ unsigned long REGPARAM2 op_2120_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_2128_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2128_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5583,7 +5583,7 @@ unsigned long REGPARAM2 op_2128_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_2130_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2130_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5599,7 +5599,7 @@ unsigned long REGPARAM2 op_2130_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_2138_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2138_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -5614,7 +5614,7 @@ unsigned long REGPARAM2 op_2138_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_2139_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2139_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -5629,7 +5629,7 @@ unsigned long REGPARAM2 op_2139_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_213a_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_213a_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -5645,7 +5645,7 @@ unsigned long REGPARAM2 op_213a_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_213b_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_213b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -5664,7 +5664,7 @@ return 12;
 #endif
 
 #ifdef PART_3
-unsigned long REGPARAM2 op_213c_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_213c_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -5678,7 +5678,7 @@ unsigned long REGPARAM2 op_213c_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_2140_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2140_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5691,7 +5691,7 @@ unsigned long REGPARAM2 op_2140_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_2148_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2148_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5704,7 +5704,7 @@ unsigned long REGPARAM2 op_2148_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_2150_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2150_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5718,7 +5718,7 @@ unsigned long REGPARAM2 op_2150_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_2158_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2158_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5733,7 +5733,7 @@ unsigned long REGPARAM2 op_2158_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_2160_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2160_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5749,7 +5749,7 @@ unsigned long REGPARAM2 op_2160_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_2168_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2168_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5763,7 +5763,7 @@ unsigned long REGPARAM2 op_2168_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_2170_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2170_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5777,7 +5777,7 @@ unsigned long REGPARAM2 op_2170_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_2178_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2178_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -5790,7 +5790,7 @@ unsigned long REGPARAM2 op_2178_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_2179_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2179_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -5803,7 +5803,7 @@ unsigned long REGPARAM2 op_2179_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_217a_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_217a_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -5817,7 +5817,7 @@ unsigned long REGPARAM2 op_217a_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_217b_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_217b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -5831,7 +5831,7 @@ unsigned long REGPARAM2 op_217b_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_217c_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_217c_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -5843,7 +5843,7 @@ unsigned long REGPARAM2 op_217c_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_2180_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2180_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5856,7 +5856,7 @@ unsigned long REGPARAM2 op_2180_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_2188_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2188_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5869,7 +5869,7 @@ unsigned long REGPARAM2 op_2188_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_2190_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2190_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5883,7 +5883,7 @@ unsigned long REGPARAM2 op_2190_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_2198_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_2198_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5898,7 +5898,7 @@ unsigned long REGPARAM2 op_2198_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_21a0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21a0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5914,7 +5914,7 @@ unsigned long REGPARAM2 op_21a0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_21a8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21a8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5928,7 +5928,7 @@ unsigned long REGPARAM2 op_21a8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_21b0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21b0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -5942,7 +5942,7 @@ unsigned long REGPARAM2 op_21b0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_21b8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21b8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -5955,7 +5955,7 @@ unsigned long REGPARAM2 op_21b8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_21b9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21b9_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -5968,7 +5968,7 @@ unsigned long REGPARAM2 op_21b9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_21ba_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21ba_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -5982,7 +5982,7 @@ unsigned long REGPARAM2 op_21ba_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_21bb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21bb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -5996,7 +5996,7 @@ unsigned long REGPARAM2 op_21bb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_21bc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21bc_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -6008,7 +6008,7 @@ unsigned long REGPARAM2 op_21bc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_21c0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21c0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -6020,7 +6020,7 @@ unsigned long REGPARAM2 op_21c0_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_21c8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21c8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg(regs, srcreg);
@@ -6032,7 +6032,7 @@ unsigned long REGPARAM2 op_21c8_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_21d0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21d0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -6045,7 +6045,7 @@ unsigned long REGPARAM2 op_21d0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_21d8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21d8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -6059,7 +6059,7 @@ unsigned long REGPARAM2 op_21d8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_21e0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21e0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
@@ -6074,7 +6074,7 @@ unsigned long REGPARAM2 op_21e0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_21e8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21e8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -6087,7 +6087,7 @@ unsigned long REGPARAM2 op_21e8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_21f0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -6100,7 +6100,7 @@ unsigned long REGPARAM2 op_21f0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_21f8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21f8_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
@@ -6112,7 +6112,7 @@ unsigned long REGPARAM2 op_21f8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_21f9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21f9_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
@@ -6124,7 +6124,7 @@ unsigned long REGPARAM2 op_21f9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_21fa_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21fa_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
@@ -6137,7 +6137,7 @@ unsigned long REGPARAM2 op_21fa_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_21fb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21fb_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
@@ -6150,7 +6150,7 @@ unsigned long REGPARAM2 op_21fb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_21fc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_21fc_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
@@ -6161,7 +6161,7 @@ unsigned long REGPARAM2 op_21fc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_23c0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_23c0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -6173,7 +6173,7 @@ unsigned long REGPARAM2 op_23c0_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_23c8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_23c8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg(regs, srcreg);
@@ -6185,7 +6185,7 @@ unsigned long REGPARAM2 op_23c8_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_23d0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_23d0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -6198,7 +6198,7 @@ unsigned long REGPARAM2 op_23d0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_23d8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_23d8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -6212,7 +6212,7 @@ unsigned long REGPARAM2 op_23d8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_23e0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_23e0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
@@ -6227,7 +6227,7 @@ unsigned long REGPARAM2 op_23e0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_23e8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_23e8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -6240,7 +6240,7 @@ unsigned long REGPARAM2 op_23e8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_23f0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_23f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -6253,7 +6253,7 @@ unsigned long REGPARAM2 op_23f0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_23f8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_23f8_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
@@ -6265,7 +6265,7 @@ unsigned long REGPARAM2 op_23f8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_23f9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_23f9_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
@@ -6277,7 +6277,7 @@ unsigned long REGPARAM2 op_23f9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(10);
 return 18;
 }
-unsigned long REGPARAM2 op_23fa_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_23fa_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
@@ -6290,7 +6290,7 @@ unsigned long REGPARAM2 op_23fa_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_23fb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_23fb_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
@@ -6303,7 +6303,7 @@ unsigned long REGPARAM2 op_23fb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 16;
 }
-unsigned long REGPARAM2 op_23fc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_23fc_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_ilong(6);
@@ -6314,7 +6314,7 @@ unsigned long REGPARAM2 op_23fc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(10);
 return 14;
 }
-unsigned long REGPARAM2 op_3000_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3000_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6326,7 +6326,7 @@ unsigned long REGPARAM2 op_3000_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_3008_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3008_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6338,7 +6338,7 @@ unsigned long REGPARAM2 op_3008_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_3010_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3010_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6351,7 +6351,7 @@ unsigned long REGPARAM2 op_3010_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_3018_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3018_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6365,7 +6365,7 @@ unsigned long REGPARAM2 op_3018_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_3020_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3020_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6380,7 +6380,7 @@ unsigned long REGPARAM2 op_3020_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_3028_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3028_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6393,7 +6393,7 @@ unsigned long REGPARAM2 op_3028_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_3030_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3030_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6406,7 +6406,7 @@ unsigned long REGPARAM2 op_3030_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_3038_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3038_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -6418,7 +6418,7 @@ unsigned long REGPARAM2 op_3038_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_3039_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3039_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -6430,7 +6430,7 @@ unsigned long REGPARAM2 op_3039_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_303a_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_303a_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -6443,7 +6443,7 @@ unsigned long REGPARAM2 op_303a_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_303b_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_303b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -6456,7 +6456,7 @@ unsigned long REGPARAM2 op_303b_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_303c_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_303c_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -6467,7 +6467,7 @@ unsigned long REGPARAM2 op_303c_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_3040_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_3040_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6478,7 +6478,7 @@ unsigned long REGPARAM2 op_3040_3(uae_u32 opcode) /* MOVEA */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_3048_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_3048_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6489,7 +6489,7 @@ unsigned long REGPARAM2 op_3048_3(uae_u32 opcode) /* MOVEA */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_3050_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_3050_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6501,7 +6501,7 @@ unsigned long REGPARAM2 op_3050_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_3058_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_3058_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6514,7 +6514,7 @@ unsigned long REGPARAM2 op_3058_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_3060_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_3060_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6528,7 +6528,7 @@ unsigned long REGPARAM2 op_3060_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_3068_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_3068_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6540,7 +6540,7 @@ unsigned long REGPARAM2 op_3068_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_3070_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_3070_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6552,7 +6552,7 @@ unsigned long REGPARAM2 op_3070_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_3078_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_3078_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -6563,7 +6563,7 @@ unsigned long REGPARAM2 op_3078_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_3079_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_3079_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -6574,7 +6574,7 @@ unsigned long REGPARAM2 op_3079_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_307a_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_307a_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -6586,7 +6586,7 @@ unsigned long REGPARAM2 op_307a_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_307b_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_307b_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -6598,7 +6598,7 @@ unsigned long REGPARAM2 op_307b_3(uae_u32 opcode) /* MOVEA */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_307c_3(uae_u32 opcode) /* MOVEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_307c_3)(uae_u32 opcode) /* MOVEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -6608,7 +6608,7 @@ unsigned long REGPARAM2 op_307c_3(uae_u32 opcode) /* MOVEA */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_3080_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3080_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6621,7 +6621,7 @@ unsigned long REGPARAM2 op_3080_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_3088_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3088_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6634,7 +6634,7 @@ unsigned long REGPARAM2 op_3088_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_3090_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3090_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6648,7 +6648,7 @@ unsigned long REGPARAM2 op_3090_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_3098_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3098_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6663,7 +6663,7 @@ unsigned long REGPARAM2 op_3098_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_30a0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30a0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6679,7 +6679,7 @@ unsigned long REGPARAM2 op_30a0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_30a8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30a8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6693,7 +6693,7 @@ unsigned long REGPARAM2 op_30a8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_30b0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30b0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6707,7 +6707,7 @@ unsigned long REGPARAM2 op_30b0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_30b8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30b8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -6720,7 +6720,7 @@ unsigned long REGPARAM2 op_30b8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_30b9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30b9_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -6733,7 +6733,7 @@ unsigned long REGPARAM2 op_30b9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_30ba_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30ba_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -6747,7 +6747,7 @@ unsigned long REGPARAM2 op_30ba_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_30bb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30bb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -6761,7 +6761,7 @@ unsigned long REGPARAM2 op_30bb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_30bc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30bc_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -6773,7 +6773,7 @@ unsigned long REGPARAM2 op_30bc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_30c0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30c0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6787,7 +6787,7 @@ unsigned long REGPARAM2 op_30c0_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_30c8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30c8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6801,7 +6801,7 @@ unsigned long REGPARAM2 op_30c8_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_30d0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30d0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6816,7 +6816,7 @@ unsigned long REGPARAM2 op_30d0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_30d8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30d8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6832,7 +6832,7 @@ unsigned long REGPARAM2 op_30d8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_30e0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30e0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6849,7 +6849,7 @@ unsigned long REGPARAM2 op_30e0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_30e8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30e8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6864,7 +6864,7 @@ unsigned long REGPARAM2 op_30e8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_30f0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6879,7 +6879,7 @@ unsigned long REGPARAM2 op_30f0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_30f8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30f8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -6893,7 +6893,7 @@ unsigned long REGPARAM2 op_30f8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_30f9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30f9_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -6907,7 +6907,7 @@ unsigned long REGPARAM2 op_30f9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_30fa_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30fa_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -6922,7 +6922,7 @@ unsigned long REGPARAM2 op_30fa_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_30fb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30fb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -6937,7 +6937,7 @@ unsigned long REGPARAM2 op_30fb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_30fc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_30fc_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -6950,7 +6950,7 @@ unsigned long REGPARAM2 op_30fc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_3100_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3100_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6965,7 +6965,7 @@ unsigned long REGPARAM2 op_3100_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_3108_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3108_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6980,7 +6980,7 @@ unsigned long REGPARAM2 op_3108_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_3110_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3110_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -6996,7 +6996,7 @@ unsigned long REGPARAM2 op_3110_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_3118_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3118_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7013,7 +7013,7 @@ unsigned long REGPARAM2 op_3118_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_3120_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3120_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7031,7 +7031,7 @@ unsigned long REGPARAM2 op_3120_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_3128_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3128_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7047,7 +7047,7 @@ unsigned long REGPARAM2 op_3128_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_3130_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3130_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7063,7 +7063,7 @@ unsigned long REGPARAM2 op_3130_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_3138_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3138_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -7078,7 +7078,7 @@ unsigned long REGPARAM2 op_3138_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_3139_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3139_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -7093,7 +7093,7 @@ unsigned long REGPARAM2 op_3139_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_313a_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_313a_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -7109,7 +7109,7 @@ unsigned long REGPARAM2 op_313a_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_313b_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_313b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -7125,7 +7125,7 @@ unsigned long REGPARAM2 op_313b_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_313c_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_313c_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -7139,7 +7139,7 @@ unsigned long REGPARAM2 op_313c_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_3140_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3140_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7152,7 +7152,7 @@ unsigned long REGPARAM2 op_3140_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_3148_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3148_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7165,7 +7165,7 @@ unsigned long REGPARAM2 op_3148_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_3150_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3150_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7179,7 +7179,7 @@ unsigned long REGPARAM2 op_3150_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_3158_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3158_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7194,7 +7194,7 @@ unsigned long REGPARAM2 op_3158_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_3160_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3160_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7210,7 +7210,7 @@ unsigned long REGPARAM2 op_3160_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_3168_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3168_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7224,7 +7224,7 @@ unsigned long REGPARAM2 op_3168_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_3170_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3170_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7238,7 +7238,7 @@ unsigned long REGPARAM2 op_3170_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_3178_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3178_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -7251,7 +7251,7 @@ unsigned long REGPARAM2 op_3178_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_3179_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3179_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -7264,7 +7264,7 @@ unsigned long REGPARAM2 op_3179_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_317a_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_317a_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -7278,7 +7278,7 @@ unsigned long REGPARAM2 op_317a_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_317b_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_317b_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -7292,7 +7292,7 @@ unsigned long REGPARAM2 op_317b_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_317c_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_317c_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -7304,7 +7304,7 @@ unsigned long REGPARAM2 op_317c_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_3180_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3180_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7317,7 +7317,7 @@ unsigned long REGPARAM2 op_3180_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_3188_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3188_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7330,7 +7330,7 @@ unsigned long REGPARAM2 op_3188_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_3190_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3190_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7344,7 +7344,7 @@ unsigned long REGPARAM2 op_3190_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_3198_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_3198_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7359,7 +7359,7 @@ unsigned long REGPARAM2 op_3198_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_31a0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31a0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7375,7 +7375,7 @@ unsigned long REGPARAM2 op_31a0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_31a8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31a8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7389,7 +7389,7 @@ unsigned long REGPARAM2 op_31a8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_31b0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31b0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -7403,7 +7403,7 @@ unsigned long REGPARAM2 op_31b0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_31b8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31b8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -7416,7 +7416,7 @@ unsigned long REGPARAM2 op_31b8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_31b9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31b9_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -7429,7 +7429,7 @@ unsigned long REGPARAM2 op_31b9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_31ba_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31ba_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -7443,7 +7443,7 @@ unsigned long REGPARAM2 op_31ba_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_31bb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31bb_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -7457,7 +7457,7 @@ unsigned long REGPARAM2 op_31bb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_31bc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31bc_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -7469,7 +7469,7 @@ unsigned long REGPARAM2 op_31bc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_31c0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31c0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -7481,7 +7481,7 @@ unsigned long REGPARAM2 op_31c0_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_31c8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31c8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg(regs, srcreg);
@@ -7493,7 +7493,7 @@ unsigned long REGPARAM2 op_31c8_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_31d0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31d0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -7506,7 +7506,7 @@ unsigned long REGPARAM2 op_31d0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_31d8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31d8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -7520,7 +7520,7 @@ unsigned long REGPARAM2 op_31d8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_31e0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31e0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
@@ -7535,7 +7535,7 @@ unsigned long REGPARAM2 op_31e0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_31e8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31e8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -7548,7 +7548,7 @@ unsigned long REGPARAM2 op_31e8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_31f0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -7561,7 +7561,7 @@ unsigned long REGPARAM2 op_31f0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_31f8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31f8_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
@@ -7573,7 +7573,7 @@ unsigned long REGPARAM2 op_31f8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_31f9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31f9_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
@@ -7585,7 +7585,7 @@ unsigned long REGPARAM2 op_31f9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_31fa_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31fa_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
@@ -7598,7 +7598,7 @@ unsigned long REGPARAM2 op_31fa_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_31fb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31fb_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
@@ -7611,7 +7611,7 @@ unsigned long REGPARAM2 op_31fb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_31fc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_31fc_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
@@ -7622,7 +7622,7 @@ unsigned long REGPARAM2 op_31fc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_33c0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_33c0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -7634,7 +7634,7 @@ unsigned long REGPARAM2 op_33c0_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_33c8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_33c8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg(regs, srcreg);
@@ -7646,7 +7646,7 @@ unsigned long REGPARAM2 op_33c8_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_33d0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_33d0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -7659,7 +7659,7 @@ unsigned long REGPARAM2 op_33d0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_33d8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_33d8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -7673,7 +7673,7 @@ unsigned long REGPARAM2 op_33d8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_33e0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_33e0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
@@ -7688,7 +7688,7 @@ unsigned long REGPARAM2 op_33e0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_33e8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_33e8_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -7701,7 +7701,7 @@ unsigned long REGPARAM2 op_33e8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_33f0_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_33f0_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -7714,7 +7714,7 @@ unsigned long REGPARAM2 op_33f0_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_33f8_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_33f8_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
@@ -7726,7 +7726,7 @@ unsigned long REGPARAM2 op_33f8_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_33f9_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_33f9_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
@@ -7738,7 +7738,7 @@ unsigned long REGPARAM2 op_33f9_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(10);
 return 14;
 }
-unsigned long REGPARAM2 op_33fa_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_33fa_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
@@ -7751,7 +7751,7 @@ unsigned long REGPARAM2 op_33fa_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_33fb_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_33fb_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
@@ -7764,7 +7764,7 @@ unsigned long REGPARAM2 op_33fb_3(uae_u32 opcode) /* MOVE */
 }}}}m68k_incpc(8);
 return 12;
 }
-unsigned long REGPARAM2 op_33fc_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_33fc_3)(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
@@ -7775,7 +7775,7 @@ unsigned long REGPARAM2 op_33fc_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(8);
 return 10;
 }
-unsigned long REGPARAM2 op_4000_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4000_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -7792,7 +7792,7 @@ unsigned long REGPARAM2 op_4000_3(uae_u32 opcode) /* NEGX */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4010_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4010_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -7810,7 +7810,7 @@ unsigned long REGPARAM2 op_4010_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4018_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4018_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -7829,7 +7829,7 @@ unsigned long REGPARAM2 op_4018_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4020_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4020_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -7849,7 +7849,7 @@ unsigned long REGPARAM2 op_4020_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4028_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4028_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -7867,7 +7867,7 @@ unsigned long REGPARAM2 op_4028_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4030_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4030_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -7885,7 +7885,7 @@ unsigned long REGPARAM2 op_4030_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4038_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4038_3)(uae_u32 opcode) /* NEGX */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
@@ -7902,7 +7902,7 @@ unsigned long REGPARAM2 op_4038_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4039_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4039_3)(uae_u32 opcode) /* NEGX */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
@@ -7919,7 +7919,7 @@ unsigned long REGPARAM2 op_4039_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_4040_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4040_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -7936,7 +7936,7 @@ unsigned long REGPARAM2 op_4040_3(uae_u32 opcode) /* NEGX */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4050_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4050_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -7954,7 +7954,7 @@ unsigned long REGPARAM2 op_4050_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4058_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4058_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -7973,7 +7973,7 @@ unsigned long REGPARAM2 op_4058_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4060_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4060_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
@@ -7993,7 +7993,7 @@ unsigned long REGPARAM2 op_4060_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4068_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4068_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -8011,7 +8011,7 @@ unsigned long REGPARAM2 op_4068_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4070_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4070_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -8029,7 +8029,7 @@ unsigned long REGPARAM2 op_4070_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4078_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4078_3)(uae_u32 opcode) /* NEGX */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
@@ -8046,7 +8046,7 @@ unsigned long REGPARAM2 op_4078_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4079_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4079_3)(uae_u32 opcode) /* NEGX */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
@@ -8063,7 +8063,7 @@ unsigned long REGPARAM2 op_4079_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_4080_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4080_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -8080,7 +8080,7 @@ unsigned long REGPARAM2 op_4080_3(uae_u32 opcode) /* NEGX */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4090_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4090_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -8098,7 +8098,7 @@ unsigned long REGPARAM2 op_4090_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_4098_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_4098_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -8117,7 +8117,7 @@ unsigned long REGPARAM2 op_4098_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_40a0_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_40a0_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
@@ -8137,7 +8137,7 @@ unsigned long REGPARAM2 op_40a0_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_40a8_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_40a8_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -8155,7 +8155,7 @@ unsigned long REGPARAM2 op_40a8_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_40b0_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_40b0_3)(uae_u32 opcode) /* NEGX */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -8173,7 +8173,7 @@ unsigned long REGPARAM2 op_40b0_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_40b8_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_40b8_3)(uae_u32 opcode) /* NEGX */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
@@ -8190,7 +8190,7 @@ unsigned long REGPARAM2 op_40b8_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_40b9_3(uae_u32 opcode) /* NEGX */
+unsigned long REGPARAM2 CPUOP_NAME(op_40b9_3)(uae_u32 opcode) /* NEGX */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
@@ -8207,7 +8207,7 @@ unsigned long REGPARAM2 op_40b9_3(uae_u32 opcode) /* NEGX */
 }}}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_40c0_3(uae_u32 opcode) /* MVSR2 */
+unsigned long REGPARAM2 CPUOP_NAME(op_40c0_3)(uae_u32 opcode) /* MVSR2 */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	MakeSR();
@@ -8215,7 +8215,7 @@ unsigned long REGPARAM2 op_40c0_3(uae_u32 opcode) /* MVSR2 */
 }}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_40d0_3(uae_u32 opcode) /* MVSR2 */
+unsigned long REGPARAM2 CPUOP_NAME(op_40d0_3)(uae_u32 opcode) /* MVSR2 */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -8224,7 +8224,7 @@ unsigned long REGPARAM2 op_40d0_3(uae_u32 opcode) /* MVSR2 */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_40d8_3(uae_u32 opcode) /* MVSR2 */
+unsigned long REGPARAM2 CPUOP_NAME(op_40d8_3)(uae_u32 opcode) /* MVSR2 */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -8234,7 +8234,7 @@ unsigned long REGPARAM2 op_40d8_3(uae_u32 opcode) /* MVSR2 */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_40e0_3(uae_u32 opcode) /* MVSR2 */
+unsigned long REGPARAM2 CPUOP_NAME(op_40e0_3)(uae_u32 opcode) /* MVSR2 */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
@@ -8245,7 +8245,7 @@ unsigned long REGPARAM2 op_40e0_3(uae_u32 opcode) /* MVSR2 */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_40e8_3(uae_u32 opcode) /* MVSR2 */
+unsigned long REGPARAM2 CPUOP_NAME(op_40e8_3)(uae_u32 opcode) /* MVSR2 */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -8254,7 +8254,7 @@ unsigned long REGPARAM2 op_40e8_3(uae_u32 opcode) /* MVSR2 */
 }}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_40f0_3(uae_u32 opcode) /* MVSR2 */
+unsigned long REGPARAM2 CPUOP_NAME(op_40f0_3)(uae_u32 opcode) /* MVSR2 */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -8263,7 +8263,7 @@ unsigned long REGPARAM2 op_40f0_3(uae_u32 opcode) /* MVSR2 */
 }}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_40f8_3(uae_u32 opcode) /* MVSR2 */
+unsigned long REGPARAM2 CPUOP_NAME(op_40f8_3)(uae_u32 opcode) /* MVSR2 */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 	MakeSR();
@@ -8271,7 +8271,7 @@ unsigned long REGPARAM2 op_40f8_3(uae_u32 opcode) /* MVSR2 */
 }}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_40f9_3(uae_u32 opcode) /* MVSR2 */
+unsigned long REGPARAM2 CPUOP_NAME(op_40f9_3)(uae_u32 opcode) /* MVSR2 */
 {
 {{	uaecptr srca = get_ilong(2);
 	MakeSR();
@@ -8279,7 +8279,7 @@ unsigned long REGPARAM2 op_40f9_3(uae_u32 opcode) /* MVSR2 */
 }}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_4100_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_4100_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8292,7 +8292,7 @@ unsigned long REGPARAM2 op_4100_3(uae_u32 opcode) /* CHK */
 endlabel579: ;
 return 2;
 }
-unsigned long REGPARAM2 op_4110_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_4110_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8306,7 +8306,7 @@ unsigned long REGPARAM2 op_4110_3(uae_u32 opcode) /* CHK */
 endlabel580: ;
 return 6;
 }
-unsigned long REGPARAM2 op_4118_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_4118_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8321,7 +8321,7 @@ unsigned long REGPARAM2 op_4118_3(uae_u32 opcode) /* CHK */
 endlabel581: ;
 return 6;
 }
-unsigned long REGPARAM2 op_4120_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_4120_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8337,7 +8337,7 @@ unsigned long REGPARAM2 op_4120_3(uae_u32 opcode) /* CHK */
 endlabel582: ;
 return 6;
 }
-unsigned long REGPARAM2 op_4128_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_4128_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8351,7 +8351,7 @@ unsigned long REGPARAM2 op_4128_3(uae_u32 opcode) /* CHK */
 endlabel583: ;
 return 8;
 }
-unsigned long REGPARAM2 op_4130_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_4130_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8365,7 +8365,7 @@ unsigned long REGPARAM2 op_4130_3(uae_u32 opcode) /* CHK */
 endlabel584: ;
 return 8;
 }
-unsigned long REGPARAM2 op_4138_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_4138_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -8378,7 +8378,7 @@ unsigned long REGPARAM2 op_4138_3(uae_u32 opcode) /* CHK */
 endlabel585: ;
 return 8;
 }
-unsigned long REGPARAM2 op_4139_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_4139_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -8391,7 +8391,7 @@ unsigned long REGPARAM2 op_4139_3(uae_u32 opcode) /* CHK */
 endlabel586: ;
 return 10;
 }
-unsigned long REGPARAM2 op_413a_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_413a_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -8405,7 +8405,7 @@ unsigned long REGPARAM2 op_413a_3(uae_u32 opcode) /* CHK */
 endlabel587: ;
 return 8;
 }
-unsigned long REGPARAM2 op_413b_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_413b_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -8419,7 +8419,7 @@ unsigned long REGPARAM2 op_413b_3(uae_u32 opcode) /* CHK */
 endlabel588: ;
 return 8;
 }
-unsigned long REGPARAM2 op_413c_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_413c_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -8431,7 +8431,7 @@ unsigned long REGPARAM2 op_413c_3(uae_u32 opcode) /* CHK */
 endlabel589: ;
 return 6;
 }
-unsigned long REGPARAM2 op_4180_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_4180_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8444,7 +8444,7 @@ unsigned long REGPARAM2 op_4180_3(uae_u32 opcode) /* CHK */
 endlabel590: ;
 return 2;
 }
-unsigned long REGPARAM2 op_4190_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_4190_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8458,7 +8458,7 @@ unsigned long REGPARAM2 op_4190_3(uae_u32 opcode) /* CHK */
 endlabel591: ;
 return 4;
 }
-unsigned long REGPARAM2 op_4198_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_4198_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8473,7 +8473,7 @@ unsigned long REGPARAM2 op_4198_3(uae_u32 opcode) /* CHK */
 endlabel592: ;
 return 4;
 }
-unsigned long REGPARAM2 op_41a0_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_41a0_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8489,7 +8489,7 @@ unsigned long REGPARAM2 op_41a0_3(uae_u32 opcode) /* CHK */
 endlabel593: ;
 return 4;
 }
-unsigned long REGPARAM2 op_41a8_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_41a8_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8503,7 +8503,7 @@ unsigned long REGPARAM2 op_41a8_3(uae_u32 opcode) /* CHK */
 endlabel594: ;
 return 6;
 }
-unsigned long REGPARAM2 op_41b0_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_41b0_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8517,7 +8517,7 @@ unsigned long REGPARAM2 op_41b0_3(uae_u32 opcode) /* CHK */
 endlabel595: ;
 return 6;
 }
-unsigned long REGPARAM2 op_41b8_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_41b8_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -8530,7 +8530,7 @@ unsigned long REGPARAM2 op_41b8_3(uae_u32 opcode) /* CHK */
 endlabel596: ;
 return 6;
 }
-unsigned long REGPARAM2 op_41b9_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_41b9_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -8543,7 +8543,7 @@ unsigned long REGPARAM2 op_41b9_3(uae_u32 opcode) /* CHK */
 endlabel597: ;
 return 8;
 }
-unsigned long REGPARAM2 op_41ba_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_41ba_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -8557,7 +8557,7 @@ unsigned long REGPARAM2 op_41ba_3(uae_u32 opcode) /* CHK */
 endlabel598: ;
 return 6;
 }
-unsigned long REGPARAM2 op_41bb_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_41bb_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -8571,7 +8571,7 @@ unsigned long REGPARAM2 op_41bb_3(uae_u32 opcode) /* CHK */
 endlabel599: ;
 return 6;
 }
-unsigned long REGPARAM2 op_41bc_3(uae_u32 opcode) /* CHK */
+unsigned long REGPARAM2 CPUOP_NAME(op_41bc_3)(uae_u32 opcode) /* CHK */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -8583,7 +8583,7 @@ unsigned long REGPARAM2 op_41bc_3(uae_u32 opcode) /* CHK */
 endlabel600: ;
 return 4;
 }
-unsigned long REGPARAM2 op_41d0_3(uae_u32 opcode) /* LEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_41d0_3)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8601,7 +8601,7 @@ unsigned long REGPARAM2 op_41d0_3(uae_u32 opcode) /* LEA */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_41e8_3(uae_u32 opcode) /* LEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_41e8_3)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8619,7 +8619,7 @@ unsigned long REGPARAM2 op_41e8_3(uae_u32 opcode) /* LEA */
 }}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_41f0_3(uae_u32 opcode) /* LEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_41f0_3)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -8637,7 +8637,7 @@ unsigned long REGPARAM2 op_41f0_3(uae_u32 opcode) /* LEA */
 }}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_41f8_3(uae_u32 opcode) /* LEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_41f8_3)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -8646,7 +8646,7 @@ unsigned long REGPARAM2 op_41f8_3(uae_u32 opcode) /* LEA */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_41f9_3(uae_u32 opcode) /* LEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_41f9_3)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -8655,7 +8655,7 @@ unsigned long REGPARAM2 op_41f9_3(uae_u32 opcode) /* LEA */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_41fa_3(uae_u32 opcode) /* LEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_41fa_3)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -8665,7 +8665,7 @@ unsigned long REGPARAM2 op_41fa_3(uae_u32 opcode) /* LEA */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_41fb_3(uae_u32 opcode) /* LEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_41fb_3)(uae_u32 opcode) /* LEA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -8675,7 +8675,7 @@ unsigned long REGPARAM2 op_41fb_3(uae_u32 opcode) /* LEA */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_4200_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4200_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	CLEAR_CZNV;
@@ -8685,7 +8685,7 @@ unsigned long REGPARAM2 op_4200_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4210_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4210_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -8696,7 +8696,7 @@ unsigned long REGPARAM2 op_4210_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_4218_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4218_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -8708,7 +8708,7 @@ unsigned long REGPARAM2 op_4218_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_4220_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4220_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -8721,7 +8721,7 @@ unsigned long REGPARAM2 op_4220_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_4228_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4228_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -8732,7 +8732,7 @@ unsigned long REGPARAM2 op_4228_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4230_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4230_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -8743,7 +8743,7 @@ unsigned long REGPARAM2 op_4230_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4238_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4238_3)(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
@@ -8753,7 +8753,7 @@ unsigned long REGPARAM2 op_4238_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4239_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4239_3)(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = get_ilong(2);
 	CLEAR_CZNV;
@@ -8763,7 +8763,7 @@ unsigned long REGPARAM2 op_4239_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_4240_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4240_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	CLEAR_CZNV;
@@ -8773,7 +8773,7 @@ unsigned long REGPARAM2 op_4240_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4250_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4250_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -8784,7 +8784,7 @@ unsigned long REGPARAM2 op_4250_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_4258_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4258_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -8796,7 +8796,7 @@ unsigned long REGPARAM2 op_4258_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_4260_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4260_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
@@ -8809,7 +8809,7 @@ unsigned long REGPARAM2 op_4260_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_4268_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4268_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -8823,7 +8823,7 @@ return 6;
 #endif
 
 #ifdef PART_4
-unsigned long REGPARAM2 op_4270_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4270_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -8834,7 +8834,7 @@ unsigned long REGPARAM2 op_4270_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4278_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4278_3)(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
@@ -8844,7 +8844,7 @@ unsigned long REGPARAM2 op_4278_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4279_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4279_3)(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = get_ilong(2);
 	CLEAR_CZNV;
@@ -8854,7 +8854,7 @@ unsigned long REGPARAM2 op_4279_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_4280_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4280_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	CLEAR_CZNV;
@@ -8864,7 +8864,7 @@ unsigned long REGPARAM2 op_4280_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4290_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4290_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -8875,7 +8875,7 @@ unsigned long REGPARAM2 op_4290_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4298_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4298_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -8887,7 +8887,7 @@ unsigned long REGPARAM2 op_4298_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_42a0_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_42a0_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
@@ -8900,7 +8900,7 @@ unsigned long REGPARAM2 op_42a0_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_42a8_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_42a8_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -8911,7 +8911,7 @@ unsigned long REGPARAM2 op_42a8_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_42b0_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_42b0_3)(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -8922,7 +8922,7 @@ unsigned long REGPARAM2 op_42b0_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_42b8_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_42b8_3)(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
@@ -8932,7 +8932,7 @@ unsigned long REGPARAM2 op_42b8_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_42b9_3(uae_u32 opcode) /* CLR */
+unsigned long REGPARAM2 CPUOP_NAME(op_42b9_3)(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = get_ilong(2);
 	CLEAR_CZNV;
@@ -8942,7 +8942,7 @@ unsigned long REGPARAM2 op_42b9_3(uae_u32 opcode) /* CLR */
 }}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_4400_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4400_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -8959,7 +8959,7 @@ unsigned long REGPARAM2 op_4400_3(uae_u32 opcode) /* NEG */
 }}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4410_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4410_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -8977,7 +8977,7 @@ unsigned long REGPARAM2 op_4410_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4418_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4418_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -8996,7 +8996,7 @@ unsigned long REGPARAM2 op_4418_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4420_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4420_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -9016,7 +9016,7 @@ unsigned long REGPARAM2 op_4420_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4428_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4428_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -9034,7 +9034,7 @@ unsigned long REGPARAM2 op_4428_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4430_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4430_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -9052,7 +9052,7 @@ unsigned long REGPARAM2 op_4430_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4438_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4438_3)(uae_u32 opcode) /* NEG */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
@@ -9069,7 +9069,7 @@ unsigned long REGPARAM2 op_4438_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4439_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4439_3)(uae_u32 opcode) /* NEG */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
@@ -9086,7 +9086,7 @@ unsigned long REGPARAM2 op_4439_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_4440_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4440_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -9103,7 +9103,7 @@ unsigned long REGPARAM2 op_4440_3(uae_u32 opcode) /* NEG */
 }}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4450_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4450_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -9121,7 +9121,7 @@ unsigned long REGPARAM2 op_4450_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4458_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4458_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -9140,7 +9140,7 @@ unsigned long REGPARAM2 op_4458_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4460_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4460_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
@@ -9160,7 +9160,7 @@ unsigned long REGPARAM2 op_4460_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4468_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4468_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -9178,7 +9178,7 @@ unsigned long REGPARAM2 op_4468_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4470_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4470_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -9196,7 +9196,7 @@ unsigned long REGPARAM2 op_4470_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4478_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4478_3)(uae_u32 opcode) /* NEG */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
@@ -9213,7 +9213,7 @@ unsigned long REGPARAM2 op_4478_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4479_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4479_3)(uae_u32 opcode) /* NEG */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
@@ -9230,7 +9230,7 @@ unsigned long REGPARAM2 op_4479_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_4480_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4480_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -9247,7 +9247,7 @@ unsigned long REGPARAM2 op_4480_3(uae_u32 opcode) /* NEG */
 }}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4490_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4490_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -9265,7 +9265,7 @@ unsigned long REGPARAM2 op_4490_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_4498_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_4498_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -9284,7 +9284,7 @@ unsigned long REGPARAM2 op_4498_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_44a0_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_44a0_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
@@ -9304,7 +9304,7 @@ unsigned long REGPARAM2 op_44a0_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_44a8_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_44a8_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -9322,7 +9322,7 @@ unsigned long REGPARAM2 op_44a8_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_44b0_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_44b0_3)(uae_u32 opcode) /* NEG */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -9340,7 +9340,7 @@ unsigned long REGPARAM2 op_44b0_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_44b8_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_44b8_3)(uae_u32 opcode) /* NEG */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
@@ -9357,7 +9357,7 @@ unsigned long REGPARAM2 op_44b8_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_44b9_3(uae_u32 opcode) /* NEG */
+unsigned long REGPARAM2 CPUOP_NAME(op_44b9_3)(uae_u32 opcode) /* NEG */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
@@ -9374,7 +9374,7 @@ unsigned long REGPARAM2 op_44b9_3(uae_u32 opcode) /* NEG */
 }}}}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_44c0_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_44c0_3)(uae_u32 opcode) /* MV2SR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -9385,7 +9385,7 @@ unsigned long REGPARAM2 op_44c0_3(uae_u32 opcode) /* MV2SR */
 }}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_44d0_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_44d0_3)(uae_u32 opcode) /* MV2SR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -9397,7 +9397,7 @@ unsigned long REGPARAM2 op_44d0_3(uae_u32 opcode) /* MV2SR */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_44d8_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_44d8_3)(uae_u32 opcode) /* MV2SR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -9410,7 +9410,7 @@ unsigned long REGPARAM2 op_44d8_3(uae_u32 opcode) /* MV2SR */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_44e0_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_44e0_3)(uae_u32 opcode) /* MV2SR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
@@ -9424,7 +9424,7 @@ unsigned long REGPARAM2 op_44e0_3(uae_u32 opcode) /* MV2SR */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_44e8_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_44e8_3)(uae_u32 opcode) /* MV2SR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -9436,7 +9436,7 @@ unsigned long REGPARAM2 op_44e8_3(uae_u32 opcode) /* MV2SR */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_44f0_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_44f0_3)(uae_u32 opcode) /* MV2SR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -9448,7 +9448,7 @@ unsigned long REGPARAM2 op_44f0_3(uae_u32 opcode) /* MV2SR */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_44f8_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_44f8_3)(uae_u32 opcode) /* MV2SR */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
@@ -9459,7 +9459,7 @@ unsigned long REGPARAM2 op_44f8_3(uae_u32 opcode) /* MV2SR */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_44f9_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_44f9_3)(uae_u32 opcode) /* MV2SR */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
@@ -9470,7 +9470,7 @@ unsigned long REGPARAM2 op_44f9_3(uae_u32 opcode) /* MV2SR */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_44fa_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_44fa_3)(uae_u32 opcode) /* MV2SR */
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
@@ -9482,7 +9482,7 @@ unsigned long REGPARAM2 op_44fa_3(uae_u32 opcode) /* MV2SR */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_44fb_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_44fb_3)(uae_u32 opcode) /* MV2SR */
 {
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
@@ -9494,7 +9494,7 @@ unsigned long REGPARAM2 op_44fb_3(uae_u32 opcode) /* MV2SR */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_44fc_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_44fc_3)(uae_u32 opcode) /* MV2SR */
 {
 {{	uae_s16 src = get_iword(2);
 	MakeSR();
@@ -9504,7 +9504,7 @@ unsigned long REGPARAM2 op_44fc_3(uae_u32 opcode) /* MV2SR */
 }}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_4600_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4600_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -9516,7 +9516,7 @@ unsigned long REGPARAM2 op_4600_3(uae_u32 opcode) /* NOT */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4610_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4610_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -9529,7 +9529,7 @@ unsigned long REGPARAM2 op_4610_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4618_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4618_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -9543,7 +9543,7 @@ unsigned long REGPARAM2 op_4618_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4620_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4620_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -9558,7 +9558,7 @@ unsigned long REGPARAM2 op_4620_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4628_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4628_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -9571,7 +9571,7 @@ unsigned long REGPARAM2 op_4628_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4630_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4630_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -9584,7 +9584,7 @@ unsigned long REGPARAM2 op_4630_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4638_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4638_3)(uae_u32 opcode) /* NOT */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
@@ -9596,7 +9596,7 @@ unsigned long REGPARAM2 op_4638_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4639_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4639_3)(uae_u32 opcode) /* NOT */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
@@ -9608,7 +9608,7 @@ unsigned long REGPARAM2 op_4639_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_4640_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4640_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -9620,7 +9620,7 @@ unsigned long REGPARAM2 op_4640_3(uae_u32 opcode) /* NOT */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4650_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4650_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -9633,7 +9633,7 @@ unsigned long REGPARAM2 op_4650_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4658_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4658_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -9647,7 +9647,7 @@ unsigned long REGPARAM2 op_4658_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4660_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4660_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
@@ -9662,7 +9662,7 @@ unsigned long REGPARAM2 op_4660_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4668_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4668_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -9675,7 +9675,7 @@ unsigned long REGPARAM2 op_4668_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4670_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4670_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -9688,7 +9688,7 @@ unsigned long REGPARAM2 op_4670_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4678_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4678_3)(uae_u32 opcode) /* NOT */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
@@ -9700,7 +9700,7 @@ unsigned long REGPARAM2 op_4678_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4679_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4679_3)(uae_u32 opcode) /* NOT */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
@@ -9712,7 +9712,7 @@ unsigned long REGPARAM2 op_4679_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_4680_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4680_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -9724,7 +9724,7 @@ unsigned long REGPARAM2 op_4680_3(uae_u32 opcode) /* NOT */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4690_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4690_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -9737,7 +9737,7 @@ unsigned long REGPARAM2 op_4690_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_4698_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4698_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -9751,7 +9751,7 @@ unsigned long REGPARAM2 op_4698_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_46a0_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_46a0_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
@@ -9766,7 +9766,7 @@ unsigned long REGPARAM2 op_46a0_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_46a8_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_46a8_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -9779,7 +9779,7 @@ unsigned long REGPARAM2 op_46a8_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_46b0_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_46b0_3)(uae_u32 opcode) /* NOT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -9792,7 +9792,7 @@ unsigned long REGPARAM2 op_46b0_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_46b8_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_46b8_3)(uae_u32 opcode) /* NOT */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
@@ -9804,7 +9804,7 @@ unsigned long REGPARAM2 op_46b8_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_46b9_3(uae_u32 opcode) /* NOT */
+unsigned long REGPARAM2 CPUOP_NAME(op_46b9_3)(uae_u32 opcode) /* NOT */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
@@ -9816,7 +9816,7 @@ unsigned long REGPARAM2 op_46b9_3(uae_u32 opcode) /* NOT */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_46c0_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_46c0_3)(uae_u32 opcode) /* MV2SR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {if (!regs.s) { Exception(8,0); goto endlabel691; }
@@ -9827,7 +9827,7 @@ unsigned long REGPARAM2 op_46c0_3(uae_u32 opcode) /* MV2SR */
 endlabel691: ;
 return 2;
 }
-unsigned long REGPARAM2 op_46d0_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_46d0_3)(uae_u32 opcode) /* MV2SR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {if (!regs.s) { Exception(8,0); goto endlabel692; }
@@ -9839,7 +9839,7 @@ unsigned long REGPARAM2 op_46d0_3(uae_u32 opcode) /* MV2SR */
 endlabel692: ;
 return 4;
 }
-unsigned long REGPARAM2 op_46d8_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_46d8_3)(uae_u32 opcode) /* MV2SR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {if (!regs.s) { Exception(8,0); goto endlabel693; }
@@ -9852,7 +9852,7 @@ unsigned long REGPARAM2 op_46d8_3(uae_u32 opcode) /* MV2SR */
 endlabel693: ;
 return 4;
 }
-unsigned long REGPARAM2 op_46e0_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_46e0_3)(uae_u32 opcode) /* MV2SR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {if (!regs.s) { Exception(8,0); goto endlabel694; }
@@ -9866,7 +9866,7 @@ unsigned long REGPARAM2 op_46e0_3(uae_u32 opcode) /* MV2SR */
 endlabel694: ;
 return 4;
 }
-unsigned long REGPARAM2 op_46e8_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_46e8_3)(uae_u32 opcode) /* MV2SR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {if (!regs.s) { Exception(8,0); goto endlabel695; }
@@ -9878,7 +9878,7 @@ unsigned long REGPARAM2 op_46e8_3(uae_u32 opcode) /* MV2SR */
 endlabel695: ;
 return 6;
 }
-unsigned long REGPARAM2 op_46f0_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_46f0_3)(uae_u32 opcode) /* MV2SR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {if (!regs.s) { Exception(8,0); goto endlabel696; }
@@ -9890,7 +9890,7 @@ unsigned long REGPARAM2 op_46f0_3(uae_u32 opcode) /* MV2SR */
 endlabel696: ;
 return 6;
 }
-unsigned long REGPARAM2 op_46f8_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_46f8_3)(uae_u32 opcode) /* MV2SR */
 {
 {if (!regs.s) { Exception(8,0); goto endlabel697; }
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -9901,7 +9901,7 @@ unsigned long REGPARAM2 op_46f8_3(uae_u32 opcode) /* MV2SR */
 endlabel697: ;
 return 6;
 }
-unsigned long REGPARAM2 op_46f9_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_46f9_3)(uae_u32 opcode) /* MV2SR */
 {
 {if (!regs.s) { Exception(8,0); goto endlabel698; }
 {{	uaecptr srca = get_ilong(2);
@@ -9912,7 +9912,7 @@ unsigned long REGPARAM2 op_46f9_3(uae_u32 opcode) /* MV2SR */
 endlabel698: ;
 return 8;
 }
-unsigned long REGPARAM2 op_46fa_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_46fa_3)(uae_u32 opcode) /* MV2SR */
 {
 {if (!regs.s) { Exception(8,0); goto endlabel699; }
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -9924,7 +9924,7 @@ unsigned long REGPARAM2 op_46fa_3(uae_u32 opcode) /* MV2SR */
 endlabel699: ;
 return 6;
 }
-unsigned long REGPARAM2 op_46fb_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_46fb_3)(uae_u32 opcode) /* MV2SR */
 {
 {if (!regs.s) { Exception(8,0); goto endlabel700; }
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -9936,7 +9936,7 @@ unsigned long REGPARAM2 op_46fb_3(uae_u32 opcode) /* MV2SR */
 endlabel700: ;
 return 6;
 }
-unsigned long REGPARAM2 op_46fc_3(uae_u32 opcode) /* MV2SR */
+unsigned long REGPARAM2 CPUOP_NAME(op_46fc_3)(uae_u32 opcode) /* MV2SR */
 {
 {if (!regs.s) { Exception(8,0); goto endlabel701; }
 {{	uae_s16 src = get_iword(2);
@@ -9946,7 +9946,7 @@ unsigned long REGPARAM2 op_46fc_3(uae_u32 opcode) /* MV2SR */
 endlabel701: ;
 return 4;
 }
-unsigned long REGPARAM2 op_4800_3(uae_u32 opcode) /* NBCD */
+unsigned long REGPARAM2 CPUOP_NAME(op_4800_3)(uae_u32 opcode) /* NBCD */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -9964,7 +9964,7 @@ unsigned long REGPARAM2 op_4800_3(uae_u32 opcode) /* NBCD */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4810_3(uae_u32 opcode) /* NBCD */
+unsigned long REGPARAM2 CPUOP_NAME(op_4810_3)(uae_u32 opcode) /* NBCD */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -9983,7 +9983,7 @@ unsigned long REGPARAM2 op_4810_3(uae_u32 opcode) /* NBCD */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4818_3(uae_u32 opcode) /* NBCD */
+unsigned long REGPARAM2 CPUOP_NAME(op_4818_3)(uae_u32 opcode) /* NBCD */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -10003,7 +10003,7 @@ unsigned long REGPARAM2 op_4818_3(uae_u32 opcode) /* NBCD */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4820_3(uae_u32 opcode) /* NBCD */
+unsigned long REGPARAM2 CPUOP_NAME(op_4820_3)(uae_u32 opcode) /* NBCD */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -10024,7 +10024,7 @@ unsigned long REGPARAM2 op_4820_3(uae_u32 opcode) /* NBCD */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4828_3(uae_u32 opcode) /* NBCD */
+unsigned long REGPARAM2 CPUOP_NAME(op_4828_3)(uae_u32 opcode) /* NBCD */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -10043,7 +10043,7 @@ unsigned long REGPARAM2 op_4828_3(uae_u32 opcode) /* NBCD */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4830_3(uae_u32 opcode) /* NBCD */
+unsigned long REGPARAM2 CPUOP_NAME(op_4830_3)(uae_u32 opcode) /* NBCD */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -10062,7 +10062,7 @@ unsigned long REGPARAM2 op_4830_3(uae_u32 opcode) /* NBCD */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4838_3(uae_u32 opcode) /* NBCD */
+unsigned long REGPARAM2 CPUOP_NAME(op_4838_3)(uae_u32 opcode) /* NBCD */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
@@ -10080,7 +10080,7 @@ unsigned long REGPARAM2 op_4838_3(uae_u32 opcode) /* NBCD */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4839_3(uae_u32 opcode) /* NBCD */
+unsigned long REGPARAM2 CPUOP_NAME(op_4839_3)(uae_u32 opcode) /* NBCD */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
@@ -10098,7 +10098,7 @@ unsigned long REGPARAM2 op_4839_3(uae_u32 opcode) /* NBCD */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_4840_3(uae_u32 opcode) /* SWAP */
+unsigned long REGPARAM2 CPUOP_NAME(op_4840_3)(uae_u32 opcode) /* SWAP */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -10110,7 +10110,7 @@ unsigned long REGPARAM2 op_4840_3(uae_u32 opcode) /* SWAP */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4850_3(uae_u32 opcode) /* PEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_4850_3)(uae_u32 opcode) /* PEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -10121,7 +10121,7 @@ unsigned long REGPARAM2 op_4850_3(uae_u32 opcode) /* PEA */
 }}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4868_3(uae_u32 opcode) /* PEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_4868_3)(uae_u32 opcode) /* PEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -10132,7 +10132,7 @@ unsigned long REGPARAM2 op_4868_3(uae_u32 opcode) /* PEA */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4870_3(uae_u32 opcode) /* PEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_4870_3)(uae_u32 opcode) /* PEA */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -10143,7 +10143,7 @@ unsigned long REGPARAM2 op_4870_3(uae_u32 opcode) /* PEA */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4878_3(uae_u32 opcode) /* PEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_4878_3)(uae_u32 opcode) /* PEA */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, 7) - 4;
@@ -10153,7 +10153,7 @@ unsigned long REGPARAM2 op_4878_3(uae_u32 opcode) /* PEA */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4879_3(uae_u32 opcode) /* PEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_4879_3)(uae_u32 opcode) /* PEA */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, 7) - 4;
@@ -10163,7 +10163,7 @@ unsigned long REGPARAM2 op_4879_3(uae_u32 opcode) /* PEA */
 }}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_487a_3(uae_u32 opcode) /* PEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_487a_3)(uae_u32 opcode) /* PEA */
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
@@ -10174,7 +10174,7 @@ unsigned long REGPARAM2 op_487a_3(uae_u32 opcode) /* PEA */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_487b_3(uae_u32 opcode) /* PEA */
+unsigned long REGPARAM2 CPUOP_NAME(op_487b_3)(uae_u32 opcode) /* PEA */
 {
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
@@ -10185,7 +10185,7 @@ unsigned long REGPARAM2 op_487b_3(uae_u32 opcode) /* PEA */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4880_3(uae_u32 opcode) /* EXT */
+unsigned long REGPARAM2 CPUOP_NAME(op_4880_3)(uae_u32 opcode) /* EXT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -10197,7 +10197,7 @@ unsigned long REGPARAM2 op_4880_3(uae_u32 opcode) /* EXT */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4890_3(uae_u32 opcode) /* MVMLE */
+unsigned long REGPARAM2 CPUOP_NAME(op_4890_3)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10208,7 +10208,7 @@ unsigned long REGPARAM2 op_4890_3(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_48a0_3(uae_u32 opcode) /* MVMLE */
+unsigned long REGPARAM2 CPUOP_NAME(op_48a0_3)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10222,7 +10222,7 @@ unsigned long REGPARAM2 op_48a0_3(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_48a8_3(uae_u32 opcode) /* MVMLE */
+unsigned long REGPARAM2 CPUOP_NAME(op_48a8_3)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10233,7 +10233,7 @@ unsigned long REGPARAM2 op_48a8_3(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_48b0_3(uae_u32 opcode) /* MVMLE */
+unsigned long REGPARAM2 CPUOP_NAME(op_48b0_3)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10244,7 +10244,7 @@ unsigned long REGPARAM2 op_48b0_3(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_48b8_3(uae_u32 opcode) /* MVMLE */
+unsigned long REGPARAM2 CPUOP_NAME(op_48b8_3)(uae_u32 opcode) /* MVMLE */
 {
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = (uae_s32)(uae_s16)get_iword(4);
@@ -10254,7 +10254,7 @@ unsigned long REGPARAM2 op_48b8_3(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_48b9_3(uae_u32 opcode) /* MVMLE */
+unsigned long REGPARAM2 CPUOP_NAME(op_48b9_3)(uae_u32 opcode) /* MVMLE */
 {
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = get_ilong(4);
@@ -10264,7 +10264,7 @@ unsigned long REGPARAM2 op_48b9_3(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(8);
 return 8;
 }
-unsigned long REGPARAM2 op_48c0_3(uae_u32 opcode) /* EXT */
+unsigned long REGPARAM2 CPUOP_NAME(op_48c0_3)(uae_u32 opcode) /* EXT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -10276,7 +10276,7 @@ unsigned long REGPARAM2 op_48c0_3(uae_u32 opcode) /* EXT */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_48d0_3(uae_u32 opcode) /* MVMLE */
+unsigned long REGPARAM2 CPUOP_NAME(op_48d0_3)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10287,7 +10287,7 @@ unsigned long REGPARAM2 op_48d0_3(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_48e0_3(uae_u32 opcode) /* MVMLE */
+unsigned long REGPARAM2 CPUOP_NAME(op_48e0_3)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10301,7 +10301,7 @@ unsigned long REGPARAM2 op_48e0_3(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_48e8_3(uae_u32 opcode) /* MVMLE */
+unsigned long REGPARAM2 CPUOP_NAME(op_48e8_3)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10312,7 +10312,7 @@ unsigned long REGPARAM2 op_48e8_3(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_48f0_3(uae_u32 opcode) /* MVMLE */
+unsigned long REGPARAM2 CPUOP_NAME(op_48f0_3)(uae_u32 opcode) /* MVMLE */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10323,7 +10323,7 @@ unsigned long REGPARAM2 op_48f0_3(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_48f8_3(uae_u32 opcode) /* MVMLE */
+unsigned long REGPARAM2 CPUOP_NAME(op_48f8_3)(uae_u32 opcode) /* MVMLE */
 {
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = (uae_s32)(uae_s16)get_iword(4);
@@ -10333,7 +10333,7 @@ unsigned long REGPARAM2 op_48f8_3(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_48f9_3(uae_u32 opcode) /* MVMLE */
+unsigned long REGPARAM2 CPUOP_NAME(op_48f9_3)(uae_u32 opcode) /* MVMLE */
 {
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = get_ilong(4);
@@ -10343,7 +10343,7 @@ unsigned long REGPARAM2 op_48f9_3(uae_u32 opcode) /* MVMLE */
 }}}m68k_incpc(8);
 return 8;
 }
-unsigned long REGPARAM2 op_49c0_3(uae_u32 opcode) /* EXT */
+unsigned long REGPARAM2 CPUOP_NAME(op_49c0_3)(uae_u32 opcode) /* EXT */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -10355,7 +10355,7 @@ unsigned long REGPARAM2 op_49c0_3(uae_u32 opcode) /* EXT */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4a00_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a00_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -10365,7 +10365,7 @@ unsigned long REGPARAM2 op_4a00_3(uae_u32 opcode) /* TST */
 }}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4a10_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a10_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -10376,7 +10376,7 @@ unsigned long REGPARAM2 op_4a10_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_4a18_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a18_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -10388,7 +10388,7 @@ unsigned long REGPARAM2 op_4a18_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_4a20_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a20_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -10401,7 +10401,7 @@ unsigned long REGPARAM2 op_4a20_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_4a28_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a28_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -10412,7 +10412,7 @@ unsigned long REGPARAM2 op_4a28_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4a30_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a30_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -10423,7 +10423,7 @@ unsigned long REGPARAM2 op_4a30_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4a38_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a38_3)(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
@@ -10433,7 +10433,7 @@ unsigned long REGPARAM2 op_4a38_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4a39_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a39_3)(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
@@ -10443,7 +10443,7 @@ unsigned long REGPARAM2 op_4a39_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_4a3a_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a3a_3)(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
@@ -10454,7 +10454,7 @@ unsigned long REGPARAM2 op_4a3a_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4a3b_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a3b_3)(uae_u32 opcode) /* TST */
 {
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
@@ -10465,7 +10465,7 @@ unsigned long REGPARAM2 op_4a3b_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4a3c_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a3c_3)(uae_u32 opcode) /* TST */
 {
 {{	uae_s8 src = get_ibyte(2);
 	CLEAR_CZNV;
@@ -10474,7 +10474,7 @@ unsigned long REGPARAM2 op_4a3c_3(uae_u32 opcode) /* TST */
 }}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_4a40_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a40_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -10484,7 +10484,7 @@ unsigned long REGPARAM2 op_4a40_3(uae_u32 opcode) /* TST */
 }}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4a48_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a48_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg(regs, srcreg);
@@ -10494,7 +10494,7 @@ unsigned long REGPARAM2 op_4a48_3(uae_u32 opcode) /* TST */
 }}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4a50_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a50_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -10505,7 +10505,7 @@ unsigned long REGPARAM2 op_4a50_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_4a58_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a58_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -10517,7 +10517,7 @@ unsigned long REGPARAM2 op_4a58_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_4a60_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a60_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
@@ -10530,7 +10530,7 @@ unsigned long REGPARAM2 op_4a60_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_4a68_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a68_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -10541,7 +10541,7 @@ unsigned long REGPARAM2 op_4a68_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4a70_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a70_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -10552,7 +10552,7 @@ unsigned long REGPARAM2 op_4a70_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4a78_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a78_3)(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
@@ -10562,7 +10562,7 @@ unsigned long REGPARAM2 op_4a78_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4a79_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a79_3)(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
@@ -10572,7 +10572,7 @@ unsigned long REGPARAM2 op_4a79_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_4a7a_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a7a_3)(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
@@ -10583,7 +10583,7 @@ unsigned long REGPARAM2 op_4a7a_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4a7b_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a7b_3)(uae_u32 opcode) /* TST */
 {
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
@@ -10594,7 +10594,7 @@ unsigned long REGPARAM2 op_4a7b_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_4a7c_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a7c_3)(uae_u32 opcode) /* TST */
 {
 {{	uae_s16 src = get_iword(2);
 	CLEAR_CZNV;
@@ -10603,7 +10603,7 @@ unsigned long REGPARAM2 op_4a7c_3(uae_u32 opcode) /* TST */
 }}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_4a80_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a80_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -10613,7 +10613,7 @@ unsigned long REGPARAM2 op_4a80_3(uae_u32 opcode) /* TST */
 }}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4a88_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a88_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg(regs, srcreg);
@@ -10623,7 +10623,7 @@ unsigned long REGPARAM2 op_4a88_3(uae_u32 opcode) /* TST */
 }}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4a90_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a90_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -10634,7 +10634,7 @@ unsigned long REGPARAM2 op_4a90_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4a98_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4a98_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -10646,7 +10646,7 @@ unsigned long REGPARAM2 op_4a98_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4aa0_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4aa0_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
@@ -10659,7 +10659,7 @@ unsigned long REGPARAM2 op_4aa0_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4aa8_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4aa8_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -10670,7 +10670,7 @@ unsigned long REGPARAM2 op_4aa8_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4ab0_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ab0_3)(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -10681,7 +10681,7 @@ unsigned long REGPARAM2 op_4ab0_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4ab8_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ab8_3)(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
@@ -10691,7 +10691,7 @@ unsigned long REGPARAM2 op_4ab8_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4ab9_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ab9_3)(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
@@ -10701,7 +10701,7 @@ unsigned long REGPARAM2 op_4ab9_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_4aba_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4aba_3)(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
@@ -10712,7 +10712,7 @@ unsigned long REGPARAM2 op_4aba_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4abb_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4abb_3)(uae_u32 opcode) /* TST */
 {
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
@@ -10723,7 +10723,7 @@ unsigned long REGPARAM2 op_4abb_3(uae_u32 opcode) /* TST */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4abc_3(uae_u32 opcode) /* TST */
+unsigned long REGPARAM2 CPUOP_NAME(op_4abc_3)(uae_u32 opcode) /* TST */
 {
 {{	uae_s32 src = get_ilong(2);
 	CLEAR_CZNV;
@@ -10732,7 +10732,7 @@ unsigned long REGPARAM2 op_4abc_3(uae_u32 opcode) /* TST */
 }}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_4ac0_3(uae_u32 opcode) /* TAS */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ac0_3)(uae_u32 opcode) /* TAS */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -10744,7 +10744,7 @@ unsigned long REGPARAM2 op_4ac0_3(uae_u32 opcode) /* TAS */
 }}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4ad0_3(uae_u32 opcode) /* TAS */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ad0_3)(uae_u32 opcode) /* TAS */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -10757,7 +10757,7 @@ unsigned long REGPARAM2 op_4ad0_3(uae_u32 opcode) /* TAS */
 }}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4ad8_3(uae_u32 opcode) /* TAS */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ad8_3)(uae_u32 opcode) /* TAS */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -10771,7 +10771,7 @@ unsigned long REGPARAM2 op_4ad8_3(uae_u32 opcode) /* TAS */
 }}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4ae0_3(uae_u32 opcode) /* TAS */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ae0_3)(uae_u32 opcode) /* TAS */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -10786,7 +10786,7 @@ unsigned long REGPARAM2 op_4ae0_3(uae_u32 opcode) /* TAS */
 }}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4ae8_3(uae_u32 opcode) /* TAS */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ae8_3)(uae_u32 opcode) /* TAS */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -10799,7 +10799,7 @@ unsigned long REGPARAM2 op_4ae8_3(uae_u32 opcode) /* TAS */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4af0_3(uae_u32 opcode) /* TAS */
+unsigned long REGPARAM2 CPUOP_NAME(op_4af0_3)(uae_u32 opcode) /* TAS */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -10812,7 +10812,7 @@ unsigned long REGPARAM2 op_4af0_3(uae_u32 opcode) /* TAS */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4af8_3(uae_u32 opcode) /* TAS */
+unsigned long REGPARAM2 CPUOP_NAME(op_4af8_3)(uae_u32 opcode) /* TAS */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
@@ -10824,7 +10824,7 @@ unsigned long REGPARAM2 op_4af8_3(uae_u32 opcode) /* TAS */
 }}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4af9_3(uae_u32 opcode) /* TAS */
+unsigned long REGPARAM2 CPUOP_NAME(op_4af9_3)(uae_u32 opcode) /* TAS */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
@@ -10836,7 +10836,7 @@ unsigned long REGPARAM2 op_4af9_3(uae_u32 opcode) /* TAS */
 }}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_4c90_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4c90_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10847,7 +10847,7 @@ unsigned long REGPARAM2 op_4c90_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_4c98_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4c98_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10859,7 +10859,7 @@ unsigned long REGPARAM2 op_4c98_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_4ca8_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ca8_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10870,7 +10870,7 @@ unsigned long REGPARAM2 op_4ca8_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_4cb0_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4cb0_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10881,7 +10881,7 @@ unsigned long REGPARAM2 op_4cb0_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_4cb8_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4cb8_3)(uae_u32 opcode) /* MVMEL */
 {
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
@@ -10891,7 +10891,7 @@ unsigned long REGPARAM2 op_4cb8_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_4cb9_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4cb9_3)(uae_u32 opcode) /* MVMEL */
 {
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
@@ -10901,7 +10901,7 @@ unsigned long REGPARAM2 op_4cb9_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(8);
 return 8;
 }
-unsigned long REGPARAM2 op_4cba_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4cba_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = 2;
 {	uae_u16 mask = get_iword(2);
@@ -10913,7 +10913,7 @@ unsigned long REGPARAM2 op_4cba_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_4cbb_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4cbb_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = 3;
 {	uae_u16 mask = get_iword(2);
@@ -10925,7 +10925,7 @@ unsigned long REGPARAM2 op_4cbb_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_4cd0_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4cd0_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10936,7 +10936,7 @@ unsigned long REGPARAM2 op_4cd0_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_4cd8_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4cd8_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10948,7 +10948,7 @@ unsigned long REGPARAM2 op_4cd8_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_4ce8_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ce8_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10959,7 +10959,7 @@ unsigned long REGPARAM2 op_4ce8_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_4cf0_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4cf0_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = opcode & 7;
 {	uae_u16 mask = get_iword(2);
@@ -10970,7 +10970,7 @@ unsigned long REGPARAM2 op_4cf0_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_4cf8_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4cf8_3)(uae_u32 opcode) /* MVMEL */
 {
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
@@ -10980,7 +10980,7 @@ unsigned long REGPARAM2 op_4cf8_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_4cf9_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4cf9_3)(uae_u32 opcode) /* MVMEL */
 {
 {	uae_u16 mask = get_iword(2);
 	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
@@ -10990,7 +10990,7 @@ unsigned long REGPARAM2 op_4cf9_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(8);
 return 8;
 }
-unsigned long REGPARAM2 op_4cfa_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4cfa_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = 2;
 {	uae_u16 mask = get_iword(2);
@@ -11002,7 +11002,7 @@ unsigned long REGPARAM2 op_4cfa_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_4cfb_3(uae_u32 opcode) /* MVMEL */
+unsigned long REGPARAM2 CPUOP_NAME(op_4cfb_3)(uae_u32 opcode) /* MVMEL */
 {
 	uae_u32 dstreg = 3;
 {	uae_u16 mask = get_iword(2);
@@ -11014,7 +11014,7 @@ unsigned long REGPARAM2 op_4cfb_3(uae_u32 opcode) /* MVMEL */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_4e40_3(uae_u32 opcode) /* TRAP */
+unsigned long REGPARAM2 CPUOP_NAME(op_4e40_3)(uae_u32 opcode) /* TRAP */
 {
 	uae_u32 srcreg = (opcode & 15);
 {{	uae_u32 src = srcreg;
@@ -11022,7 +11022,7 @@ m68k_incpc(2);
 	Exception(src+32,0);
 }}return 2;
 }
-unsigned long REGPARAM2 op_4e50_3(uae_u32 opcode) /* LINK */
+unsigned long REGPARAM2 CPUOP_NAME(op_4e50_3)(uae_u32 opcode) /* LINK */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr olda = m68k_areg(regs, 7) - 4;
@@ -11038,7 +11038,7 @@ unsigned long REGPARAM2 op_4e50_3(uae_u32 opcode) /* LINK */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_4e58_3(uae_u32 opcode) /* UNLK */
+unsigned long REGPARAM2 CPUOP_NAME(op_4e58_3)(uae_u32 opcode) /* UNLK */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg(regs, srcreg);
@@ -11052,7 +11052,7 @@ unsigned long REGPARAM2 op_4e58_3(uae_u32 opcode) /* UNLK */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_4e60_3(uae_u32 opcode) /* MVR2USP */
+unsigned long REGPARAM2 CPUOP_NAME(op_4e60_3)(uae_u32 opcode) /* MVR2USP */
 {
 	uae_u32 srcreg = (opcode & 7);
 {if (!regs.s) { Exception(8,0); goto endlabel795; }
@@ -11062,7 +11062,7 @@ unsigned long REGPARAM2 op_4e60_3(uae_u32 opcode) /* MVR2USP */
 endlabel795: ;
 return 2;
 }
-unsigned long REGPARAM2 op_4e68_3(uae_u32 opcode) /* MVUSP2R */
+unsigned long REGPARAM2 CPUOP_NAME(op_4e68_3)(uae_u32 opcode) /* MVUSP2R */
 {
 	uae_u32 srcreg = (opcode & 7);
 {if (!regs.s) { Exception(8,0); goto endlabel796; }
@@ -11072,7 +11072,7 @@ unsigned long REGPARAM2 op_4e68_3(uae_u32 opcode) /* MVUSP2R */
 endlabel796: ;
 return 2;
 }
-unsigned long REGPARAM2 op_4e70_3(uae_u32 opcode) /* RESET */
+unsigned long REGPARAM2 CPUOP_NAME(op_4e70_3)(uae_u32 opcode) /* RESET */
 {
 {if (!regs.s) { Exception(8,0); goto endlabel797; }
 {	customreset();
@@ -11080,12 +11080,12 @@ unsigned long REGPARAM2 op_4e70_3(uae_u32 opcode) /* RESET */
 endlabel797: ;
 return 2;
 }
-unsigned long REGPARAM2 op_4e71_3(uae_u32 opcode) /* NOP */
+unsigned long REGPARAM2 CPUOP_NAME(op_4e71_3)(uae_u32 opcode) /* NOP */
 {
 {}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_4e72_3(uae_u32 opcode) /* STOP */
+unsigned long REGPARAM2 CPUOP_NAME(op_4e72_3)(uae_u32 opcode) /* STOP */
 {
 {if (!regs.s) { Exception(8,0); goto endlabel799; }
 {{	uae_s16 src = get_iword(2);
@@ -11096,7 +11096,7 @@ unsigned long REGPARAM2 op_4e72_3(uae_u32 opcode) /* STOP */
 endlabel799: ;
 return 4;
 }
-unsigned long REGPARAM2 op_4e73_3(uae_u32 opcode) /* RTE */
+unsigned long REGPARAM2 CPUOP_NAME(op_4e73_3)(uae_u32 opcode) /* RTE */
 {
 {if (!regs.s) { Exception(8,0); goto endlabel800; }
 {{	uaecptr sra = m68k_areg(regs, 7);
@@ -11110,7 +11110,7 @@ unsigned long REGPARAM2 op_4e73_3(uae_u32 opcode) /* RTE */
 }}}}}}endlabel800: ;
 return 8;
 }
-unsigned long REGPARAM2 op_4e74_3(uae_u32 opcode) /* RTD */
+unsigned long REGPARAM2 CPUOP_NAME(op_4e74_3)(uae_u32 opcode) /* RTD */
 {
 {	compiler_flush_jsr_stack();
 {	uaecptr pca = m68k_areg(regs, 7);
@@ -11121,19 +11121,19 @@ unsigned long REGPARAM2 op_4e74_3(uae_u32 opcode) /* RTD */
 	m68k_setpc_rte(pc);
 }}}}return 8;
 }
-unsigned long REGPARAM2 op_4e75_3(uae_u32 opcode) /* RTS */
+unsigned long REGPARAM2 CPUOP_NAME(op_4e75_3)(uae_u32 opcode) /* RTS */
 {
 {	m68k_do_rts();
 }return 2;
 }
-unsigned long REGPARAM2 op_4e76_3(uae_u32 opcode) /* TRAPV */
+unsigned long REGPARAM2 CPUOP_NAME(op_4e76_3)(uae_u32 opcode) /* TRAPV */
 {
 {m68k_incpc(2);
 	if (GET_VFLG) { Exception(7,m68k_getpc()); goto endlabel803; }
 }endlabel803: ;
 return 2;
 }
-unsigned long REGPARAM2 op_4e77_3(uae_u32 opcode) /* RTR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4e77_3)(uae_u32 opcode) /* RTR */
 {
 {	compiler_flush_jsr_stack();
 	MakeSR();
@@ -11148,7 +11148,7 @@ unsigned long REGPARAM2 op_4e77_3(uae_u32 opcode) /* RTR */
 	MakeFromSR();
 }}}}}return 8;
 }
-unsigned long REGPARAM2 op_4e90_3(uae_u32 opcode) /* JSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4e90_3)(uae_u32 opcode) /* JSR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -11156,87 +11156,87 @@ if (!Software_ProcessJSR_Ind (m68k_getpc(), srca))
 	m68k_do_jsr(m68k_getpc() + 2, srca);
 }}return 2;
 }
-unsigned long REGPARAM2 op_4ea8_3(uae_u32 opcode) /* JSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ea8_3)(uae_u32 opcode) /* JSR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 	m68k_do_jsr(m68k_getpc() + 4, srca);
 }}return 4;
 }
-unsigned long REGPARAM2 op_4eb0_3(uae_u32 opcode) /* JSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4eb0_3)(uae_u32 opcode) /* JSR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 	m68k_do_jsr(m68k_getpc() + 4, srca);
 }}return 4;
 }
-unsigned long REGPARAM2 op_4eb8_3(uae_u32 opcode) /* JSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4eb8_3)(uae_u32 opcode) /* JSR */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 	m68k_do_jsr(m68k_getpc() + 4, srca);
 }}return 4;
 }
-unsigned long REGPARAM2 op_4eb9_3(uae_u32 opcode) /* JSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4eb9_3)(uae_u32 opcode) /* JSR */
 {
 {{	uaecptr srca = get_ilong(2);
 	m68k_do_jsr(m68k_getpc() + 6, srca);
 }}return 6;
 }
-unsigned long REGPARAM2 op_4eba_3(uae_u32 opcode) /* JSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4eba_3)(uae_u32 opcode) /* JSR */
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 	m68k_do_jsr(m68k_getpc() + 4, srca);
 }}return 4;
 }
-unsigned long REGPARAM2 op_4ebb_3(uae_u32 opcode) /* JSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ebb_3)(uae_u32 opcode) /* JSR */
 {
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 	m68k_do_jsr(m68k_getpc() + 4, srca);
 }}return 4;
 }
-unsigned long REGPARAM2 op_4ed0_3(uae_u32 opcode) /* JMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ed0_3)(uae_u32 opcode) /* JMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_setpc(srca);
 }}return 2;
 }
-unsigned long REGPARAM2 op_4ee8_3(uae_u32 opcode) /* JMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ee8_3)(uae_u32 opcode) /* JMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 	m68k_setpc(srca);
 }}return 4;
 }
-unsigned long REGPARAM2 op_4ef0_3(uae_u32 opcode) /* JMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ef0_3)(uae_u32 opcode) /* JMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 	m68k_setpc(srca);
 }}return 4;
 }
-unsigned long REGPARAM2 op_4ef8_3(uae_u32 opcode) /* JMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ef8_3)(uae_u32 opcode) /* JMP */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 	m68k_setpc(srca);
 }}return 4;
 }
-unsigned long REGPARAM2 op_4ef9_3(uae_u32 opcode) /* JMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_4ef9_3)(uae_u32 opcode) /* JMP */
 {
 {{	uaecptr srca = get_ilong(2);
 	m68k_setpc(srca);
 }}return 6;
 }
-unsigned long REGPARAM2 op_4efa_3(uae_u32 opcode) /* JMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_4efa_3)(uae_u32 opcode) /* JMP */
 {
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 	m68k_setpc(srca);
 }}return 4;
 }
-unsigned long REGPARAM2 op_4efb_3(uae_u32 opcode) /* JMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_4efb_3)(uae_u32 opcode) /* JMP */
 {
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
@@ -11246,7 +11246,7 @@ unsigned long REGPARAM2 op_4efb_3(uae_u32 opcode) /* JMP */
 #endif
 
 #ifdef PART_5
-unsigned long REGPARAM2 op_5000_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5000_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11265,7 +11265,7 @@ unsigned long REGPARAM2 op_5000_3(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5010_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5010_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11285,7 +11285,7 @@ unsigned long REGPARAM2 op_5010_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_5018_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5018_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11306,7 +11306,7 @@ unsigned long REGPARAM2 op_5018_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_5020_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5020_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11328,7 +11328,7 @@ unsigned long REGPARAM2 op_5020_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_5028_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5028_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11348,7 +11348,7 @@ unsigned long REGPARAM2 op_5028_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_5030_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5030_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11368,7 +11368,7 @@ unsigned long REGPARAM2 op_5030_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_5038_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5038_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
@@ -11387,7 +11387,7 @@ unsigned long REGPARAM2 op_5038_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_5039_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5039_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
@@ -11406,7 +11406,7 @@ unsigned long REGPARAM2 op_5039_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_5040_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5040_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11425,7 +11425,7 @@ unsigned long REGPARAM2 op_5040_3(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5048_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_5048_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11437,7 +11437,7 @@ unsigned long REGPARAM2 op_5048_3(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5050_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5050_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11457,7 +11457,7 @@ unsigned long REGPARAM2 op_5050_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_5058_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5058_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11478,7 +11478,7 @@ unsigned long REGPARAM2 op_5058_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_5060_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5060_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11500,7 +11500,7 @@ unsigned long REGPARAM2 op_5060_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_5068_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5068_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11520,7 +11520,7 @@ unsigned long REGPARAM2 op_5068_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_5070_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5070_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11540,7 +11540,7 @@ unsigned long REGPARAM2 op_5070_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_5078_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5078_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
@@ -11559,7 +11559,7 @@ unsigned long REGPARAM2 op_5078_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_5079_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5079_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
@@ -11578,7 +11578,7 @@ unsigned long REGPARAM2 op_5079_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_5080_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5080_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11597,7 +11597,7 @@ unsigned long REGPARAM2 op_5080_3(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5088_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_5088_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11609,7 +11609,7 @@ unsigned long REGPARAM2 op_5088_3(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5090_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5090_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11629,7 +11629,7 @@ unsigned long REGPARAM2 op_5090_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_5098_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_5098_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11650,7 +11650,7 @@ unsigned long REGPARAM2 op_5098_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_50a0_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_50a0_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11672,7 +11672,7 @@ unsigned long REGPARAM2 op_50a0_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_50a8_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_50a8_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11692,7 +11692,7 @@ unsigned long REGPARAM2 op_50a8_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_50b0_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_50b0_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11712,7 +11712,7 @@ unsigned long REGPARAM2 op_50b0_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_50b8_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_50b8_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
@@ -11731,7 +11731,7 @@ unsigned long REGPARAM2 op_50b8_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_50b9_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_50b9_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
@@ -11750,7 +11750,7 @@ unsigned long REGPARAM2 op_50b9_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_50c0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_50c0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(0) ? 0xff : 0;
@@ -11762,7 +11762,7 @@ unsigned long REGPARAM2 op_50c0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_50c8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_50c8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -11782,7 +11782,7 @@ unsigned long REGPARAM2 op_50c8_3(uae_u32 opcode) /* DBcc */
 endlabel846: ;
 return 4;
 }
-unsigned long REGPARAM2 op_50d0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_50d0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -11791,7 +11791,7 @@ unsigned long REGPARAM2 op_50d0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_50d8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_50d8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -11801,7 +11801,7 @@ unsigned long REGPARAM2 op_50d8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_50e0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_50e0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -11812,7 +11812,7 @@ unsigned long REGPARAM2 op_50e0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_50e8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_50e8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -11821,7 +11821,7 @@ unsigned long REGPARAM2 op_50e8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_50f0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_50f0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -11830,7 +11830,7 @@ unsigned long REGPARAM2 op_50f0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_50f8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_50f8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(0) ? 0xff : 0;
@@ -11838,7 +11838,7 @@ unsigned long REGPARAM2 op_50f8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_50f9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_50f9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(0) ? 0xff : 0;
@@ -11846,7 +11846,7 @@ unsigned long REGPARAM2 op_50f9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_5100_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5100_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11865,7 +11865,7 @@ unsigned long REGPARAM2 op_5100_3(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5110_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5110_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11885,7 +11885,7 @@ unsigned long REGPARAM2 op_5110_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_5118_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5118_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11906,7 +11906,7 @@ unsigned long REGPARAM2 op_5118_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_5120_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5120_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11928,7 +11928,7 @@ unsigned long REGPARAM2 op_5120_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_5128_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5128_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11948,7 +11948,7 @@ unsigned long REGPARAM2 op_5128_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_5130_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5130_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -11968,7 +11968,7 @@ unsigned long REGPARAM2 op_5130_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_5138_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5138_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
@@ -11987,7 +11987,7 @@ unsigned long REGPARAM2 op_5138_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_5139_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5139_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
@@ -12006,7 +12006,7 @@ unsigned long REGPARAM2 op_5139_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_5140_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5140_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -12025,7 +12025,7 @@ unsigned long REGPARAM2 op_5140_3(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5148_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_5148_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -12037,7 +12037,7 @@ unsigned long REGPARAM2 op_5148_3(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5150_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5150_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -12057,7 +12057,7 @@ unsigned long REGPARAM2 op_5150_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_5158_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5158_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -12078,7 +12078,7 @@ unsigned long REGPARAM2 op_5158_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_5160_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5160_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -12100,7 +12100,7 @@ unsigned long REGPARAM2 op_5160_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_5168_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5168_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -12120,7 +12120,7 @@ unsigned long REGPARAM2 op_5168_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_5170_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5170_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -12140,7 +12140,7 @@ unsigned long REGPARAM2 op_5170_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_5178_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5178_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
@@ -12159,7 +12159,7 @@ unsigned long REGPARAM2 op_5178_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_5179_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5179_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
@@ -12178,7 +12178,7 @@ unsigned long REGPARAM2 op_5179_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_5180_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5180_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -12197,7 +12197,7 @@ unsigned long REGPARAM2 op_5180_3(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5188_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_5188_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -12209,7 +12209,7 @@ unsigned long REGPARAM2 op_5188_3(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5190_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5190_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -12229,7 +12229,7 @@ unsigned long REGPARAM2 op_5190_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_5198_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_5198_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -12250,7 +12250,7 @@ unsigned long REGPARAM2 op_5198_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_51a0_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_51a0_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -12272,7 +12272,7 @@ unsigned long REGPARAM2 op_51a0_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_51a8_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_51a8_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -12292,7 +12292,7 @@ unsigned long REGPARAM2 op_51a8_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_51b0_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_51b0_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -12312,7 +12312,7 @@ unsigned long REGPARAM2 op_51b0_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_51b8_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_51b8_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
@@ -12331,7 +12331,7 @@ unsigned long REGPARAM2 op_51b8_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_51b9_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_51b9_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 {{	uae_u32 src = srcreg;
@@ -12350,7 +12350,7 @@ unsigned long REGPARAM2 op_51b9_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_51c0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_51c0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(1) ? 0xff : 0;
@@ -12362,7 +12362,7 @@ unsigned long REGPARAM2 op_51c0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_51c8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_51c8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -12382,7 +12382,7 @@ unsigned long REGPARAM2 op_51c8_3(uae_u32 opcode) /* DBcc */
 endlabel881: ;
 return 4;
 }
-unsigned long REGPARAM2 op_51d0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_51d0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -12391,7 +12391,7 @@ unsigned long REGPARAM2 op_51d0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_51d8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_51d8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -12401,7 +12401,7 @@ unsigned long REGPARAM2 op_51d8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_51e0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_51e0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -12412,7 +12412,7 @@ unsigned long REGPARAM2 op_51e0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_51e8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_51e8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -12421,7 +12421,7 @@ unsigned long REGPARAM2 op_51e8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_51f0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_51f0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -12430,7 +12430,7 @@ unsigned long REGPARAM2 op_51f0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_51f8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_51f8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(1) ? 0xff : 0;
@@ -12438,7 +12438,7 @@ unsigned long REGPARAM2 op_51f8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_51f9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_51f9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(1) ? 0xff : 0;
@@ -12446,7 +12446,7 @@ unsigned long REGPARAM2 op_51f9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_52c0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_52c0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(2) ? 0xff : 0;
@@ -12458,7 +12458,7 @@ unsigned long REGPARAM2 op_52c0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_52c8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_52c8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -12478,7 +12478,7 @@ unsigned long REGPARAM2 op_52c8_3(uae_u32 opcode) /* DBcc */
 endlabel890: ;
 return 4;
 }
-unsigned long REGPARAM2 op_52d0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_52d0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -12487,7 +12487,7 @@ unsigned long REGPARAM2 op_52d0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_52d8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_52d8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -12497,7 +12497,7 @@ unsigned long REGPARAM2 op_52d8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_52e0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_52e0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -12508,7 +12508,7 @@ unsigned long REGPARAM2 op_52e0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_52e8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_52e8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -12517,7 +12517,7 @@ unsigned long REGPARAM2 op_52e8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_52f0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_52f0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -12526,7 +12526,7 @@ unsigned long REGPARAM2 op_52f0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_52f8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_52f8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(2) ? 0xff : 0;
@@ -12534,7 +12534,7 @@ unsigned long REGPARAM2 op_52f8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_52f9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_52f9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(2) ? 0xff : 0;
@@ -12542,7 +12542,7 @@ unsigned long REGPARAM2 op_52f9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_53c0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_53c0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(3) ? 0xff : 0;
@@ -12554,7 +12554,7 @@ unsigned long REGPARAM2 op_53c0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_53c8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_53c8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -12574,7 +12574,7 @@ unsigned long REGPARAM2 op_53c8_3(uae_u32 opcode) /* DBcc */
 endlabel899: ;
 return 4;
 }
-unsigned long REGPARAM2 op_53d0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_53d0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -12583,7 +12583,7 @@ unsigned long REGPARAM2 op_53d0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_53d8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_53d8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -12593,7 +12593,7 @@ unsigned long REGPARAM2 op_53d8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_53e0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_53e0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -12604,7 +12604,7 @@ unsigned long REGPARAM2 op_53e0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_53e8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_53e8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -12613,7 +12613,7 @@ unsigned long REGPARAM2 op_53e8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_53f0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_53f0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -12622,7 +12622,7 @@ unsigned long REGPARAM2 op_53f0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_53f8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_53f8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(3) ? 0xff : 0;
@@ -12630,7 +12630,7 @@ unsigned long REGPARAM2 op_53f8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_53f9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_53f9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(3) ? 0xff : 0;
@@ -12638,7 +12638,7 @@ unsigned long REGPARAM2 op_53f9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_54c0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_54c0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(4) ? 0xff : 0;
@@ -12650,7 +12650,7 @@ unsigned long REGPARAM2 op_54c0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_54c8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_54c8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -12670,7 +12670,7 @@ unsigned long REGPARAM2 op_54c8_3(uae_u32 opcode) /* DBcc */
 endlabel908: ;
 return 4;
 }
-unsigned long REGPARAM2 op_54d0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_54d0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -12679,7 +12679,7 @@ unsigned long REGPARAM2 op_54d0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_54d8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_54d8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -12689,7 +12689,7 @@ unsigned long REGPARAM2 op_54d8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_54e0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_54e0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -12700,7 +12700,7 @@ unsigned long REGPARAM2 op_54e0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_54e8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_54e8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -12709,7 +12709,7 @@ unsigned long REGPARAM2 op_54e8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_54f0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_54f0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -12718,7 +12718,7 @@ unsigned long REGPARAM2 op_54f0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_54f8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_54f8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(4) ? 0xff : 0;
@@ -12726,7 +12726,7 @@ unsigned long REGPARAM2 op_54f8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_54f9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_54f9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(4) ? 0xff : 0;
@@ -12734,7 +12734,7 @@ unsigned long REGPARAM2 op_54f9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_55c0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_55c0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(5) ? 0xff : 0;
@@ -12746,7 +12746,7 @@ unsigned long REGPARAM2 op_55c0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_55c8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_55c8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -12766,7 +12766,7 @@ unsigned long REGPARAM2 op_55c8_3(uae_u32 opcode) /* DBcc */
 endlabel917: ;
 return 4;
 }
-unsigned long REGPARAM2 op_55d0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_55d0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -12775,7 +12775,7 @@ unsigned long REGPARAM2 op_55d0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_55d8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_55d8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -12785,7 +12785,7 @@ unsigned long REGPARAM2 op_55d8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_55e0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_55e0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -12796,7 +12796,7 @@ unsigned long REGPARAM2 op_55e0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_55e8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_55e8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -12805,7 +12805,7 @@ unsigned long REGPARAM2 op_55e8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_55f0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_55f0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -12814,7 +12814,7 @@ unsigned long REGPARAM2 op_55f0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_55f8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_55f8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(5) ? 0xff : 0;
@@ -12822,7 +12822,7 @@ unsigned long REGPARAM2 op_55f8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_55f9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_55f9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(5) ? 0xff : 0;
@@ -12830,7 +12830,7 @@ unsigned long REGPARAM2 op_55f9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_56c0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_56c0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(6) ? 0xff : 0;
@@ -12842,7 +12842,7 @@ unsigned long REGPARAM2 op_56c0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_56c8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_56c8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -12862,7 +12862,7 @@ unsigned long REGPARAM2 op_56c8_3(uae_u32 opcode) /* DBcc */
 endlabel926: ;
 return 4;
 }
-unsigned long REGPARAM2 op_56d0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_56d0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -12871,7 +12871,7 @@ unsigned long REGPARAM2 op_56d0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_56d8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_56d8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -12881,7 +12881,7 @@ unsigned long REGPARAM2 op_56d8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_56e0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_56e0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -12892,7 +12892,7 @@ unsigned long REGPARAM2 op_56e0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_56e8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_56e8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -12901,7 +12901,7 @@ unsigned long REGPARAM2 op_56e8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_56f0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_56f0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -12910,7 +12910,7 @@ unsigned long REGPARAM2 op_56f0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_56f8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_56f8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(6) ? 0xff : 0;
@@ -12918,7 +12918,7 @@ unsigned long REGPARAM2 op_56f8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_56f9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_56f9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(6) ? 0xff : 0;
@@ -12926,7 +12926,7 @@ unsigned long REGPARAM2 op_56f9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_57c0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_57c0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(7) ? 0xff : 0;
@@ -12938,7 +12938,7 @@ unsigned long REGPARAM2 op_57c0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_57c8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_57c8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -12958,7 +12958,7 @@ unsigned long REGPARAM2 op_57c8_3(uae_u32 opcode) /* DBcc */
 endlabel935: ;
 return 4;
 }
-unsigned long REGPARAM2 op_57d0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_57d0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -12967,7 +12967,7 @@ unsigned long REGPARAM2 op_57d0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_57d8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_57d8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -12977,7 +12977,7 @@ unsigned long REGPARAM2 op_57d8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_57e0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_57e0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -12988,7 +12988,7 @@ unsigned long REGPARAM2 op_57e0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_57e8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_57e8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -12997,7 +12997,7 @@ unsigned long REGPARAM2 op_57e8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_57f0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_57f0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -13006,7 +13006,7 @@ unsigned long REGPARAM2 op_57f0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_57f8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_57f8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(7) ? 0xff : 0;
@@ -13014,7 +13014,7 @@ unsigned long REGPARAM2 op_57f8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_57f9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_57f9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(7) ? 0xff : 0;
@@ -13022,7 +13022,7 @@ unsigned long REGPARAM2 op_57f9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_58c0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_58c0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(8) ? 0xff : 0;
@@ -13034,7 +13034,7 @@ unsigned long REGPARAM2 op_58c0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_58c8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_58c8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -13054,7 +13054,7 @@ unsigned long REGPARAM2 op_58c8_3(uae_u32 opcode) /* DBcc */
 endlabel944: ;
 return 4;
 }
-unsigned long REGPARAM2 op_58d0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_58d0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13063,7 +13063,7 @@ unsigned long REGPARAM2 op_58d0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_58d8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_58d8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13073,7 +13073,7 @@ unsigned long REGPARAM2 op_58d8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_58e0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_58e0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -13084,7 +13084,7 @@ unsigned long REGPARAM2 op_58e0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_58e8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_58e8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -13093,7 +13093,7 @@ unsigned long REGPARAM2 op_58e8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_58f0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_58f0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -13102,7 +13102,7 @@ unsigned long REGPARAM2 op_58f0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_58f8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_58f8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(8) ? 0xff : 0;
@@ -13110,7 +13110,7 @@ unsigned long REGPARAM2 op_58f8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_58f9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_58f9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(8) ? 0xff : 0;
@@ -13118,7 +13118,7 @@ unsigned long REGPARAM2 op_58f9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_59c0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_59c0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(9) ? 0xff : 0;
@@ -13130,7 +13130,7 @@ unsigned long REGPARAM2 op_59c0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_59c8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_59c8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -13150,7 +13150,7 @@ unsigned long REGPARAM2 op_59c8_3(uae_u32 opcode) /* DBcc */
 endlabel953: ;
 return 4;
 }
-unsigned long REGPARAM2 op_59d0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_59d0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13159,7 +13159,7 @@ unsigned long REGPARAM2 op_59d0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_59d8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_59d8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13169,7 +13169,7 @@ unsigned long REGPARAM2 op_59d8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_59e0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_59e0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -13180,7 +13180,7 @@ unsigned long REGPARAM2 op_59e0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_59e8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_59e8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -13189,7 +13189,7 @@ unsigned long REGPARAM2 op_59e8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_59f0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_59f0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -13198,7 +13198,7 @@ unsigned long REGPARAM2 op_59f0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_59f8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_59f8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(9) ? 0xff : 0;
@@ -13206,7 +13206,7 @@ unsigned long REGPARAM2 op_59f8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_59f9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_59f9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(9) ? 0xff : 0;
@@ -13214,7 +13214,7 @@ unsigned long REGPARAM2 op_59f9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_5ac0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ac0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(10) ? 0xff : 0;
@@ -13226,7 +13226,7 @@ unsigned long REGPARAM2 op_5ac0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5ac8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ac8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -13246,7 +13246,7 @@ unsigned long REGPARAM2 op_5ac8_3(uae_u32 opcode) /* DBcc */
 endlabel962: ;
 return 4;
 }
-unsigned long REGPARAM2 op_5ad0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ad0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13255,7 +13255,7 @@ unsigned long REGPARAM2 op_5ad0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5ad8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ad8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13265,7 +13265,7 @@ unsigned long REGPARAM2 op_5ad8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5ae0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ae0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -13276,7 +13276,7 @@ unsigned long REGPARAM2 op_5ae0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5ae8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ae8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -13285,7 +13285,7 @@ unsigned long REGPARAM2 op_5ae8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5af0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5af0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -13294,7 +13294,7 @@ unsigned long REGPARAM2 op_5af0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5af8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5af8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(10) ? 0xff : 0;
@@ -13302,7 +13302,7 @@ unsigned long REGPARAM2 op_5af8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5af9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5af9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(10) ? 0xff : 0;
@@ -13310,7 +13310,7 @@ unsigned long REGPARAM2 op_5af9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_5bc0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5bc0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(11) ? 0xff : 0;
@@ -13322,7 +13322,7 @@ unsigned long REGPARAM2 op_5bc0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5bc8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5bc8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -13342,7 +13342,7 @@ unsigned long REGPARAM2 op_5bc8_3(uae_u32 opcode) /* DBcc */
 endlabel971: ;
 return 4;
 }
-unsigned long REGPARAM2 op_5bd0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5bd0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13351,7 +13351,7 @@ unsigned long REGPARAM2 op_5bd0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5bd8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5bd8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13361,7 +13361,7 @@ unsigned long REGPARAM2 op_5bd8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5be0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5be0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -13372,7 +13372,7 @@ unsigned long REGPARAM2 op_5be0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5be8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5be8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -13381,7 +13381,7 @@ unsigned long REGPARAM2 op_5be8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5bf0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5bf0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -13390,7 +13390,7 @@ unsigned long REGPARAM2 op_5bf0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5bf8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5bf8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(11) ? 0xff : 0;
@@ -13398,7 +13398,7 @@ unsigned long REGPARAM2 op_5bf8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5bf9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5bf9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(11) ? 0xff : 0;
@@ -13406,7 +13406,7 @@ unsigned long REGPARAM2 op_5bf9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_5cc0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5cc0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(12) ? 0xff : 0;
@@ -13418,7 +13418,7 @@ unsigned long REGPARAM2 op_5cc0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5cc8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5cc8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -13438,7 +13438,7 @@ unsigned long REGPARAM2 op_5cc8_3(uae_u32 opcode) /* DBcc */
 endlabel980: ;
 return 4;
 }
-unsigned long REGPARAM2 op_5cd0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5cd0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13447,7 +13447,7 @@ unsigned long REGPARAM2 op_5cd0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5cd8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5cd8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13457,7 +13457,7 @@ unsigned long REGPARAM2 op_5cd8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5ce0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ce0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -13468,7 +13468,7 @@ unsigned long REGPARAM2 op_5ce0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5ce8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ce8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -13477,7 +13477,7 @@ unsigned long REGPARAM2 op_5ce8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5cf0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5cf0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -13486,7 +13486,7 @@ unsigned long REGPARAM2 op_5cf0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5cf8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5cf8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(12) ? 0xff : 0;
@@ -13494,7 +13494,7 @@ unsigned long REGPARAM2 op_5cf8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5cf9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5cf9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(12) ? 0xff : 0;
@@ -13502,7 +13502,7 @@ unsigned long REGPARAM2 op_5cf9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_5dc0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5dc0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(13) ? 0xff : 0;
@@ -13514,7 +13514,7 @@ unsigned long REGPARAM2 op_5dc0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5dc8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5dc8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -13534,7 +13534,7 @@ unsigned long REGPARAM2 op_5dc8_3(uae_u32 opcode) /* DBcc */
 endlabel989: ;
 return 4;
 }
-unsigned long REGPARAM2 op_5dd0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5dd0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13543,7 +13543,7 @@ unsigned long REGPARAM2 op_5dd0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5dd8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5dd8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13553,7 +13553,7 @@ unsigned long REGPARAM2 op_5dd8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5de0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5de0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -13564,7 +13564,7 @@ unsigned long REGPARAM2 op_5de0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5de8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5de8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -13573,7 +13573,7 @@ unsigned long REGPARAM2 op_5de8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5df0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5df0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -13582,7 +13582,7 @@ unsigned long REGPARAM2 op_5df0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5df8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5df8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(13) ? 0xff : 0;
@@ -13590,7 +13590,7 @@ unsigned long REGPARAM2 op_5df8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5df9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5df9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(13) ? 0xff : 0;
@@ -13598,7 +13598,7 @@ unsigned long REGPARAM2 op_5df9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_5ec0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ec0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(14) ? 0xff : 0;
@@ -13610,7 +13610,7 @@ unsigned long REGPARAM2 op_5ec0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5ec8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ec8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -13630,7 +13630,7 @@ unsigned long REGPARAM2 op_5ec8_3(uae_u32 opcode) /* DBcc */
 endlabel998: ;
 return 4;
 }
-unsigned long REGPARAM2 op_5ed0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ed0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13639,7 +13639,7 @@ unsigned long REGPARAM2 op_5ed0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5ed8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ed8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13649,7 +13649,7 @@ unsigned long REGPARAM2 op_5ed8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5ee0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ee0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -13660,7 +13660,7 @@ unsigned long REGPARAM2 op_5ee0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5ee8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ee8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -13669,7 +13669,7 @@ unsigned long REGPARAM2 op_5ee8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5ef0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ef0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -13678,7 +13678,7 @@ unsigned long REGPARAM2 op_5ef0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5ef8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ef8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(14) ? 0xff : 0;
@@ -13686,7 +13686,7 @@ unsigned long REGPARAM2 op_5ef8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5ef9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ef9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(14) ? 0xff : 0;
@@ -13697,7 +13697,7 @@ return 8;
 #endif
 
 #ifdef PART_6
-unsigned long REGPARAM2 op_5fc0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5fc0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{{	int val = cctrue(15) ? 0xff : 0;
@@ -13709,7 +13709,7 @@ unsigned long REGPARAM2 op_5fc0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_5fc8_3(uae_u32 opcode) /* DBcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5fc8_3)(uae_u32 opcode) /* DBcc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -13729,7 +13729,7 @@ unsigned long REGPARAM2 op_5fc8_3(uae_u32 opcode) /* DBcc */
 endlabel1007: ;
 return 4;
 }
-unsigned long REGPARAM2 op_5fd0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5fd0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13738,7 +13738,7 @@ unsigned long REGPARAM2 op_5fd0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5fd8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5fd8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
@@ -13748,7 +13748,7 @@ unsigned long REGPARAM2 op_5fd8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5fe0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5fe0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
@@ -13759,7 +13759,7 @@ unsigned long REGPARAM2 op_5fe0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_5fe8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5fe8_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -13768,7 +13768,7 @@ unsigned long REGPARAM2 op_5fe8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5ff0_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ff0_3)(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -13777,7 +13777,7 @@ unsigned long REGPARAM2 op_5ff0_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5ff8_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ff8_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	int val = cctrue(15) ? 0xff : 0;
@@ -13785,7 +13785,7 @@ unsigned long REGPARAM2 op_5ff8_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_5ff9_3(uae_u32 opcode) /* Scc */
+unsigned long REGPARAM2 CPUOP_NAME(op_5ff9_3)(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
 {	int val = cctrue(15) ? 0xff : 0;
@@ -13793,7 +13793,7 @@ unsigned long REGPARAM2 op_5ff9_3(uae_u32 opcode) /* Scc */
 }}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_6000_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6000_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(0)) goto didnt_jump;
@@ -13808,7 +13808,7 @@ didnt_jump:;
 endlabel1015: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6001_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6001_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -13824,7 +13824,7 @@ didnt_jump:;
 endlabel1016: ;
 return 2;
 }
-unsigned long REGPARAM2 op_60ff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_60ff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(0)) goto endlabel1017;
@@ -13844,14 +13844,14 @@ didnt_jump:;
 endlabel1017: ;
 return 6;
 }
-unsigned long REGPARAM2 op_6100_3(uae_u32 opcode) /* BSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_6100_3)(uae_u32 opcode) /* BSR */
 {
 {{	uae_s16 src = get_iword(2);
 	uae_s32 s = (uae_s32)src + 2;
 	m68k_do_bsr(m68k_getpc() + 4, s);
 }}return 4;
 }
-unsigned long REGPARAM2 op_6101_3(uae_u32 opcode) /* BSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_6101_3)(uae_u32 opcode) /* BSR */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -13859,14 +13859,14 @@ unsigned long REGPARAM2 op_6101_3(uae_u32 opcode) /* BSR */
 	m68k_do_bsr(m68k_getpc() + 2, s);
 }}return 2;
 }
-unsigned long REGPARAM2 op_61ff_3(uae_u32 opcode) /* BSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_61ff_3)(uae_u32 opcode) /* BSR */
 {
 {{	uae_s32 src = get_ilong(2);
 	uae_s32 s = (uae_s32)src + 2;
 	m68k_do_bsr(m68k_getpc() + 6, s);
 }}return 6;
 }
-unsigned long REGPARAM2 op_6200_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6200_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(2)) goto didnt_jump;
@@ -13881,7 +13881,7 @@ didnt_jump:;
 endlabel1021: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6201_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6201_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -13897,7 +13897,7 @@ didnt_jump:;
 endlabel1022: ;
 return 2;
 }
-unsigned long REGPARAM2 op_62ff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_62ff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(2)) goto endlabel1023;
@@ -13917,7 +13917,7 @@ didnt_jump:;
 endlabel1023: ;
 return 6;
 }
-unsigned long REGPARAM2 op_6300_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6300_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(3)) goto didnt_jump;
@@ -13932,7 +13932,7 @@ didnt_jump:;
 endlabel1024: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6301_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6301_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -13948,7 +13948,7 @@ didnt_jump:;
 endlabel1025: ;
 return 2;
 }
-unsigned long REGPARAM2 op_63ff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_63ff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(3)) goto endlabel1026;
@@ -13968,7 +13968,7 @@ didnt_jump:;
 endlabel1026: ;
 return 6;
 }
-unsigned long REGPARAM2 op_6400_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6400_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(4)) goto didnt_jump;
@@ -13983,7 +13983,7 @@ didnt_jump:;
 endlabel1027: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6401_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6401_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -13999,7 +13999,7 @@ didnt_jump:;
 endlabel1028: ;
 return 2;
 }
-unsigned long REGPARAM2 op_64ff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_64ff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(4)) goto endlabel1029;
@@ -14019,7 +14019,7 @@ didnt_jump:;
 endlabel1029: ;
 return 6;
 }
-unsigned long REGPARAM2 op_6500_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6500_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(5)) goto didnt_jump;
@@ -14034,7 +14034,7 @@ didnt_jump:;
 endlabel1030: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6501_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6501_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -14050,7 +14050,7 @@ didnt_jump:;
 endlabel1031: ;
 return 2;
 }
-unsigned long REGPARAM2 op_65ff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_65ff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(5)) goto endlabel1032;
@@ -14070,7 +14070,7 @@ didnt_jump:;
 endlabel1032: ;
 return 6;
 }
-unsigned long REGPARAM2 op_6600_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6600_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(6)) goto didnt_jump;
@@ -14085,7 +14085,7 @@ didnt_jump:;
 endlabel1033: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6601_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6601_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -14101,7 +14101,7 @@ didnt_jump:;
 endlabel1034: ;
 return 2;
 }
-unsigned long REGPARAM2 op_66ff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_66ff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(6)) goto endlabel1035;
@@ -14121,7 +14121,7 @@ didnt_jump:;
 endlabel1035: ;
 return 6;
 }
-unsigned long REGPARAM2 op_6700_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6700_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(7)) goto didnt_jump;
@@ -14136,7 +14136,7 @@ didnt_jump:;
 endlabel1036: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6701_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6701_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -14152,7 +14152,7 @@ didnt_jump:;
 endlabel1037: ;
 return 2;
 }
-unsigned long REGPARAM2 op_67ff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_67ff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(7)) goto endlabel1038;
@@ -14172,7 +14172,7 @@ didnt_jump:;
 endlabel1038: ;
 return 6;
 }
-unsigned long REGPARAM2 op_6800_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6800_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(8)) goto didnt_jump;
@@ -14187,7 +14187,7 @@ didnt_jump:;
 endlabel1039: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6801_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6801_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -14203,7 +14203,7 @@ didnt_jump:;
 endlabel1040: ;
 return 2;
 }
-unsigned long REGPARAM2 op_68ff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_68ff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(8)) goto endlabel1041;
@@ -14223,7 +14223,7 @@ didnt_jump:;
 endlabel1041: ;
 return 6;
 }
-unsigned long REGPARAM2 op_6900_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6900_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(9)) goto didnt_jump;
@@ -14238,7 +14238,7 @@ didnt_jump:;
 endlabel1042: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6901_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6901_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -14254,7 +14254,7 @@ didnt_jump:;
 endlabel1043: ;
 return 2;
 }
-unsigned long REGPARAM2 op_69ff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_69ff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(9)) goto endlabel1044;
@@ -14274,7 +14274,7 @@ didnt_jump:;
 endlabel1044: ;
 return 6;
 }
-unsigned long REGPARAM2 op_6a00_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6a00_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(10)) goto didnt_jump;
@@ -14289,7 +14289,7 @@ didnt_jump:;
 endlabel1045: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6a01_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6a01_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -14305,7 +14305,7 @@ didnt_jump:;
 endlabel1046: ;
 return 2;
 }
-unsigned long REGPARAM2 op_6aff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6aff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(10)) goto endlabel1047;
@@ -14325,7 +14325,7 @@ didnt_jump:;
 endlabel1047: ;
 return 6;
 }
-unsigned long REGPARAM2 op_6b00_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6b00_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(11)) goto didnt_jump;
@@ -14340,7 +14340,7 @@ didnt_jump:;
 endlabel1048: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6b01_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6b01_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -14356,7 +14356,7 @@ didnt_jump:;
 endlabel1049: ;
 return 2;
 }
-unsigned long REGPARAM2 op_6bff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6bff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(11)) goto endlabel1050;
@@ -14376,7 +14376,7 @@ didnt_jump:;
 endlabel1050: ;
 return 6;
 }
-unsigned long REGPARAM2 op_6c00_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6c00_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(12)) goto didnt_jump;
@@ -14391,7 +14391,7 @@ didnt_jump:;
 endlabel1051: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6c01_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6c01_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -14407,7 +14407,7 @@ didnt_jump:;
 endlabel1052: ;
 return 2;
 }
-unsigned long REGPARAM2 op_6cff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6cff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(12)) goto endlabel1053;
@@ -14427,7 +14427,7 @@ didnt_jump:;
 endlabel1053: ;
 return 6;
 }
-unsigned long REGPARAM2 op_6d00_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6d00_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(13)) goto didnt_jump;
@@ -14442,7 +14442,7 @@ didnt_jump:;
 endlabel1054: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6d01_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6d01_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -14458,7 +14458,7 @@ didnt_jump:;
 endlabel1055: ;
 return 2;
 }
-unsigned long REGPARAM2 op_6dff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6dff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(13)) goto endlabel1056;
@@ -14478,7 +14478,7 @@ didnt_jump:;
 endlabel1056: ;
 return 6;
 }
-unsigned long REGPARAM2 op_6e00_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6e00_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(14)) goto didnt_jump;
@@ -14493,7 +14493,7 @@ didnt_jump:;
 endlabel1057: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6e01_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6e01_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -14509,7 +14509,7 @@ didnt_jump:;
 endlabel1058: ;
 return 2;
 }
-unsigned long REGPARAM2 op_6eff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6eff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(14)) goto endlabel1059;
@@ -14529,7 +14529,7 @@ didnt_jump:;
 endlabel1059: ;
 return 6;
 }
-unsigned long REGPARAM2 op_6f00_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6f00_3)(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
 	if (!cctrue(15)) goto didnt_jump;
@@ -14544,7 +14544,7 @@ didnt_jump:;
 endlabel1060: ;
 return 4;
 }
-unsigned long REGPARAM2 op_6f01_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6f01_3)(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
@@ -14560,7 +14560,7 @@ didnt_jump:;
 endlabel1061: ;
 return 2;
 }
-unsigned long REGPARAM2 op_6fff_3(uae_u32 opcode) /* Bcc */
+unsigned long REGPARAM2 CPUOP_NAME(op_6fff_3)(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
 	if (!cctrue(15)) goto endlabel1062;
@@ -14580,7 +14580,7 @@ didnt_jump:;
 endlabel1062: ;
 return 6;
 }
-unsigned long REGPARAM2 op_7000_3(uae_u32 opcode) /* MOVE */
+unsigned long REGPARAM2 CPUOP_NAME(op_7000_3)(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14592,7 +14592,7 @@ unsigned long REGPARAM2 op_7000_3(uae_u32 opcode) /* MOVE */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_8000_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8000_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14606,7 +14606,7 @@ unsigned long REGPARAM2 op_8000_3(uae_u32 opcode) /* OR */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_8010_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8010_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14621,7 +14621,7 @@ unsigned long REGPARAM2 op_8010_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_8018_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8018_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14637,7 +14637,7 @@ unsigned long REGPARAM2 op_8018_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_8020_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8020_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14654,7 +14654,7 @@ unsigned long REGPARAM2 op_8020_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_8028_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8028_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14669,7 +14669,7 @@ unsigned long REGPARAM2 op_8028_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_8030_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8030_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14684,7 +14684,7 @@ unsigned long REGPARAM2 op_8030_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_8038_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8038_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -14698,7 +14698,7 @@ unsigned long REGPARAM2 op_8038_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_8039_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8039_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -14712,7 +14712,7 @@ unsigned long REGPARAM2 op_8039_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_803a_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_803a_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -14727,7 +14727,7 @@ unsigned long REGPARAM2 op_803a_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_803b_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_803b_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -14742,7 +14742,7 @@ unsigned long REGPARAM2 op_803b_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_803c_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_803c_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -14755,7 +14755,7 @@ unsigned long REGPARAM2 op_803c_3(uae_u32 opcode) /* OR */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_8040_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8040_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14769,7 +14769,7 @@ unsigned long REGPARAM2 op_8040_3(uae_u32 opcode) /* OR */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_8050_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8050_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14784,7 +14784,7 @@ unsigned long REGPARAM2 op_8050_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_8058_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8058_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14800,7 +14800,7 @@ unsigned long REGPARAM2 op_8058_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_8060_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8060_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14817,7 +14817,7 @@ unsigned long REGPARAM2 op_8060_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_8068_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8068_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14832,7 +14832,7 @@ unsigned long REGPARAM2 op_8068_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_8070_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8070_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14847,7 +14847,7 @@ unsigned long REGPARAM2 op_8070_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_8078_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8078_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -14861,7 +14861,7 @@ unsigned long REGPARAM2 op_8078_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_8079_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8079_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -14875,7 +14875,7 @@ unsigned long REGPARAM2 op_8079_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_807a_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_807a_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -14890,7 +14890,7 @@ unsigned long REGPARAM2 op_807a_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_807b_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_807b_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -14905,7 +14905,7 @@ unsigned long REGPARAM2 op_807b_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_807c_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_807c_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -14918,7 +14918,7 @@ unsigned long REGPARAM2 op_807c_3(uae_u32 opcode) /* OR */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_8080_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8080_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14932,7 +14932,7 @@ unsigned long REGPARAM2 op_8080_3(uae_u32 opcode) /* OR */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_8090_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8090_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14947,7 +14947,7 @@ unsigned long REGPARAM2 op_8090_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_8098_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8098_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14963,7 +14963,7 @@ unsigned long REGPARAM2 op_8098_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_80a0_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_80a0_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14980,7 +14980,7 @@ unsigned long REGPARAM2 op_80a0_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_80a8_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_80a8_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -14995,7 +14995,7 @@ unsigned long REGPARAM2 op_80a8_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_80b0_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_80b0_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15010,7 +15010,7 @@ unsigned long REGPARAM2 op_80b0_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_80b8_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_80b8_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -15024,7 +15024,7 @@ unsigned long REGPARAM2 op_80b8_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_80b9_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_80b9_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -15038,7 +15038,7 @@ unsigned long REGPARAM2 op_80b9_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_80ba_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_80ba_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -15053,7 +15053,7 @@ unsigned long REGPARAM2 op_80ba_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_80bb_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_80bb_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -15068,7 +15068,7 @@ unsigned long REGPARAM2 op_80bb_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_80bc_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_80bc_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -15081,7 +15081,7 @@ unsigned long REGPARAM2 op_80bc_3(uae_u32 opcode) /* OR */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_80c0_3(uae_u32 opcode) /* DIVU */
+unsigned long REGPARAM2 CPUOP_NAME(op_80c0_3)(uae_u32 opcode) /* DIVU */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15104,7 +15104,7 @@ unsigned long REGPARAM2 op_80c0_3(uae_u32 opcode) /* DIVU */
 endlabel1097: ;
 return 70;
 }
-unsigned long REGPARAM2 op_80d0_3(uae_u32 opcode) /* DIVU */
+unsigned long REGPARAM2 CPUOP_NAME(op_80d0_3)(uae_u32 opcode) /* DIVU */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15128,7 +15128,7 @@ unsigned long REGPARAM2 op_80d0_3(uae_u32 opcode) /* DIVU */
 endlabel1098: ;
 return 72;
 }
-unsigned long REGPARAM2 op_80d8_3(uae_u32 opcode) /* DIVU */
+unsigned long REGPARAM2 CPUOP_NAME(op_80d8_3)(uae_u32 opcode) /* DIVU */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15153,7 +15153,7 @@ unsigned long REGPARAM2 op_80d8_3(uae_u32 opcode) /* DIVU */
 endlabel1099: ;
 return 72;
 }
-unsigned long REGPARAM2 op_80e0_3(uae_u32 opcode) /* DIVU */
+unsigned long REGPARAM2 CPUOP_NAME(op_80e0_3)(uae_u32 opcode) /* DIVU */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15179,7 +15179,7 @@ unsigned long REGPARAM2 op_80e0_3(uae_u32 opcode) /* DIVU */
 endlabel1100: ;
 return 72;
 }
-unsigned long REGPARAM2 op_80e8_3(uae_u32 opcode) /* DIVU */
+unsigned long REGPARAM2 CPUOP_NAME(op_80e8_3)(uae_u32 opcode) /* DIVU */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15203,7 +15203,7 @@ unsigned long REGPARAM2 op_80e8_3(uae_u32 opcode) /* DIVU */
 endlabel1101: ;
 return 74;
 }
-unsigned long REGPARAM2 op_80f0_3(uae_u32 opcode) /* DIVU */
+unsigned long REGPARAM2 CPUOP_NAME(op_80f0_3)(uae_u32 opcode) /* DIVU */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15227,7 +15227,7 @@ unsigned long REGPARAM2 op_80f0_3(uae_u32 opcode) /* DIVU */
 endlabel1102: ;
 return 74;
 }
-unsigned long REGPARAM2 op_80f8_3(uae_u32 opcode) /* DIVU */
+unsigned long REGPARAM2 CPUOP_NAME(op_80f8_3)(uae_u32 opcode) /* DIVU */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -15250,7 +15250,7 @@ unsigned long REGPARAM2 op_80f8_3(uae_u32 opcode) /* DIVU */
 endlabel1103: ;
 return 74;
 }
-unsigned long REGPARAM2 op_80f9_3(uae_u32 opcode) /* DIVU */
+unsigned long REGPARAM2 CPUOP_NAME(op_80f9_3)(uae_u32 opcode) /* DIVU */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -15273,7 +15273,7 @@ unsigned long REGPARAM2 op_80f9_3(uae_u32 opcode) /* DIVU */
 endlabel1104: ;
 return 76;
 }
-unsigned long REGPARAM2 op_80fa_3(uae_u32 opcode) /* DIVU */
+unsigned long REGPARAM2 CPUOP_NAME(op_80fa_3)(uae_u32 opcode) /* DIVU */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -15297,7 +15297,7 @@ unsigned long REGPARAM2 op_80fa_3(uae_u32 opcode) /* DIVU */
 endlabel1105: ;
 return 74;
 }
-unsigned long REGPARAM2 op_80fb_3(uae_u32 opcode) /* DIVU */
+unsigned long REGPARAM2 CPUOP_NAME(op_80fb_3)(uae_u32 opcode) /* DIVU */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -15321,7 +15321,7 @@ unsigned long REGPARAM2 op_80fb_3(uae_u32 opcode) /* DIVU */
 endlabel1106: ;
 return 74;
 }
-unsigned long REGPARAM2 op_80fc_3(uae_u32 opcode) /* DIVU */
+unsigned long REGPARAM2 CPUOP_NAME(op_80fc_3)(uae_u32 opcode) /* DIVU */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -15343,7 +15343,7 @@ unsigned long REGPARAM2 op_80fc_3(uae_u32 opcode) /* DIVU */
 endlabel1107: ;
 return 72;
 }
-unsigned long REGPARAM2 op_8100_3(uae_u32 opcode) /* SBCD */
+unsigned long REGPARAM2 CPUOP_NAME(op_8100_3)(uae_u32 opcode) /* SBCD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15367,7 +15367,7 @@ unsigned long REGPARAM2 op_8100_3(uae_u32 opcode) /* SBCD */
 }}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_8108_3(uae_u32 opcode) /* SBCD */
+unsigned long REGPARAM2 CPUOP_NAME(op_8108_3)(uae_u32 opcode) /* SBCD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15397,7 +15397,7 @@ unsigned long REGPARAM2 op_8108_3(uae_u32 opcode) /* SBCD */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 op_8110_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8110_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15412,7 +15412,7 @@ unsigned long REGPARAM2 op_8110_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_8118_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8118_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15428,7 +15428,7 @@ unsigned long REGPARAM2 op_8118_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_8120_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8120_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15445,7 +15445,7 @@ unsigned long REGPARAM2 op_8120_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_8128_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8128_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15460,7 +15460,7 @@ unsigned long REGPARAM2 op_8128_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_8130_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8130_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15475,7 +15475,7 @@ unsigned long REGPARAM2 op_8130_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_8138_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8138_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -15489,7 +15489,7 @@ unsigned long REGPARAM2 op_8138_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_8139_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8139_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -15503,7 +15503,7 @@ unsigned long REGPARAM2 op_8139_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_8150_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8150_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15518,7 +15518,7 @@ unsigned long REGPARAM2 op_8150_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_8158_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8158_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15534,7 +15534,7 @@ unsigned long REGPARAM2 op_8158_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_8160_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8160_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15551,7 +15551,7 @@ unsigned long REGPARAM2 op_8160_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_8168_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8168_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15566,7 +15566,7 @@ unsigned long REGPARAM2 op_8168_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_8170_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8170_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15581,7 +15581,7 @@ unsigned long REGPARAM2 op_8170_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_8178_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8178_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -15595,7 +15595,7 @@ unsigned long REGPARAM2 op_8178_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_8179_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8179_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -15609,7 +15609,7 @@ unsigned long REGPARAM2 op_8179_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_8190_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8190_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15624,7 +15624,7 @@ unsigned long REGPARAM2 op_8190_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_8198_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_8198_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15640,7 +15640,7 @@ unsigned long REGPARAM2 op_8198_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_81a0_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_81a0_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15657,7 +15657,7 @@ unsigned long REGPARAM2 op_81a0_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_81a8_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_81a8_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15672,7 +15672,7 @@ unsigned long REGPARAM2 op_81a8_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_81b0_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_81b0_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -15687,7 +15687,7 @@ unsigned long REGPARAM2 op_81b0_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_81b8_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_81b8_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -15701,7 +15701,7 @@ unsigned long REGPARAM2 op_81b8_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_81b9_3(uae_u32 opcode) /* OR */
+unsigned long REGPARAM2 CPUOP_NAME(op_81b9_3)(uae_u32 opcode) /* OR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -15715,7 +15715,7 @@ unsigned long REGPARAM2 op_81b9_3(uae_u32 opcode) /* OR */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_81c0_3(uae_u32 opcode) /* DIVS */
+unsigned long REGPARAM2 CPUOP_NAME(op_81c0_3)(uae_u32 opcode) /* DIVS */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15739,7 +15739,7 @@ unsigned long REGPARAM2 op_81c0_3(uae_u32 opcode) /* DIVS */
 endlabel1131: ;
 return 74;
 }
-unsigned long REGPARAM2 op_81d0_3(uae_u32 opcode) /* DIVS */
+unsigned long REGPARAM2 CPUOP_NAME(op_81d0_3)(uae_u32 opcode) /* DIVS */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15764,7 +15764,7 @@ unsigned long REGPARAM2 op_81d0_3(uae_u32 opcode) /* DIVS */
 endlabel1132: ;
 return 76;
 }
-unsigned long REGPARAM2 op_81d8_3(uae_u32 opcode) /* DIVS */
+unsigned long REGPARAM2 CPUOP_NAME(op_81d8_3)(uae_u32 opcode) /* DIVS */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15790,7 +15790,7 @@ unsigned long REGPARAM2 op_81d8_3(uae_u32 opcode) /* DIVS */
 endlabel1133: ;
 return 76;
 }
-unsigned long REGPARAM2 op_81e0_3(uae_u32 opcode) /* DIVS */
+unsigned long REGPARAM2 CPUOP_NAME(op_81e0_3)(uae_u32 opcode) /* DIVS */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15817,7 +15817,7 @@ unsigned long REGPARAM2 op_81e0_3(uae_u32 opcode) /* DIVS */
 endlabel1134: ;
 return 76;
 }
-unsigned long REGPARAM2 op_81e8_3(uae_u32 opcode) /* DIVS */
+unsigned long REGPARAM2 CPUOP_NAME(op_81e8_3)(uae_u32 opcode) /* DIVS */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15842,7 +15842,7 @@ unsigned long REGPARAM2 op_81e8_3(uae_u32 opcode) /* DIVS */
 endlabel1135: ;
 return 78;
 }
-unsigned long REGPARAM2 op_81f0_3(uae_u32 opcode) /* DIVS */
+unsigned long REGPARAM2 CPUOP_NAME(op_81f0_3)(uae_u32 opcode) /* DIVS */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -15867,7 +15867,7 @@ unsigned long REGPARAM2 op_81f0_3(uae_u32 opcode) /* DIVS */
 endlabel1136: ;
 return 78;
 }
-unsigned long REGPARAM2 op_81f8_3(uae_u32 opcode) /* DIVS */
+unsigned long REGPARAM2 CPUOP_NAME(op_81f8_3)(uae_u32 opcode) /* DIVS */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -15891,7 +15891,7 @@ unsigned long REGPARAM2 op_81f8_3(uae_u32 opcode) /* DIVS */
 endlabel1137: ;
 return 78;
 }
-unsigned long REGPARAM2 op_81f9_3(uae_u32 opcode) /* DIVS */
+unsigned long REGPARAM2 CPUOP_NAME(op_81f9_3)(uae_u32 opcode) /* DIVS */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -15915,7 +15915,7 @@ unsigned long REGPARAM2 op_81f9_3(uae_u32 opcode) /* DIVS */
 endlabel1138: ;
 return 80;
 }
-unsigned long REGPARAM2 op_81fa_3(uae_u32 opcode) /* DIVS */
+unsigned long REGPARAM2 CPUOP_NAME(op_81fa_3)(uae_u32 opcode) /* DIVS */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -15940,7 +15940,7 @@ unsigned long REGPARAM2 op_81fa_3(uae_u32 opcode) /* DIVS */
 endlabel1139: ;
 return 78;
 }
-unsigned long REGPARAM2 op_81fb_3(uae_u32 opcode) /* DIVS */
+unsigned long REGPARAM2 CPUOP_NAME(op_81fb_3)(uae_u32 opcode) /* DIVS */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -15965,7 +15965,7 @@ unsigned long REGPARAM2 op_81fb_3(uae_u32 opcode) /* DIVS */
 endlabel1140: ;
 return 78;
 }
-unsigned long REGPARAM2 op_81fc_3(uae_u32 opcode) /* DIVS */
+unsigned long REGPARAM2 CPUOP_NAME(op_81fc_3)(uae_u32 opcode) /* DIVS */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {	uaecptr oldpc = m68k_getpc();
@@ -15988,7 +15988,7 @@ unsigned long REGPARAM2 op_81fc_3(uae_u32 opcode) /* DIVS */
 endlabel1141: ;
 return 76;
 }
-unsigned long REGPARAM2 op_9000_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9000_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16007,7 +16007,7 @@ unsigned long REGPARAM2 op_9000_3(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_9010_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9010_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16027,7 +16027,7 @@ unsigned long REGPARAM2 op_9010_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_9018_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9018_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16048,7 +16048,7 @@ unsigned long REGPARAM2 op_9018_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_9020_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9020_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16070,7 +16070,7 @@ unsigned long REGPARAM2 op_9020_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_9028_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9028_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16090,7 +16090,7 @@ unsigned long REGPARAM2 op_9028_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_9030_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9030_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16110,7 +16110,7 @@ unsigned long REGPARAM2 op_9030_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_9038_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9038_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -16129,7 +16129,7 @@ unsigned long REGPARAM2 op_9038_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_9039_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9039_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -16148,7 +16148,7 @@ unsigned long REGPARAM2 op_9039_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_903a_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_903a_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -16168,7 +16168,7 @@ unsigned long REGPARAM2 op_903a_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_903b_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_903b_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -16188,7 +16188,7 @@ unsigned long REGPARAM2 op_903b_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_903c_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_903c_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -16206,7 +16206,7 @@ unsigned long REGPARAM2 op_903c_3(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_9040_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9040_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16225,7 +16225,7 @@ unsigned long REGPARAM2 op_9040_3(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_9048_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9048_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16244,7 +16244,7 @@ unsigned long REGPARAM2 op_9048_3(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_9050_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9050_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16264,7 +16264,7 @@ unsigned long REGPARAM2 op_9050_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_9058_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9058_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16285,7 +16285,7 @@ unsigned long REGPARAM2 op_9058_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_9060_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9060_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16307,7 +16307,7 @@ unsigned long REGPARAM2 op_9060_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_9068_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9068_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16327,7 +16327,7 @@ unsigned long REGPARAM2 op_9068_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_9070_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9070_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16347,7 +16347,7 @@ unsigned long REGPARAM2 op_9070_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_9078_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9078_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -16366,7 +16366,7 @@ unsigned long REGPARAM2 op_9078_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_9079_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9079_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -16385,7 +16385,7 @@ unsigned long REGPARAM2 op_9079_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_907a_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_907a_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -16405,7 +16405,7 @@ unsigned long REGPARAM2 op_907a_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_907b_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_907b_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -16425,7 +16425,7 @@ unsigned long REGPARAM2 op_907b_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_907c_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_907c_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -16443,7 +16443,7 @@ unsigned long REGPARAM2 op_907c_3(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_9080_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9080_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16462,7 +16462,7 @@ unsigned long REGPARAM2 op_9080_3(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_9088_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9088_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16481,7 +16481,7 @@ unsigned long REGPARAM2 op_9088_3(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_9090_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9090_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16501,7 +16501,7 @@ unsigned long REGPARAM2 op_9090_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_9098_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9098_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16522,7 +16522,7 @@ unsigned long REGPARAM2 op_9098_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_90a0_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_90a0_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16544,7 +16544,7 @@ unsigned long REGPARAM2 op_90a0_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_90a8_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_90a8_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16564,7 +16564,7 @@ unsigned long REGPARAM2 op_90a8_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_90b0_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_90b0_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16584,7 +16584,7 @@ unsigned long REGPARAM2 op_90b0_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_90b8_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_90b8_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -16603,7 +16603,7 @@ unsigned long REGPARAM2 op_90b8_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_90b9_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_90b9_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -16622,7 +16622,7 @@ unsigned long REGPARAM2 op_90b9_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_90ba_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_90ba_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -16642,7 +16642,7 @@ unsigned long REGPARAM2 op_90ba_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_90bb_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_90bb_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -16662,7 +16662,7 @@ unsigned long REGPARAM2 op_90bb_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_90bc_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_90bc_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -16680,7 +16680,7 @@ unsigned long REGPARAM2 op_90bc_3(uae_u32 opcode) /* SUB */
 }}}}}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_90c0_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_90c0_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16692,7 +16692,7 @@ unsigned long REGPARAM2 op_90c0_3(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_90c8_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_90c8_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16704,7 +16704,7 @@ unsigned long REGPARAM2 op_90c8_3(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_90d0_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_90d0_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16717,7 +16717,7 @@ unsigned long REGPARAM2 op_90d0_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_90d8_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_90d8_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16731,7 +16731,7 @@ unsigned long REGPARAM2 op_90d8_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_90e0_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_90e0_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16746,7 +16746,7 @@ unsigned long REGPARAM2 op_90e0_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_90e8_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_90e8_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16759,7 +16759,7 @@ unsigned long REGPARAM2 op_90e8_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_90f0_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_90f0_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16772,7 +16772,7 @@ unsigned long REGPARAM2 op_90f0_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_90f8_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_90f8_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -16784,7 +16784,7 @@ unsigned long REGPARAM2 op_90f8_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_90f9_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_90f9_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -16796,7 +16796,7 @@ unsigned long REGPARAM2 op_90f9_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_90fa_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_90fa_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -16809,7 +16809,7 @@ unsigned long REGPARAM2 op_90fa_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_90fb_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_90fb_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -16822,7 +16822,7 @@ unsigned long REGPARAM2 op_90fb_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_90fc_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_90fc_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -16833,7 +16833,7 @@ unsigned long REGPARAM2 op_90fc_3(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_9100_3(uae_u32 opcode) /* SUBX */
+unsigned long REGPARAM2 CPUOP_NAME(op_9100_3)(uae_u32 opcode) /* SUBX */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16852,7 +16852,7 @@ unsigned long REGPARAM2 op_9100_3(uae_u32 opcode) /* SUBX */
 }}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_9108_3(uae_u32 opcode) /* SUBX */
+unsigned long REGPARAM2 CPUOP_NAME(op_9108_3)(uae_u32 opcode) /* SUBX */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -16877,7 +16877,7 @@ unsigned long REGPARAM2 op_9108_3(uae_u32 opcode) /* SUBX */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 op_9110_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9110_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -16897,7 +16897,7 @@ unsigned long REGPARAM2 op_9110_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_9118_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9118_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -16918,7 +16918,7 @@ unsigned long REGPARAM2 op_9118_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_9120_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9120_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -16940,7 +16940,7 @@ unsigned long REGPARAM2 op_9120_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_9128_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9128_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -16960,7 +16960,7 @@ unsigned long REGPARAM2 op_9128_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_9130_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9130_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -16980,7 +16980,7 @@ unsigned long REGPARAM2 op_9130_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_9138_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9138_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -16999,7 +16999,7 @@ unsigned long REGPARAM2 op_9138_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_9139_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9139_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -17018,7 +17018,7 @@ unsigned long REGPARAM2 op_9139_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_9140_3(uae_u32 opcode) /* SUBX */
+unsigned long REGPARAM2 CPUOP_NAME(op_9140_3)(uae_u32 opcode) /* SUBX */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17037,7 +17037,7 @@ unsigned long REGPARAM2 op_9140_3(uae_u32 opcode) /* SUBX */
 }}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_9148_3(uae_u32 opcode) /* SUBX */
+unsigned long REGPARAM2 CPUOP_NAME(op_9148_3)(uae_u32 opcode) /* SUBX */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17062,7 +17062,7 @@ unsigned long REGPARAM2 op_9148_3(uae_u32 opcode) /* SUBX */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 op_9150_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9150_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -17082,7 +17082,7 @@ unsigned long REGPARAM2 op_9150_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_9158_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9158_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -17103,7 +17103,7 @@ unsigned long REGPARAM2 op_9158_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_9160_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9160_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -17125,7 +17125,7 @@ unsigned long REGPARAM2 op_9160_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_9168_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9168_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -17145,7 +17145,7 @@ unsigned long REGPARAM2 op_9168_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_9170_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9170_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -17165,7 +17165,7 @@ unsigned long REGPARAM2 op_9170_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_9178_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9178_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -17184,7 +17184,7 @@ unsigned long REGPARAM2 op_9178_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_9179_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9179_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -17203,7 +17203,7 @@ unsigned long REGPARAM2 op_9179_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_9180_3(uae_u32 opcode) /* SUBX */
+unsigned long REGPARAM2 CPUOP_NAME(op_9180_3)(uae_u32 opcode) /* SUBX */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17222,7 +17222,7 @@ unsigned long REGPARAM2 op_9180_3(uae_u32 opcode) /* SUBX */
 }}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_9188_3(uae_u32 opcode) /* SUBX */
+unsigned long REGPARAM2 CPUOP_NAME(op_9188_3)(uae_u32 opcode) /* SUBX */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17247,7 +17247,7 @@ unsigned long REGPARAM2 op_9188_3(uae_u32 opcode) /* SUBX */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 op_9190_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9190_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -17267,7 +17267,7 @@ unsigned long REGPARAM2 op_9190_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_9198_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_9198_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -17288,7 +17288,7 @@ unsigned long REGPARAM2 op_9198_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_91a0_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_91a0_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -17310,7 +17310,7 @@ unsigned long REGPARAM2 op_91a0_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_91a8_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_91a8_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -17330,7 +17330,7 @@ unsigned long REGPARAM2 op_91a8_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_91b0_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_91b0_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -17350,7 +17350,7 @@ unsigned long REGPARAM2 op_91b0_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_91b8_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_91b8_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -17369,7 +17369,7 @@ unsigned long REGPARAM2 op_91b8_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_91b9_3(uae_u32 opcode) /* SUB */
+unsigned long REGPARAM2 CPUOP_NAME(op_91b9_3)(uae_u32 opcode) /* SUB */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -17388,7 +17388,7 @@ unsigned long REGPARAM2 op_91b9_3(uae_u32 opcode) /* SUB */
 }}}}}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_91c0_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_91c0_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17400,7 +17400,7 @@ unsigned long REGPARAM2 op_91c0_3(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_91c8_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_91c8_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17412,7 +17412,7 @@ unsigned long REGPARAM2 op_91c8_3(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_91d0_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_91d0_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17425,7 +17425,7 @@ unsigned long REGPARAM2 op_91d0_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_91d8_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_91d8_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17439,7 +17439,7 @@ unsigned long REGPARAM2 op_91d8_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_91e0_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_91e0_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17454,7 +17454,7 @@ unsigned long REGPARAM2 op_91e0_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_91e8_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_91e8_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17467,7 +17467,7 @@ unsigned long REGPARAM2 op_91e8_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_91f0_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_91f0_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17480,7 +17480,7 @@ unsigned long REGPARAM2 op_91f0_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_91f8_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_91f8_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -17492,7 +17492,7 @@ unsigned long REGPARAM2 op_91f8_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_91f9_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_91f9_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -17504,7 +17504,7 @@ unsigned long REGPARAM2 op_91f9_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_91fa_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_91fa_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -17517,7 +17517,7 @@ unsigned long REGPARAM2 op_91fa_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_91fb_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_91fb_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -17530,7 +17530,7 @@ unsigned long REGPARAM2 op_91fb_3(uae_u32 opcode) /* SUBA */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_91fc_3(uae_u32 opcode) /* SUBA */
+unsigned long REGPARAM2 CPUOP_NAME(op_91fc_3)(uae_u32 opcode) /* SUBA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -17541,7 +17541,7 @@ unsigned long REGPARAM2 op_91fc_3(uae_u32 opcode) /* SUBA */
 }}}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_b000_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b000_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17558,7 +17558,7 @@ unsigned long REGPARAM2 op_b000_3(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_b010_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b010_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17579,7 +17579,7 @@ return 4;
 #endif
 
 #ifdef PART_7
-unsigned long REGPARAM2 op_b018_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b018_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17598,7 +17598,7 @@ unsigned long REGPARAM2 op_b018_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_b020_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b020_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17618,7 +17618,7 @@ unsigned long REGPARAM2 op_b020_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_b028_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b028_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17636,7 +17636,7 @@ unsigned long REGPARAM2 op_b028_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b030_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b030_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17654,7 +17654,7 @@ unsigned long REGPARAM2 op_b030_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b038_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b038_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -17671,7 +17671,7 @@ unsigned long REGPARAM2 op_b038_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b039_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b039_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -17688,7 +17688,7 @@ unsigned long REGPARAM2 op_b039_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_b03a_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b03a_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -17706,7 +17706,7 @@ unsigned long REGPARAM2 op_b03a_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b03b_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b03b_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -17724,7 +17724,7 @@ unsigned long REGPARAM2 op_b03b_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b03c_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b03c_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -17740,7 +17740,7 @@ unsigned long REGPARAM2 op_b03c_3(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_b040_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b040_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17757,7 +17757,7 @@ unsigned long REGPARAM2 op_b040_3(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_b048_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b048_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17774,7 +17774,7 @@ unsigned long REGPARAM2 op_b048_3(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_b050_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b050_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17792,7 +17792,7 @@ unsigned long REGPARAM2 op_b050_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_b058_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b058_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17811,7 +17811,7 @@ unsigned long REGPARAM2 op_b058_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_b060_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b060_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17831,7 +17831,7 @@ unsigned long REGPARAM2 op_b060_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_b068_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b068_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17849,7 +17849,7 @@ unsigned long REGPARAM2 op_b068_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b070_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b070_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17867,7 +17867,7 @@ unsigned long REGPARAM2 op_b070_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b078_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b078_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -17884,7 +17884,7 @@ unsigned long REGPARAM2 op_b078_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b079_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b079_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -17901,7 +17901,7 @@ unsigned long REGPARAM2 op_b079_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_b07a_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b07a_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -17919,7 +17919,7 @@ unsigned long REGPARAM2 op_b07a_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b07b_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b07b_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -17937,7 +17937,7 @@ unsigned long REGPARAM2 op_b07b_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b07c_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b07c_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -17953,7 +17953,7 @@ unsigned long REGPARAM2 op_b07c_3(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_b080_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b080_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17970,7 +17970,7 @@ unsigned long REGPARAM2 op_b080_3(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_b088_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b088_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -17987,7 +17987,7 @@ unsigned long REGPARAM2 op_b088_3(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_b090_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b090_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18005,7 +18005,7 @@ unsigned long REGPARAM2 op_b090_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_b098_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b098_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18024,7 +18024,7 @@ unsigned long REGPARAM2 op_b098_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_b0a0_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0a0_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18044,7 +18044,7 @@ unsigned long REGPARAM2 op_b0a0_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_b0a8_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0a8_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18062,7 +18062,7 @@ unsigned long REGPARAM2 op_b0a8_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b0b0_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0b0_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18080,7 +18080,7 @@ unsigned long REGPARAM2 op_b0b0_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b0b8_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0b8_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -18097,7 +18097,7 @@ unsigned long REGPARAM2 op_b0b8_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b0b9_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0b9_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -18114,7 +18114,7 @@ unsigned long REGPARAM2 op_b0b9_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_b0ba_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0ba_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -18132,7 +18132,7 @@ unsigned long REGPARAM2 op_b0ba_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b0bb_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0bb_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -18150,7 +18150,7 @@ unsigned long REGPARAM2 op_b0bb_3(uae_u32 opcode) /* CMP */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b0bc_3(uae_u32 opcode) /* CMP */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0bc_3)(uae_u32 opcode) /* CMP */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -18166,7 +18166,7 @@ unsigned long REGPARAM2 op_b0bc_3(uae_u32 opcode) /* CMP */
 }}}}}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_b0c0_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0c0_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18183,7 +18183,7 @@ unsigned long REGPARAM2 op_b0c0_3(uae_u32 opcode) /* CMPA */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_b0c8_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0c8_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18200,7 +18200,7 @@ unsigned long REGPARAM2 op_b0c8_3(uae_u32 opcode) /* CMPA */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_b0d0_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0d0_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18218,7 +18218,7 @@ unsigned long REGPARAM2 op_b0d0_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_b0d8_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0d8_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18237,7 +18237,7 @@ unsigned long REGPARAM2 op_b0d8_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_b0e0_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0e0_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18257,7 +18257,7 @@ unsigned long REGPARAM2 op_b0e0_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_b0e8_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0e8_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18275,7 +18275,7 @@ unsigned long REGPARAM2 op_b0e8_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b0f0_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0f0_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18293,7 +18293,7 @@ unsigned long REGPARAM2 op_b0f0_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b0f8_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0f8_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -18310,7 +18310,7 @@ unsigned long REGPARAM2 op_b0f8_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b0f9_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0f9_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -18327,7 +18327,7 @@ unsigned long REGPARAM2 op_b0f9_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_b0fa_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0fa_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -18345,7 +18345,7 @@ unsigned long REGPARAM2 op_b0fa_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b0fb_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0fb_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -18363,7 +18363,7 @@ unsigned long REGPARAM2 op_b0fb_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_b0fc_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b0fc_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -18379,7 +18379,7 @@ unsigned long REGPARAM2 op_b0fc_3(uae_u32 opcode) /* CMPA */
 }}}}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_b100_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b100_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18393,7 +18393,7 @@ unsigned long REGPARAM2 op_b100_3(uae_u32 opcode) /* EOR */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_b108_3(uae_u32 opcode) /* CMPM */
+unsigned long REGPARAM2 CPUOP_NAME(op_b108_3)(uae_u32 opcode) /* CMPM */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18414,7 +18414,7 @@ unsigned long REGPARAM2 op_b108_3(uae_u32 opcode) /* CMPM */
 }}}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_b110_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b110_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18429,7 +18429,7 @@ unsigned long REGPARAM2 op_b110_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_b118_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b118_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18445,7 +18445,7 @@ unsigned long REGPARAM2 op_b118_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_b120_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b120_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18462,7 +18462,7 @@ unsigned long REGPARAM2 op_b120_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_b128_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b128_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18477,7 +18477,7 @@ unsigned long REGPARAM2 op_b128_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b130_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b130_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18492,7 +18492,7 @@ unsigned long REGPARAM2 op_b130_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b138_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b138_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -18506,7 +18506,7 @@ unsigned long REGPARAM2 op_b138_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b139_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b139_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -18520,7 +18520,7 @@ unsigned long REGPARAM2 op_b139_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_b140_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b140_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18534,7 +18534,7 @@ unsigned long REGPARAM2 op_b140_3(uae_u32 opcode) /* EOR */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_b148_3(uae_u32 opcode) /* CMPM */
+unsigned long REGPARAM2 CPUOP_NAME(op_b148_3)(uae_u32 opcode) /* CMPM */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18555,7 +18555,7 @@ unsigned long REGPARAM2 op_b148_3(uae_u32 opcode) /* CMPM */
 }}}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_b150_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b150_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18570,7 +18570,7 @@ unsigned long REGPARAM2 op_b150_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_b158_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b158_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18586,7 +18586,7 @@ unsigned long REGPARAM2 op_b158_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_b160_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b160_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18603,7 +18603,7 @@ unsigned long REGPARAM2 op_b160_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_b168_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b168_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18618,7 +18618,7 @@ unsigned long REGPARAM2 op_b168_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b170_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b170_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18633,7 +18633,7 @@ unsigned long REGPARAM2 op_b170_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b178_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b178_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -18647,7 +18647,7 @@ unsigned long REGPARAM2 op_b178_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b179_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b179_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -18661,7 +18661,7 @@ unsigned long REGPARAM2 op_b179_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_b180_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b180_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18675,7 +18675,7 @@ unsigned long REGPARAM2 op_b180_3(uae_u32 opcode) /* EOR */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_b188_3(uae_u32 opcode) /* CMPM */
+unsigned long REGPARAM2 CPUOP_NAME(op_b188_3)(uae_u32 opcode) /* CMPM */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18696,7 +18696,7 @@ unsigned long REGPARAM2 op_b188_3(uae_u32 opcode) /* CMPM */
 }}}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_b190_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b190_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18711,7 +18711,7 @@ unsigned long REGPARAM2 op_b190_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_b198_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b198_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18727,7 +18727,7 @@ unsigned long REGPARAM2 op_b198_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_b1a0_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1a0_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18744,7 +18744,7 @@ unsigned long REGPARAM2 op_b1a0_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_b1a8_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1a8_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18759,7 +18759,7 @@ unsigned long REGPARAM2 op_b1a8_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_b1b0_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1b0_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -18774,7 +18774,7 @@ unsigned long REGPARAM2 op_b1b0_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_b1b8_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1b8_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -18788,7 +18788,7 @@ unsigned long REGPARAM2 op_b1b8_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_b1b9_3(uae_u32 opcode) /* EOR */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1b9_3)(uae_u32 opcode) /* EOR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -18802,7 +18802,7 @@ unsigned long REGPARAM2 op_b1b9_3(uae_u32 opcode) /* EOR */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_b1c0_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1c0_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18819,7 +18819,7 @@ unsigned long REGPARAM2 op_b1c0_3(uae_u32 opcode) /* CMPA */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_b1c8_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1c8_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18836,7 +18836,7 @@ unsigned long REGPARAM2 op_b1c8_3(uae_u32 opcode) /* CMPA */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_b1d0_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1d0_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18854,7 +18854,7 @@ unsigned long REGPARAM2 op_b1d0_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_b1d8_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1d8_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18873,7 +18873,7 @@ unsigned long REGPARAM2 op_b1d8_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_b1e0_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1e0_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18893,7 +18893,7 @@ unsigned long REGPARAM2 op_b1e0_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_b1e8_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1e8_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18911,7 +18911,7 @@ unsigned long REGPARAM2 op_b1e8_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b1f0_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1f0_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -18929,7 +18929,7 @@ unsigned long REGPARAM2 op_b1f0_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b1f8_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1f8_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -18946,7 +18946,7 @@ unsigned long REGPARAM2 op_b1f8_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b1f9_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1f9_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -18963,7 +18963,7 @@ unsigned long REGPARAM2 op_b1f9_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_b1fa_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1fa_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -18981,7 +18981,7 @@ unsigned long REGPARAM2 op_b1fa_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b1fb_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1fb_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -18999,7 +18999,7 @@ unsigned long REGPARAM2 op_b1fb_3(uae_u32 opcode) /* CMPA */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_b1fc_3(uae_u32 opcode) /* CMPA */
+unsigned long REGPARAM2 CPUOP_NAME(op_b1fc_3)(uae_u32 opcode) /* CMPA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -19015,7 +19015,7 @@ unsigned long REGPARAM2 op_b1fc_3(uae_u32 opcode) /* CMPA */
 }}}}}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_c000_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c000_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19029,7 +19029,7 @@ unsigned long REGPARAM2 op_c000_3(uae_u32 opcode) /* AND */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_c010_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c010_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19044,7 +19044,7 @@ unsigned long REGPARAM2 op_c010_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_c018_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c018_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19060,7 +19060,7 @@ unsigned long REGPARAM2 op_c018_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_c020_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c020_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19077,7 +19077,7 @@ unsigned long REGPARAM2 op_c020_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_c028_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c028_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19092,7 +19092,7 @@ unsigned long REGPARAM2 op_c028_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c030_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c030_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19107,7 +19107,7 @@ unsigned long REGPARAM2 op_c030_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c038_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c038_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -19121,7 +19121,7 @@ unsigned long REGPARAM2 op_c038_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c039_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c039_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -19135,7 +19135,7 @@ unsigned long REGPARAM2 op_c039_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_c03a_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c03a_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -19150,7 +19150,7 @@ unsigned long REGPARAM2 op_c03a_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c03b_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c03b_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -19165,7 +19165,7 @@ unsigned long REGPARAM2 op_c03b_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c03c_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c03c_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -19178,7 +19178,7 @@ unsigned long REGPARAM2 op_c03c_3(uae_u32 opcode) /* AND */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_c040_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c040_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19192,7 +19192,7 @@ unsigned long REGPARAM2 op_c040_3(uae_u32 opcode) /* AND */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_c050_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c050_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19207,7 +19207,7 @@ unsigned long REGPARAM2 op_c050_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_c058_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c058_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19223,7 +19223,7 @@ unsigned long REGPARAM2 op_c058_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_c060_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c060_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19240,7 +19240,7 @@ unsigned long REGPARAM2 op_c060_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_c068_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c068_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19255,7 +19255,7 @@ unsigned long REGPARAM2 op_c068_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c070_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c070_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19270,7 +19270,7 @@ unsigned long REGPARAM2 op_c070_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c078_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c078_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -19284,7 +19284,7 @@ unsigned long REGPARAM2 op_c078_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c079_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c079_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -19298,7 +19298,7 @@ unsigned long REGPARAM2 op_c079_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_c07a_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c07a_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -19313,7 +19313,7 @@ unsigned long REGPARAM2 op_c07a_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c07b_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c07b_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -19328,7 +19328,7 @@ unsigned long REGPARAM2 op_c07b_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_c07c_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c07c_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -19341,7 +19341,7 @@ unsigned long REGPARAM2 op_c07c_3(uae_u32 opcode) /* AND */
 }}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_c080_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c080_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19355,7 +19355,7 @@ unsigned long REGPARAM2 op_c080_3(uae_u32 opcode) /* AND */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_c090_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c090_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19370,7 +19370,7 @@ unsigned long REGPARAM2 op_c090_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_c098_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c098_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19386,7 +19386,7 @@ unsigned long REGPARAM2 op_c098_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_c0a0_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0a0_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19403,7 +19403,7 @@ unsigned long REGPARAM2 op_c0a0_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_c0a8_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0a8_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19418,7 +19418,7 @@ unsigned long REGPARAM2 op_c0a8_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_c0b0_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0b0_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19433,7 +19433,7 @@ unsigned long REGPARAM2 op_c0b0_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_c0b8_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0b8_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -19447,7 +19447,7 @@ unsigned long REGPARAM2 op_c0b8_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_c0b9_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0b9_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -19461,7 +19461,7 @@ unsigned long REGPARAM2 op_c0b9_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_c0ba_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0ba_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -19476,7 +19476,7 @@ unsigned long REGPARAM2 op_c0ba_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_c0bb_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0bb_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -19491,7 +19491,7 @@ unsigned long REGPARAM2 op_c0bb_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_c0bc_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0bc_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -19504,7 +19504,7 @@ unsigned long REGPARAM2 op_c0bc_3(uae_u32 opcode) /* AND */
 }}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_c0c0_3(uae_u32 opcode) /* MULU */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0c0_3)(uae_u32 opcode) /* MULU */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19518,7 +19518,7 @@ unsigned long REGPARAM2 op_c0c0_3(uae_u32 opcode) /* MULU */
 }}}}m68k_incpc(2);
 return 34;
 }
-unsigned long REGPARAM2 op_c0d0_3(uae_u32 opcode) /* MULU */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0d0_3)(uae_u32 opcode) /* MULU */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19533,7 +19533,7 @@ unsigned long REGPARAM2 op_c0d0_3(uae_u32 opcode) /* MULU */
 }}}}}m68k_incpc(2);
 return 36;
 }
-unsigned long REGPARAM2 op_c0d8_3(uae_u32 opcode) /* MULU */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0d8_3)(uae_u32 opcode) /* MULU */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19549,7 +19549,7 @@ unsigned long REGPARAM2 op_c0d8_3(uae_u32 opcode) /* MULU */
 }}}}}m68k_incpc(2);
 return 36;
 }
-unsigned long REGPARAM2 op_c0e0_3(uae_u32 opcode) /* MULU */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0e0_3)(uae_u32 opcode) /* MULU */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19566,7 +19566,7 @@ unsigned long REGPARAM2 op_c0e0_3(uae_u32 opcode) /* MULU */
 }}}}}m68k_incpc(2);
 return 36;
 }
-unsigned long REGPARAM2 op_c0e8_3(uae_u32 opcode) /* MULU */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0e8_3)(uae_u32 opcode) /* MULU */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19581,7 +19581,7 @@ unsigned long REGPARAM2 op_c0e8_3(uae_u32 opcode) /* MULU */
 }}}}}m68k_incpc(4);
 return 38;
 }
-unsigned long REGPARAM2 op_c0f0_3(uae_u32 opcode) /* MULU */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0f0_3)(uae_u32 opcode) /* MULU */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19596,7 +19596,7 @@ unsigned long REGPARAM2 op_c0f0_3(uae_u32 opcode) /* MULU */
 }}}}}m68k_incpc(4);
 return 38;
 }
-unsigned long REGPARAM2 op_c0f8_3(uae_u32 opcode) /* MULU */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0f8_3)(uae_u32 opcode) /* MULU */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -19610,7 +19610,7 @@ unsigned long REGPARAM2 op_c0f8_3(uae_u32 opcode) /* MULU */
 }}}}}m68k_incpc(4);
 return 38;
 }
-unsigned long REGPARAM2 op_c0f9_3(uae_u32 opcode) /* MULU */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0f9_3)(uae_u32 opcode) /* MULU */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -19624,7 +19624,7 @@ unsigned long REGPARAM2 op_c0f9_3(uae_u32 opcode) /* MULU */
 }}}}}m68k_incpc(6);
 return 40;
 }
-unsigned long REGPARAM2 op_c0fa_3(uae_u32 opcode) /* MULU */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0fa_3)(uae_u32 opcode) /* MULU */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -19639,7 +19639,7 @@ unsigned long REGPARAM2 op_c0fa_3(uae_u32 opcode) /* MULU */
 }}}}}m68k_incpc(4);
 return 38;
 }
-unsigned long REGPARAM2 op_c0fb_3(uae_u32 opcode) /* MULU */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0fb_3)(uae_u32 opcode) /* MULU */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -19654,7 +19654,7 @@ unsigned long REGPARAM2 op_c0fb_3(uae_u32 opcode) /* MULU */
 }}}}}m68k_incpc(4);
 return 38;
 }
-unsigned long REGPARAM2 op_c0fc_3(uae_u32 opcode) /* MULU */
+unsigned long REGPARAM2 CPUOP_NAME(op_c0fc_3)(uae_u32 opcode) /* MULU */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -19667,7 +19667,7 @@ unsigned long REGPARAM2 op_c0fc_3(uae_u32 opcode) /* MULU */
 }}}}m68k_incpc(4);
 return 36;
 }
-unsigned long REGPARAM2 op_c100_3(uae_u32 opcode) /* ABCD */
+unsigned long REGPARAM2 CPUOP_NAME(op_c100_3)(uae_u32 opcode) /* ABCD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19691,7 +19691,7 @@ unsigned long REGPARAM2 op_c100_3(uae_u32 opcode) /* ABCD */
 }}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_c108_3(uae_u32 opcode) /* ABCD */
+unsigned long REGPARAM2 CPUOP_NAME(op_c108_3)(uae_u32 opcode) /* ABCD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -19721,7 +19721,7 @@ unsigned long REGPARAM2 op_c108_3(uae_u32 opcode) /* ABCD */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 op_c110_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c110_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -19736,7 +19736,7 @@ unsigned long REGPARAM2 op_c110_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_c118_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c118_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -19752,7 +19752,7 @@ unsigned long REGPARAM2 op_c118_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_c120_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c120_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -19769,7 +19769,7 @@ unsigned long REGPARAM2 op_c120_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_c128_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c128_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -19784,7 +19784,7 @@ unsigned long REGPARAM2 op_c128_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_c130_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c130_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -19799,7 +19799,7 @@ unsigned long REGPARAM2 op_c130_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_c138_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c138_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -19813,7 +19813,7 @@ unsigned long REGPARAM2 op_c138_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_c139_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c139_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -19827,7 +19827,7 @@ unsigned long REGPARAM2 op_c139_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_c140_3(uae_u32 opcode) /* EXG */
+unsigned long REGPARAM2 CPUOP_NAME(op_c140_3)(uae_u32 opcode) /* EXG */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -19838,7 +19838,7 @@ unsigned long REGPARAM2 op_c140_3(uae_u32 opcode) /* EXG */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_c148_3(uae_u32 opcode) /* EXG */
+unsigned long REGPARAM2 CPUOP_NAME(op_c148_3)(uae_u32 opcode) /* EXG */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -19851,7 +19851,7 @@ unsigned long REGPARAM2 op_c148_3(uae_u32 opcode) /* EXG */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_c150_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c150_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -19866,7 +19866,7 @@ unsigned long REGPARAM2 op_c150_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_c158_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c158_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -19882,7 +19882,7 @@ unsigned long REGPARAM2 op_c158_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_c160_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c160_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -19899,7 +19899,7 @@ unsigned long REGPARAM2 op_c160_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_c168_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c168_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -19914,7 +19914,7 @@ unsigned long REGPARAM2 op_c168_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_c170_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c170_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -19929,7 +19929,7 @@ unsigned long REGPARAM2 op_c170_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_c178_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c178_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -19943,7 +19943,7 @@ unsigned long REGPARAM2 op_c178_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_c179_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c179_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -19957,7 +19957,7 @@ unsigned long REGPARAM2 op_c179_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_c188_3(uae_u32 opcode) /* EXG */
+unsigned long REGPARAM2 CPUOP_NAME(op_c188_3)(uae_u32 opcode) /* EXG */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -19969,7 +19969,7 @@ unsigned long REGPARAM2 op_c188_3(uae_u32 opcode) /* EXG */
 }}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_c190_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c190_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -19984,7 +19984,7 @@ unsigned long REGPARAM2 op_c190_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_c198_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c198_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -20000,7 +20000,7 @@ unsigned long REGPARAM2 op_c198_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_c1a0_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1a0_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -20017,7 +20017,7 @@ unsigned long REGPARAM2 op_c1a0_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_c1a8_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1a8_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -20032,7 +20032,7 @@ unsigned long REGPARAM2 op_c1a8_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_c1b0_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1b0_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -20047,7 +20047,7 @@ unsigned long REGPARAM2 op_c1b0_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_c1b8_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1b8_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -20061,7 +20061,7 @@ unsigned long REGPARAM2 op_c1b8_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_c1b9_3(uae_u32 opcode) /* AND */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1b9_3)(uae_u32 opcode) /* AND */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -20075,7 +20075,7 @@ unsigned long REGPARAM2 op_c1b9_3(uae_u32 opcode) /* AND */
 }}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_c1c0_3(uae_u32 opcode) /* MULS */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1c0_3)(uae_u32 opcode) /* MULS */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20089,7 +20089,7 @@ unsigned long REGPARAM2 op_c1c0_3(uae_u32 opcode) /* MULS */
 }}}}m68k_incpc(2);
 return 34;
 }
-unsigned long REGPARAM2 op_c1d0_3(uae_u32 opcode) /* MULS */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1d0_3)(uae_u32 opcode) /* MULS */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20104,7 +20104,7 @@ unsigned long REGPARAM2 op_c1d0_3(uae_u32 opcode) /* MULS */
 }}}}}m68k_incpc(2);
 return 36;
 }
-unsigned long REGPARAM2 op_c1d8_3(uae_u32 opcode) /* MULS */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1d8_3)(uae_u32 opcode) /* MULS */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20120,7 +20120,7 @@ unsigned long REGPARAM2 op_c1d8_3(uae_u32 opcode) /* MULS */
 }}}}}m68k_incpc(2);
 return 36;
 }
-unsigned long REGPARAM2 op_c1e0_3(uae_u32 opcode) /* MULS */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1e0_3)(uae_u32 opcode) /* MULS */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20137,7 +20137,7 @@ unsigned long REGPARAM2 op_c1e0_3(uae_u32 opcode) /* MULS */
 }}}}}m68k_incpc(2);
 return 36;
 }
-unsigned long REGPARAM2 op_c1e8_3(uae_u32 opcode) /* MULS */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1e8_3)(uae_u32 opcode) /* MULS */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20152,7 +20152,7 @@ unsigned long REGPARAM2 op_c1e8_3(uae_u32 opcode) /* MULS */
 }}}}}m68k_incpc(4);
 return 38;
 }
-unsigned long REGPARAM2 op_c1f0_3(uae_u32 opcode) /* MULS */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1f0_3)(uae_u32 opcode) /* MULS */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20167,7 +20167,7 @@ unsigned long REGPARAM2 op_c1f0_3(uae_u32 opcode) /* MULS */
 }}}}}m68k_incpc(4);
 return 38;
 }
-unsigned long REGPARAM2 op_c1f8_3(uae_u32 opcode) /* MULS */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1f8_3)(uae_u32 opcode) /* MULS */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -20181,7 +20181,7 @@ unsigned long REGPARAM2 op_c1f8_3(uae_u32 opcode) /* MULS */
 }}}}}m68k_incpc(4);
 return 38;
 }
-unsigned long REGPARAM2 op_c1f9_3(uae_u32 opcode) /* MULS */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1f9_3)(uae_u32 opcode) /* MULS */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -20195,7 +20195,7 @@ unsigned long REGPARAM2 op_c1f9_3(uae_u32 opcode) /* MULS */
 }}}}}m68k_incpc(6);
 return 40;
 }
-unsigned long REGPARAM2 op_c1fa_3(uae_u32 opcode) /* MULS */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1fa_3)(uae_u32 opcode) /* MULS */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -20210,7 +20210,7 @@ unsigned long REGPARAM2 op_c1fa_3(uae_u32 opcode) /* MULS */
 }}}}}m68k_incpc(4);
 return 38;
 }
-unsigned long REGPARAM2 op_c1fb_3(uae_u32 opcode) /* MULS */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1fb_3)(uae_u32 opcode) /* MULS */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -20225,7 +20225,7 @@ unsigned long REGPARAM2 op_c1fb_3(uae_u32 opcode) /* MULS */
 }}}}}m68k_incpc(4);
 return 38;
 }
-unsigned long REGPARAM2 op_c1fc_3(uae_u32 opcode) /* MULS */
+unsigned long REGPARAM2 CPUOP_NAME(op_c1fc_3)(uae_u32 opcode) /* MULS */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -20238,7 +20238,7 @@ unsigned long REGPARAM2 op_c1fc_3(uae_u32 opcode) /* MULS */
 }}}}m68k_incpc(4);
 return 36;
 }
-unsigned long REGPARAM2 op_d000_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d000_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20257,7 +20257,7 @@ unsigned long REGPARAM2 op_d000_3(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_d010_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d010_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20277,7 +20277,7 @@ unsigned long REGPARAM2 op_d010_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_d018_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d018_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20298,7 +20298,7 @@ unsigned long REGPARAM2 op_d018_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_d020_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d020_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20320,7 +20320,7 @@ unsigned long REGPARAM2 op_d020_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_d028_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d028_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20340,7 +20340,7 @@ unsigned long REGPARAM2 op_d028_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d030_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d030_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20360,7 +20360,7 @@ unsigned long REGPARAM2 op_d030_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d038_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d038_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -20379,7 +20379,7 @@ unsigned long REGPARAM2 op_d038_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d039_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d039_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -20398,7 +20398,7 @@ unsigned long REGPARAM2 op_d039_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_d03a_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d03a_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -20418,7 +20418,7 @@ unsigned long REGPARAM2 op_d03a_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d03b_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d03b_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -20438,7 +20438,7 @@ unsigned long REGPARAM2 op_d03b_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d03c_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d03c_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
@@ -20456,7 +20456,7 @@ unsigned long REGPARAM2 op_d03c_3(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_d040_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d040_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20475,7 +20475,7 @@ unsigned long REGPARAM2 op_d040_3(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_d048_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d048_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20494,7 +20494,7 @@ unsigned long REGPARAM2 op_d048_3(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_d050_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d050_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20514,7 +20514,7 @@ unsigned long REGPARAM2 op_d050_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_d058_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d058_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20535,7 +20535,7 @@ unsigned long REGPARAM2 op_d058_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_d060_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d060_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20557,7 +20557,7 @@ unsigned long REGPARAM2 op_d060_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_d068_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d068_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20577,7 +20577,7 @@ unsigned long REGPARAM2 op_d068_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d070_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d070_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20597,7 +20597,7 @@ unsigned long REGPARAM2 op_d070_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d078_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d078_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -20616,7 +20616,7 @@ unsigned long REGPARAM2 op_d078_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d079_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d079_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -20635,7 +20635,7 @@ unsigned long REGPARAM2 op_d079_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_d07a_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d07a_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -20655,7 +20655,7 @@ unsigned long REGPARAM2 op_d07a_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d07b_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d07b_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -20675,7 +20675,7 @@ unsigned long REGPARAM2 op_d07b_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d07c_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d07c_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -20693,7 +20693,7 @@ unsigned long REGPARAM2 op_d07c_3(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_d080_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d080_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20712,7 +20712,7 @@ unsigned long REGPARAM2 op_d080_3(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_d088_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d088_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20731,7 +20731,7 @@ unsigned long REGPARAM2 op_d088_3(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_d090_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d090_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20751,7 +20751,7 @@ unsigned long REGPARAM2 op_d090_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_d098_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d098_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20772,7 +20772,7 @@ unsigned long REGPARAM2 op_d098_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_d0a0_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0a0_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20794,7 +20794,7 @@ unsigned long REGPARAM2 op_d0a0_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_d0a8_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0a8_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20814,7 +20814,7 @@ unsigned long REGPARAM2 op_d0a8_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d0b0_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0b0_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20834,7 +20834,7 @@ unsigned long REGPARAM2 op_d0b0_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d0b8_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0b8_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -20853,7 +20853,7 @@ unsigned long REGPARAM2 op_d0b8_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d0b9_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0b9_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -20872,7 +20872,7 @@ unsigned long REGPARAM2 op_d0b9_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_d0ba_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0ba_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -20892,7 +20892,7 @@ unsigned long REGPARAM2 op_d0ba_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d0bb_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0bb_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -20912,7 +20912,7 @@ unsigned long REGPARAM2 op_d0bb_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d0bc_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0bc_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -20930,7 +20930,7 @@ unsigned long REGPARAM2 op_d0bc_3(uae_u32 opcode) /* ADD */
 }}}}}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_d0c0_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0c0_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20942,7 +20942,7 @@ unsigned long REGPARAM2 op_d0c0_3(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_d0c8_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0c8_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20954,7 +20954,7 @@ unsigned long REGPARAM2 op_d0c8_3(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_d0d0_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0d0_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20967,7 +20967,7 @@ unsigned long REGPARAM2 op_d0d0_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_d0d8_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0d8_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20981,7 +20981,7 @@ unsigned long REGPARAM2 op_d0d8_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_d0e0_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0e0_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -20996,7 +20996,7 @@ unsigned long REGPARAM2 op_d0e0_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(2);
 return 4;
 }
-unsigned long REGPARAM2 op_d0e8_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0e8_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21009,7 +21009,7 @@ unsigned long REGPARAM2 op_d0e8_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d0f0_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0f0_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21022,7 +21022,7 @@ unsigned long REGPARAM2 op_d0f0_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d0f8_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0f8_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -21034,7 +21034,7 @@ unsigned long REGPARAM2 op_d0f8_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d0f9_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0f9_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -21046,7 +21046,7 @@ unsigned long REGPARAM2 op_d0f9_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(6);
 return 8;
 }
-unsigned long REGPARAM2 op_d0fa_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0fa_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -21059,7 +21059,7 @@ unsigned long REGPARAM2 op_d0fa_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d0fb_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0fb_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -21072,7 +21072,7 @@ unsigned long REGPARAM2 op_d0fb_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 6;
 }
-unsigned long REGPARAM2 op_d0fc_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d0fc_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
@@ -21083,7 +21083,7 @@ unsigned long REGPARAM2 op_d0fc_3(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(4);
 return 4;
 }
-unsigned long REGPARAM2 op_d100_3(uae_u32 opcode) /* ADDX */
+unsigned long REGPARAM2 CPUOP_NAME(op_d100_3)(uae_u32 opcode) /* ADDX */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21102,7 +21102,7 @@ unsigned long REGPARAM2 op_d100_3(uae_u32 opcode) /* ADDX */
 }}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_d108_3(uae_u32 opcode) /* ADDX */
+unsigned long REGPARAM2 CPUOP_NAME(op_d108_3)(uae_u32 opcode) /* ADDX */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21127,7 +21127,7 @@ unsigned long REGPARAM2 op_d108_3(uae_u32 opcode) /* ADDX */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 op_d110_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d110_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21147,7 +21147,7 @@ unsigned long REGPARAM2 op_d110_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_d118_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d118_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21168,7 +21168,7 @@ unsigned long REGPARAM2 op_d118_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_d120_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d120_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21190,7 +21190,7 @@ unsigned long REGPARAM2 op_d120_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_d128_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d128_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21210,7 +21210,7 @@ unsigned long REGPARAM2 op_d128_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d130_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d130_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21230,7 +21230,7 @@ unsigned long REGPARAM2 op_d130_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d138_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d138_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -21249,7 +21249,7 @@ unsigned long REGPARAM2 op_d138_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d139_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d139_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
@@ -21268,7 +21268,7 @@ unsigned long REGPARAM2 op_d139_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_d140_3(uae_u32 opcode) /* ADDX */
+unsigned long REGPARAM2 CPUOP_NAME(op_d140_3)(uae_u32 opcode) /* ADDX */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21287,7 +21287,7 @@ unsigned long REGPARAM2 op_d140_3(uae_u32 opcode) /* ADDX */
 }}}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_d148_3(uae_u32 opcode) /* ADDX */
+unsigned long REGPARAM2 CPUOP_NAME(op_d148_3)(uae_u32 opcode) /* ADDX */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21312,7 +21312,7 @@ unsigned long REGPARAM2 op_d148_3(uae_u32 opcode) /* ADDX */
 }}}}}}}m68k_incpc(2);
 return 8;
 }
-unsigned long REGPARAM2 op_d150_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d150_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21332,7 +21332,7 @@ unsigned long REGPARAM2 op_d150_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_d158_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d158_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21353,7 +21353,7 @@ unsigned long REGPARAM2 op_d158_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_d160_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d160_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21375,7 +21375,7 @@ unsigned long REGPARAM2 op_d160_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_d168_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d168_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21395,7 +21395,7 @@ unsigned long REGPARAM2 op_d168_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d170_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d170_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21415,7 +21415,7 @@ unsigned long REGPARAM2 op_d170_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d178_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d178_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -21434,7 +21434,7 @@ unsigned long REGPARAM2 op_d178_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d179_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d179_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
@@ -21453,7 +21453,7 @@ unsigned long REGPARAM2 op_d179_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_d180_3(uae_u32 opcode) /* ADDX */
+unsigned long REGPARAM2 CPUOP_NAME(op_d180_3)(uae_u32 opcode) /* ADDX */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21475,7 +21475,7 @@ return 2;
 #endif
 
 #ifdef PART_8
-unsigned long REGPARAM2 op_d188_3(uae_u32 opcode) /* ADDX */
+unsigned long REGPARAM2 CPUOP_NAME(op_d188_3)(uae_u32 opcode) /* ADDX */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21500,7 +21500,7 @@ unsigned long REGPARAM2 op_d188_3(uae_u32 opcode) /* ADDX */
 }}}}}}}m68k_incpc(2);
 return 14;
 }
-unsigned long REGPARAM2 op_d190_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d190_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21520,7 +21520,7 @@ unsigned long REGPARAM2 op_d190_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_d198_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d198_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21541,7 +21541,7 @@ unsigned long REGPARAM2 op_d198_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_d1a0_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1a0_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21563,7 +21563,7 @@ unsigned long REGPARAM2 op_d1a0_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(2);
 return 10;
 }
-unsigned long REGPARAM2 op_d1a8_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1a8_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21583,7 +21583,7 @@ unsigned long REGPARAM2 op_d1a8_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_d1b0_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1b0_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21603,7 +21603,7 @@ unsigned long REGPARAM2 op_d1b0_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_d1b8_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1b8_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -21622,7 +21622,7 @@ unsigned long REGPARAM2 op_d1b8_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(4);
 return 12;
 }
-unsigned long REGPARAM2 op_d1b9_3(uae_u32 opcode) /* ADD */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1b9_3)(uae_u32 opcode) /* ADD */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
@@ -21641,7 +21641,7 @@ unsigned long REGPARAM2 op_d1b9_3(uae_u32 opcode) /* ADD */
 }}}}}}}m68k_incpc(6);
 return 14;
 }
-unsigned long REGPARAM2 op_d1c0_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1c0_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21653,7 +21653,7 @@ unsigned long REGPARAM2 op_d1c0_3(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_d1c8_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1c8_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21665,7 +21665,7 @@ unsigned long REGPARAM2 op_d1c8_3(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_d1d0_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1d0_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21678,7 +21678,7 @@ unsigned long REGPARAM2 op_d1d0_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_d1d8_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1d8_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21692,7 +21692,7 @@ unsigned long REGPARAM2 op_d1d8_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_d1e0_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1e0_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21707,7 +21707,7 @@ unsigned long REGPARAM2 op_d1e0_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_d1e8_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1e8_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21720,7 +21720,7 @@ unsigned long REGPARAM2 op_d1e8_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d1f0_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1f0_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
@@ -21733,7 +21733,7 @@ unsigned long REGPARAM2 op_d1f0_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d1f8_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1f8_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
@@ -21745,7 +21745,7 @@ unsigned long REGPARAM2 op_d1f8_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d1f9_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1f9_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
@@ -21757,7 +21757,7 @@ unsigned long REGPARAM2 op_d1f9_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_d1fa_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1fa_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_getpc () + 2;
@@ -21770,7 +21770,7 @@ unsigned long REGPARAM2 op_d1fa_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d1fb_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1fb_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr tmppc = m68k_getpc() + 2;
@@ -21783,7 +21783,7 @@ unsigned long REGPARAM2 op_d1fb_3(uae_u32 opcode) /* ADDA */
 }}}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_d1fc_3(uae_u32 opcode) /* ADDA */
+unsigned long REGPARAM2 CPUOP_NAME(op_d1fc_3)(uae_u32 opcode) /* ADDA */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
@@ -21794,7 +21794,7 @@ unsigned long REGPARAM2 op_d1fc_3(uae_u32 opcode) /* ADDA */
 }}}}m68k_incpc(6);
 return 6;
 }
-unsigned long REGPARAM2 op_e000_3(uae_u32 opcode) /* ASR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e000_3)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -21826,7 +21826,7 @@ unsigned long REGPARAM2 op_e000_3(uae_u32 opcode) /* ASR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e008_3(uae_u32 opcode) /* LSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e008_3)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -21855,7 +21855,7 @@ unsigned long REGPARAM2 op_e008_3(uae_u32 opcode) /* LSR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e010_3(uae_u32 opcode) /* ROXR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e010_3)(uae_u32 opcode) /* ROXR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -21887,7 +21887,7 @@ unsigned long REGPARAM2 op_e010_3(uae_u32 opcode) /* ROXR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e018_3(uae_u32 opcode) /* ROR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e018_3)(uae_u32 opcode) /* ROR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -21912,7 +21912,7 @@ unsigned long REGPARAM2 op_e018_3(uae_u32 opcode) /* ROR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e020_3(uae_u32 opcode) /* ASR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e020_3)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21944,7 +21944,7 @@ unsigned long REGPARAM2 op_e020_3(uae_u32 opcode) /* ASR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e028_3(uae_u32 opcode) /* LSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e028_3)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -21973,7 +21973,7 @@ unsigned long REGPARAM2 op_e028_3(uae_u32 opcode) /* LSR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e030_3(uae_u32 opcode) /* ROXR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e030_3)(uae_u32 opcode) /* ROXR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -22009,7 +22009,7 @@ unsigned long REGPARAM2 op_e030_3(uae_u32 opcode) /* ROXR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e038_3(uae_u32 opcode) /* ROR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e038_3)(uae_u32 opcode) /* ROR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -22034,7 +22034,7 @@ unsigned long REGPARAM2 op_e038_3(uae_u32 opcode) /* ROR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e040_3(uae_u32 opcode) /* ASR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e040_3)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22066,7 +22066,7 @@ unsigned long REGPARAM2 op_e040_3(uae_u32 opcode) /* ASR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e048_3(uae_u32 opcode) /* LSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e048_3)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22095,7 +22095,7 @@ unsigned long REGPARAM2 op_e048_3(uae_u32 opcode) /* LSR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e050_3(uae_u32 opcode) /* ROXR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e050_3)(uae_u32 opcode) /* ROXR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22127,7 +22127,7 @@ unsigned long REGPARAM2 op_e050_3(uae_u32 opcode) /* ROXR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e058_3(uae_u32 opcode) /* ROR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e058_3)(uae_u32 opcode) /* ROR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22152,7 +22152,7 @@ unsigned long REGPARAM2 op_e058_3(uae_u32 opcode) /* ROR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e060_3(uae_u32 opcode) /* ASR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e060_3)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -22184,7 +22184,7 @@ unsigned long REGPARAM2 op_e060_3(uae_u32 opcode) /* ASR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e068_3(uae_u32 opcode) /* LSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e068_3)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -22213,7 +22213,7 @@ unsigned long REGPARAM2 op_e068_3(uae_u32 opcode) /* LSR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e070_3(uae_u32 opcode) /* ROXR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e070_3)(uae_u32 opcode) /* ROXR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -22248,7 +22248,7 @@ unsigned long REGPARAM2 op_e070_3(uae_u32 opcode) /* ROXR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e078_3(uae_u32 opcode) /* ROR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e078_3)(uae_u32 opcode) /* ROR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -22273,7 +22273,7 @@ unsigned long REGPARAM2 op_e078_3(uae_u32 opcode) /* ROR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e080_3(uae_u32 opcode) /* ASR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e080_3)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22305,7 +22305,7 @@ unsigned long REGPARAM2 op_e080_3(uae_u32 opcode) /* ASR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e088_3(uae_u32 opcode) /* LSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e088_3)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22334,7 +22334,7 @@ unsigned long REGPARAM2 op_e088_3(uae_u32 opcode) /* LSR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e090_3(uae_u32 opcode) /* ROXR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e090_3)(uae_u32 opcode) /* ROXR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22366,7 +22366,7 @@ unsigned long REGPARAM2 op_e090_3(uae_u32 opcode) /* ROXR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e098_3(uae_u32 opcode) /* ROR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e098_3)(uae_u32 opcode) /* ROR */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22391,7 +22391,7 @@ unsigned long REGPARAM2 op_e098_3(uae_u32 opcode) /* ROR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e0a0_3(uae_u32 opcode) /* ASR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e0a0_3)(uae_u32 opcode) /* ASR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -22423,7 +22423,7 @@ unsigned long REGPARAM2 op_e0a0_3(uae_u32 opcode) /* ASR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e0a8_3(uae_u32 opcode) /* LSR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e0a8_3)(uae_u32 opcode) /* LSR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -22452,7 +22452,7 @@ unsigned long REGPARAM2 op_e0a8_3(uae_u32 opcode) /* LSR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e0b0_3(uae_u32 opcode) /* ROXR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e0b0_3)(uae_u32 opcode) /* ROXR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -22486,7 +22486,7 @@ unsigned long REGPARAM2 op_e0b0_3(uae_u32 opcode) /* ROXR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e0b8_3(uae_u32 opcode) /* ROR */
+unsigned long REGPARAM2 CPUOP_NAME(op_e0b8_3)(uae_u32 opcode) /* ROR */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -22511,7 +22511,7 @@ unsigned long REGPARAM2 op_e0b8_3(uae_u32 opcode) /* ROR */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e0d0_3(uae_u32 opcode) /* ASRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e0d0_3)(uae_u32 opcode) /* ASRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -22529,7 +22529,7 @@ unsigned long REGPARAM2 op_e0d0_3(uae_u32 opcode) /* ASRW */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e0d8_3(uae_u32 opcode) /* ASRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e0d8_3)(uae_u32 opcode) /* ASRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -22548,7 +22548,7 @@ unsigned long REGPARAM2 op_e0d8_3(uae_u32 opcode) /* ASRW */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e0e0_3(uae_u32 opcode) /* ASRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e0e0_3)(uae_u32 opcode) /* ASRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
@@ -22568,7 +22568,7 @@ unsigned long REGPARAM2 op_e0e0_3(uae_u32 opcode) /* ASRW */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e0e8_3(uae_u32 opcode) /* ASRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e0e8_3)(uae_u32 opcode) /* ASRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -22586,7 +22586,7 @@ unsigned long REGPARAM2 op_e0e8_3(uae_u32 opcode) /* ASRW */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e0f0_3(uae_u32 opcode) /* ASRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e0f0_3)(uae_u32 opcode) /* ASRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -22604,7 +22604,7 @@ unsigned long REGPARAM2 op_e0f0_3(uae_u32 opcode) /* ASRW */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e0f8_3(uae_u32 opcode) /* ASRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e0f8_3)(uae_u32 opcode) /* ASRW */
 {
 {{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 data = get_word(dataa);
@@ -22621,7 +22621,7 @@ unsigned long REGPARAM2 op_e0f8_3(uae_u32 opcode) /* ASRW */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e0f9_3(uae_u32 opcode) /* ASRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e0f9_3)(uae_u32 opcode) /* ASRW */
 {
 {{	uaecptr dataa = get_ilong(2);
 {	uae_s16 data = get_word(dataa);
@@ -22638,7 +22638,7 @@ unsigned long REGPARAM2 op_e0f9_3(uae_u32 opcode) /* ASRW */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_e100_3(uae_u32 opcode) /* ASL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e100_3)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22671,7 +22671,7 @@ unsigned long REGPARAM2 op_e100_3(uae_u32 opcode) /* ASL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e108_3(uae_u32 opcode) /* LSL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e108_3)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22701,7 +22701,7 @@ unsigned long REGPARAM2 op_e108_3(uae_u32 opcode) /* LSL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e110_3(uae_u32 opcode) /* ROXL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e110_3)(uae_u32 opcode) /* ROXL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22730,7 +22730,7 @@ unsigned long REGPARAM2 op_e110_3(uae_u32 opcode) /* ROXL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e118_3(uae_u32 opcode) /* ROL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e118_3)(uae_u32 opcode) /* ROL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22757,7 +22757,7 @@ unsigned long REGPARAM2 op_e118_3(uae_u32 opcode) /* ROL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e120_3(uae_u32 opcode) /* ASL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e120_3)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -22790,7 +22790,7 @@ unsigned long REGPARAM2 op_e120_3(uae_u32 opcode) /* ASL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e128_3(uae_u32 opcode) /* LSL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e128_3)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -22820,7 +22820,7 @@ unsigned long REGPARAM2 op_e128_3(uae_u32 opcode) /* LSL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e130_3(uae_u32 opcode) /* ROXL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e130_3)(uae_u32 opcode) /* ROXL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -22853,7 +22853,7 @@ unsigned long REGPARAM2 op_e130_3(uae_u32 opcode) /* ROXL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e138_3(uae_u32 opcode) /* ROL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e138_3)(uae_u32 opcode) /* ROL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -22881,7 +22881,7 @@ unsigned long REGPARAM2 op_e138_3(uae_u32 opcode) /* ROL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e140_3(uae_u32 opcode) /* ASL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e140_3)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22914,7 +22914,7 @@ unsigned long REGPARAM2 op_e140_3(uae_u32 opcode) /* ASL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e148_3(uae_u32 opcode) /* LSL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e148_3)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22944,7 +22944,7 @@ unsigned long REGPARAM2 op_e148_3(uae_u32 opcode) /* LSL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e150_3(uae_u32 opcode) /* ROXL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e150_3)(uae_u32 opcode) /* ROXL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -22973,7 +22973,7 @@ unsigned long REGPARAM2 op_e150_3(uae_u32 opcode) /* ROXL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e158_3(uae_u32 opcode) /* ROL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e158_3)(uae_u32 opcode) /* ROL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -23000,7 +23000,7 @@ unsigned long REGPARAM2 op_e158_3(uae_u32 opcode) /* ROL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e160_3(uae_u32 opcode) /* ASL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e160_3)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -23033,7 +23033,7 @@ unsigned long REGPARAM2 op_e160_3(uae_u32 opcode) /* ASL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e168_3(uae_u32 opcode) /* LSL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e168_3)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -23063,7 +23063,7 @@ unsigned long REGPARAM2 op_e168_3(uae_u32 opcode) /* LSL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e170_3(uae_u32 opcode) /* ROXL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e170_3)(uae_u32 opcode) /* ROXL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -23095,7 +23095,7 @@ unsigned long REGPARAM2 op_e170_3(uae_u32 opcode) /* ROXL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e178_3(uae_u32 opcode) /* ROL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e178_3)(uae_u32 opcode) /* ROL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -23123,7 +23123,7 @@ unsigned long REGPARAM2 op_e178_3(uae_u32 opcode) /* ROL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e180_3(uae_u32 opcode) /* ASL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e180_3)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -23156,7 +23156,7 @@ unsigned long REGPARAM2 op_e180_3(uae_u32 opcode) /* ASL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e188_3(uae_u32 opcode) /* LSL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e188_3)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -23186,7 +23186,7 @@ unsigned long REGPARAM2 op_e188_3(uae_u32 opcode) /* LSL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e190_3(uae_u32 opcode) /* ROXL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e190_3)(uae_u32 opcode) /* ROXL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -23215,7 +23215,7 @@ unsigned long REGPARAM2 op_e190_3(uae_u32 opcode) /* ROXL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e198_3(uae_u32 opcode) /* ROL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e198_3)(uae_u32 opcode) /* ROL */
 {
 	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 	uae_u32 dstreg = opcode & 7;
@@ -23242,7 +23242,7 @@ unsigned long REGPARAM2 op_e198_3(uae_u32 opcode) /* ROL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e1a0_3(uae_u32 opcode) /* ASL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e1a0_3)(uae_u32 opcode) /* ASL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -23275,7 +23275,7 @@ unsigned long REGPARAM2 op_e1a0_3(uae_u32 opcode) /* ASL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e1a8_3(uae_u32 opcode) /* LSL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e1a8_3)(uae_u32 opcode) /* LSL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -23305,7 +23305,7 @@ unsigned long REGPARAM2 op_e1a8_3(uae_u32 opcode) /* LSL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e1b0_3(uae_u32 opcode) /* ROXL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e1b0_3)(uae_u32 opcode) /* ROXL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -23336,7 +23336,7 @@ unsigned long REGPARAM2 op_e1b0_3(uae_u32 opcode) /* ROXL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e1b8_3(uae_u32 opcode) /* ROL */
+unsigned long REGPARAM2 CPUOP_NAME(op_e1b8_3)(uae_u32 opcode) /* ROL */
 {
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
@@ -23364,7 +23364,7 @@ unsigned long REGPARAM2 op_e1b8_3(uae_u32 opcode) /* ROL */
 }}}}m68k_incpc(2);
 return 2;
 }
-unsigned long REGPARAM2 op_e1d0_3(uae_u32 opcode) /* ASLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e1d0_3)(uae_u32 opcode) /* ASLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -23384,7 +23384,7 @@ unsigned long REGPARAM2 op_e1d0_3(uae_u32 opcode) /* ASLW */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e1d8_3(uae_u32 opcode) /* ASLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e1d8_3)(uae_u32 opcode) /* ASLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -23405,7 +23405,7 @@ unsigned long REGPARAM2 op_e1d8_3(uae_u32 opcode) /* ASLW */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e1e0_3(uae_u32 opcode) /* ASLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e1e0_3)(uae_u32 opcode) /* ASLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
@@ -23427,7 +23427,7 @@ unsigned long REGPARAM2 op_e1e0_3(uae_u32 opcode) /* ASLW */
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e1e8_3(uae_u32 opcode) /* ASLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e1e8_3)(uae_u32 opcode) /* ASLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -23447,7 +23447,7 @@ unsigned long REGPARAM2 op_e1e8_3(uae_u32 opcode) /* ASLW */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e1f0_3(uae_u32 opcode) /* ASLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e1f0_3)(uae_u32 opcode) /* ASLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -23467,7 +23467,7 @@ unsigned long REGPARAM2 op_e1f0_3(uae_u32 opcode) /* ASLW */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e1f8_3(uae_u32 opcode) /* ASLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e1f8_3)(uae_u32 opcode) /* ASLW */
 {
 {{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 data = get_word(dataa);
@@ -23486,7 +23486,7 @@ unsigned long REGPARAM2 op_e1f8_3(uae_u32 opcode) /* ASLW */
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e1f9_3(uae_u32 opcode) /* ASLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e1f9_3)(uae_u32 opcode) /* ASLW */
 {
 {{	uaecptr dataa = get_ilong(2);
 {	uae_s16 data = get_word(dataa);
@@ -23505,7 +23505,7 @@ unsigned long REGPARAM2 op_e1f9_3(uae_u32 opcode) /* ASLW */
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_e2d0_3(uae_u32 opcode) /* LSRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e2d0_3)(uae_u32 opcode) /* LSRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -23522,7 +23522,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e2d8_3(uae_u32 opcode) /* LSRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e2d8_3)(uae_u32 opcode) /* LSRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -23540,7 +23540,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e2e0_3(uae_u32 opcode) /* LSRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e2e0_3)(uae_u32 opcode) /* LSRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
@@ -23559,7 +23559,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e2e8_3(uae_u32 opcode) /* LSRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e2e8_3)(uae_u32 opcode) /* LSRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -23576,7 +23576,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e2f0_3(uae_u32 opcode) /* LSRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e2f0_3)(uae_u32 opcode) /* LSRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -23593,7 +23593,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e2f8_3(uae_u32 opcode) /* LSRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e2f8_3)(uae_u32 opcode) /* LSRW */
 {
 {{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 data = get_word(dataa);
@@ -23609,7 +23609,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e2f9_3(uae_u32 opcode) /* LSRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e2f9_3)(uae_u32 opcode) /* LSRW */
 {
 {{	uaecptr dataa = get_ilong(2);
 {	uae_s16 data = get_word(dataa);
@@ -23625,7 +23625,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_e3d0_3(uae_u32 opcode) /* LSLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e3d0_3)(uae_u32 opcode) /* LSLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -23642,7 +23642,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e3d8_3(uae_u32 opcode) /* LSLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e3d8_3)(uae_u32 opcode) /* LSLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -23660,7 +23660,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e3e0_3(uae_u32 opcode) /* LSLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e3e0_3)(uae_u32 opcode) /* LSLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
@@ -23679,7 +23679,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e3e8_3(uae_u32 opcode) /* LSLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e3e8_3)(uae_u32 opcode) /* LSLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -23696,7 +23696,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e3f0_3(uae_u32 opcode) /* LSLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e3f0_3)(uae_u32 opcode) /* LSLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -23713,7 +23713,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e3f8_3(uae_u32 opcode) /* LSLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e3f8_3)(uae_u32 opcode) /* LSLW */
 {
 {{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 data = get_word(dataa);
@@ -23729,7 +23729,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e3f9_3(uae_u32 opcode) /* LSLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e3f9_3)(uae_u32 opcode) /* LSLW */
 {
 {{	uaecptr dataa = get_ilong(2);
 {	uae_s16 data = get_word(dataa);
@@ -23745,7 +23745,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_e4d0_3(uae_u32 opcode) /* ROXRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e4d0_3)(uae_u32 opcode) /* ROXRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -23763,7 +23763,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e4d8_3(uae_u32 opcode) /* ROXRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e4d8_3)(uae_u32 opcode) /* ROXRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -23782,7 +23782,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e4e0_3(uae_u32 opcode) /* ROXRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e4e0_3)(uae_u32 opcode) /* ROXRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
@@ -23802,7 +23802,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e4e8_3(uae_u32 opcode) /* ROXRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e4e8_3)(uae_u32 opcode) /* ROXRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -23820,7 +23820,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e4f0_3(uae_u32 opcode) /* ROXRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e4f0_3)(uae_u32 opcode) /* ROXRW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -23838,7 +23838,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e4f8_3(uae_u32 opcode) /* ROXRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e4f8_3)(uae_u32 opcode) /* ROXRW */
 {
 {{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 data = get_word(dataa);
@@ -23855,7 +23855,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e4f9_3(uae_u32 opcode) /* ROXRW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e4f9_3)(uae_u32 opcode) /* ROXRW */
 {
 {{	uaecptr dataa = get_ilong(2);
 {	uae_s16 data = get_word(dataa);
@@ -23872,7 +23872,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_e5d0_3(uae_u32 opcode) /* ROXLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e5d0_3)(uae_u32 opcode) /* ROXLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -23890,7 +23890,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e5d8_3(uae_u32 opcode) /* ROXLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e5d8_3)(uae_u32 opcode) /* ROXLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -23909,7 +23909,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e5e0_3(uae_u32 opcode) /* ROXLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e5e0_3)(uae_u32 opcode) /* ROXLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
@@ -23929,7 +23929,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e5e8_3(uae_u32 opcode) /* ROXLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e5e8_3)(uae_u32 opcode) /* ROXLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -23947,7 +23947,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e5f0_3(uae_u32 opcode) /* ROXLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e5f0_3)(uae_u32 opcode) /* ROXLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -23965,7 +23965,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e5f8_3(uae_u32 opcode) /* ROXLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e5f8_3)(uae_u32 opcode) /* ROXLW */
 {
 {{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 data = get_word(dataa);
@@ -23982,7 +23982,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e5f9_3(uae_u32 opcode) /* ROXLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e5f9_3)(uae_u32 opcode) /* ROXLW */
 {
 {{	uaecptr dataa = get_ilong(2);
 {	uae_s16 data = get_word(dataa);
@@ -23999,7 +23999,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_e6d0_3(uae_u32 opcode) /* RORW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e6d0_3)(uae_u32 opcode) /* RORW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -24016,7 +24016,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e6d8_3(uae_u32 opcode) /* RORW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e6d8_3)(uae_u32 opcode) /* RORW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -24034,7 +24034,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e6e0_3(uae_u32 opcode) /* RORW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e6e0_3)(uae_u32 opcode) /* RORW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
@@ -24053,7 +24053,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e6e8_3(uae_u32 opcode) /* RORW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e6e8_3)(uae_u32 opcode) /* RORW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -24070,7 +24070,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e6f0_3(uae_u32 opcode) /* RORW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e6f0_3)(uae_u32 opcode) /* RORW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -24087,7 +24087,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e6f8_3(uae_u32 opcode) /* RORW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e6f8_3)(uae_u32 opcode) /* RORW */
 {
 {{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 data = get_word(dataa);
@@ -24103,7 +24103,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e6f9_3(uae_u32 opcode) /* RORW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e6f9_3)(uae_u32 opcode) /* RORW */
 {
 {{	uaecptr dataa = get_ilong(2);
 {	uae_s16 data = get_word(dataa);
@@ -24119,7 +24119,7 @@ SET_CFLG (carry);
 }}}}m68k_incpc(6);
 return 10;
 }
-unsigned long REGPARAM2 op_e7d0_3(uae_u32 opcode) /* ROLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e7d0_3)(uae_u32 opcode) /* ROLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -24136,7 +24136,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e7d8_3(uae_u32 opcode) /* ROLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e7d8_3)(uae_u32 opcode) /* ROLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg);
@@ -24154,7 +24154,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e7e0_3(uae_u32 opcode) /* ROLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e7e0_3)(uae_u32 opcode) /* ROLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
@@ -24173,7 +24173,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(2);
 return 6;
 }
-unsigned long REGPARAM2 op_e7e8_3(uae_u32 opcode) /* ROLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e7e8_3)(uae_u32 opcode) /* ROLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
@@ -24190,7 +24190,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e7f0_3(uae_u32 opcode) /* ROLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e7f0_3)(uae_u32 opcode) /* ROLW */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
@@ -24207,7 +24207,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e7f8_3(uae_u32 opcode) /* ROLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e7f8_3)(uae_u32 opcode) /* ROLW */
 {
 {{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 data = get_word(dataa);
@@ -24223,7 +24223,7 @@ SET_CFLG (carry >> 15);
 }}}}m68k_incpc(4);
 return 8;
 }
-unsigned long REGPARAM2 op_e7f9_3(uae_u32 opcode) /* ROLW */
+unsigned long REGPARAM2 CPUOP_NAME(op_e7f9_3)(uae_u32 opcode) /* ROLW */
 {
 {{	uaecptr dataa = get_ilong(2);
 {	uae_s16 data = get_word(dataa);
@@ -0,0 +1,59 @@
+/*********************************************************************
+ *
+ * Copyright (c) 1998
+ * 3Com/Palm Computing Division.  All rights reserved.
+ *
+ * Portions copyright (c) 1995-1998
+ * Bernd Schmidt.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without 
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *		This product includes software developed by 3Com and its
+ *		contributors.
+ *
+ * 4. Neither 3Com nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE 3COM AND CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL 3COM OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ * USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+// Build a second set of opcode handlers from the same generated source,
+// this time with the stack pointer checks compiled out.  Those checks
+// are what let us track the current stack and report stack overflows,
+// but they're on the path of every instruction that changes A7.
+// EmCPU68K switches cpufunctbl to this set when the user turns them off.
+//
+// Everything defined here gets a "_nocheck" suffix, so these handlers
+// and op_smalltbl_3_nocheck link alongside the regular ones.
+
+#define CPUOP_NAME(name)		name##_nocheck
+#define CPUOP_NO_STACK_CHECKS	1
+
+#include "cpuemu.c"
+#include "cpustbl.c"
@@ -1,1584 +1,1584 @@
-extern cpuop_func op_0_3;
-extern cpuop_func op_10_3;
-extern cpuop_func op_18_3;
-extern cpuop_func op_20_3;
-extern cpuop_func op_28_3;
-extern cpuop_func op_30_3;
-extern cpuop_func op_38_3;
-extern cpuop_func op_39_3;
-extern cpuop_func op_3c_3;
-extern cpuop_func op_40_3;
-extern cpuop_func op_50_3;
-extern cpuop_func op_58_3;
-extern cpuop_func op_60_3;
-extern cpuop_func op_68_3;
-extern cpuop_func op_70_3;
-extern cpuop_func op_78_3;
-extern cpuop_func op_79_3;
-extern cpuop_func op_7c_3;
-extern cpuop_func op_80_3;
-extern cpuop_func op_90_3;
-extern cpuop_func op_98_3;
-extern cpuop_func op_a0_3;
-extern cpuop_func op_a8_3;
-extern cpuop_func op_b0_3;
-extern cpuop_func op_b8_3;
-extern cpuop_func op_b9_3;
-extern cpuop_func op_100_3;
-extern cpuop_func op_108_3;
-extern cpuop_func op_110_3;
-extern cpuop_func op_118_3;
-extern cpuop_func op_120_3;
-extern cpuop_func op_128_3;
-extern cpuop_func op_130_3;
-extern cpuop_func op_138_3;
-extern cpuop_func op_139_3;
-extern cpuop_func op_13a_3;
-extern cpuop_func op_13b_3;
-extern cpuop_func op_13c_3;
-extern cpuop_func op_140_3;
-extern cpuop_func op_148_3;
-extern cpuop_func op_150_3;
-extern cpuop_func op_158_3;
-extern cpuop_func op_160_3;
-extern cpuop_func op_168_3;
-extern cpuop_func op_170_3;
-extern cpuop_func op_178_3;
-extern cpuop_func op_179_3;
-extern cpuop_func op_17a_3;
-extern cpuop_func op_17b_3;
-extern cpuop_func op_180_3;
-extern cpuop_func op_188_3;
-extern cpuop_func op_190_3;
-extern cpuop_func op_198_3;
-extern cpuop_func op_1a0_3;
-extern cpuop_func op_1a8_3;
-extern cpuop_func op_1b0_3;
-extern cpuop_func op_1b8_3;
-extern cpuop_func op_1b9_3;
-extern cpuop_func op_1ba_3;
-extern cpuop_func op_1bb_3;
-extern cpuop_func op_1c0_3;
-extern cpuop_func op_1c8_3;
-extern cpuop_func op_1d0_3;
-extern cpuop_func op_1d8_3;
-extern cpuop_func op_1e0_3;
-extern cpuop_func op_1e8_3;
-extern cpuop_func op_1f0_3;
-extern cpuop_func op_1f8_3;
-extern cpuop_func op_1f9_3;
-extern cpuop_func op_1fa_3;
-extern cpuop_func op_1fb_3;
-extern cpuop_func op_200_3;
-extern cpuop_func op_210_3;
-extern cpuop_func op_218_3;
-extern cpuop_func op_220_3;
-extern cpuop_func op_228_3;
-extern cpuop_func op_230_3;
-extern cpuop_func op_238_3;
-extern cpuop_func op_239_3;
-extern cpuop_func op_23c_3;
-extern cpuop_func op_240_3;
-extern cpuop_func op_250_3;
-extern cpuop_func op_258_3;
-extern cpuop_func op_260_3;
-extern cpuop_func op_268_3;
-extern cpuop_func op_270_3;
-extern cpuop_func op_278_3;
-extern cpuop_func op_279_3;
-extern cpuop_func op_27c_3;
-extern cpuop_func op_280_3;
-extern cpuop_func op_290_3;
-extern cpuop_func op_298_3;
-extern cpuop_func op_2a0_3;
-extern cpuop_func op_2a8_3;
-extern cpuop_func op_2b0_3;
-extern cpuop_func op_2b8_3;
-extern cpuop_func op_2b9_3;
-extern cpuop_func op_400_3;
-extern cpuop_func op_410_3;
-extern cpuop_func op_418_3;
-extern cpuop_func op_420_3;
-extern cpuop_func op_428_3;
-extern cpuop_func op_430_3;
-extern cpuop_func op_438_3;
-extern cpuop_func op_439_3;
-extern cpuop_func op_440_3;
-extern cpuop_func op_450_3;
-extern cpuop_func op_458_3;
-extern cpuop_func op_460_3;
-extern cpuop_func op_468_3;
-extern cpuop_func op_470_3;
-extern cpuop_func op_478_3;
-extern cpuop_func op_479_3;
-extern cpuop_func op_480_3;
-extern cpuop_func op_490_3;
-extern cpuop_func op_498_3;
-extern cpuop_func op_4a0_3;
-extern cpuop_func op_4a8_3;
-extern cpuop_func op_4b0_3;
-extern cpuop_func op_4b8_3;
-extern cpuop_func op_4b9_3;
-extern cpuop_func op_600_3;
-extern cpuop_func op_610_3;
-extern cpuop_func op_618_3;
-extern cpuop_func op_620_3;
-extern cpuop_func op_628_3;
-extern cpuop_func op_630_3;
-extern cpuop_func op_638_3;
-extern cpuop_func op_639_3;
-extern cpuop_func op_640_3;
-extern cpuop_func op_650_3;
-extern cpuop_func op_658_3;
-extern cpuop_func op_660_3;
-extern cpuop_func op_668_3;
-extern cpuop_func op_670_3;
-extern cpuop_func op_678_3;
-extern cpuop_func op_679_3;
-extern cpuop_func op_680_3;
-extern cpuop_func op_690_3;
-extern cpuop_func op_698_3;
-extern cpuop_func op_6a0_3;
-extern cpuop_func op_6a8_3;
-extern cpuop_func op_6b0_3;
-extern cpuop_func op_6b8_3;
-extern cpuop_func op_6b9_3;
-extern cpuop_func op_800_3;
-extern cpuop_func op_810_3;
-extern cpuop_func op_818_3;
-extern cpuop_func op_820_3;
-extern cpuop_func op_828_3;
-extern cpuop_func op_830_3;
-extern cpuop_func op_838_3;
-extern cpuop_func op_839_3;
-extern cpuop_func op_83a_3;
-extern cpuop_func op_83b_3;
-extern cpuop_func op_83c_3;
-extern cpuop_func op_840_3;
-extern cpuop_func op_850_3;
-extern cpuop_func op_858_3;
-extern cpuop_func op_860_3;
-extern cpuop_func op_868_3;
-extern cpuop_func op_870_3;
-extern cpuop_func op_878_3;
-extern cpuop_func op_879_3;
-extern cpuop_func op_87a_3;
-extern cpuop_func op_87b_3;
-extern cpuop_func op_880_3;
-extern cpuop_func op_890_3;
-extern cpuop_func op_898_3;
-extern cpuop_func op_8a0_3;
-extern cpuop_func op_8a8_3;
-extern cpuop_func op_8b0_3;
-extern cpuop_func op_8b8_3;
-extern cpuop_func op_8b9_3;
-extern cpuop_func op_8ba_3;
-extern cpuop_func op_8bb_3;
-extern cpuop_func op_8c0_3;
-extern cpuop_func op_8d0_3;
-extern cpuop_func op_8d8_3;
-extern cpuop_func op_8e0_3;
-extern cpuop_func op_8e8_3;
-extern cpuop_func op_8f0_3;
-extern cpuop_func op_8f8_3;
-extern cpuop_func op_8f9_3;
-extern cpuop_func op_8fa_3;
-extern cpuop_func op_8fb_3;
-extern cpuop_func op_a00_3;
-extern cpuop_func op_a10_3;
-extern cpuop_func op_a18_3;
-extern cpuop_func op_a20_3;
-extern cpuop_func op_a28_3;
-extern cpuop_func op_a30_3;
-extern cpuop_func op_a38_3;
-extern cpuop_func op_a39_3;
-extern cpuop_func op_a3c_3;
-extern cpuop_func op_a40_3;
-extern cpuop_func op_a50_3;
-extern cpuop_func op_a58_3;
-extern cpuop_func op_a60_3;
-extern cpuop_func op_a68_3;
-extern cpuop_func op_a70_3;
-extern cpuop_func op_a78_3;
-extern cpuop_func op_a79_3;
-extern cpuop_func op_a7c_3;
-extern cpuop_func op_a80_3;
-extern cpuop_func op_a90_3;
-extern cpuop_func op_a98_3;
-extern cpuop_func op_aa0_3;
-extern cpuop_func op_aa8_3;
-extern cpuop_func op_ab0_3;
-extern cpuop_func op_ab8_3;
-extern cpuop_func op_ab9_3;
-extern cpuop_func op_c00_3;
-extern cpuop_func op_c10_3;
-extern cpuop_func op_c18_3;
-extern cpuop_func op_c20_3;
-extern cpuop_func op_c28_3;
-extern cpuop_func op_c30_3;
-extern cpuop_func op_c38_3;
-extern cpuop_func op_c39_3;
-extern cpuop_func op_c3a_3;
-extern cpuop_func op_c3b_3;
-extern cpuop_func op_c40_3;
-extern cpuop_func op_c50_3;
-extern cpuop_func op_c58_3;
-extern cpuop_func op_c60_3;
-extern cpuop_func op_c68_3;
-extern cpuop_func op_c70_3;
-extern cpuop_func op_c78_3;
-extern cpuop_func op_c79_3;
-extern cpuop_func op_c7a_3;
-extern cpuop_func op_c7b_3;
-extern cpuop_func op_c80_3;
-extern cpuop_func op_c90_3;
-extern cpuop_func op_c98_3;
-extern cpuop_func op_ca0_3;
-extern cpuop_func op_ca8_3;
-extern cpuop_func op_cb0_3;
-extern cpuop_func op_cb8_3;
-extern cpuop_func op_cb9_3;
-extern cpuop_func op_cba_3;
-extern cpuop_func op_cbb_3;
-extern cpuop_func op_1000_3;
-extern cpuop_func op_1010_3;
-extern cpuop_func op_1018_3;
-extern cpuop_func op_1020_3;
-extern cpuop_func op_1028_3;
-extern cpuop_func op_1030_3;
-extern cpuop_func op_1038_3;
-extern cpuop_func op_1039_3;
-extern cpuop_func op_103a_3;
-extern cpuop_func op_103b_3;
-extern cpuop_func op_103c_3;
-extern cpuop_func op_1080_3;
-extern cpuop_func op_1090_3;
-extern cpuop_func op_1098_3;
-extern cpuop_func op_10a0_3;
-extern cpuop_func op_10a8_3;
-extern cpuop_func op_10b0_3;
-extern cpuop_func op_10b8_3;
-extern cpuop_func op_10b9_3;
-extern cpuop_func op_10ba_3;
-extern cpuop_func op_10bb_3;
-extern cpuop_func op_10bc_3;
-extern cpuop_func op_10c0_3;
-extern cpuop_func op_10d0_3;
-extern cpuop_func op_10d8_3;
-extern cpuop_func op_10e0_3;
-extern cpuop_func op_10e8_3;
-extern cpuop_func op_10f0_3;
-extern cpuop_func op_10f8_3;
-extern cpuop_func op_10f9_3;
-extern cpuop_func op_10fa_3;
-extern cpuop_func op_10fb_3;
-extern cpuop_func op_10fc_3;
-extern cpuop_func op_1100_3;
-extern cpuop_func op_1110_3;
-extern cpuop_func op_1118_3;
-extern cpuop_func op_1120_3;
-extern cpuop_func op_1128_3;
-extern cpuop_func op_1130_3;
-extern cpuop_func op_1138_3;
-extern cpuop_func op_1139_3;
-extern cpuop_func op_113a_3;
-extern cpuop_func op_113b_3;
-extern cpuop_func op_113c_3;
-extern cpuop_func op_1140_3;
-extern cpuop_func op_1150_3;
-extern cpuop_func op_1158_3;
-extern cpuop_func op_1160_3;
-extern cpuop_func op_1168_3;
-extern cpuop_func op_1170_3;
-extern cpuop_func op_1178_3;
-extern cpuop_func op_1179_3;
-extern cpuop_func op_117a_3;
-extern cpuop_func op_117b_3;
-extern cpuop_func op_117c_3;
-extern cpuop_func op_1180_3;
-extern cpuop_func op_1190_3;
-extern cpuop_func op_1198_3;
-extern cpuop_func op_11a0_3;
-extern cpuop_func op_11a8_3;
-extern cpuop_func op_11b0_3;
-extern cpuop_func op_11b8_3;
-extern cpuop_func op_11b9_3;
-extern cpuop_func op_11ba_3;
-extern cpuop_func op_11bb_3;
-extern cpuop_func op_11bc_3;
-extern cpuop_func op_11c0_3;
-extern cpuop_func op_11d0_3;
-extern cpuop_func op_11d8_3;
-extern cpuop_func op_11e0_3;
-extern cpuop_func op_11e8_3;
-extern cpuop_func op_11f0_3;
-extern cpuop_func op_11f8_3;
-extern cpuop_func op_11f9_3;
-extern cpuop_func op_11fa_3;
-extern cpuop_func op_11fb_3;
-extern cpuop_func op_11fc_3;
-extern cpuop_func op_13c0_3;
-extern cpuop_func op_13d0_3;
-extern cpuop_func op_13d8_3;
-extern cpuop_func op_13e0_3;
-extern cpuop_func op_13e8_3;
-extern cpuop_func op_13f0_3;
-extern cpuop_func op_13f8_3;
-extern cpuop_func op_13f9_3;
-extern cpuop_func op_13fa_3;
-extern cpuop_func op_13fb_3;
-extern cpuop_func op_13fc_3;
-extern cpuop_func op_2000_3;
-extern cpuop_func op_2008_3;
-extern cpuop_func op_2010_3;
-extern cpuop_func op_2018_3;
-extern cpuop_func op_2020_3;
-extern cpuop_func op_2028_3;
-extern cpuop_func op_2030_3;
-extern cpuop_func op_2038_3;
-extern cpuop_func op_2039_3;
-extern cpuop_func op_203a_3;
-extern cpuop_func op_203b_3;
-extern cpuop_func op_203c_3;
-extern cpuop_func op_2040_3;
-extern cpuop_func op_2048_3;
-extern cpuop_func op_2050_3;
-extern cpuop_func op_2058_3;
-extern cpuop_func op_2060_3;
-extern cpuop_func op_2068_3;
-extern cpuop_func op_2070_3;
-extern cpuop_func op_2078_3;
-extern cpuop_func op_2079_3;
-extern cpuop_func op_207a_3;
-extern cpuop_func op_207b_3;
-extern cpuop_func op_207c_3;
-extern cpuop_func op_2080_3;
-extern cpuop_func op_2088_3;
-extern cpuop_func op_2090_3;
-extern cpuop_func op_2098_3;
-extern cpuop_func op_20a0_3;
-extern cpuop_func op_20a8_3;
-extern cpuop_func op_20b0_3;
-extern cpuop_func op_20b8_3;
-extern cpuop_func op_20b9_3;
-extern cpuop_func op_20ba_3;
-extern cpuop_func op_20bb_3;
-extern cpuop_func op_20bc_3;
-extern cpuop_func op_20c0_3;
-extern cpuop_func op_20c8_3;
-extern cpuop_func op_20d0_3;
-extern cpuop_func op_20d8_3;
-extern cpuop_func op_20e0_3;
-extern cpuop_func op_20e8_3;
-extern cpuop_func op_20f0_3;
-extern cpuop_func op_20f8_3;
-extern cpuop_func op_20f9_3;
-extern cpuop_func op_20fa_3;
-extern cpuop_func op_20fb_3;
-extern cpuop_func op_20fc_3;
-extern cpuop_func op_2100_3;
-extern cpuop_func op_2108_3;
-extern cpuop_func op_2110_3;
-extern cpuop_func op_2118_3;
-extern cpuop_func op_2120_3;
-extern cpuop_func op_2128_3;
-extern cpuop_func op_2130_3;
-extern cpuop_func op_2138_3;
-extern cpuop_func op_2139_3;
-extern cpuop_func op_213a_3;
-extern cpuop_func op_213b_3;
-extern cpuop_func op_213c_3;
-extern cpuop_func op_2140_3;
-extern cpuop_func op_2148_3;
-extern cpuop_func op_2150_3;
-extern cpuop_func op_2158_3;
-extern cpuop_func op_2160_3;
-extern cpuop_func op_2168_3;
-extern cpuop_func op_2170_3;
-extern cpuop_func op_2178_3;
-extern cpuop_func op_2179_3;
-extern cpuop_func op_217a_3;
-extern cpuop_func op_217b_3;
-extern cpuop_func op_217c_3;
-extern cpuop_func op_2180_3;
-extern cpuop_func op_2188_3;
-extern cpuop_func op_2190_3;
-extern cpuop_func op_2198_3;
-extern cpuop_func op_21a0_3;
-extern cpuop_func op_21a8_3;
-extern cpuop_func op_21b0_3;
-extern cpuop_func op_21b8_3;
-extern cpuop_func op_21b9_3;
-extern cpuop_func op_21ba_3;
-extern cpuop_func op_21bb_3;
-extern cpuop_func op_21bc_3;
-extern cpuop_func op_21c0_3;
-extern cpuop_func op_21c8_3;
-extern cpuop_func op_21d0_3;
-extern cpuop_func op_21d8_3;
-extern cpuop_func op_21e0_3;
-extern cpuop_func op_21e8_3;
-extern cpuop_func op_21f0_3;
-extern cpuop_func op_21f8_3;
-extern cpuop_func op_21f9_3;
-extern cpuop_func op_21fa_3;
-extern cpuop_func op_21fb_3;
-extern cpuop_func op_21fc_3;
-extern cpuop_func op_23c0_3;
-extern cpuop_func op_23c8_3;
-extern cpuop_func op_23d0_3;
-extern cpuop_func op_23d8_3;
-extern cpuop_func op_23e0_3;
-extern cpuop_func op_23e8_3;
-extern cpuop_func op_23f0_3;
-extern cpuop_func op_23f8_3;
-extern cpuop_func op_23f9_3;
-extern cpuop_func op_23fa_3;
-extern cpuop_func op_23fb_3;
-extern cpuop_func op_23fc_3;
-extern cpuop_func op_3000_3;
-extern cpuop_func op_3008_3;
-extern cpuop_func op_3010_3;
-extern cpuop_func op_3018_3;
-extern cpuop_func op_3020_3;
-extern cpuop_func op_3028_3;
-extern cpuop_func op_3030_3;
-extern cpuop_func op_3038_3;
-extern cpuop_func op_3039_3;
-extern cpuop_func op_303a_3;
-extern cpuop_func op_303b_3;
-extern cpuop_func op_303c_3;
-extern cpuop_func op_3040_3;
-extern cpuop_func op_3048_3;
-extern cpuop_func op_3050_3;
-extern cpuop_func op_3058_3;
-extern cpuop_func op_3060_3;
-extern cpuop_func op_3068_3;
-extern cpuop_func op_3070_3;
-extern cpuop_func op_3078_3;
-extern cpuop_func op_3079_3;
-extern cpuop_func op_307a_3;
-extern cpuop_func op_307b_3;
-extern cpuop_func op_307c_3;
-extern cpuop_func op_3080_3;
-extern cpuop_func op_3088_3;
-extern cpuop_func op_3090_3;
-extern cpuop_func op_3098_3;
-extern cpuop_func op_30a0_3;
-extern cpuop_func op_30a8_3;
-extern cpuop_func op_30b0_3;
-extern cpuop_func op_30b8_3;
-extern cpuop_func op_30b9_3;
-extern cpuop_func op_30ba_3;
-extern cpuop_func op_30bb_3;
-extern cpuop_func op_30bc_3;
-extern cpuop_func op_30c0_3;
-extern cpuop_func op_30c8_3;
-extern cpuop_func op_30d0_3;
-extern cpuop_func op_30d8_3;
-extern cpuop_func op_30e0_3;
-extern cpuop_func op_30e8_3;
-extern cpuop_func op_30f0_3;
-extern cpuop_func op_30f8_3;
-extern cpuop_func op_30f9_3;
-extern cpuop_func op_30fa_3;
-extern cpuop_func op_30fb_3;
-extern cpuop_func op_30fc_3;
-extern cpuop_func op_3100_3;
-extern cpuop_func op_3108_3;
-extern cpuop_func op_3110_3;
-extern cpuop_func op_3118_3;
-extern cpuop_func op_3120_3;
-extern cpuop_func op_3128_3;
-extern cpuop_func op_3130_3;
-extern cpuop_func op_3138_3;
-extern cpuop_func op_3139_3;
-extern cpuop_func op_313a_3;
-extern cpuop_func op_313b_3;
-extern cpuop_func op_313c_3;
-extern cpuop_func op_3140_3;
-extern cpuop_func op_3148_3;
-extern cpuop_func op_3150_3;
-extern cpuop_func op_3158_3;
-extern cpuop_func op_3160_3;
-extern cpuop_func op_3168_3;
-extern cpuop_func op_3170_3;
-extern cpuop_func op_3178_3;
-extern cpuop_func op_3179_3;
-extern cpuop_func op_317a_3;
-extern cpuop_func op_317b_3;
-extern cpuop_func op_317c_3;
-extern cpuop_func op_3180_3;
-extern cpuop_func op_3188_3;
-extern cpuop_func op_3190_3;
-extern cpuop_func op_3198_3;
-extern cpuop_func op_31a0_3;
-extern cpuop_func op_31a8_3;
-extern cpuop_func op_31b0_3;
-extern cpuop_func op_31b8_3;
-extern cpuop_func op_31b9_3;
-extern cpuop_func op_31ba_3;
-extern cpuop_func op_31bb_3;
-extern cpuop_func op_31bc_3;
-extern cpuop_func op_31c0_3;
-extern cpuop_func op_31c8_3;
-extern cpuop_func op_31d0_3;
-extern cpuop_func op_31d8_3;
-extern cpuop_func op_31e0_3;
-extern cpuop_func op_31e8_3;
-extern cpuop_func op_31f0_3;
-extern cpuop_func op_31f8_3;
-extern cpuop_func op_31f9_3;
-extern cpuop_func op_31fa_3;
-extern cpuop_func op_31fb_3;
-extern cpuop_func op_31fc_3;
-extern cpuop_func op_33c0_3;
-extern cpuop_func op_33c8_3;
-extern cpuop_func op_33d0_3;
-extern cpuop_func op_33d8_3;
-extern cpuop_func op_33e0_3;
-extern cpuop_func op_33e8_3;
-extern cpuop_func op_33f0_3;
-extern cpuop_func op_33f8_3;
-extern cpuop_func op_33f9_3;
-extern cpuop_func op_33fa_3;
-extern cpuop_func op_33fb_3;
-extern cpuop_func op_33fc_3;
-extern cpuop_func op_4000_3;
-extern cpuop_func op_4010_3;
-extern cpuop_func op_4018_3;
-extern cpuop_func op_4020_3;
-extern cpuop_func op_4028_3;
-extern cpuop_func op_4030_3;
-extern cpuop_func op_4038_3;
-extern cpuop_func op_4039_3;
-extern cpuop_func op_4040_3;
-extern cpuop_func op_4050_3;
-extern cpuop_func op_4058_3;
-extern cpuop_func op_4060_3;
-extern cpuop_func op_4068_3;
-extern cpuop_func op_4070_3;
-extern cpuop_func op_4078_3;
-extern cpuop_func op_4079_3;
-extern cpuop_func op_4080_3;
-extern cpuop_func op_4090_3;
-extern cpuop_func op_4098_3;
-extern cpuop_func op_40a0_3;
-extern cpuop_func op_40a8_3;
-extern cpuop_func op_40b0_3;
-extern cpuop_func op_40b8_3;
-extern cpuop_func op_40b9_3;
-extern cpuop_func op_40c0_3;
-extern cpuop_func op_40d0_3;
-extern cpuop_func op_40d8_3;
-extern cpuop_func op_40e0_3;
-extern cpuop_func op_40e8_3;
-extern cpuop_func op_40f0_3;
-extern cpuop_func op_40f8_3;
-extern cpuop_func op_40f9_3;
-extern cpuop_func op_4100_3;
-extern cpuop_func op_4110_3;
-extern cpuop_func op_4118_3;
-extern cpuop_func op_4120_3;
-extern cpuop_func op_4128_3;
-extern cpuop_func op_4130_3;
-extern cpuop_func op_4138_3;
-extern cpuop_func op_4139_3;
-extern cpuop_func op_413a_3;
-extern cpuop_func op_413b_3;
-extern cpuop_func op_413c_3;
-extern cpuop_func op_4180_3;
-extern cpuop_func op_4190_3;
-extern cpuop_func op_4198_3;
-extern cpuop_func op_41a0_3;
-extern cpuop_func op_41a8_3;
-extern cpuop_func op_41b0_3;
-extern cpuop_func op_41b8_3;
-extern cpuop_func op_41b9_3;
-extern cpuop_func op_41ba_3;
-extern cpuop_func op_41bb_3;
-extern cpuop_func op_41bc_3;
-extern cpuop_func op_41d0_3;
-extern cpuop_func op_41e8_3;
-extern cpuop_func op_41f0_3;
-extern cpuop_func op_41f8_3;
-extern cpuop_func op_41f9_3;
-extern cpuop_func op_41fa_3;
-extern cpuop_func op_41fb_3;
-extern cpuop_func op_4200_3;
-extern cpuop_func op_4210_3;
-extern cpuop_func op_4218_3;
-extern cpuop_func op_4220_3;
-extern cpuop_func op_4228_3;
-extern cpuop_func op_4230_3;
-extern cpuop_func op_4238_3;
-extern cpuop_func op_4239_3;
-extern cpuop_func op_4240_3;
-extern cpuop_func op_4250_3;
-extern cpuop_func op_4258_3;
-extern cpuop_func op_4260_3;
-extern cpuop_func op_4268_3;
-extern cpuop_func op_4270_3;
-extern cpuop_func op_4278_3;
-extern cpuop_func op_4279_3;
-extern cpuop_func op_4280_3;
-extern cpuop_func op_4290_3;
-extern cpuop_func op_4298_3;
-extern cpuop_func op_42a0_3;
-extern cpuop_func op_42a8_3;
-extern cpuop_func op_42b0_3;
-extern cpuop_func op_42b8_3;
-extern cpuop_func op_42b9_3;
-extern cpuop_func op_4400_3;
-extern cpuop_func op_4410_3;
-extern cpuop_func op_4418_3;
-extern cpuop_func op_4420_3;
-extern cpuop_func op_4428_3;
-extern cpuop_func op_4430_3;
-extern cpuop_func op_4438_3;
-extern cpuop_func op_4439_3;
-extern cpuop_func op_4440_3;
-extern cpuop_func op_4450_3;
-extern cpuop_func op_4458_3;
-extern cpuop_func op_4460_3;
-extern cpuop_func op_4468_3;
-extern cpuop_func op_4470_3;
-extern cpuop_func op_4478_3;
-extern cpuop_func op_4479_3;
-extern cpuop_func op_4480_3;
-extern cpuop_func op_4490_3;
-extern cpuop_func op_4498_3;
-extern cpuop_func op_44a0_3;
-extern cpuop_func op_44a8_3;
-extern cpuop_func op_44b0_3;
-extern cpuop_func op_44b8_3;
-extern cpuop_func op_44b9_3;
-extern cpuop_func op_44c0_3;
-extern cpuop_func op_44d0_3;
-extern cpuop_func op_44d8_3;
-extern cpuop_func op_44e0_3;
-extern cpuop_func op_44e8_3;
-extern cpuop_func op_44f0_3;
-extern cpuop_func op_44f8_3;
-extern cpuop_func op_44f9_3;
-extern cpuop_func op_44fa_3;
-extern cpuop_func op_44fb_3;
-extern cpuop_func op_44fc_3;
-extern cpuop_func op_4600_3;
-extern cpuop_func op_4610_3;
-extern cpuop_func op_4618_3;
-extern cpuop_func op_4620_3;
-extern cpuop_func op_4628_3;
-extern cpuop_func op_4630_3;
-extern cpuop_func op_4638_3;
-extern cpuop_func op_4639_3;
-extern cpuop_func op_4640_3;
-extern cpuop_func op_4650_3;
-extern cpuop_func op_4658_3;
-extern cpuop_func op_4660_3;
-extern cpuop_func op_4668_3;
-extern cpuop_func op_4670_3;
-extern cpuop_func op_4678_3;
-extern cpuop_func op_4679_3;
-extern cpuop_func op_4680_3;
-extern cpuop_func op_4690_3;
-extern cpuop_func op_4698_3;
-extern cpuop_func op_46a0_3;
-extern cpuop_func op_46a8_3;
-extern cpuop_func op_46b0_3;
-extern cpuop_func op_46b8_3;
-extern cpuop_func op_46b9_3;
-extern cpuop_func op_46c0_3;
-extern cpuop_func op_46d0_3;
-extern cpuop_func op_46d8_3;
-extern cpuop_func op_46e0_3;
-extern cpuop_func op_46e8_3;
-extern cpuop_func op_46f0_3;
-extern cpuop_func op_46f8_3;
-extern cpuop_func op_46f9_3;
-extern cpuop_func op_46fa_3;
-extern cpuop_func op_46fb_3;
-extern cpuop_func op_46fc_3;
-extern cpuop_func op_4800_3;
-extern cpuop_func op_4810_3;
-extern cpuop_func op_4818_3;
-extern cpuop_func op_4820_3;
-extern cpuop_func op_4828_3;
-extern cpuop_func op_4830_3;
-extern cpuop_func op_4838_3;
-extern cpuop_func op_4839_3;
-extern cpuop_func op_4840_3;
-extern cpuop_func op_4850_3;
-extern cpuop_func op_4868_3;
-extern cpuop_func op_4870_3;
-extern cpuop_func op_4878_3;
-extern cpuop_func op_4879_3;
-extern cpuop_func op_487a_3;
-extern cpuop_func op_487b_3;
-extern cpuop_func op_4880_3;
-extern cpuop_func op_4890_3;
-extern cpuop_func op_48a0_3;
-extern cpuop_func op_48a8_3;
-extern cpuop_func op_48b0_3;
-extern cpuop_func op_48b8_3;
-extern cpuop_func op_48b9_3;
-extern cpuop_func op_48c0_3;
-extern cpuop_func op_48d0_3;
-extern cpuop_func op_48e0_3;
-extern cpuop_func op_48e8_3;
-extern cpuop_func op_48f0_3;
-extern cpuop_func op_48f8_3;
-extern cpuop_func op_48f9_3;
-extern cpuop_func op_49c0_3;
-extern cpuop_func op_4a00_3;
-extern cpuop_func op_4a10_3;
-extern cpuop_func op_4a18_3;
-extern cpuop_func op_4a20_3;
-extern cpuop_func op_4a28_3;
-extern cpuop_func op_4a30_3;
-extern cpuop_func op_4a38_3;
-extern cpuop_func op_4a39_3;
-extern cpuop_func op_4a3a_3;
-extern cpuop_func op_4a3b_3;
-extern cpuop_func op_4a3c_3;
-extern cpuop_func op_4a40_3;
-extern cpuop_func op_4a48_3;
-extern cpuop_func op_4a50_3;
-extern cpuop_func op_4a58_3;
-extern cpuop_func op_4a60_3;
-extern cpuop_func op_4a68_3;
-extern cpuop_func op_4a70_3;
-extern cpuop_func op_4a78_3;
-extern cpuop_func op_4a79_3;
-extern cpuop_func op_4a7a_3;
-extern cpuop_func op_4a7b_3;
-extern cpuop_func op_4a7c_3;
-extern cpuop_func op_4a80_3;
-extern cpuop_func op_4a88_3;
-extern cpuop_func op_4a90_3;
-extern cpuop_func op_4a98_3;
-extern cpuop_func op_4aa0_3;
-extern cpuop_func op_4aa8_3;
-extern cpuop_func op_4ab0_3;
-extern cpuop_func op_4ab8_3;
-extern cpuop_func op_4ab9_3;
-extern cpuop_func op_4aba_3;
-extern cpuop_func op_4abb_3;
-extern cpuop_func op_4abc_3;
-extern cpuop_func op_4ac0_3;
-extern cpuop_func op_4ad0_3;
-extern cpuop_func op_4ad8_3;
-extern cpuop_func op_4ae0_3;
-extern cpuop_func op_4ae8_3;
-extern cpuop_func op_4af0_3;
-extern cpuop_func op_4af8_3;
-extern cpuop_func op_4af9_3;
-extern cpuop_func op_4c90_3;
-extern cpuop_func op_4c98_3;
-extern cpuop_func op_4ca8_3;
-extern cpuop_func op_4cb0_3;
-extern cpuop_func op_4cb8_3;
-extern cpuop_func op_4cb9_3;
-extern cpuop_func op_4cba_3;
-extern cpuop_func op_4cbb_3;
-extern cpuop_func op_4cd0_3;
-extern cpuop_func op_4cd8_3;
-extern cpuop_func op_4ce8_3;
-extern cpuop_func op_4cf0_3;
-extern cpuop_func op_4cf8_3;
-extern cpuop_func op_4cf9_3;
-extern cpuop_func op_4cfa_3;
-extern cpuop_func op_4cfb_3;
-extern cpuop_func op_4e40_3;
-extern cpuop_func op_4e50_3;
-extern cpuop_func op_4e58_3;
-extern cpuop_func op_4e60_3;
-extern cpuop_func op_4e68_3;
-extern cpuop_func op_4e70_3;
-extern cpuop_func op_4e71_3;
-extern cpuop_func op_4e72_3;
-extern cpuop_func op_4e73_3;
-extern cpuop_func op_4e74_3;
-extern cpuop_func op_4e75_3;
-extern cpuop_func op_4e76_3;
-extern cpuop_func op_4e77_3;
-extern cpuop_func op_4e90_3;
-extern cpuop_func op_4ea8_3;
-extern cpuop_func op_4eb0_3;
-extern cpuop_func op_4eb8_3;
-extern cpuop_func op_4eb9_3;
-extern cpuop_func op_4eba_3;
-extern cpuop_func op_4ebb_3;
-extern cpuop_func op_4ed0_3;
-extern cpuop_func op_4ee8_3;
-extern cpuop_func op_4ef0_3;
-extern cpuop_func op_4ef8_3;
-extern cpuop_func op_4ef9_3;
-extern cpuop_func op_4efa_3;
-extern cpuop_func op_4efb_3;
-extern cpuop_func op_5000_3;
-extern cpuop_func op_5010_3;
-extern cpuop_func op_5018_3;
-extern cpuop_func op_5020_3;
-extern cpuop_func op_5028_3;
-extern cpuop_func op_5030_3;
-extern cpuop_func op_5038_3;
-extern cpuop_func op_5039_3;
-extern cpuop_func op_5040_3;
-extern cpuop_func op_5048_3;
-extern cpuop_func op_5050_3;
-extern cpuop_func op_5058_3;
-extern cpuop_func op_5060_3;
-extern cpuop_func op_5068_3;
-extern cpuop_func op_5070_3;
-extern cpuop_func op_5078_3;
-extern cpuop_func op_5079_3;
-extern cpuop_func op_5080_3;
-extern cpuop_func op_5088_3;
-extern cpuop_func op_5090_3;
-extern cpuop_func op_5098_3;
-extern cpuop_func op_50a0_3;
-extern cpuop_func op_50a8_3;
-extern cpuop_func op_50b0_3;
-extern cpuop_func op_50b8_3;
-extern cpuop_func op_50b9_3;
-extern cpuop_func op_50c0_3;
-extern cpuop_func op_50c8_3;
-extern cpuop_func op_50d0_3;
-extern cpuop_func op_50d8_3;
-extern cpuop_func op_50e0_3;
-extern cpuop_func op_50e8_3;
-extern cpuop_func op_50f0_3;
-extern cpuop_func op_50f8_3;
-extern cpuop_func op_50f9_3;
-extern cpuop_func op_5100_3;
-extern cpuop_func op_5110_3;
-extern cpuop_func op_5118_3;
-extern cpuop_func op_5120_3;
-extern cpuop_func op_5128_3;
-extern cpuop_func op_5130_3;
-extern cpuop_func op_5138_3;
-extern cpuop_func op_5139_3;
-extern cpuop_func op_5140_3;
-extern cpuop_func op_5148_3;
-extern cpuop_func op_5150_3;
-extern cpuop_func op_5158_3;
-extern cpuop_func op_5160_3;
-extern cpuop_func op_5168_3;
-extern cpuop_func op_5170_3;
-extern cpuop_func op_5178_3;
-extern cpuop_func op_5179_3;
-extern cpuop_func op_5180_3;
-extern cpuop_func op_5188_3;
-extern cpuop_func op_5190_3;
-extern cpuop_func op_5198_3;
-extern cpuop_func op_51a0_3;
-extern cpuop_func op_51a8_3;
-extern cpuop_func op_51b0_3;
-extern cpuop_func op_51b8_3;
-extern cpuop_func op_51b9_3;
-extern cpuop_func op_51c0_3;
-extern cpuop_func op_51c8_3;
-extern cpuop_func op_51d0_3;
-extern cpuop_func op_51d8_3;
-extern cpuop_func op_51e0_3;
-extern cpuop_func op_51e8_3;
-extern cpuop_func op_51f0_3;
-extern cpuop_func op_51f8_3;
-extern cpuop_func op_51f9_3;
-extern cpuop_func op_52c0_3;
-extern cpuop_func op_52c8_3;
-extern cpuop_func op_52d0_3;
-extern cpuop_func op_52d8_3;
-extern cpuop_func op_52e0_3;
-extern cpuop_func op_52e8_3;
-extern cpuop_func op_52f0_3;
-extern cpuop_func op_52f8_3;
-extern cpuop_func op_52f9_3;
-extern cpuop_func op_53c0_3;
-extern cpuop_func op_53c8_3;
-extern cpuop_func op_53d0_3;
-extern cpuop_func op_53d8_3;
-extern cpuop_func op_53e0_3;
-extern cpuop_func op_53e8_3;
-extern cpuop_func op_53f0_3;
-extern cpuop_func op_53f8_3;
-extern cpuop_func op_53f9_3;
-extern cpuop_func op_54c0_3;
-extern cpuop_func op_54c8_3;
-extern cpuop_func op_54d0_3;
-extern cpuop_func op_54d8_3;
-extern cpuop_func op_54e0_3;
-extern cpuop_func op_54e8_3;
-extern cpuop_func op_54f0_3;
-extern cpuop_func op_54f8_3;
-extern cpuop_func op_54f9_3;
-extern cpuop_func op_55c0_3;
-extern cpuop_func op_55c8_3;
-extern cpuop_func op_55d0_3;
-extern cpuop_func op_55d8_3;
-extern cpuop_func op_55e0_3;
-extern cpuop_func op_55e8_3;
-extern cpuop_func op_55f0_3;
-extern cpuop_func op_55f8_3;
-extern cpuop_func op_55f9_3;
-extern cpuop_func op_56c0_3;
-extern cpuop_func op_56c8_3;
-extern cpuop_func op_56d0_3;
-extern cpuop_func op_56d8_3;
-extern cpuop_func op_56e0_3;
-extern cpuop_func op_56e8_3;
-extern cpuop_func op_56f0_3;
-extern cpuop_func op_56f8_3;
-extern cpuop_func op_56f9_3;
-extern cpuop_func op_57c0_3;
-extern cpuop_func op_57c8_3;
-extern cpuop_func op_57d0_3;
-extern cpuop_func op_57d8_3;
-extern cpuop_func op_57e0_3;
-extern cpuop_func op_57e8_3;
-extern cpuop_func op_57f0_3;
-extern cpuop_func op_57f8_3;
-extern cpuop_func op_57f9_3;
-extern cpuop_func op_58c0_3;
-extern cpuop_func op_58c8_3;
-extern cpuop_func op_58d0_3;
-extern cpuop_func op_58d8_3;
-extern cpuop_func op_58e0_3;
-extern cpuop_func op_58e8_3;
-extern cpuop_func op_58f0_3;
-extern cpuop_func op_58f8_3;
-extern cpuop_func op_58f9_3;
-extern cpuop_func op_59c0_3;
-extern cpuop_func op_59c8_3;
-extern cpuop_func op_59d0_3;
-extern cpuop_func op_59d8_3;
-extern cpuop_func op_59e0_3;
-extern cpuop_func op_59e8_3;
-extern cpuop_func op_59f0_3;
-extern cpuop_func op_59f8_3;
-extern cpuop_func op_59f9_3;
-extern cpuop_func op_5ac0_3;
-extern cpuop_func op_5ac8_3;
-extern cpuop_func op_5ad0_3;
-extern cpuop_func op_5ad8_3;
-extern cpuop_func op_5ae0_3;
-extern cpuop_func op_5ae8_3;
-extern cpuop_func op_5af0_3;
-extern cpuop_func op_5af8_3;
-extern cpuop_func op_5af9_3;
-extern cpuop_func op_5bc0_3;
-extern cpuop_func op_5bc8_3;
-extern cpuop_func op_5bd0_3;
-extern cpuop_func op_5bd8_3;
-extern cpuop_func op_5be0_3;
-extern cpuop_func op_5be8_3;
-extern cpuop_func op_5bf0_3;
-extern cpuop_func op_5bf8_3;
-extern cpuop_func op_5bf9_3;
-extern cpuop_func op_5cc0_3;
-extern cpuop_func op_5cc8_3;
-extern cpuop_func op_5cd0_3;
-extern cpuop_func op_5cd8_3;
-extern cpuop_func op_5ce0_3;
-extern cpuop_func op_5ce8_3;
-extern cpuop_func op_5cf0_3;
-extern cpuop_func op_5cf8_3;
-extern cpuop_func op_5cf9_3;
-extern cpuop_func op_5dc0_3;
-extern cpuop_func op_5dc8_3;
-extern cpuop_func op_5dd0_3;
-extern cpuop_func op_5dd8_3;
-extern cpuop_func op_5de0_3;
-extern cpuop_func op_5de8_3;
-extern cpuop_func op_5df0_3;
-extern cpuop_func op_5df8_3;
-extern cpuop_func op_5df9_3;
-extern cpuop_func op_5ec0_3;
-extern cpuop_func op_5ec8_3;
-extern cpuop_func op_5ed0_3;
-extern cpuop_func op_5ed8_3;
-extern cpuop_func op_5ee0_3;
-extern cpuop_func op_5ee8_3;
-extern cpuop_func op_5ef0_3;
-extern cpuop_func op_5ef8_3;
-extern cpuop_func op_5ef9_3;
-extern cpuop_func op_5fc0_3;
-extern cpuop_func op_5fc8_3;
-extern cpuop_func op_5fd0_3;
-extern cpuop_func op_5fd8_3;
-extern cpuop_func op_5fe0_3;
-extern cpuop_func op_5fe8_3;
-extern cpuop_func op_5ff0_3;
-extern cpuop_func op_5ff8_3;
-extern cpuop_func op_5ff9_3;
-extern cpuop_func op_6000_3;
-extern cpuop_func op_6001_3;
-extern cpuop_func op_60ff_3;
-extern cpuop_func op_6100_3;
-extern cpuop_func op_6101_3;
-extern cpuop_func op_61ff_3;
-extern cpuop_func op_6200_3;
-extern cpuop_func op_6201_3;
-extern cpuop_func op_62ff_3;
-extern cpuop_func op_6300_3;
-extern cpuop_func op_6301_3;
-extern cpuop_func op_63ff_3;
-extern cpuop_func op_6400_3;
-extern cpuop_func op_6401_3;
-extern cpuop_func op_64ff_3;
-extern cpuop_func op_6500_3;
-extern cpuop_func op_6501_3;
-extern cpuop_func op_65ff_3;
-extern cpuop_func op_6600_3;
-extern cpuop_func op_6601_3;
-extern cpuop_func op_66ff_3;
-extern cpuop_func op_6700_3;
-extern cpuop_func op_6701_3;
-extern cpuop_func op_67ff_3;
-extern cpuop_func op_6800_3;
-extern cpuop_func op_6801_3;
-extern cpuop_func op_68ff_3;
-extern cpuop_func op_6900_3;
-extern cpuop_func op_6901_3;
-extern cpuop_func op_69ff_3;
-extern cpuop_func op_6a00_3;
-extern cpuop_func op_6a01_3;
-extern cpuop_func op_6aff_3;
-extern cpuop_func op_6b00_3;
-extern cpuop_func op_6b01_3;
-extern cpuop_func op_6bff_3;
-extern cpuop_func op_6c00_3;
-extern cpuop_func op_6c01_3;
-extern cpuop_func op_6cff_3;
-extern cpuop_func op_6d00_3;
-extern cpuop_func op_6d01_3;
-extern cpuop_func op_6dff_3;
-extern cpuop_func op_6e00_3;
-extern cpuop_func op_6e01_3;
-extern cpuop_func op_6eff_3;
-extern cpuop_func op_6f00_3;
-extern cpuop_func op_6f01_3;
-extern cpuop_func op_6fff_3;
-extern cpuop_func op_7000_3;
-extern cpuop_func op_8000_3;
-extern cpuop_func op_8010_3;
-extern cpuop_func op_8018_3;
-extern cpuop_func op_8020_3;
-extern cpuop_func op_8028_3;
-extern cpuop_func op_8030_3;
-extern cpuop_func op_8038_3;
-extern cpuop_func op_8039_3;
-extern cpuop_func op_803a_3;
-extern cpuop_func op_803b_3;
-extern cpuop_func op_803c_3;
-extern cpuop_func op_8040_3;
-extern cpuop_func op_8050_3;
-extern cpuop_func op_8058_3;
-extern cpuop_func op_8060_3;
-extern cpuop_func op_8068_3;
-extern cpuop_func op_8070_3;
-extern cpuop_func op_8078_3;
-extern cpuop_func op_8079_3;
-extern cpuop_func op_807a_3;
-extern cpuop_func op_807b_3;
-extern cpuop_func op_807c_3;
-extern cpuop_func op_8080_3;
-extern cpuop_func op_8090_3;
-extern cpuop_func op_8098_3;
-extern cpuop_func op_80a0_3;
-extern cpuop_func op_80a8_3;
-extern cpuop_func op_80b0_3;
-extern cpuop_func op_80b8_3;
-extern cpuop_func op_80b9_3;
-extern cpuop_func op_80ba_3;
-extern cpuop_func op_80bb_3;
-extern cpuop_func op_80bc_3;
-extern cpuop_func op_80c0_3;
-extern cpuop_func op_80d0_3;
-extern cpuop_func op_80d8_3;
-extern cpuop_func op_80e0_3;
-extern cpuop_func op_80e8_3;
-extern cpuop_func op_80f0_3;
-extern cpuop_func op_80f8_3;
-extern cpuop_func op_80f9_3;
-extern cpuop_func op_80fa_3;
-extern cpuop_func op_80fb_3;
-extern cpuop_func op_80fc_3;
-extern cpuop_func op_8100_3;
-extern cpuop_func op_8108_3;
-extern cpuop_func op_8110_3;
-extern cpuop_func op_8118_3;
-extern cpuop_func op_8120_3;
-extern cpuop_func op_8128_3;
-extern cpuop_func op_8130_3;
-extern cpuop_func op_8138_3;
-extern cpuop_func op_8139_3;
-extern cpuop_func op_8150_3;
-extern cpuop_func op_8158_3;
-extern cpuop_func op_8160_3;
-extern cpuop_func op_8168_3;
-extern cpuop_func op_8170_3;
-extern cpuop_func op_8178_3;
-extern cpuop_func op_8179_3;
-extern cpuop_func op_8190_3;
-extern cpuop_func op_8198_3;
-extern cpuop_func op_81a0_3;
-extern cpuop_func op_81a8_3;
-extern cpuop_func op_81b0_3;
-extern cpuop_func op_81b8_3;
-extern cpuop_func op_81b9_3;
-extern cpuop_func op_81c0_3;
-extern cpuop_func op_81d0_3;
-extern cpuop_func op_81d8_3;
-extern cpuop_func op_81e0_3;
-extern cpuop_func op_81e8_3;
-extern cpuop_func op_81f0_3;
-extern cpuop_func op_81f8_3;
-extern cpuop_func op_81f9_3;
-extern cpuop_func op_81fa_3;
-extern cpuop_func op_81fb_3;
-extern cpuop_func op_81fc_3;
-extern cpuop_func op_9000_3;
-extern cpuop_func op_9010_3;
-extern cpuop_func op_9018_3;
-extern cpuop_func op_9020_3;
-extern cpuop_func op_9028_3;
-extern cpuop_func op_9030_3;
-extern cpuop_func op_9038_3;
-extern cpuop_func op_9039_3;
-extern cpuop_func op_903a_3;
-extern cpuop_func op_903b_3;
-extern cpuop_func op_903c_3;
-extern cpuop_func op_9040_3;
-extern cpuop_func op_9048_3;
-extern cpuop_func op_9050_3;
-extern cpuop_func op_9058_3;
-extern cpuop_func op_9060_3;
-extern cpuop_func op_9068_3;
-extern cpuop_func op_9070_3;
-extern cpuop_func op_9078_3;
-extern cpuop_func op_9079_3;
-extern cpuop_func op_907a_3;
-extern cpuop_func op_907b_3;
-extern cpuop_func op_907c_3;
-extern cpuop_func op_9080_3;
-extern cpuop_func op_9088_3;
-extern cpuop_func op_9090_3;
-extern cpuop_func op_9098_3;
-extern cpuop_func op_90a0_3;
-extern cpuop_func op_90a8_3;
-extern cpuop_func op_90b0_3;
-extern cpuop_func op_90b8_3;
-extern cpuop_func op_90b9_3;
-extern cpuop_func op_90ba_3;
-extern cpuop_func op_90bb_3;
-extern cpuop_func op_90bc_3;
-extern cpuop_func op_90c0_3;
-extern cpuop_func op_90c8_3;
-extern cpuop_func op_90d0_3;
-extern cpuop_func op_90d8_3;
-extern cpuop_func op_90e0_3;
-extern cpuop_func op_90e8_3;
-extern cpuop_func op_90f0_3;
-extern cpuop_func op_90f8_3;
-extern cpuop_func op_90f9_3;
-extern cpuop_func op_90fa_3;
-extern cpuop_func op_90fb_3;
-extern cpuop_func op_90fc_3;
-extern cpuop_func op_9100_3;
-extern cpuop_func op_9108_3;
-extern cpuop_func op_9110_3;
-extern cpuop_func op_9118_3;
-extern cpuop_func op_9120_3;
-extern cpuop_func op_9128_3;
-extern cpuop_func op_9130_3;
-extern cpuop_func op_9138_3;
-extern cpuop_func op_9139_3;
-extern cpuop_func op_9140_3;
-extern cpuop_func op_9148_3;
-extern cpuop_func op_9150_3;
-extern cpuop_func op_9158_3;
-extern cpuop_func op_9160_3;
-extern cpuop_func op_9168_3;
-extern cpuop_func op_9170_3;
-extern cpuop_func op_9178_3;
-extern cpuop_func op_9179_3;
-extern cpuop_func op_9180_3;
-extern cpuop_func op_9188_3;
-extern cpuop_func op_9190_3;
-extern cpuop_func op_9198_3;
-extern cpuop_func op_91a0_3;
-extern cpuop_func op_91a8_3;
-extern cpuop_func op_91b0_3;
-extern cpuop_func op_91b8_3;
-extern cpuop_func op_91b9_3;
-extern cpuop_func op_91c0_3;
-extern cpuop_func op_91c8_3;
-extern cpuop_func op_91d0_3;
-extern cpuop_func op_91d8_3;
-extern cpuop_func op_91e0_3;
-extern cpuop_func op_91e8_3;
-extern cpuop_func op_91f0_3;
-extern cpuop_func op_91f8_3;
-extern cpuop_func op_91f9_3;
-extern cpuop_func op_91fa_3;
-extern cpuop_func op_91fb_3;
-extern cpuop_func op_91fc_3;
-extern cpuop_func op_b000_3;
-extern cpuop_func op_b010_3;
-extern cpuop_func op_b018_3;
-extern cpuop_func op_b020_3;
-extern cpuop_func op_b028_3;
-extern cpuop_func op_b030_3;
-extern cpuop_func op_b038_3;
-extern cpuop_func op_b039_3;
-extern cpuop_func op_b03a_3;
-extern cpuop_func op_b03b_3;
-extern cpuop_func op_b03c_3;
-extern cpuop_func op_b040_3;
-extern cpuop_func op_b048_3;
-extern cpuop_func op_b050_3;
-extern cpuop_func op_b058_3;
-extern cpuop_func op_b060_3;
-extern cpuop_func op_b068_3;
-extern cpuop_func op_b070_3;
-extern cpuop_func op_b078_3;
-extern cpuop_func op_b079_3;
-extern cpuop_func op_b07a_3;
-extern cpuop_func op_b07b_3;
-extern cpuop_func op_b07c_3;
-extern cpuop_func op_b080_3;
-extern cpuop_func op_b088_3;
-extern cpuop_func op_b090_3;
-extern cpuop_func op_b098_3;
-extern cpuop_func op_b0a0_3;
-extern cpuop_func op_b0a8_3;
-extern cpuop_func op_b0b0_3;
-extern cpuop_func op_b0b8_3;
-extern cpuop_func op_b0b9_3;
-extern cpuop_func op_b0ba_3;
-extern cpuop_func op_b0bb_3;
-extern cpuop_func op_b0bc_3;
-extern cpuop_func op_b0c0_3;
-extern cpuop_func op_b0c8_3;
-extern cpuop_func op_b0d0_3;
-extern cpuop_func op_b0d8_3;
-extern cpuop_func op_b0e0_3;
-extern cpuop_func op_b0e8_3;
-extern cpuop_func op_b0f0_3;
-extern cpuop_func op_b0f8_3;
-extern cpuop_func op_b0f9_3;
-extern cpuop_func op_b0fa_3;
-extern cpuop_func op_b0fb_3;
-extern cpuop_func op_b0fc_3;
-extern cpuop_func op_b100_3;
-extern cpuop_func op_b108_3;
-extern cpuop_func op_b110_3;
-extern cpuop_func op_b118_3;
-extern cpuop_func op_b120_3;
-extern cpuop_func op_b128_3;
-extern cpuop_func op_b130_3;
-extern cpuop_func op_b138_3;
-extern cpuop_func op_b139_3;
-extern cpuop_func op_b140_3;
-extern cpuop_func op_b148_3;
-extern cpuop_func op_b150_3;
-extern cpuop_func op_b158_3;
-extern cpuop_func op_b160_3;
-extern cpuop_func op_b168_3;
-extern cpuop_func op_b170_3;
-extern cpuop_func op_b178_3;
-extern cpuop_func op_b179_3;
-extern cpuop_func op_b180_3;
-extern cpuop_func op_b188_3;
-extern cpuop_func op_b190_3;
-extern cpuop_func op_b198_3;
-extern cpuop_func op_b1a0_3;
-extern cpuop_func op_b1a8_3;
-extern cpuop_func op_b1b0_3;
-extern cpuop_func op_b1b8_3;
-extern cpuop_func op_b1b9_3;
-extern cpuop_func op_b1c0_3;
-extern cpuop_func op_b1c8_3;
-extern cpuop_func op_b1d0_3;
-extern cpuop_func op_b1d8_3;
-extern cpuop_func op_b1e0_3;
-extern cpuop_func op_b1e8_3;
-extern cpuop_func op_b1f0_3;
-extern cpuop_func op_b1f8_3;
-extern cpuop_func op_b1f9_3;
-extern cpuop_func op_b1fa_3;
-extern cpuop_func op_b1fb_3;
-extern cpuop_func op_b1fc_3;
-extern cpuop_func op_c000_3;
-extern cpuop_func op_c010_3;
-extern cpuop_func op_c018_3;
-extern cpuop_func op_c020_3;
-extern cpuop_func op_c028_3;
-extern cpuop_func op_c030_3;
-extern cpuop_func op_c038_3;
-extern cpuop_func op_c039_3;
-extern cpuop_func op_c03a_3;
-extern cpuop_func op_c03b_3;
-extern cpuop_func op_c03c_3;
-extern cpuop_func op_c040_3;
-extern cpuop_func op_c050_3;
-extern cpuop_func op_c058_3;
-extern cpuop_func op_c060_3;
-extern cpuop_func op_c068_3;
-extern cpuop_func op_c070_3;
-extern cpuop_func op_c078_3;
-extern cpuop_func op_c079_3;
-extern cpuop_func op_c07a_3;
-extern cpuop_func op_c07b_3;
-extern cpuop_func op_c07c_3;
-extern cpuop_func op_c080_3;
-extern cpuop_func op_c090_3;
-extern cpuop_func op_c098_3;
-extern cpuop_func op_c0a0_3;
-extern cpuop_func op_c0a8_3;
-extern cpuop_func op_c0b0_3;
-extern cpuop_func op_c0b8_3;
-extern cpuop_func op_c0b9_3;
-extern cpuop_func op_c0ba_3;
-extern cpuop_func op_c0bb_3;
-extern cpuop_func op_c0bc_3;
-extern cpuop_func op_c0c0_3;
-extern cpuop_func op_c0d0_3;
-extern cpuop_func op_c0d8_3;
-extern cpuop_func op_c0e0_3;
-extern cpuop_func op_c0e8_3;
-extern cpuop_func op_c0f0_3;
-extern cpuop_func op_c0f8_3;
-extern cpuop_func op_c0f9_3;
-extern cpuop_func op_c0fa_3;
-extern cpuop_func op_c0fb_3;
-extern cpuop_func op_c0fc_3;
-extern cpuop_func op_c100_3;
-extern cpuop_func op_c108_3;
-extern cpuop_func op_c110_3;
-extern cpuop_func op_c118_3;
-extern cpuop_func op_c120_3;
-extern cpuop_func op_c128_3;
-extern cpuop_func op_c130_3;
-extern cpuop_func op_c138_3;
-extern cpuop_func op_c139_3;
-extern cpuop_func op_c140_3;
-extern cpuop_func op_c148_3;
-extern cpuop_func op_c150_3;
-extern cpuop_func op_c158_3;
-extern cpuop_func op_c160_3;
-extern cpuop_func op_c168_3;
-extern cpuop_func op_c170_3;
-extern cpuop_func op_c178_3;
-extern cpuop_func op_c179_3;
-extern cpuop_func op_c188_3;
-extern cpuop_func op_c190_3;
-extern cpuop_func op_c198_3;
-extern cpuop_func op_c1a0_3;
-extern cpuop_func op_c1a8_3;
-extern cpuop_func op_c1b0_3;
-extern cpuop_func op_c1b8_3;
-extern cpuop_func op_c1b9_3;
-extern cpuop_func op_c1c0_3;
-extern cpuop_func op_c1d0_3;
-extern cpuop_func op_c1d8_3;
-extern cpuop_func op_c1e0_3;
-extern cpuop_func op_c1e8_3;
-extern cpuop_func op_c1f0_3;
-extern cpuop_func op_c1f8_3;
-extern cpuop_func op_c1f9_3;
-extern cpuop_func op_c1fa_3;
-extern cpuop_func op_c1fb_3;
-extern cpuop_func op_c1fc_3;
-extern cpuop_func op_d000_3;
-extern cpuop_func op_d010_3;
-extern cpuop_func op_d018_3;
-extern cpuop_func op_d020_3;
-extern cpuop_func op_d028_3;
-extern cpuop_func op_d030_3;
-extern cpuop_func op_d038_3;
-extern cpuop_func op_d039_3;
-extern cpuop_func op_d03a_3;
-extern cpuop_func op_d03b_3;
-extern cpuop_func op_d03c_3;
-extern cpuop_func op_d040_3;
-extern cpuop_func op_d048_3;
-extern cpuop_func op_d050_3;
-extern cpuop_func op_d058_3;
-extern cpuop_func op_d060_3;
-extern cpuop_func op_d068_3;
-extern cpuop_func op_d070_3;
-extern cpuop_func op_d078_3;
-extern cpuop_func op_d079_3;
-extern cpuop_func op_d07a_3;
-extern cpuop_func op_d07b_3;
-extern cpuop_func op_d07c_3;
-extern cpuop_func op_d080_3;
-extern cpuop_func op_d088_3;
-extern cpuop_func op_d090_3;
-extern cpuop_func op_d098_3;
-extern cpuop_func op_d0a0_3;
-extern cpuop_func op_d0a8_3;
-extern cpuop_func op_d0b0_3;
-extern cpuop_func op_d0b8_3;
-extern cpuop_func op_d0b9_3;
-extern cpuop_func op_d0ba_3;
-extern cpuop_func op_d0bb_3;
-extern cpuop_func op_d0bc_3;
-extern cpuop_func op_d0c0_3;
-extern cpuop_func op_d0c8_3;
-extern cpuop_func op_d0d0_3;
-extern cpuop_func op_d0d8_3;
-extern cpuop_func op_d0e0_3;
-extern cpuop_func op_d0e8_3;
-extern cpuop_func op_d0f0_3;
-extern cpuop_func op_d0f8_3;
-extern cpuop_func op_d0f9_3;
-extern cpuop_func op_d0fa_3;
-extern cpuop_func op_d0fb_3;
-extern cpuop_func op_d0fc_3;
-extern cpuop_func op_d100_3;
-extern cpuop_func op_d108_3;
-extern cpuop_func op_d110_3;
-extern cpuop_func op_d118_3;
-extern cpuop_func op_d120_3;
-extern cpuop_func op_d128_3;
-extern cpuop_func op_d130_3;
-extern cpuop_func op_d138_3;
-extern cpuop_func op_d139_3;
-extern cpuop_func op_d140_3;
-extern cpuop_func op_d148_3;
-extern cpuop_func op_d150_3;
-extern cpuop_func op_d158_3;
-extern cpuop_func op_d160_3;
-extern cpuop_func op_d168_3;
-extern cpuop_func op_d170_3;
-extern cpuop_func op_d178_3;
-extern cpuop_func op_d179_3;
-extern cpuop_func op_d180_3;
-extern cpuop_func op_d188_3;
-extern cpuop_func op_d190_3;
-extern cpuop_func op_d198_3;
-extern cpuop_func op_d1a0_3;
-extern cpuop_func op_d1a8_3;
-extern cpuop_func op_d1b0_3;
-extern cpuop_func op_d1b8_3;
-extern cpuop_func op_d1b9_3;
-extern cpuop_func op_d1c0_3;
-extern cpuop_func op_d1c8_3;
-extern cpuop_func op_d1d0_3;
-extern cpuop_func op_d1d8_3;
-extern cpuop_func op_d1e0_3;
-extern cpuop_func op_d1e8_3;
-extern cpuop_func op_d1f0_3;
-extern cpuop_func op_d1f8_3;
-extern cpuop_func op_d1f9_3;
-extern cpuop_func op_d1fa_3;
-extern cpuop_func op_d1fb_3;
-extern cpuop_func op_d1fc_3;
-extern cpuop_func op_e000_3;
-extern cpuop_func op_e008_3;
-extern cpuop_func op_e010_3;
-extern cpuop_func op_e018_3;
-extern cpuop_func op_e020_3;
-extern cpuop_func op_e028_3;
-extern cpuop_func op_e030_3;
-extern cpuop_func op_e038_3;
-extern cpuop_func op_e040_3;
-extern cpuop_func op_e048_3;
-extern cpuop_func op_e050_3;
-extern cpuop_func op_e058_3;
-extern cpuop_func op_e060_3;
-extern cpuop_func op_e068_3;
-extern cpuop_func op_e070_3;
-extern cpuop_func op_e078_3;
-extern cpuop_func op_e080_3;
-extern cpuop_func op_e088_3;
-extern cpuop_func op_e090_3;
-extern cpuop_func op_e098_3;
-extern cpuop_func op_e0a0_3;
-extern cpuop_func op_e0a8_3;
-extern cpuop_func op_e0b0_3;
-extern cpuop_func op_e0b8_3;
-extern cpuop_func op_e0d0_3;
-extern cpuop_func op_e0d8_3;
-extern cpuop_func op_e0e0_3;
-extern cpuop_func op_e0e8_3;
-extern cpuop_func op_e0f0_3;
-extern cpuop_func op_e0f8_3;
-extern cpuop_func op_e0f9_3;
-extern cpuop_func op_e100_3;
-extern cpuop_func op_e108_3;
-extern cpuop_func op_e110_3;
-extern cpuop_func op_e118_3;
-extern cpuop_func op_e120_3;
-extern cpuop_func op_e128_3;
-extern cpuop_func op_e130_3;
-extern cpuop_func op_e138_3;
-extern cpuop_func op_e140_3;
-extern cpuop_func op_e148_3;
-extern cpuop_func op_e150_3;
-extern cpuop_func op_e158_3;
-extern cpuop_func op_e160_3;
-extern cpuop_func op_e168_3;
-extern cpuop_func op_e170_3;
-extern cpuop_func op_e178_3;
-extern cpuop_func op_e180_3;
-extern cpuop_func op_e188_3;
-extern cpuop_func op_e190_3;
-extern cpuop_func op_e198_3;
-extern cpuop_func op_e1a0_3;
-extern cpuop_func op_e1a8_3;
-extern cpuop_func op_e1b0_3;
-extern cpuop_func op_e1b8_3;
-extern cpuop_func op_e1d0_3;
-extern cpuop_func op_e1d8_3;
-extern cpuop_func op_e1e0_3;
-extern cpuop_func op_e1e8_3;
-extern cpuop_func op_e1f0_3;
-extern cpuop_func op_e1f8_3;
-extern cpuop_func op_e1f9_3;
-extern cpuop_func op_e2d0_3;
-extern cpuop_func op_e2d8_3;
-extern cpuop_func op_e2e0_3;
-extern cpuop_func op_e2e8_3;
-extern cpuop_func op_e2f0_3;
-extern cpuop_func op_e2f8_3;
-extern cpuop_func op_e2f9_3;
-extern cpuop_func op_e3d0_3;
-extern cpuop_func op_e3d8_3;
-extern cpuop_func op_e3e0_3;
-extern cpuop_func op_e3e8_3;
-extern cpuop_func op_e3f0_3;
-extern cpuop_func op_e3f8_3;
-extern cpuop_func op_e3f9_3;
-extern cpuop_func op_e4d0_3;
-extern cpuop_func op_e4d8_3;
-extern cpuop_func op_e4e0_3;
-extern cpuop_func op_e4e8_3;
-extern cpuop_func op_e4f0_3;
-extern cpuop_func op_e4f8_3;
-extern cpuop_func op_e4f9_3;
-extern cpuop_func op_e5d0_3;
-extern cpuop_func op_e5d8_3;
-extern cpuop_func op_e5e0_3;
-extern cpuop_func op_e5e8_3;
-extern cpuop_func op_e5f0_3;
-extern cpuop_func op_e5f8_3;
-extern cpuop_func op_e5f9_3;
-extern cpuop_func op_e6d0_3;
-extern cpuop_func op_e6d8_3;
-extern cpuop_func op_e6e0_3;
-extern cpuop_func op_e6e8_3;
-extern cpuop_func op_e6f0_3;
-extern cpuop_func op_e6f8_3;
-extern cpuop_func op_e6f9_3;
-extern cpuop_func op_e7d0_3;
-extern cpuop_func op_e7d8_3;
-extern cpuop_func op_e7e0_3;
-extern cpuop_func op_e7e8_3;
-extern cpuop_func op_e7f0_3;
-extern cpuop_func op_e7f8_3;
-extern cpuop_func op_e7f9_3;
+extern cpuop_func CPUOP_NAME(op_0_3);
+extern cpuop_func CPUOP_NAME(op_10_3);
+extern cpuop_func CPUOP_NAME(op_18_3);
+extern cpuop_func CPUOP_NAME(op_20_3);
+extern cpuop_func CPUOP_NAME(op_28_3);
+extern cpuop_func CPUOP_NAME(op_30_3);
+extern cpuop_func CPUOP_NAME(op_38_3);
+extern cpuop_func CPUOP_NAME(op_39_3);
+extern cpuop_func CPUOP_NAME(op_3c_3);
+extern cpuop_func CPUOP_NAME(op_40_3);
+extern cpuop_func CPUOP_NAME(op_50_3);
+extern cpuop_func CPUOP_NAME(op_58_3);
+extern cpuop_func CPUOP_NAME(op_60_3);
+extern cpuop_func CPUOP_NAME(op_68_3);
+extern cpuop_func CPUOP_NAME(op_70_3);
+extern cpuop_func CPUOP_NAME(op_78_3);
+extern cpuop_func CPUOP_NAME(op_79_3);
+extern cpuop_func CPUOP_NAME(op_7c_3);
+extern cpuop_func CPUOP_NAME(op_80_3);
+extern cpuop_func CPUOP_NAME(op_90_3);
+extern cpuop_func CPUOP_NAME(op_98_3);
+extern cpuop_func CPUOP_NAME(op_a0_3);
+extern cpuop_func CPUOP_NAME(op_a8_3);
+extern cpuop_func CPUOP_NAME(op_b0_3);
+extern cpuop_func CPUOP_NAME(op_b8_3);
+extern cpuop_func CPUOP_NAME(op_b9_3);
+extern cpuop_func CPUOP_NAME(op_100_3);
+extern cpuop_func CPUOP_NAME(op_108_3);
+extern cpuop_func CPUOP_NAME(op_110_3);
+extern cpuop_func CPUOP_NAME(op_118_3);
+extern cpuop_func CPUOP_NAME(op_120_3);
+extern cpuop_func CPUOP_NAME(op_128_3);
+extern cpuop_func CPUOP_NAME(op_130_3);
+extern cpuop_func CPUOP_NAME(op_138_3);
+extern cpuop_func CPUOP_NAME(op_139_3);
+extern cpuop_func CPUOP_NAME(op_13a_3);
+extern cpuop_func CPUOP_NAME(op_13b_3);
+extern cpuop_func CPUOP_NAME(op_13c_3);
+extern cpuop_func CPUOP_NAME(op_140_3);
+extern cpuop_func CPUOP_NAME(op_148_3);
+extern cpuop_func CPUOP_NAME(op_150_3);
+extern cpuop_func CPUOP_NAME(op_158_3);
+extern cpuop_func CPUOP_NAME(op_160_3);
+extern cpuop_func CPUOP_NAME(op_168_3);
+extern cpuop_func CPUOP_NAME(op_170_3);
+extern cpuop_func CPUOP_NAME(op_178_3);
+extern cpuop_func CPUOP_NAME(op_179_3);
+extern cpuop_func CPUOP_NAME(op_17a_3);
+extern cpuop_func CPUOP_NAME(op_17b_3);
+extern cpuop_func CPUOP_NAME(op_180_3);
+extern cpuop_func CPUOP_NAME(op_188_3);
+extern cpuop_func CPUOP_NAME(op_190_3);
+extern cpuop_func CPUOP_NAME(op_198_3);
+extern cpuop_func CPUOP_NAME(op_1a0_3);
+extern cpuop_func CPUOP_NAME(op_1a8_3);
+extern cpuop_func CPUOP_NAME(op_1b0_3);
+extern cpuop_func CPUOP_NAME(op_1b8_3);
+extern cpuop_func CPUOP_NAME(op_1b9_3);
+extern cpuop_func CPUOP_NAME(op_1ba_3);
+extern cpuop_func CPUOP_NAME(op_1bb_3);
+extern cpuop_func CPUOP_NAME(op_1c0_3);
+extern cpuop_func CPUOP_NAME(op_1c8_3);
+extern cpuop_func CPUOP_NAME(op_1d0_3);
+extern cpuop_func CPUOP_NAME(op_1d8_3);
+extern cpuop_func CPUOP_NAME(op_1e0_3);
+extern cpuop_func CPUOP_NAME(op_1e8_3);
+extern cpuop_func CPUOP_NAME(op_1f0_3);
+extern cpuop_func CPUOP_NAME(op_1f8_3);
+extern cpuop_func CPUOP_NAME(op_1f9_3);
+extern cpuop_func CPUOP_NAME(op_1fa_3);
+extern cpuop_func CPUOP_NAME(op_1fb_3);
+extern cpuop_func CPUOP_NAME(op_200_3);
+extern cpuop_func CPUOP_NAME(op_210_3);
+extern cpuop_func CPUOP_NAME(op_218_3);
+extern cpuop_func CPUOP_NAME(op_220_3);
+extern cpuop_func CPUOP_NAME(op_228_3);
+extern cpuop_func CPUOP_NAME(op_230_3);
+extern cpuop_func CPUOP_NAME(op_238_3);
+extern cpuop_func CPUOP_NAME(op_239_3);
+extern cpuop_func CPUOP_NAME(op_23c_3);
+extern cpuop_func CPUOP_NAME(op_240_3);
+extern cpuop_func CPUOP_NAME(op_250_3);
+extern cpuop_func CPUOP_NAME(op_258_3);
+extern cpuop_func CPUOP_NAME(op_260_3);
+extern cpuop_func CPUOP_NAME(op_268_3);
+extern cpuop_func CPUOP_NAME(op_270_3);
+extern cpuop_func CPUOP_NAME(op_278_3);
+extern cpuop_func CPUOP_NAME(op_279_3);
+extern cpuop_func CPUOP_NAME(op_27c_3);
+extern cpuop_func CPUOP_NAME(op_280_3);
+extern cpuop_func CPUOP_NAME(op_290_3);
+extern cpuop_func CPUOP_NAME(op_298_3);
+extern cpuop_func CPUOP_NAME(op_2a0_3);
+extern cpuop_func CPUOP_NAME(op_2a8_3);
+extern cpuop_func CPUOP_NAME(op_2b0_3);
+extern cpuop_func CPUOP_NAME(op_2b8_3);
+extern cpuop_func CPUOP_NAME(op_2b9_3);
+extern cpuop_func CPUOP_NAME(op_400_3);
+extern cpuop_func CPUOP_NAME(op_410_3);
+extern cpuop_func CPUOP_NAME(op_418_3);
+extern cpuop_func CPUOP_NAME(op_420_3);
+extern cpuop_func CPUOP_NAME(op_428_3);
+extern cpuop_func CPUOP_NAME(op_430_3);
+extern cpuop_func CPUOP_NAME(op_438_3);
+extern cpuop_func CPUOP_NAME(op_439_3);
+extern cpuop_func CPUOP_NAME(op_440_3);
+extern cpuop_func CPUOP_NAME(op_450_3);
+extern cpuop_func CPUOP_NAME(op_458_3);
+extern cpuop_func CPUOP_NAME(op_460_3);
+extern cpuop_func CPUOP_NAME(op_468_3);
+extern cpuop_func CPUOP_NAME(op_470_3);
+extern cpuop_func CPUOP_NAME(op_478_3);
+extern cpuop_func CPUOP_NAME(op_479_3);
+extern cpuop_func CPUOP_NAME(op_480_3);
+extern cpuop_func CPUOP_NAME(op_490_3);
+extern cpuop_func CPUOP_NAME(op_498_3);
+extern cpuop_func CPUOP_NAME(op_4a0_3);
+extern cpuop_func CPUOP_NAME(op_4a8_3);
+extern cpuop_func CPUOP_NAME(op_4b0_3);
+extern cpuop_func CPUOP_NAME(op_4b8_3);
+extern cpuop_func CPUOP_NAME(op_4b9_3);
+extern cpuop_func CPUOP_NAME(op_600_3);
+extern cpuop_func CPUOP_NAME(op_610_3);
+extern cpuop_func CPUOP_NAME(op_618_3);
+extern cpuop_func CPUOP_NAME(op_620_3);
+extern cpuop_func CPUOP_NAME(op_628_3);
+extern cpuop_func CPUOP_NAME(op_630_3);
+extern cpuop_func CPUOP_NAME(op_638_3);
+extern cpuop_func CPUOP_NAME(op_639_3);
+extern cpuop_func CPUOP_NAME(op_640_3);
+extern cpuop_func CPUOP_NAME(op_650_3);
+extern cpuop_func CPUOP_NAME(op_658_3);
+extern cpuop_func CPUOP_NAME(op_660_3);
+extern cpuop_func CPUOP_NAME(op_668_3);
+extern cpuop_func CPUOP_NAME(op_670_3);
+extern cpuop_func CPUOP_NAME(op_678_3);
+extern cpuop_func CPUOP_NAME(op_679_3);
+extern cpuop_func CPUOP_NAME(op_680_3);
+extern cpuop_func CPUOP_NAME(op_690_3);
+extern cpuop_func CPUOP_NAME(op_698_3);
+extern cpuop_func CPUOP_NAME(op_6a0_3);
+extern cpuop_func CPUOP_NAME(op_6a8_3);
+extern cpuop_func CPUOP_NAME(op_6b0_3);
+extern cpuop_func CPUOP_NAME(op_6b8_3);
+extern cpuop_func CPUOP_NAME(op_6b9_3);
+extern cpuop_func CPUOP_NAME(op_800_3);
+extern cpuop_func CPUOP_NAME(op_810_3);
+extern cpuop_func CPUOP_NAME(op_818_3);
+extern cpuop_func CPUOP_NAME(op_820_3);
+extern cpuop_func CPUOP_NAME(op_828_3);
+extern cpuop_func CPUOP_NAME(op_830_3);
+extern cpuop_func CPUOP_NAME(op_838_3);
+extern cpuop_func CPUOP_NAME(op_839_3);
+extern cpuop_func CPUOP_NAME(op_83a_3);
+extern cpuop_func CPUOP_NAME(op_83b_3);
+extern cpuop_func CPUOP_NAME(op_83c_3);
+extern cpuop_func CPUOP_NAME(op_840_3);
+extern cpuop_func CPUOP_NAME(op_850_3);
+extern cpuop_func CPUOP_NAME(op_858_3);
+extern cpuop_func CPUOP_NAME(op_860_3);
+extern cpuop_func CPUOP_NAME(op_868_3);
+extern cpuop_func CPUOP_NAME(op_870_3);
+extern cpuop_func CPUOP_NAME(op_878_3);
+extern cpuop_func CPUOP_NAME(op_879_3);
+extern cpuop_func CPUOP_NAME(op_87a_3);
+extern cpuop_func CPUOP_NAME(op_87b_3);
+extern cpuop_func CPUOP_NAME(op_880_3);
+extern cpuop_func CPUOP_NAME(op_890_3);
+extern cpuop_func CPUOP_NAME(op_898_3);
+extern cpuop_func CPUOP_NAME(op_8a0_3);
+extern cpuop_func CPUOP_NAME(op_8a8_3);
+extern cpuop_func CPUOP_NAME(op_8b0_3);
+extern cpuop_func CPUOP_NAME(op_8b8_3);
+extern cpuop_func CPUOP_NAME(op_8b9_3);
+extern cpuop_func CPUOP_NAME(op_8ba_3);
+extern cpuop_func CPUOP_NAME(op_8bb_3);
+extern cpuop_func CPUOP_NAME(op_8c0_3);
+extern cpuop_func CPUOP_NAME(op_8d0_3);
+extern cpuop_func CPUOP_NAME(op_8d8_3);
+extern cpuop_func CPUOP_NAME(op_8e0_3);
+extern cpuop_func CPUOP_NAME(op_8e8_3);
+extern cpuop_func CPUOP_NAME(op_8f0_3);
+extern cpuop_func CPUOP_NAME(op_8f8_3);
+extern cpuop_func CPUOP_NAME(op_8f9_3);
+extern cpuop_func CPUOP_NAME(op_8fa_3);
+extern cpuop_func CPUOP_NAME(op_8fb_3);
+extern cpuop_func CPUOP_NAME(op_a00_3);
+extern cpuop_func CPUOP_NAME(op_a10_3);
+extern cpuop_func CPUOP_NAME(op_a18_3);
+extern cpuop_func CPUOP_NAME(op_a20_3);
+extern cpuop_func CPUOP_NAME(op_a28_3);
+extern cpuop_func CPUOP_NAME(op_a30_3);
+extern cpuop_func CPUOP_NAME(op_a38_3);
+extern cpuop_func CPUOP_NAME(op_a39_3);
+extern cpuop_func CPUOP_NAME(op_a3c_3);
+extern cpuop_func CPUOP_NAME(op_a40_3);
+extern cpuop_func CPUOP_NAME(op_a50_3);
+extern cpuop_func CPUOP_NAME(op_a58_3);
+extern cpuop_func CPUOP_NAME(op_a60_3);
+extern cpuop_func CPUOP_NAME(op_a68_3);
+extern cpuop_func CPUOP_NAME(op_a70_3);
+extern cpuop_func CPUOP_NAME(op_a78_3);
+extern cpuop_func CPUOP_NAME(op_a79_3);
+extern cpuop_func CPUOP_NAME(op_a7c_3);
+extern cpuop_func CPUOP_NAME(op_a80_3);
+extern cpuop_func CPUOP_NAME(op_a90_3);
+extern cpuop_func CPUOP_NAME(op_a98_3);
+extern cpuop_func CPUOP_NAME(op_aa0_3);
+extern cpuop_func CPUOP_NAME(op_aa8_3);
+extern cpuop_func CPUOP_NAME(op_ab0_3);
+extern cpuop_func CPUOP_NAME(op_ab8_3);
+extern cpuop_func CPUOP_NAME(op_ab9_3);
+extern cpuop_func CPUOP_NAME(op_c00_3);
+extern cpuop_func CPUOP_NAME(op_c10_3);
+extern cpuop_func CPUOP_NAME(op_c18_3);
+extern cpuop_func CPUOP_NAME(op_c20_3);
+extern cpuop_func CPUOP_NAME(op_c28_3);
+extern cpuop_func CPUOP_NAME(op_c30_3);
+extern cpuop_func CPUOP_NAME(op_c38_3);
+extern cpuop_func CPUOP_NAME(op_c39_3);
+extern cpuop_func CPUOP_NAME(op_c3a_3);
+extern cpuop_func CPUOP_NAME(op_c3b_3);
+extern cpuop_func CPUOP_NAME(op_c40_3);
+extern cpuop_func CPUOP_NAME(op_c50_3);
+extern cpuop_func CPUOP_NAME(op_c58_3);
+extern cpuop_func CPUOP_NAME(op_c60_3);
+extern cpuop_func CPUOP_NAME(op_c68_3);
+extern cpuop_func CPUOP_NAME(op_c70_3);
+extern cpuop_func CPUOP_NAME(op_c78_3);
+extern cpuop_func CPUOP_NAME(op_c79_3);
+extern cpuop_func CPUOP_NAME(op_c7a_3);
+extern cpuop_func CPUOP_NAME(op_c7b_3);
+extern cpuop_func CPUOP_NAME(op_c80_3);
+extern cpuop_func CPUOP_NAME(op_c90_3);
+extern cpuop_func CPUOP_NAME(op_c98_3);
+extern cpuop_func CPUOP_NAME(op_ca0_3);
+extern cpuop_func CPUOP_NAME(op_ca8_3);
+extern cpuop_func CPUOP_NAME(op_cb0_3);
+extern cpuop_func CPUOP_NAME(op_cb8_3);
+extern cpuop_func CPUOP_NAME(op_cb9_3);
+extern cpuop_func CPUOP_NAME(op_cba_3);
+extern cpuop_func CPUOP_NAME(op_cbb_3);
+extern cpuop_func CPUOP_NAME(op_1000_3);
+extern cpuop_func CPUOP_NAME(op_1010_3);
+extern cpuop_func CPUOP_NAME(op_1018_3);
+extern cpuop_func CPUOP_NAME(op_1020_3);
+extern cpuop_func CPUOP_NAME(op_1028_3);
+extern cpuop_func CPUOP_NAME(op_1030_3);
+extern cpuop_func CPUOP_NAME(op_1038_3);
+extern cpuop_func CPUOP_NAME(op_1039_3);
+extern cpuop_func CPUOP_NAME(op_103a_3);
+extern cpuop_func CPUOP_NAME(op_103b_3);
+extern cpuop_func CPUOP_NAME(op_103c_3);
+extern cpuop_func CPUOP_NAME(op_1080_3);
+extern cpuop_func CPUOP_NAME(op_1090_3);
+extern cpuop_func CPUOP_NAME(op_1098_3);
+extern cpuop_func CPUOP_NAME(op_10a0_3);
+extern cpuop_func CPUOP_NAME(op_10a8_3);
+extern cpuop_func CPUOP_NAME(op_10b0_3);
+extern cpuop_func CPUOP_NAME(op_10b8_3);
+extern cpuop_func CPUOP_NAME(op_10b9_3);
+extern cpuop_func CPUOP_NAME(op_10ba_3);
+extern cpuop_func CPUOP_NAME(op_10bb_3);
+extern cpuop_func CPUOP_NAME(op_10bc_3);
+extern cpuop_func CPUOP_NAME(op_10c0_3);
+extern cpuop_func CPUOP_NAME(op_10d0_3);
+extern cpuop_func CPUOP_NAME(op_10d8_3);
+extern cpuop_func CPUOP_NAME(op_10e0_3);
+extern cpuop_func CPUOP_NAME(op_10e8_3);
+extern cpuop_func CPUOP_NAME(op_10f0_3);
+extern cpuop_func CPUOP_NAME(op_10f8_3);
+extern cpuop_func CPUOP_NAME(op_10f9_3);
+extern cpuop_func CPUOP_NAME(op_10fa_3);
+extern cpuop_func CPUOP_NAME(op_10fb_3);
+extern cpuop_func CPUOP_NAME(op_10fc_3);
+extern cpuop_func CPUOP_NAME(op_1100_3);
+extern cpuop_func CPUOP_NAME(op_1110_3);
+extern cpuop_func CPUOP_NAME(op_1118_3);
+extern cpuop_func CPUOP_NAME(op_1120_3);
+extern cpuop_func CPUOP_NAME(op_1128_3);
+extern cpuop_func CPUOP_NAME(op_1130_3);
+extern cpuop_func CPUOP_NAME(op_1138_3);
+extern cpuop_func CPUOP_NAME(op_1139_3);
+extern cpuop_func CPUOP_NAME(op_113a_3);
+extern cpuop_func CPUOP_NAME(op_113b_3);
+extern cpuop_func CPUOP_NAME(op_113c_3);
+extern cpuop_func CPUOP_NAME(op_1140_3);
+extern cpuop_func CPUOP_NAME(op_1150_3);
+extern cpuop_func CPUOP_NAME(op_1158_3);
+extern cpuop_func CPUOP_NAME(op_1160_3);
+extern cpuop_func CPUOP_NAME(op_1168_3);
+extern cpuop_func CPUOP_NAME(op_1170_3);
+extern cpuop_func CPUOP_NAME(op_1178_3);
+extern cpuop_func CPUOP_NAME(op_1179_3);
+extern cpuop_func CPUOP_NAME(op_117a_3);
+extern cpuop_func CPUOP_NAME(op_117b_3);
+extern cpuop_func CPUOP_NAME(op_117c_3);
+extern cpuop_func CPUOP_NAME(op_1180_3);
+extern cpuop_func CPUOP_NAME(op_1190_3);
+extern cpuop_func CPUOP_NAME(op_1198_3);
+extern cpuop_func CPUOP_NAME(op_11a0_3);
+extern cpuop_func CPUOP_NAME(op_11a8_3);
+extern cpuop_func CPUOP_NAME(op_11b0_3);
+extern cpuop_func CPUOP_NAME(op_11b8_3);
+extern cpuop_func CPUOP_NAME(op_11b9_3);
+extern cpuop_func CPUOP_NAME(op_11ba_3);
+extern cpuop_func CPUOP_NAME(op_11bb_3);
+extern cpuop_func CPUOP_NAME(op_11bc_3);
+extern cpuop_func CPUOP_NAME(op_11c0_3);
+extern cpuop_func CPUOP_NAME(op_11d0_3);
+extern cpuop_func CPUOP_NAME(op_11d8_3);
+extern cpuop_func CPUOP_NAME(op_11e0_3);
+extern cpuop_func CPUOP_NAME(op_11e8_3);
+extern cpuop_func CPUOP_NAME(op_11f0_3);
+extern cpuop_func CPUOP_NAME(op_11f8_3);
+extern cpuop_func CPUOP_NAME(op_11f9_3);
+extern cpuop_func CPUOP_NAME(op_11fa_3);
+extern cpuop_func CPUOP_NAME(op_11fb_3);
+extern cpuop_func CPUOP_NAME(op_11fc_3);
+extern cpuop_func CPUOP_NAME(op_13c0_3);
+extern cpuop_func CPUOP_NAME(op_13d0_3);
+extern cpuop_func CPUOP_NAME(op_13d8_3);
+extern cpuop_func CPUOP_NAME(op_13e0_3);
+extern cpuop_func CPUOP_NAME(op_13e8_3);
+extern cpuop_func CPUOP_NAME(op_13f0_3);
+extern cpuop_func CPUOP_NAME(op_13f8_3);
+extern cpuop_func CPUOP_NAME(op_13f9_3);
+extern cpuop_func CPUOP_NAME(op_13fa_3);
+extern cpuop_func CPUOP_NAME(op_13fb_3);
+extern cpuop_func CPUOP_NAME(op_13fc_3);
+extern cpuop_func CPUOP_NAME(op_2000_3);
+extern cpuop_func CPUOP_NAME(op_2008_3);
+extern cpuop_func CPUOP_NAME(op_2010_3);
+extern cpuop_func CPUOP_NAME(op_2018_3);
+extern cpuop_func CPUOP_NAME(op_2020_3);
+extern cpuop_func CPUOP_NAME(op_2028_3);
+extern cpuop_func CPUOP_NAME(op_2030_3);
+extern cpuop_func CPUOP_NAME(op_2038_3);
+extern cpuop_func CPUOP_NAME(op_2039_3);
+extern cpuop_func CPUOP_NAME(op_203a_3);
+extern cpuop_func CPUOP_NAME(op_203b_3);
+extern cpuop_func CPUOP_NAME(op_203c_3);
+extern cpuop_func CPUOP_NAME(op_2040_3);
+extern cpuop_func CPUOP_NAME(op_2048_3);
+extern cpuop_func CPUOP_NAME(op_2050_3);
+extern cpuop_func CPUOP_NAME(op_2058_3);
+extern cpuop_func CPUOP_NAME(op_2060_3);
+extern cpuop_func CPUOP_NAME(op_2068_3);
+extern cpuop_func CPUOP_NAME(op_2070_3);
+extern cpuop_func CPUOP_NAME(op_2078_3);
+extern cpuop_func CPUOP_NAME(op_2079_3);
+extern cpuop_func CPUOP_NAME(op_207a_3);
+extern cpuop_func CPUOP_NAME(op_207b_3);
+extern cpuop_func CPUOP_NAME(op_207c_3);
+extern cpuop_func CPUOP_NAME(op_2080_3);
+extern cpuop_func CPUOP_NAME(op_2088_3);
+extern cpuop_func CPUOP_NAME(op_2090_3);
+extern cpuop_func CPUOP_NAME(op_2098_3);
+extern cpuop_func CPUOP_NAME(op_20a0_3);
+extern cpuop_func CPUOP_NAME(op_20a8_3);
+extern cpuop_func CPUOP_NAME(op_20b0_3);
+extern cpuop_func CPUOP_NAME(op_20b8_3);
+extern cpuop_func CPUOP_NAME(op_20b9_3);
+extern cpuop_func CPUOP_NAME(op_20ba_3);
+extern cpuop_func CPUOP_NAME(op_20bb_3);
+extern cpuop_func CPUOP_NAME(op_20bc_3);
+extern cpuop_func CPUOP_NAME(op_20c0_3);
+extern cpuop_func CPUOP_NAME(op_20c8_3);
+extern cpuop_func CPUOP_NAME(op_20d0_3);
+extern cpuop_func CPUOP_NAME(op_20d8_3);
+extern cpuop_func CPUOP_NAME(op_20e0_3);
+extern cpuop_func CPUOP_NAME(op_20e8_3);
+extern cpuop_func CPUOP_NAME(op_20f0_3);
+extern cpuop_func CPUOP_NAME(op_20f8_3);
+extern cpuop_func CPUOP_NAME(op_20f9_3);
+extern cpuop_func CPUOP_NAME(op_20fa_3);
+extern cpuop_func CPUOP_NAME(op_20fb_3);
+extern cpuop_func CPUOP_NAME(op_20fc_3);
+extern cpuop_func CPUOP_NAME(op_2100_3);
+extern cpuop_func CPUOP_NAME(op_2108_3);
+extern cpuop_func CPUOP_NAME(op_2110_3);
+extern cpuop_func CPUOP_NAME(op_2118_3);
+extern cpuop_func CPUOP_NAME(op_2120_3);
+extern cpuop_func CPUOP_NAME(op_2128_3);
+extern cpuop_func CPUOP_NAME(op_2130_3);
+extern cpuop_func CPUOP_NAME(op_2138_3);
+extern cpuop_func CPUOP_NAME(op_2139_3);
+extern cpuop_func CPUOP_NAME(op_213a_3);
+extern cpuop_func CPUOP_NAME(op_213b_3);
+extern cpuop_func CPUOP_NAME(op_213c_3);
+extern cpuop_func CPUOP_NAME(op_2140_3);
+extern cpuop_func CPUOP_NAME(op_2148_3);
+extern cpuop_func CPUOP_NAME(op_2150_3);
+extern cpuop_func CPUOP_NAME(op_2158_3);
+extern cpuop_func CPUOP_NAME(op_2160_3);
+extern cpuop_func CPUOP_NAME(op_2168_3);
+extern cpuop_func CPUOP_NAME(op_2170_3);
+extern cpuop_func CPUOP_NAME(op_2178_3);
+extern cpuop_func CPUOP_NAME(op_2179_3);
+extern cpuop_func CPUOP_NAME(op_217a_3);
+extern cpuop_func CPUOP_NAME(op_217b_3);
+extern cpuop_func CPUOP_NAME(op_217c_3);
+extern cpuop_func CPUOP_NAME(op_2180_3);
+extern cpuop_func CPUOP_NAME(op_2188_3);
+extern cpuop_func CPUOP_NAME(op_2190_3);
+extern cpuop_func CPUOP_NAME(op_2198_3);
+extern cpuop_func CPUOP_NAME(op_21a0_3);
+extern cpuop_func CPUOP_NAME(op_21a8_3);
+extern cpuop_func CPUOP_NAME(op_21b0_3);
+extern cpuop_func CPUOP_NAME(op_21b8_3);
+extern cpuop_func CPUOP_NAME(op_21b9_3);
+extern cpuop_func CPUOP_NAME(op_21ba_3);
+extern cpuop_func CPUOP_NAME(op_21bb_3);
+extern cpuop_func CPUOP_NAME(op_21bc_3);
+extern cpuop_func CPUOP_NAME(op_21c0_3);
+extern cpuop_func CPUOP_NAME(op_21c8_3);
+extern cpuop_func CPUOP_NAME(op_21d0_3);
+extern cpuop_func CPUOP_NAME(op_21d8_3);
+extern cpuop_func CPUOP_NAME(op_21e0_3);
+extern cpuop_func CPUOP_NAME(op_21e8_3);
+extern cpuop_func CPUOP_NAME(op_21f0_3);
+extern cpuop_func CPUOP_NAME(op_21f8_3);
+extern cpuop_func CPUOP_NAME(op_21f9_3);
+extern cpuop_func CPUOP_NAME(op_21fa_3);
+extern cpuop_func CPUOP_NAME(op_21fb_3);
+extern cpuop_func CPUOP_NAME(op_21fc_3);
+extern cpuop_func CPUOP_NAME(op_23c0_3);
+extern cpuop_func CPUOP_NAME(op_23c8_3);
+extern cpuop_func CPUOP_NAME(op_23d0_3);
+extern cpuop_func CPUOP_NAME(op_23d8_3);
+extern cpuop_func CPUOP_NAME(op_23e0_3);
+extern cpuop_func CPUOP_NAME(op_23e8_3);
+extern cpuop_func CPUOP_NAME(op_23f0_3);
+extern cpuop_func CPUOP_NAME(op_23f8_3);
+extern cpuop_func CPUOP_NAME(op_23f9_3);
+extern cpuop_func CPUOP_NAME(op_23fa_3);
+extern cpuop_func CPUOP_NAME(op_23fb_3);
+extern cpuop_func CPUOP_NAME(op_23fc_3);
+extern cpuop_func CPUOP_NAME(op_3000_3);
+extern cpuop_func CPUOP_NAME(op_3008_3);
+extern cpuop_func CPUOP_NAME(op_3010_3);
+extern cpuop_func CPUOP_NAME(op_3018_3);
+extern cpuop_func CPUOP_NAME(op_3020_3);
+extern cpuop_func CPUOP_NAME(op_3028_3);
+extern cpuop_func CPUOP_NAME(op_3030_3);
+extern cpuop_func CPUOP_NAME(op_3038_3);
+extern cpuop_func CPUOP_NAME(op_3039_3);
+extern cpuop_func CPUOP_NAME(op_303a_3);
+extern cpuop_func CPUOP_NAME(op_303b_3);
+extern cpuop_func CPUOP_NAME(op_303c_3);
+extern cpuop_func CPUOP_NAME(op_3040_3);
+extern cpuop_func CPUOP_NAME(op_3048_3);
+extern cpuop_func CPUOP_NAME(op_3050_3);
+extern cpuop_func CPUOP_NAME(op_3058_3);
+extern cpuop_func CPUOP_NAME(op_3060_3);
+extern cpuop_func CPUOP_NAME(op_3068_3);
+extern cpuop_func CPUOP_NAME(op_3070_3);
+extern cpuop_func CPUOP_NAME(op_3078_3);
+extern cpuop_func CPUOP_NAME(op_3079_3);
+extern cpuop_func CPUOP_NAME(op_307a_3);
+extern cpuop_func CPUOP_NAME(op_307b_3);
+extern cpuop_func CPUOP_NAME(op_307c_3);
+extern cpuop_func CPUOP_NAME(op_3080_3);
+extern cpuop_func CPUOP_NAME(op_3088_3);
+extern cpuop_func CPUOP_NAME(op_3090_3);
+extern cpuop_func CPUOP_NAME(op_3098_3);
+extern cpuop_func CPUOP_NAME(op_30a0_3);
+extern cpuop_func CPUOP_NAME(op_30a8_3);
+extern cpuop_func CPUOP_NAME(op_30b0_3);
+extern cpuop_func CPUOP_NAME(op_30b8_3);
+extern cpuop_func CPUOP_NAME(op_30b9_3);
+extern cpuop_func CPUOP_NAME(op_30ba_3);
+extern cpuop_func CPUOP_NAME(op_30bb_3);
+extern cpuop_func CPUOP_NAME(op_30bc_3);
+extern cpuop_func CPUOP_NAME(op_30c0_3);
+extern cpuop_func CPUOP_NAME(op_30c8_3);
+extern cpuop_func CPUOP_NAME(op_30d0_3);
+extern cpuop_func CPUOP_NAME(op_30d8_3);
+extern cpuop_func CPUOP_NAME(op_30e0_3);
+extern cpuop_func CPUOP_NAME(op_30e8_3);
+extern cpuop_func CPUOP_NAME(op_30f0_3);
+extern cpuop_func CPUOP_NAME(op_30f8_3);
+extern cpuop_func CPUOP_NAME(op_30f9_3);
+extern cpuop_func CPUOP_NAME(op_30fa_3);
+extern cpuop_func CPUOP_NAME(op_30fb_3);
+extern cpuop_func CPUOP_NAME(op_30fc_3);
+extern cpuop_func CPUOP_NAME(op_3100_3);
+extern cpuop_func CPUOP_NAME(op_3108_3);
+extern cpuop_func CPUOP_NAME(op_3110_3);
+extern cpuop_func CPUOP_NAME(op_3118_3);
+extern cpuop_func CPUOP_NAME(op_3120_3);
+extern cpuop_func CPUOP_NAME(op_3128_3);
+extern cpuop_func CPUOP_NAME(op_3130_3);
+extern cpuop_func CPUOP_NAME(op_3138_3);
+extern cpuop_func CPUOP_NAME(op_3139_3);
+extern cpuop_func CPUOP_NAME(op_313a_3);
+extern cpuop_func CPUOP_NAME(op_313b_3);
+extern cpuop_func CPUOP_NAME(op_313c_3);
+extern cpuop_func CPUOP_NAME(op_3140_3);
+extern cpuop_func CPUOP_NAME(op_3148_3);
+extern cpuop_func CPUOP_NAME(op_3150_3);
+extern cpuop_func CPUOP_NAME(op_3158_3);
+extern cpuop_func CPUOP_NAME(op_3160_3);
+extern cpuop_func CPUOP_NAME(op_3168_3);
+extern cpuop_func CPUOP_NAME(op_3170_3);
+extern cpuop_func CPUOP_NAME(op_3178_3);
+extern cpuop_func CPUOP_NAME(op_3179_3);
+extern cpuop_func CPUOP_NAME(op_317a_3);
+extern cpuop_func CPUOP_NAME(op_317b_3);
+extern cpuop_func CPUOP_NAME(op_317c_3);
+extern cpuop_func CPUOP_NAME(op_3180_3);
+extern cpuop_func CPUOP_NAME(op_3188_3);
+extern cpuop_func CPUOP_NAME(op_3190_3);
+extern cpuop_func CPUOP_NAME(op_3198_3);
+extern cpuop_func CPUOP_NAME(op_31a0_3);
+extern cpuop_func CPUOP_NAME(op_31a8_3);
+extern cpuop_func CPUOP_NAME(op_31b0_3);
+extern cpuop_func CPUOP_NAME(op_31b8_3);
+extern cpuop_func CPUOP_NAME(op_31b9_3);
+extern cpuop_func CPUOP_NAME(op_31ba_3);
+extern cpuop_func CPUOP_NAME(op_31bb_3);
+extern cpuop_func CPUOP_NAME(op_31bc_3);
+extern cpuop_func CPUOP_NAME(op_31c0_3);
+extern cpuop_func CPUOP_NAME(op_31c8_3);
+extern cpuop_func CPUOP_NAME(op_31d0_3);
+extern cpuop_func CPUOP_NAME(op_31d8_3);
+extern cpuop_func CPUOP_NAME(op_31e0_3);
+extern cpuop_func CPUOP_NAME(op_31e8_3);
+extern cpuop_func CPUOP_NAME(op_31f0_3);
+extern cpuop_func CPUOP_NAME(op_31f8_3);
+extern cpuop_func CPUOP_NAME(op_31f9_3);
+extern cpuop_func CPUOP_NAME(op_31fa_3);
+extern cpuop_func CPUOP_NAME(op_31fb_3);
+extern cpuop_func CPUOP_NAME(op_31fc_3);
+extern cpuop_func CPUOP_NAME(op_33c0_3);
+extern cpuop_func CPUOP_NAME(op_33c8_3);
+extern cpuop_func CPUOP_NAME(op_33d0_3);
+extern cpuop_func CPUOP_NAME(op_33d8_3);
+extern cpuop_func CPUOP_NAME(op_33e0_3);
+extern cpuop_func CPUOP_NAME(op_33e8_3);
+extern cpuop_func CPUOP_NAME(op_33f0_3);
+extern cpuop_func CPUOP_NAME(op_33f8_3);
+extern cpuop_func CPUOP_NAME(op_33f9_3);
+extern cpuop_func CPUOP_NAME(op_33fa_3);
+extern cpuop_func CPUOP_NAME(op_33fb_3);
+extern cpuop_func CPUOP_NAME(op_33fc_3);
+extern cpuop_func CPUOP_NAME(op_4000_3);
+extern cpuop_func CPUOP_NAME(op_4010_3);
+extern cpuop_func CPUOP_NAME(op_4018_3);
+extern cpuop_func CPUOP_NAME(op_4020_3);
+extern cpuop_func CPUOP_NAME(op_4028_3);
+extern cpuop_func CPUOP_NAME(op_4030_3);
+extern cpuop_func CPUOP_NAME(op_4038_3);
+extern cpuop_func CPUOP_NAME(op_4039_3);
+extern cpuop_func CPUOP_NAME(op_4040_3);
+extern cpuop_func CPUOP_NAME(op_4050_3);
+extern cpuop_func CPUOP_NAME(op_4058_3);
+extern cpuop_func CPUOP_NAME(op_4060_3);
+extern cpuop_func CPUOP_NAME(op_4068_3);
+extern cpuop_func CPUOP_NAME(op_4070_3);
+extern cpuop_func CPUOP_NAME(op_4078_3);
+extern cpuop_func CPUOP_NAME(op_4079_3);
+extern cpuop_func CPUOP_NAME(op_4080_3);
+extern cpuop_func CPUOP_NAME(op_4090_3);
+extern cpuop_func CPUOP_NAME(op_4098_3);
+extern cpuop_func CPUOP_NAME(op_40a0_3);
+extern cpuop_func CPUOP_NAME(op_40a8_3);
+extern cpuop_func CPUOP_NAME(op_40b0_3);
+extern cpuop_func CPUOP_NAME(op_40b8_3);
+extern cpuop_func CPUOP_NAME(op_40b9_3);
+extern cpuop_func CPUOP_NAME(op_40c0_3);
+extern cpuop_func CPUOP_NAME(op_40d0_3);
+extern cpuop_func CPUOP_NAME(op_40d8_3);
+extern cpuop_func CPUOP_NAME(op_40e0_3);
+extern cpuop_func CPUOP_NAME(op_40e8_3);
+extern cpuop_func CPUOP_NAME(op_40f0_3);
+extern cpuop_func CPUOP_NAME(op_40f8_3);
+extern cpuop_func CPUOP_NAME(op_40f9_3);
+extern cpuop_func CPUOP_NAME(op_4100_3);
+extern cpuop_func CPUOP_NAME(op_4110_3);
+extern cpuop_func CPUOP_NAME(op_4118_3);
+extern cpuop_func CPUOP_NAME(op_4120_3);
+extern cpuop_func CPUOP_NAME(op_4128_3);
+extern cpuop_func CPUOP_NAME(op_4130_3);
+extern cpuop_func CPUOP_NAME(op_4138_3);
+extern cpuop_func CPUOP_NAME(op_4139_3);
+extern cpuop_func CPUOP_NAME(op_413a_3);
+extern cpuop_func CPUOP_NAME(op_413b_3);
+extern cpuop_func CPUOP_NAME(op_413c_3);
+extern cpuop_func CPUOP_NAME(op_4180_3);
+extern cpuop_func CPUOP_NAME(op_4190_3);
+extern cpuop_func CPUOP_NAME(op_4198_3);
+extern cpuop_func CPUOP_NAME(op_41a0_3);
+extern cpuop_func CPUOP_NAME(op_41a8_3);
+extern cpuop_func CPUOP_NAME(op_41b0_3);
+extern cpuop_func CPUOP_NAME(op_41b8_3);
+extern cpuop_func CPUOP_NAME(op_41b9_3);
+extern cpuop_func CPUOP_NAME(op_41ba_3);
+extern cpuop_func CPUOP_NAME(op_41bb_3);
+extern cpuop_func CPUOP_NAME(op_41bc_3);
+extern cpuop_func CPUOP_NAME(op_41d0_3);
+extern cpuop_func CPUOP_NAME(op_41e8_3);
+extern cpuop_func CPUOP_NAME(op_41f0_3);
+extern cpuop_func CPUOP_NAME(op_41f8_3);
+extern cpuop_func CPUOP_NAME(op_41f9_3);
+extern cpuop_func CPUOP_NAME(op_41fa_3);
+extern cpuop_func CPUOP_NAME(op_41fb_3);
+extern cpuop_func CPUOP_NAME(op_4200_3);
+extern cpuop_func CPUOP_NAME(op_4210_3);
+extern cpuop_func CPUOP_NAME(op_4218_3);
+extern cpuop_func CPUOP_NAME(op_4220_3);
+extern cpuop_func CPUOP_NAME(op_4228_3);
+extern cpuop_func CPUOP_NAME(op_4230_3);
+extern cpuop_func CPUOP_NAME(op_4238_3);
+extern cpuop_func CPUOP_NAME(op_4239_3);
+extern cpuop_func CPUOP_NAME(op_4240_3);
+extern cpuop_func CPUOP_NAME(op_4250_3);
+extern cpuop_func CPUOP_NAME(op_4258_3);
+extern cpuop_func CPUOP_NAME(op_4260_3);
+extern cpuop_func CPUOP_NAME(op_4268_3);
+extern cpuop_func CPUOP_NAME(op_4270_3);
+extern cpuop_func CPUOP_NAME(op_4278_3);
+extern cpuop_func CPUOP_NAME(op_4279_3);
+extern cpuop_func CPUOP_NAME(op_4280_3);
+extern cpuop_func CPUOP_NAME(op_4290_3);
+extern cpuop_func CPUOP_NAME(op_4298_3);
+extern cpuop_func CPUOP_NAME(op_42a0_3);
+extern cpuop_func CPUOP_NAME(op_42a8_3);
+extern cpuop_func CPUOP_NAME(op_42b0_3);
+extern cpuop_func CPUOP_NAME(op_42b8_3);
+extern cpuop_func CPUOP_NAME(op_42b9_3);
+extern cpuop_func CPUOP_NAME(op_4400_3);
+extern cpuop_func CPUOP_NAME(op_4410_3);
+extern cpuop_func CPUOP_NAME(op_4418_3);
+extern cpuop_func CPUOP_NAME(op_4420_3);
+extern cpuop_func CPUOP_NAME(op_4428_3);
+extern cpuop_func CPUOP_NAME(op_4430_3);
+extern cpuop_func CPUOP_NAME(op_4438_3);
+extern cpuop_func CPUOP_NAME(op_4439_3);
+extern cpuop_func CPUOP_NAME(op_4440_3);
+extern cpuop_func CPUOP_NAME(op_4450_3);
+extern cpuop_func CPUOP_NAME(op_4458_3);
+extern cpuop_func CPUOP_NAME(op_4460_3);
+extern cpuop_func CPUOP_NAME(op_4468_3);
+extern cpuop_func CPUOP_NAME(op_4470_3);
+extern cpuop_func CPUOP_NAME(op_4478_3);
+extern cpuop_func CPUOP_NAME(op_4479_3);
+extern cpuop_func CPUOP_NAME(op_4480_3);
+extern cpuop_func CPUOP_NAME(op_4490_3);
+extern cpuop_func CPUOP_NAME(op_4498_3);
+extern cpuop_func CPUOP_NAME(op_44a0_3);
+extern cpuop_func CPUOP_NAME(op_44a8_3);
+extern cpuop_func CPUOP_NAME(op_44b0_3);
+extern cpuop_func CPUOP_NAME(op_44b8_3);
+extern cpuop_func CPUOP_NAME(op_44b9_3);
+extern cpuop_func CPUOP_NAME(op_44c0_3);
+extern cpuop_func CPUOP_NAME(op_44d0_3);
+extern cpuop_func CPUOP_NAME(op_44d8_3);
+extern cpuop_func CPUOP_NAME(op_44e0_3);
+extern cpuop_func CPUOP_NAME(op_44e8_3);
+extern cpuop_func CPUOP_NAME(op_44f0_3);
+extern cpuop_func CPUOP_NAME(op_44f8_3);
+extern cpuop_func CPUOP_NAME(op_44f9_3);
+extern cpuop_func CPUOP_NAME(op_44fa_3);
+extern cpuop_func CPUOP_NAME(op_44fb_3);
+extern cpuop_func CPUOP_NAME(op_44fc_3);
+extern cpuop_func CPUOP_NAME(op_4600_3);
+extern cpuop_func CPUOP_NAME(op_4610_3);
+extern cpuop_func CPUOP_NAME(op_4618_3);
+extern cpuop_func CPUOP_NAME(op_4620_3);
+extern cpuop_func CPUOP_NAME(op_4628_3);
+extern cpuop_func CPUOP_NAME(op_4630_3);
+extern cpuop_func CPUOP_NAME(op_4638_3);
+extern cpuop_func CPUOP_NAME(op_4639_3);
+extern cpuop_func CPUOP_NAME(op_4640_3);
+extern cpuop_func CPUOP_NAME(op_4650_3);
+extern cpuop_func CPUOP_NAME(op_4658_3);
+extern cpuop_func CPUOP_NAME(op_4660_3);
+extern cpuop_func CPUOP_NAME(op_4668_3);
+extern cpuop_func CPUOP_NAME(op_4670_3);
+extern cpuop_func CPUOP_NAME(op_4678_3);
+extern cpuop_func CPUOP_NAME(op_4679_3);
+extern cpuop_func CPUOP_NAME(op_4680_3);
+extern cpuop_func CPUOP_NAME(op_4690_3);
+extern cpuop_func CPUOP_NAME(op_4698_3);
+extern cpuop_func CPUOP_NAME(op_46a0_3);
+extern cpuop_func CPUOP_NAME(op_46a8_3);
+extern cpuop_func CPUOP_NAME(op_46b0_3);
+extern cpuop_func CPUOP_NAME(op_46b8_3);
+extern cpuop_func CPUOP_NAME(op_46b9_3);
+extern cpuop_func CPUOP_NAME(op_46c0_3);
+extern cpuop_func CPUOP_NAME(op_46d0_3);
+extern cpuop_func CPUOP_NAME(op_46d8_3);
+extern cpuop_func CPUOP_NAME(op_46e0_3);
+extern cpuop_func CPUOP_NAME(op_46e8_3);
+extern cpuop_func CPUOP_NAME(op_46f0_3);
+extern cpuop_func CPUOP_NAME(op_46f8_3);
+extern cpuop_func CPUOP_NAME(op_46f9_3);
+extern cpuop_func CPUOP_NAME(op_46fa_3);
+extern cpuop_func CPUOP_NAME(op_46fb_3);
+extern cpuop_func CPUOP_NAME(op_46fc_3);
+extern cpuop_func CPUOP_NAME(op_4800_3);
+extern cpuop_func CPUOP_NAME(op_4810_3);
+extern cpuop_func CPUOP_NAME(op_4818_3);
+extern cpuop_func CPUOP_NAME(op_4820_3);
+extern cpuop_func CPUOP_NAME(op_4828_3);
+extern cpuop_func CPUOP_NAME(op_4830_3);
+extern cpuop_func CPUOP_NAME(op_4838_3);
+extern cpuop_func CPUOP_NAME(op_4839_3);
+extern cpuop_func CPUOP_NAME(op_4840_3);
+extern cpuop_func CPUOP_NAME(op_4850_3);
+extern cpuop_func CPUOP_NAME(op_4868_3);
+extern cpuop_func CPUOP_NAME(op_4870_3);
+extern cpuop_func CPUOP_NAME(op_4878_3);
+extern cpuop_func CPUOP_NAME(op_4879_3);
+extern cpuop_func CPUOP_NAME(op_487a_3);
+extern cpuop_func CPUOP_NAME(op_487b_3);
+extern cpuop_func CPUOP_NAME(op_4880_3);
+extern cpuop_func CPUOP_NAME(op_4890_3);
+extern cpuop_func CPUOP_NAME(op_48a0_3);
+extern cpuop_func CPUOP_NAME(op_48a8_3);
+extern cpuop_func CPUOP_NAME(op_48b0_3);
+extern cpuop_func CPUOP_NAME(op_48b8_3);
+extern cpuop_func CPUOP_NAME(op_48b9_3);
+extern cpuop_func CPUOP_NAME(op_48c0_3);
+extern cpuop_func CPUOP_NAME(op_48d0_3);
+extern cpuop_func CPUOP_NAME(op_48e0_3);
+extern cpuop_func CPUOP_NAME(op_48e8_3);
+extern cpuop_func CPUOP_NAME(op_48f0_3);
+extern cpuop_func CPUOP_NAME(op_48f8_3);
+extern cpuop_func CPUOP_NAME(op_48f9_3);
+extern cpuop_func CPUOP_NAME(op_49c0_3);
+extern cpuop_func CPUOP_NAME(op_4a00_3);
+extern cpuop_func CPUOP_NAME(op_4a10_3);
+extern cpuop_func CPUOP_NAME(op_4a18_3);
+extern cpuop_func CPUOP_NAME(op_4a20_3);
+extern cpuop_func CPUOP_NAME(op_4a28_3);
+extern cpuop_func CPUOP_NAME(op_4a30_3);
+extern cpuop_func CPUOP_NAME(op_4a38_3);
+extern cpuop_func CPUOP_NAME(op_4a39_3);
+extern cpuop_func CPUOP_NAME(op_4a3a_3);
+extern cpuop_func CPUOP_NAME(op_4a3b_3);
+extern cpuop_func CPUOP_NAME(op_4a3c_3);
+extern cpuop_func CPUOP_NAME(op_4a40_3);
+extern cpuop_func CPUOP_NAME(op_4a48_3);
+extern cpuop_func CPUOP_NAME(op_4a50_3);
+extern cpuop_func CPUOP_NAME(op_4a58_3);
+extern cpuop_func CPUOP_NAME(op_4a60_3);
+extern cpuop_func CPUOP_NAME(op_4a68_3);
+extern cpuop_func CPUOP_NAME(op_4a70_3);
+extern cpuop_func CPUOP_NAME(op_4a78_3);
+extern cpuop_func CPUOP_NAME(op_4a79_3);
+extern cpuop_func CPUOP_NAME(op_4a7a_3);
+extern cpuop_func CPUOP_NAME(op_4a7b_3);
+extern cpuop_func CPUOP_NAME(op_4a7c_3);
+extern cpuop_func CPUOP_NAME(op_4a80_3);
+extern cpuop_func CPUOP_NAME(op_4a88_3);
+extern cpuop_func CPUOP_NAME(op_4a90_3);
+extern cpuop_func CPUOP_NAME(op_4a98_3);
+extern cpuop_func CPUOP_NAME(op_4aa0_3);
+extern cpuop_func CPUOP_NAME(op_4aa8_3);
+extern cpuop_func CPUOP_NAME(op_4ab0_3);
+extern cpuop_func CPUOP_NAME(op_4ab8_3);
+extern cpuop_func CPUOP_NAME(op_4ab9_3);
+extern cpuop_func CPUOP_NAME(op_4aba_3);
+extern cpuop_func CPUOP_NAME(op_4abb_3);
+extern cpuop_func CPUOP_NAME(op_4abc_3);
+extern cpuop_func CPUOP_NAME(op_4ac0_3);
+extern cpuop_func CPUOP_NAME(op_4ad0_3);
+extern cpuop_func CPUOP_NAME(op_4ad8_3);
+extern cpuop_func CPUOP_NAME(op_4ae0_3);
+extern cpuop_func CPUOP_NAME(op_4ae8_3);
+extern cpuop_func CPUOP_NAME(op_4af0_3);
+extern cpuop_func CPUOP_NAME(op_4af8_3);
+extern cpuop_func CPUOP_NAME(op_4af9_3);
+extern cpuop_func CPUOP_NAME(op_4c90_3);
+extern cpuop_func CPUOP_NAME(op_4c98_3);
+extern cpuop_func CPUOP_NAME(op_4ca8_3);
+extern cpuop_func CPUOP_NAME(op_4cb0_3);
+extern cpuop_func CPUOP_NAME(op_4cb8_3);
+extern cpuop_func CPUOP_NAME(op_4cb9_3);
+extern cpuop_func CPUOP_NAME(op_4cba_3);
+extern cpuop_func CPUOP_NAME(op_4cbb_3);
+extern cpuop_func CPUOP_NAME(op_4cd0_3);
+extern cpuop_func CPUOP_NAME(op_4cd8_3);
+extern cpuop_func CPUOP_NAME(op_4ce8_3);
+extern cpuop_func CPUOP_NAME(op_4cf0_3);
+extern cpuop_func CPUOP_NAME(op_4cf8_3);
+extern cpuop_func CPUOP_NAME(op_4cf9_3);
+extern cpuop_func CPUOP_NAME(op_4cfa_3);
+extern cpuop_func CPUOP_NAME(op_4cfb_3);
+extern cpuop_func CPUOP_NAME(op_4e40_3);
+extern cpuop_func CPUOP_NAME(op_4e50_3);
+extern cpuop_func CPUOP_NAME(op_4e58_3);
+extern cpuop_func CPUOP_NAME(op_4e60_3);
+extern cpuop_func CPUOP_NAME(op_4e68_3);
+extern cpuop_func CPUOP_NAME(op_4e70_3);
+extern cpuop_func CPUOP_NAME(op_4e71_3);
+extern cpuop_func CPUOP_NAME(op_4e72_3);
+extern cpuop_func CPUOP_NAME(op_4e73_3);
+extern cpuop_func CPUOP_NAME(op_4e74_3);
+extern cpuop_func CPUOP_NAME(op_4e75_3);
+extern cpuop_func CPUOP_NAME(op_4e76_3);
+extern cpuop_func CPUOP_NAME(op_4e77_3);
+extern cpuop_func CPUOP_NAME(op_4e90_3);
+extern cpuop_func CPUOP_NAME(op_4ea8_3);
+extern cpuop_func CPUOP_NAME(op_4eb0_3);
+extern cpuop_func CPUOP_NAME(op_4eb8_3);
+extern cpuop_func CPUOP_NAME(op_4eb9_3);
+extern cpuop_func CPUOP_NAME(op_4eba_3);
+extern cpuop_func CPUOP_NAME(op_4ebb_3);
+extern cpuop_func CPUOP_NAME(op_4ed0_3);
+extern cpuop_func CPUOP_NAME(op_4ee8_3);
+extern cpuop_func CPUOP_NAME(op_4ef0_3);
+extern cpuop_func CPUOP_NAME(op_4ef8_3);
+extern cpuop_func CPUOP_NAME(op_4ef9_3);
+extern cpuop_func CPUOP_NAME(op_4efa_3);
+extern cpuop_func CPUOP_NAME(op_4efb_3);
+extern cpuop_func CPUOP_NAME(op_5000_3);
+extern cpuop_func CPUOP_NAME(op_5010_3);
+extern cpuop_func CPUOP_NAME(op_5018_3);
+extern cpuop_func CPUOP_NAME(op_5020_3);
+extern cpuop_func CPUOP_NAME(op_5028_3);
+extern cpuop_func CPUOP_NAME(op_5030_3);
+extern cpuop_func CPUOP_NAME(op_5038_3);
+extern cpuop_func CPUOP_NAME(op_5039_3);
+extern cpuop_func CPUOP_NAME(op_5040_3);
+extern cpuop_func CPUOP_NAME(op_5048_3);
+extern cpuop_func CPUOP_NAME(op_5050_3);
+extern cpuop_func CPUOP_NAME(op_5058_3);
+extern cpuop_func CPUOP_NAME(op_5060_3);
+extern cpuop_func CPUOP_NAME(op_5068_3);
+extern cpuop_func CPUOP_NAME(op_5070_3);
+extern cpuop_func CPUOP_NAME(op_5078_3);
+extern cpuop_func CPUOP_NAME(op_5079_3);
+extern cpuop_func CPUOP_NAME(op_5080_3);
+extern cpuop_func CPUOP_NAME(op_5088_3);
+extern cpuop_func CPUOP_NAME(op_5090_3);
+extern cpuop_func CPUOP_NAME(op_5098_3);
+extern cpuop_func CPUOP_NAME(op_50a0_3);
+extern cpuop_func CPUOP_NAME(op_50a8_3);
+extern cpuop_func CPUOP_NAME(op_50b0_3);
+extern cpuop_func CPUOP_NAME(op_50b8_3);
+extern cpuop_func CPUOP_NAME(op_50b9_3);
+extern cpuop_func CPUOP_NAME(op_50c0_3);
+extern cpuop_func CPUOP_NAME(op_50c8_3);
+extern cpuop_func CPUOP_NAME(op_50d0_3);
+extern cpuop_func CPUOP_NAME(op_50d8_3);
+extern cpuop_func CPUOP_NAME(op_50e0_3);
+extern cpuop_func CPUOP_NAME(op_50e8_3);
+extern cpuop_func CPUOP_NAME(op_50f0_3);
+extern cpuop_func CPUOP_NAME(op_50f8_3);
+extern cpuop_func CPUOP_NAME(op_50f9_3);
+extern cpuop_func CPUOP_NAME(op_5100_3);
+extern cpuop_func CPUOP_NAME(op_5110_3);
+extern cpuop_func CPUOP_NAME(op_5118_3);
+extern cpuop_func CPUOP_NAME(op_5120_3);
+extern cpuop_func CPUOP_NAME(op_5128_3);
+extern cpuop_func CPUOP_NAME(op_5130_3);
+extern cpuop_func CPUOP_NAME(op_5138_3);
+extern cpuop_func CPUOP_NAME(op_5139_3);
+extern cpuop_func CPUOP_NAME(op_5140_3);
+extern cpuop_func CPUOP_NAME(op_5148_3);
+extern cpuop_func CPUOP_NAME(op_5150_3);
+extern cpuop_func CPUOP_NAME(op_5158_3);
+extern cpuop_func CPUOP_NAME(op_5160_3);
+extern cpuop_func CPUOP_NAME(op_5168_3);
+extern cpuop_func CPUOP_NAME(op_5170_3);
+extern cpuop_func CPUOP_NAME(op_5178_3);
+extern cpuop_func CPUOP_NAME(op_5179_3);
+extern cpuop_func CPUOP_NAME(op_5180_3);
+extern cpuop_func CPUOP_NAME(op_5188_3);
+extern cpuop_func CPUOP_NAME(op_5190_3);
+extern cpuop_func CPUOP_NAME(op_5198_3);
+extern cpuop_func CPUOP_NAME(op_51a0_3);
+extern cpuop_func CPUOP_NAME(op_51a8_3);
+extern cpuop_func CPUOP_NAME(op_51b0_3);
+extern cpuop_func CPUOP_NAME(op_51b8_3);
+extern cpuop_func CPUOP_NAME(op_51b9_3);
+extern cpuop_func CPUOP_NAME(op_51c0_3);
+extern cpuop_func CPUOP_NAME(op_51c8_3);
+extern cpuop_func CPUOP_NAME(op_51d0_3);
+extern cpuop_func CPUOP_NAME(op_51d8_3);
+extern cpuop_func CPUOP_NAME(op_51e0_3);
+extern cpuop_func CPUOP_NAME(op_51e8_3);
+extern cpuop_func CPUOP_NAME(op_51f0_3);
+extern cpuop_func CPUOP_NAME(op_51f8_3);
+extern cpuop_func CPUOP_NAME(op_51f9_3);
+extern cpuop_func CPUOP_NAME(op_52c0_3);
+extern cpuop_func CPUOP_NAME(op_52c8_3);
+extern cpuop_func CPUOP_NAME(op_52d0_3);
+extern cpuop_func CPUOP_NAME(op_52d8_3);
+extern cpuop_func CPUOP_NAME(op_52e0_3);
+extern cpuop_func CPUOP_NAME(op_52e8_3);
+extern cpuop_func CPUOP_NAME(op_52f0_3);
+extern cpuop_func CPUOP_NAME(op_52f8_3);
+extern cpuop_func CPUOP_NAME(op_52f9_3);
+extern cpuop_func CPUOP_NAME(op_53c0_3);
+extern cpuop_func CPUOP_NAME(op_53c8_3);
+extern cpuop_func CPUOP_NAME(op_53d0_3);
+extern cpuop_func CPUOP_NAME(op_53d8_3);
+extern cpuop_func CPUOP_NAME(op_53e0_3);
+extern cpuop_func CPUOP_NAME(op_53e8_3);
+extern cpuop_func CPUOP_NAME(op_53f0_3);
+extern cpuop_func CPUOP_NAME(op_53f8_3);
+extern cpuop_func CPUOP_NAME(op_53f9_3);
+extern cpuop_func CPUOP_NAME(op_54c0_3);
+extern cpuop_func CPUOP_NAME(op_54c8_3);
+extern cpuop_func CPUOP_NAME(op_54d0_3);
+extern cpuop_func CPUOP_NAME(op_54d8_3);
+extern cpuop_func CPUOP_NAME(op_54e0_3);
+extern cpuop_func CPUOP_NAME(op_54e8_3);
+extern cpuop_func CPUOP_NAME(op_54f0_3);
+extern cpuop_func CPUOP_NAME(op_54f8_3);
+extern cpuop_func CPUOP_NAME(op_54f9_3);
+extern cpuop_func CPUOP_NAME(op_55c0_3);
+extern cpuop_func CPUOP_NAME(op_55c8_3);
+extern cpuop_func CPUOP_NAME(op_55d0_3);
+extern cpuop_func CPUOP_NAME(op_55d8_3);
+extern cpuop_func CPUOP_NAME(op_55e0_3);
+extern cpuop_func CPUOP_NAME(op_55e8_3);
+extern cpuop_func CPUOP_NAME(op_55f0_3);
+extern cpuop_func CPUOP_NAME(op_55f8_3);
+extern cpuop_func CPUOP_NAME(op_55f9_3);
+extern cpuop_func CPUOP_NAME(op_56c0_3);
+extern cpuop_func CPUOP_NAME(op_56c8_3);
+extern cpuop_func CPUOP_NAME(op_56d0_3);
+extern cpuop_func CPUOP_NAME(op_56d8_3);
+extern cpuop_func CPUOP_NAME(op_56e0_3);
+extern cpuop_func CPUOP_NAME(op_56e8_3);
+extern cpuop_func CPUOP_NAME(op_56f0_3);
+extern cpuop_func CPUOP_NAME(op_56f8_3);
+extern cpuop_func CPUOP_NAME(op_56f9_3);
+extern cpuop_func CPUOP_NAME(op_57c0_3);
+extern cpuop_func CPUOP_NAME(op_57c8_3);
+extern cpuop_func CPUOP_NAME(op_57d0_3);
+extern cpuop_func CPUOP_NAME(op_57d8_3);
+extern cpuop_func CPUOP_NAME(op_57e0_3);
+extern cpuop_func CPUOP_NAME(op_57e8_3);
+extern cpuop_func CPUOP_NAME(op_57f0_3);
+extern cpuop_func CPUOP_NAME(op_57f8_3);
+extern cpuop_func CPUOP_NAME(op_57f9_3);
+extern cpuop_func CPUOP_NAME(op_58c0_3);
+extern cpuop_func CPUOP_NAME(op_58c8_3);
+extern cpuop_func CPUOP_NAME(op_58d0_3);
+extern cpuop_func CPUOP_NAME(op_58d8_3);
+extern cpuop_func CPUOP_NAME(op_58e0_3);
+extern cpuop_func CPUOP_NAME(op_58e8_3);
+extern cpuop_func CPUOP_NAME(op_58f0_3);
+extern cpuop_func CPUOP_NAME(op_58f8_3);
+extern cpuop_func CPUOP_NAME(op_58f9_3);
+extern cpuop_func CPUOP_NAME(op_59c0_3);
+extern cpuop_func CPUOP_NAME(op_59c8_3);
+extern cpuop_func CPUOP_NAME(op_59d0_3);
+extern cpuop_func CPUOP_NAME(op_59d8_3);
+extern cpuop_func CPUOP_NAME(op_59e0_3);
+extern cpuop_func CPUOP_NAME(op_59e8_3);
+extern cpuop_func CPUOP_NAME(op_59f0_3);
+extern cpuop_func CPUOP_NAME(op_59f8_3);
+extern cpuop_func CPUOP_NAME(op_59f9_3);
+extern cpuop_func CPUOP_NAME(op_5ac0_3);
+extern cpuop_func CPUOP_NAME(op_5ac8_3);
+extern cpuop_func CPUOP_NAME(op_5ad0_3);
+extern cpuop_func CPUOP_NAME(op_5ad8_3);
+extern cpuop_func CPUOP_NAME(op_5ae0_3);
+extern cpuop_func CPUOP_NAME(op_5ae8_3);
+extern cpuop_func CPUOP_NAME(op_5af0_3);
+extern cpuop_func CPUOP_NAME(op_5af8_3);
+extern cpuop_func CPUOP_NAME(op_5af9_3);
+extern cpuop_func CPUOP_NAME(op_5bc0_3);
+extern cpuop_func CPUOP_NAME(op_5bc8_3);
+extern cpuop_func CPUOP_NAME(op_5bd0_3);
+extern cpuop_func CPUOP_NAME(op_5bd8_3);
+extern cpuop_func CPUOP_NAME(op_5be0_3);
+extern cpuop_func CPUOP_NAME(op_5be8_3);
+extern cpuop_func CPUOP_NAME(op_5bf0_3);
+extern cpuop_func CPUOP_NAME(op_5bf8_3);
+extern cpuop_func CPUOP_NAME(op_5bf9_3);
+extern cpuop_func CPUOP_NAME(op_5cc0_3);
+extern cpuop_func CPUOP_NAME(op_5cc8_3);
+extern cpuop_func CPUOP_NAME(op_5cd0_3);
+extern cpuop_func CPUOP_NAME(op_5cd8_3);
+extern cpuop_func CPUOP_NAME(op_5ce0_3);
+extern cpuop_func CPUOP_NAME(op_5ce8_3);
+extern cpuop_func CPUOP_NAME(op_5cf0_3);
+extern cpuop_func CPUOP_NAME(op_5cf8_3);
+extern cpuop_func CPUOP_NAME(op_5cf9_3);
+extern cpuop_func CPUOP_NAME(op_5dc0_3);
+extern cpuop_func CPUOP_NAME(op_5dc8_3);
+extern cpuop_func CPUOP_NAME(op_5dd0_3);
+extern cpuop_func CPUOP_NAME(op_5dd8_3);
+extern cpuop_func CPUOP_NAME(op_5de0_3);
+extern cpuop_func CPUOP_NAME(op_5de8_3);
+extern cpuop_func CPUOP_NAME(op_5df0_3);
+extern cpuop_func CPUOP_NAME(op_5df8_3);
+extern cpuop_func CPUOP_NAME(op_5df9_3);
+extern cpuop_func CPUOP_NAME(op_5ec0_3);
+extern cpuop_func CPUOP_NAME(op_5ec8_3);
+extern cpuop_func CPUOP_NAME(op_5ed0_3);
+extern cpuop_func CPUOP_NAME(op_5ed8_3);
+extern cpuop_func CPUOP_NAME(op_5ee0_3);
+extern cpuop_func CPUOP_NAME(op_5ee8_3);
+extern cpuop_func CPUOP_NAME(op_5ef0_3);
+extern cpuop_func CPUOP_NAME(op_5ef8_3);
+extern cpuop_func CPUOP_NAME(op_5ef9_3);
+extern cpuop_func CPUOP_NAME(op_5fc0_3);
+extern cpuop_func CPUOP_NAME(op_5fc8_3);
+extern cpuop_func CPUOP_NAME(op_5fd0_3);
+extern cpuop_func CPUOP_NAME(op_5fd8_3);
+extern cpuop_func CPUOP_NAME(op_5fe0_3);
+extern cpuop_func CPUOP_NAME(op_5fe8_3);
+extern cpuop_func CPUOP_NAME(op_5ff0_3);
+extern cpuop_func CPUOP_NAME(op_5ff8_3);
+extern cpuop_func CPUOP_NAME(op_5ff9_3);
+extern cpuop_func CPUOP_NAME(op_6000_3);
+extern cpuop_func CPUOP_NAME(op_6001_3);
+extern cpuop_func CPUOP_NAME(op_60ff_3);
+extern cpuop_func CPUOP_NAME(op_6100_3);
+extern cpuop_func CPUOP_NAME(op_6101_3);
+extern cpuop_func CPUOP_NAME(op_61ff_3);
+extern cpuop_func CPUOP_NAME(op_6200_3);
+extern cpuop_func CPUOP_NAME(op_6201_3);
+extern cpuop_func CPUOP_NAME(op_62ff_3);
+extern cpuop_func CPUOP_NAME(op_6300_3);
+extern cpuop_func CPUOP_NAME(op_6301_3);
+extern cpuop_func CPUOP_NAME(op_63ff_3);
+extern cpuop_func CPUOP_NAME(op_6400_3);
+extern cpuop_func CPUOP_NAME(op_6401_3);
+extern cpuop_func CPUOP_NAME(op_64ff_3);
+extern cpuop_func CPUOP_NAME(op_6500_3);
+extern cpuop_func CPUOP_NAME(op_6501_3);
+extern cpuop_func CPUOP_NAME(op_65ff_3);
+extern cpuop_func CPUOP_NAME(op_6600_3);
+extern cpuop_func CPUOP_NAME(op_6601_3);
+extern cpuop_func CPUOP_NAME(op_66ff_3);
+extern cpuop_func CPUOP_NAME(op_6700_3);
+extern cpuop_func CPUOP_NAME(op_6701_3);
+extern cpuop_func CPUOP_NAME(op_67ff_3);
+extern cpuop_func CPUOP_NAME(op_6800_3);
+extern cpuop_func CPUOP_NAME(op_6801_3);
+extern cpuop_func CPUOP_NAME(op_68ff_3);
+extern cpuop_func CPUOP_NAME(op_6900_3);
+extern cpuop_func CPUOP_NAME(op_6901_3);
+extern cpuop_func CPUOP_NAME(op_69ff_3);
+extern cpuop_func CPUOP_NAME(op_6a00_3);
+extern cpuop_func CPUOP_NAME(op_6a01_3);
+extern cpuop_func CPUOP_NAME(op_6aff_3);
+extern cpuop_func CPUOP_NAME(op_6b00_3);
+extern cpuop_func CPUOP_NAME(op_6b01_3);
+extern cpuop_func CPUOP_NAME(op_6bff_3);
+extern cpuop_func CPUOP_NAME(op_6c00_3);
+extern cpuop_func CPUOP_NAME(op_6c01_3);
+extern cpuop_func CPUOP_NAME(op_6cff_3);
+extern cpuop_func CPUOP_NAME(op_6d00_3);
+extern cpuop_func CPUOP_NAME(op_6d01_3);
+extern cpuop_func CPUOP_NAME(op_6dff_3);
+extern cpuop_func CPUOP_NAME(op_6e00_3);
+extern cpuop_func CPUOP_NAME(op_6e01_3);
+extern cpuop_func CPUOP_NAME(op_6eff_3);
+extern cpuop_func CPUOP_NAME(op_6f00_3);
+extern cpuop_func CPUOP_NAME(op_6f01_3);
+extern cpuop_func CPUOP_NAME(op_6fff_3);
+extern cpuop_func CPUOP_NAME(op_7000_3);
+extern cpuop_func CPUOP_NAME(op_8000_3);
+extern cpuop_func CPUOP_NAME(op_8010_3);
+extern cpuop_func CPUOP_NAME(op_8018_3);
+extern cpuop_func CPUOP_NAME(op_8020_3);
+extern cpuop_func CPUOP_NAME(op_8028_3);
+extern cpuop_func CPUOP_NAME(op_8030_3);
+extern cpuop_func CPUOP_NAME(op_8038_3);
+extern cpuop_func CPUOP_NAME(op_8039_3);
+extern cpuop_func CPUOP_NAME(op_803a_3);
+extern cpuop_func CPUOP_NAME(op_803b_3);
+extern cpuop_func CPUOP_NAME(op_803c_3);
+extern cpuop_func CPUOP_NAME(op_8040_3);
+extern cpuop_func CPUOP_NAME(op_8050_3);
+extern cpuop_func CPUOP_NAME(op_8058_3);
+extern cpuop_func CPUOP_NAME(op_8060_3);
+extern cpuop_func CPUOP_NAME(op_8068_3);
+extern cpuop_func CPUOP_NAME(op_8070_3);
+extern cpuop_func CPUOP_NAME(op_8078_3);
+extern cpuop_func CPUOP_NAME(op_8079_3);
+extern cpuop_func CPUOP_NAME(op_807a_3);
+extern cpuop_func CPUOP_NAME(op_807b_3);
+extern cpuop_func CPUOP_NAME(op_807c_3);
+extern cpuop_func CPUOP_NAME(op_8080_3);
+extern cpuop_func CPUOP_NAME(op_8090_3);
+extern cpuop_func CPUOP_NAME(op_8098_3);
+extern cpuop_func CPUOP_NAME(op_80a0_3);
+extern cpuop_func CPUOP_NAME(op_80a8_3);
+extern cpuop_func CPUOP_NAME(op_80b0_3);
+extern cpuop_func CPUOP_NAME(op_80b8_3);
+extern cpuop_func CPUOP_NAME(op_80b9_3);
+extern cpuop_func CPUOP_NAME(op_80ba_3);
+extern cpuop_func CPUOP_NAME(op_80bb_3);
+extern cpuop_func CPUOP_NAME(op_80bc_3);
+extern cpuop_func CPUOP_NAME(op_80c0_3);
+extern cpuop_func CPUOP_NAME(op_80d0_3);
+extern cpuop_func CPUOP_NAME(op_80d8_3);
+extern cpuop_func CPUOP_NAME(op_80e0_3);
+extern cpuop_func CPUOP_NAME(op_80e8_3);
+extern cpuop_func CPUOP_NAME(op_80f0_3);
+extern cpuop_func CPUOP_NAME(op_80f8_3);
+extern cpuop_func CPUOP_NAME(op_80f9_3);
+extern cpuop_func CPUOP_NAME(op_80fa_3);
+extern cpuop_func CPUOP_NAME(op_80fb_3);
+extern cpuop_func CPUOP_NAME(op_80fc_3);
+extern cpuop_func CPUOP_NAME(op_8100_3);
+extern cpuop_func CPUOP_NAME(op_8108_3);
+extern cpuop_func CPUOP_NAME(op_8110_3);
+extern cpuop_func CPUOP_NAME(op_8118_3);
+extern cpuop_func CPUOP_NAME(op_8120_3);
+extern cpuop_func CPUOP_NAME(op_8128_3);
+extern cpuop_func CPUOP_NAME(op_8130_3);
+extern cpuop_func CPUOP_NAME(op_8138_3);
+extern cpuop_func CPUOP_NAME(op_8139_3);
+extern cpuop_func CPUOP_NAME(op_8150_3);
+extern cpuop_func CPUOP_NAME(op_8158_3);
+extern cpuop_func CPUOP_NAME(op_8160_3);
+extern cpuop_func CPUOP_NAME(op_8168_3);
+extern cpuop_func CPUOP_NAME(op_8170_3);
+extern cpuop_func CPUOP_NAME(op_8178_3);
+extern cpuop_func CPUOP_NAME(op_8179_3);
+extern cpuop_func CPUOP_NAME(op_8190_3);
+extern cpuop_func CPUOP_NAME(op_8198_3);
+extern cpuop_func CPUOP_NAME(op_81a0_3);
+extern cpuop_func CPUOP_NAME(op_81a8_3);
+extern cpuop_func CPUOP_NAME(op_81b0_3);
+extern cpuop_func CPUOP_NAME(op_81b8_3);
+extern cpuop_func CPUOP_NAME(op_81b9_3);
+extern cpuop_func CPUOP_NAME(op_81c0_3);
+extern cpuop_func CPUOP_NAME(op_81d0_3);
+extern cpuop_func CPUOP_NAME(op_81d8_3);
+extern cpuop_func CPUOP_NAME(op_81e0_3);
+extern cpuop_func CPUOP_NAME(op_81e8_3);
+extern cpuop_func CPUOP_NAME(op_81f0_3);
+extern cpuop_func CPUOP_NAME(op_81f8_3);
+extern cpuop_func CPUOP_NAME(op_81f9_3);
+extern cpuop_func CPUOP_NAME(op_81fa_3);
+extern cpuop_func CPUOP_NAME(op_81fb_3);
+extern cpuop_func CPUOP_NAME(op_81fc_3);
+extern cpuop_func CPUOP_NAME(op_9000_3);
+extern cpuop_func CPUOP_NAME(op_9010_3);
+extern cpuop_func CPUOP_NAME(op_9018_3);
+extern cpuop_func CPUOP_NAME(op_9020_3);
+extern cpuop_func CPUOP_NAME(op_9028_3);
+extern cpuop_func CPUOP_NAME(op_9030_3);
+extern cpuop_func CPUOP_NAME(op_9038_3);
+extern cpuop_func CPUOP_NAME(op_9039_3);
+extern cpuop_func CPUOP_NAME(op_903a_3);
+extern cpuop_func CPUOP_NAME(op_903b_3);
+extern cpuop_func CPUOP_NAME(op_903c_3);
+extern cpuop_func CPUOP_NAME(op_9040_3);
+extern cpuop_func CPUOP_NAME(op_9048_3);
+extern cpuop_func CPUOP_NAME(op_9050_3);
+extern cpuop_func CPUOP_NAME(op_9058_3);
+extern cpuop_func CPUOP_NAME(op_9060_3);
+extern cpuop_func CPUOP_NAME(op_9068_3);
+extern cpuop_func CPUOP_NAME(op_9070_3);
+extern cpuop_func CPUOP_NAME(op_9078_3);
+extern cpuop_func CPUOP_NAME(op_9079_3);
+extern cpuop_func CPUOP_NAME(op_907a_3);
+extern cpuop_func CPUOP_NAME(op_907b_3);
+extern cpuop_func CPUOP_NAME(op_907c_3);
+extern cpuop_func CPUOP_NAME(op_9080_3);
+extern cpuop_func CPUOP_NAME(op_9088_3);
+extern cpuop_func CPUOP_NAME(op_9090_3);
+extern cpuop_func CPUOP_NAME(op_9098_3);
+extern cpuop_func CPUOP_NAME(op_90a0_3);
+extern cpuop_func CPUOP_NAME(op_90a8_3);
+extern cpuop_func CPUOP_NAME(op_90b0_3);
+extern cpuop_func CPUOP_NAME(op_90b8_3);
+extern cpuop_func CPUOP_NAME(op_90b9_3);
+extern cpuop_func CPUOP_NAME(op_90ba_3);
+extern cpuop_func CPUOP_NAME(op_90bb_3);
+extern cpuop_func CPUOP_NAME(op_90bc_3);
+extern cpuop_func CPUOP_NAME(op_90c0_3);
+extern cpuop_func CPUOP_NAME(op_90c8_3);
+extern cpuop_func CPUOP_NAME(op_90d0_3);
+extern cpuop_func CPUOP_NAME(op_90d8_3);
+extern cpuop_func CPUOP_NAME(op_90e0_3);
+extern cpuop_func CPUOP_NAME(op_90e8_3);
+extern cpuop_func CPUOP_NAME(op_90f0_3);
+extern cpuop_func CPUOP_NAME(op_90f8_3);
+extern cpuop_func CPUOP_NAME(op_90f9_3);
+extern cpuop_func CPUOP_NAME(op_90fa_3);
+extern cpuop_func CPUOP_NAME(op_90fb_3);
+extern cpuop_func CPUOP_NAME(op_90fc_3);
+extern cpuop_func CPUOP_NAME(op_9100_3);
+extern cpuop_func CPUOP_NAME(op_9108_3);
+extern cpuop_func CPUOP_NAME(op_9110_3);
+extern cpuop_func CPUOP_NAME(op_9118_3);
+extern cpuop_func CPUOP_NAME(op_9120_3);
+extern cpuop_func CPUOP_NAME(op_9128_3);
+extern cpuop_func CPUOP_NAME(op_9130_3);
+extern cpuop_func CPUOP_NAME(op_9138_3);
+extern cpuop_func CPUOP_NAME(op_9139_3);
+extern cpuop_func CPUOP_NAME(op_9140_3);
+extern cpuop_func CPUOP_NAME(op_9148_3);
+extern cpuop_func CPUOP_NAME(op_9150_3);
+extern cpuop_func CPUOP_NAME(op_9158_3);
+extern cpuop_func CPUOP_NAME(op_9160_3);
+extern cpuop_func CPUOP_NAME(op_9168_3);
+extern cpuop_func CPUOP_NAME(op_9170_3);
+extern cpuop_func CPUOP_NAME(op_9178_3);
+extern cpuop_func CPUOP_NAME(op_9179_3);
+extern cpuop_func CPUOP_NAME(op_9180_3);
+extern cpuop_func CPUOP_NAME(op_9188_3);
+extern cpuop_func CPUOP_NAME(op_9190_3);
+extern cpuop_func CPUOP_NAME(op_9198_3);
+extern cpuop_func CPUOP_NAME(op_91a0_3);
+extern cpuop_func CPUOP_NAME(op_91a8_3);
+extern cpuop_func CPUOP_NAME(op_91b0_3);
+extern cpuop_func CPUOP_NAME(op_91b8_3);
+extern cpuop_func CPUOP_NAME(op_91b9_3);
+extern cpuop_func CPUOP_NAME(op_91c0_3);
+extern cpuop_func CPUOP_NAME(op_91c8_3);
+extern cpuop_func CPUOP_NAME(op_91d0_3);
+extern cpuop_func CPUOP_NAME(op_91d8_3);
+extern cpuop_func CPUOP_NAME(op_91e0_3);
+extern cpuop_func CPUOP_NAME(op_91e8_3);
+extern cpuop_func CPUOP_NAME(op_91f0_3);
+extern cpuop_func CPUOP_NAME(op_91f8_3);
+extern cpuop_func CPUOP_NAME(op_91f9_3);
+extern cpuop_func CPUOP_NAME(op_91fa_3);
+extern cpuop_func CPUOP_NAME(op_91fb_3);
+extern cpuop_func CPUOP_NAME(op_91fc_3);
+extern cpuop_func CPUOP_NAME(op_b000_3);
+extern cpuop_func CPUOP_NAME(op_b010_3);
+extern cpuop_func CPUOP_NAME(op_b018_3);
+extern cpuop_func CPUOP_NAME(op_b020_3);
+extern cpuop_func CPUOP_NAME(op_b028_3);
+extern cpuop_func CPUOP_NAME(op_b030_3);
+extern cpuop_func CPUOP_NAME(op_b038_3);
+extern cpuop_func CPUOP_NAME(op_b039_3);
+extern cpuop_func CPUOP_NAME(op_b03a_3);
+extern cpuop_func CPUOP_NAME(op_b03b_3);
+extern cpuop_func CPUOP_NAME(op_b03c_3);
+extern cpuop_func CPUOP_NAME(op_b040_3);
+extern cpuop_func CPUOP_NAME(op_b048_3);
+extern cpuop_func CPUOP_NAME(op_b050_3);
+extern cpuop_func CPUOP_NAME(op_b058_3);
+extern cpuop_func CPUOP_NAME(op_b060_3);
+extern cpuop_func CPUOP_NAME(op_b068_3);
+extern cpuop_func CPUOP_NAME(op_b070_3);
+extern cpuop_func CPUOP_NAME(op_b078_3);
+extern cpuop_func CPUOP_NAME(op_b079_3);
+extern cpuop_func CPUOP_NAME(op_b07a_3);
+extern cpuop_func CPUOP_NAME(op_b07b_3);
+extern cpuop_func CPUOP_NAME(op_b07c_3);
+extern cpuop_func CPUOP_NAME(op_b080_3);
+extern cpuop_func CPUOP_NAME(op_b088_3);
+extern cpuop_func CPUOP_NAME(op_b090_3);
+extern cpuop_func CPUOP_NAME(op_b098_3);
+extern cpuop_func CPUOP_NAME(op_b0a0_3);
+extern cpuop_func CPUOP_NAME(op_b0a8_3);
+extern cpuop_func CPUOP_NAME(op_b0b0_3);
+extern cpuop_func CPUOP_NAME(op_b0b8_3);
+extern cpuop_func CPUOP_NAME(op_b0b9_3);
+extern cpuop_func CPUOP_NAME(op_b0ba_3);
+extern cpuop_func CPUOP_NAME(op_b0bb_3);
+extern cpuop_func CPUOP_NAME(op_b0bc_3);
+extern cpuop_func CPUOP_NAME(op_b0c0_3);
+extern cpuop_func CPUOP_NAME(op_b0c8_3);
+extern cpuop_func CPUOP_NAME(op_b0d0_3);
+extern cpuop_func CPUOP_NAME(op_b0d8_3);
+extern cpuop_func CPUOP_NAME(op_b0e0_3);
+extern cpuop_func CPUOP_NAME(op_b0e8_3);
+extern cpuop_func CPUOP_NAME(op_b0f0_3);
+extern cpuop_func CPUOP_NAME(op_b0f8_3);
+extern cpuop_func CPUOP_NAME(op_b0f9_3);
+extern cpuop_func CPUOP_NAME(op_b0fa_3);
+extern cpuop_func CPUOP_NAME(op_b0fb_3);
+extern cpuop_func CPUOP_NAME(op_b0fc_3);
+extern cpuop_func CPUOP_NAME(op_b100_3);
+extern cpuop_func CPUOP_NAME(op_b108_3);
+extern cpuop_func CPUOP_NAME(op_b110_3);
+extern cpuop_func CPUOP_NAME(op_b118_3);
+extern cpuop_func CPUOP_NAME(op_b120_3);
+extern cpuop_func CPUOP_NAME(op_b128_3);
+extern cpuop_func CPUOP_NAME(op_b130_3);
+extern cpuop_func CPUOP_NAME(op_b138_3);
+extern cpuop_func CPUOP_NAME(op_b139_3);
+extern cpuop_func CPUOP_NAME(op_b140_3);
+extern cpuop_func CPUOP_NAME(op_b148_3);
+extern cpuop_func CPUOP_NAME(op_b150_3);
+extern cpuop_func CPUOP_NAME(op_b158_3);
+extern cpuop_func CPUOP_NAME(op_b160_3);
+extern cpuop_func CPUOP_NAME(op_b168_3);
+extern cpuop_func CPUOP_NAME(op_b170_3);
+extern cpuop_func CPUOP_NAME(op_b178_3);
+extern cpuop_func CPUOP_NAME(op_b179_3);
+extern cpuop_func CPUOP_NAME(op_b180_3);
+extern cpuop_func CPUOP_NAME(op_b188_3);
+extern cpuop_func CPUOP_NAME(op_b190_3);
+extern cpuop_func CPUOP_NAME(op_b198_3);
+extern cpuop_func CPUOP_NAME(op_b1a0_3);
+extern cpuop_func CPUOP_NAME(op_b1a8_3);
+extern cpuop_func CPUOP_NAME(op_b1b0_3);
+extern cpuop_func CPUOP_NAME(op_b1b8_3);
+extern cpuop_func CPUOP_NAME(op_b1b9_3);
+extern cpuop_func CPUOP_NAME(op_b1c0_3);
+extern cpuop_func CPUOP_NAME(op_b1c8_3);
+extern cpuop_func CPUOP_NAME(op_b1d0_3);
+extern cpuop_func CPUOP_NAME(op_b1d8_3);
+extern cpuop_func CPUOP_NAME(op_b1e0_3);
+extern cpuop_func CPUOP_NAME(op_b1e8_3);
+extern cpuop_func CPUOP_NAME(op_b1f0_3);
+extern cpuop_func CPUOP_NAME(op_b1f8_3);
+extern cpuop_func CPUOP_NAME(op_b1f9_3);
+extern cpuop_func CPUOP_NAME(op_b1fa_3);
+extern cpuop_func CPUOP_NAME(op_b1fb_3);
+extern cpuop_func CPUOP_NAME(op_b1fc_3);
+extern cpuop_func CPUOP_NAME(op_c000_3);
+extern cpuop_func CPUOP_NAME(op_c010_3);
+extern cpuop_func CPUOP_NAME(op_c018_3);
+extern cpuop_func CPUOP_NAME(op_c020_3);
+extern cpuop_func CPUOP_NAME(op_c028_3);
+extern cpuop_func CPUOP_NAME(op_c030_3);
+extern cpuop_func CPUOP_NAME(op_c038_3);
+extern cpuop_func CPUOP_NAME(op_c039_3);
+extern cpuop_func CPUOP_NAME(op_c03a_3);
+extern cpuop_func CPUOP_NAME(op_c03b_3);
+extern cpuop_func CPUOP_NAME(op_c03c_3);
+extern cpuop_func CPUOP_NAME(op_c040_3);
+extern cpuop_func CPUOP_NAME(op_c050_3);
+extern cpuop_func CPUOP_NAME(op_c058_3);
+extern cpuop_func CPUOP_NAME(op_c060_3);
+extern cpuop_func CPUOP_NAME(op_c068_3);
+extern cpuop_func CPUOP_NAME(op_c070_3);
+extern cpuop_func CPUOP_NAME(op_c078_3);
+extern cpuop_func CPUOP_NAME(op_c079_3);
+extern cpuop_func CPUOP_NAME(op_c07a_3);
+extern cpuop_func CPUOP_NAME(op_c07b_3);
+extern cpuop_func CPUOP_NAME(op_c07c_3);
+extern cpuop_func CPUOP_NAME(op_c080_3);
+extern cpuop_func CPUOP_NAME(op_c090_3);
+extern cpuop_func CPUOP_NAME(op_c098_3);
+extern cpuop_func CPUOP_NAME(op_c0a0_3);
+extern cpuop_func CPUOP_NAME(op_c0a8_3);
+extern cpuop_func CPUOP_NAME(op_c0b0_3);
+extern cpuop_func CPUOP_NAME(op_c0b8_3);
+extern cpuop_func CPUOP_NAME(op_c0b9_3);
+extern cpuop_func CPUOP_NAME(op_c0ba_3);
+extern cpuop_func CPUOP_NAME(op_c0bb_3);
+extern cpuop_func CPUOP_NAME(op_c0bc_3);
+extern cpuop_func CPUOP_NAME(op_c0c0_3);
+extern cpuop_func CPUOP_NAME(op_c0d0_3);
+extern cpuop_func CPUOP_NAME(op_c0d8_3);
+extern cpuop_func CPUOP_NAME(op_c0e0_3);
+extern cpuop_func CPUOP_NAME(op_c0e8_3);
+extern cpuop_func CPUOP_NAME(op_c0f0_3);
+extern cpuop_func CPUOP_NAME(op_c0f8_3);
+extern cpuop_func CPUOP_NAME(op_c0f9_3);
+extern cpuop_func CPUOP_NAME(op_c0fa_3);
+extern cpuop_func CPUOP_NAME(op_c0fb_3);
+extern cpuop_func CPUOP_NAME(op_c0fc_3);
+extern cpuop_func CPUOP_NAME(op_c100_3);
+extern cpuop_func CPUOP_NAME(op_c108_3);
+extern cpuop_func CPUOP_NAME(op_c110_3);
+extern cpuop_func CPUOP_NAME(op_c118_3);
+extern cpuop_func CPUOP_NAME(op_c120_3);
+extern cpuop_func CPUOP_NAME(op_c128_3);
+extern cpuop_func CPUOP_NAME(op_c130_3);
+extern cpuop_func CPUOP_NAME(op_c138_3);
+extern cpuop_func CPUOP_NAME(op_c139_3);
+extern cpuop_func CPUOP_NAME(op_c140_3);
+extern cpuop_func CPUOP_NAME(op_c148_3);
+extern cpuop_func CPUOP_NAME(op_c150_3);
+extern cpuop_func CPUOP_NAME(op_c158_3);
+extern cpuop_func CPUOP_NAME(op_c160_3);
+extern cpuop_func CPUOP_NAME(op_c168_3);
+extern cpuop_func CPUOP_NAME(op_c170_3);
+extern cpuop_func CPUOP_NAME(op_c178_3);
+extern cpuop_func CPUOP_NAME(op_c179_3);
+extern cpuop_func CPUOP_NAME(op_c188_3);
+extern cpuop_func CPUOP_NAME(op_c190_3);
+extern cpuop_func CPUOP_NAME(op_c198_3);
+extern cpuop_func CPUOP_NAME(op_c1a0_3);
+extern cpuop_func CPUOP_NAME(op_c1a8_3);
+extern cpuop_func CPUOP_NAME(op_c1b0_3);
+extern cpuop_func CPUOP_NAME(op_c1b8_3);
+extern cpuop_func CPUOP_NAME(op_c1b9_3);
+extern cpuop_func CPUOP_NAME(op_c1c0_3);
+extern cpuop_func CPUOP_NAME(op_c1d0_3);
+extern cpuop_func CPUOP_NAME(op_c1d8_3);
+extern cpuop_func CPUOP_NAME(op_c1e0_3);
+extern cpuop_func CPUOP_NAME(op_c1e8_3);
+extern cpuop_func CPUOP_NAME(op_c1f0_3);
+extern cpuop_func CPUOP_NAME(op_c1f8_3);
+extern cpuop_func CPUOP_NAME(op_c1f9_3);
+extern cpuop_func CPUOP_NAME(op_c1fa_3);
+extern cpuop_func CPUOP_NAME(op_c1fb_3);
+extern cpuop_func CPUOP_NAME(op_c1fc_3);
+extern cpuop_func CPUOP_NAME(op_d000_3);
+extern cpuop_func CPUOP_NAME(op_d010_3);
+extern cpuop_func CPUOP_NAME(op_d018_3);
+extern cpuop_func CPUOP_NAME(op_d020_3);
+extern cpuop_func CPUOP_NAME(op_d028_3);
+extern cpuop_func CPUOP_NAME(op_d030_3);
+extern cpuop_func CPUOP_NAME(op_d038_3);
+extern cpuop_func CPUOP_NAME(op_d039_3);
+extern cpuop_func CPUOP_NAME(op_d03a_3);
+extern cpuop_func CPUOP_NAME(op_d03b_3);
+extern cpuop_func CPUOP_NAME(op_d03c_3);
+extern cpuop_func CPUOP_NAME(op_d040_3);
+extern cpuop_func CPUOP_NAME(op_d048_3);
+extern cpuop_func CPUOP_NAME(op_d050_3);
+extern cpuop_func CPUOP_NAME(op_d058_3);
+extern cpuop_func CPUOP_NAME(op_d060_3);
+extern cpuop_func CPUOP_NAME(op_d068_3);
+extern cpuop_func CPUOP_NAME(op_d070_3);
+extern cpuop_func CPUOP_NAME(op_d078_3);
+extern cpuop_func CPUOP_NAME(op_d079_3);
+extern cpuop_func CPUOP_NAME(op_d07a_3);
+extern cpuop_func CPUOP_NAME(op_d07b_3);
+extern cpuop_func CPUOP_NAME(op_d07c_3);
+extern cpuop_func CPUOP_NAME(op_d080_3);
+extern cpuop_func CPUOP_NAME(op_d088_3);
+extern cpuop_func CPUOP_NAME(op_d090_3);
+extern cpuop_func CPUOP_NAME(op_d098_3);
+extern cpuop_func CPUOP_NAME(op_d0a0_3);
+extern cpuop_func CPUOP_NAME(op_d0a8_3);
+extern cpuop_func CPUOP_NAME(op_d0b0_3);
+extern cpuop_func CPUOP_NAME(op_d0b8_3);
+extern cpuop_func CPUOP_NAME(op_d0b9_3);
+extern cpuop_func CPUOP_NAME(op_d0ba_3);
+extern cpuop_func CPUOP_NAME(op_d0bb_3);
+extern cpuop_func CPUOP_NAME(op_d0bc_3);
+extern cpuop_func CPUOP_NAME(op_d0c0_3);
+extern cpuop_func CPUOP_NAME(op_d0c8_3);
+extern cpuop_func CPUOP_NAME(op_d0d0_3);
+extern cpuop_func CPUOP_NAME(op_d0d8_3);
+extern cpuop_func CPUOP_NAME(op_d0e0_3);
+extern cpuop_func CPUOP_NAME(op_d0e8_3);
+extern cpuop_func CPUOP_NAME(op_d0f0_3);
+extern cpuop_func CPUOP_NAME(op_d0f8_3);
+extern cpuop_func CPUOP_NAME(op_d0f9_3);
+extern cpuop_func CPUOP_NAME(op_d0fa_3);
+extern cpuop_func CPUOP_NAME(op_d0fb_3);
+extern cpuop_func CPUOP_NAME(op_d0fc_3);
+extern cpuop_func CPUOP_NAME(op_d100_3);
+extern cpuop_func CPUOP_NAME(op_d108_3);
+extern cpuop_func CPUOP_NAME(op_d110_3);
+extern cpuop_func CPUOP_NAME(op_d118_3);
+extern cpuop_func CPUOP_NAME(op_d120_3);
+extern cpuop_func CPUOP_NAME(op_d128_3);
+extern cpuop_func CPUOP_NAME(op_d130_3);
+extern cpuop_func CPUOP_NAME(op_d138_3);
+extern cpuop_func CPUOP_NAME(op_d139_3);
+extern cpuop_func CPUOP_NAME(op_d140_3);
+extern cpuop_func CPUOP_NAME(op_d148_3);
+extern cpuop_func CPUOP_NAME(op_d150_3);
+extern cpuop_func CPUOP_NAME(op_d158_3);
+extern cpuop_func CPUOP_NAME(op_d160_3);
+extern cpuop_func CPUOP_NAME(op_d168_3);
+extern cpuop_func CPUOP_NAME(op_d170_3);
+extern cpuop_func CPUOP_NAME(op_d178_3);
+extern cpuop_func CPUOP_NAME(op_d179_3);
+extern cpuop_func CPUOP_NAME(op_d180_3);
+extern cpuop_func CPUOP_NAME(op_d188_3);
+extern cpuop_func CPUOP_NAME(op_d190_3);
+extern cpuop_func CPUOP_NAME(op_d198_3);
+extern cpuop_func CPUOP_NAME(op_d1a0_3);
+extern cpuop_func CPUOP_NAME(op_d1a8_3);
+extern cpuop_func CPUOP_NAME(op_d1b0_3);
+extern cpuop_func CPUOP_NAME(op_d1b8_3);
+extern cpuop_func CPUOP_NAME(op_d1b9_3);
+extern cpuop_func CPUOP_NAME(op_d1c0_3);
+extern cpuop_func CPUOP_NAME(op_d1c8_3);
+extern cpuop_func CPUOP_NAME(op_d1d0_3);
+extern cpuop_func CPUOP_NAME(op_d1d8_3);
+extern cpuop_func CPUOP_NAME(op_d1e0_3);
+extern cpuop_func CPUOP_NAME(op_d1e8_3);
+extern cpuop_func CPUOP_NAME(op_d1f0_3);
+extern cpuop_func CPUOP_NAME(op_d1f8_3);
+extern cpuop_func CPUOP_NAME(op_d1f9_3);
+extern cpuop_func CPUOP_NAME(op_d1fa_3);
+extern cpuop_func CPUOP_NAME(op_d1fb_3);
+extern cpuop_func CPUOP_NAME(op_d1fc_3);
+extern cpuop_func CPUOP_NAME(op_e000_3);
+extern cpuop_func CPUOP_NAME(op_e008_3);
+extern cpuop_func CPUOP_NAME(op_e010_3);
+extern cpuop_func CPUOP_NAME(op_e018_3);
+extern cpuop_func CPUOP_NAME(op_e020_3);
+extern cpuop_func CPUOP_NAME(op_e028_3);
+extern cpuop_func CPUOP_NAME(op_e030_3);
+extern cpuop_func CPUOP_NAME(op_e038_3);
+extern cpuop_func CPUOP_NAME(op_e040_3);
+extern cpuop_func CPUOP_NAME(op_e048_3);
+extern cpuop_func CPUOP_NAME(op_e050_3);
+extern cpuop_func CPUOP_NAME(op_e058_3);
+extern cpuop_func CPUOP_NAME(op_e060_3);
+extern cpuop_func CPUOP_NAME(op_e068_3);
+extern cpuop_func CPUOP_NAME(op_e070_3);
+extern cpuop_func CPUOP_NAME(op_e078_3);
+extern cpuop_func CPUOP_NAME(op_e080_3);
+extern cpuop_func CPUOP_NAME(op_e088_3);
+extern cpuop_func CPUOP_NAME(op_e090_3);
+extern cpuop_func CPUOP_NAME(op_e098_3);
+extern cpuop_func CPUOP_NAME(op_e0a0_3);
+extern cpuop_func CPUOP_NAME(op_e0a8_3);
+extern cpuop_func CPUOP_NAME(op_e0b0_3);
+extern cpuop_func CPUOP_NAME(op_e0b8_3);
+extern cpuop_func CPUOP_NAME(op_e0d0_3);
+extern cpuop_func CPUOP_NAME(op_e0d8_3);
+extern cpuop_func CPUOP_NAME(op_e0e0_3);
+extern cpuop_func CPUOP_NAME(op_e0e8_3);
+extern cpuop_func CPUOP_NAME(op_e0f0_3);
+extern cpuop_func CPUOP_NAME(op_e0f8_3);
+extern cpuop_func CPUOP_NAME(op_e0f9_3);
+extern cpuop_func CPUOP_NAME(op_e100_3);
+extern cpuop_func CPUOP_NAME(op_e108_3);
+extern cpuop_func CPUOP_NAME(op_e110_3);
+extern cpuop_func CPUOP_NAME(op_e118_3);
+extern cpuop_func CPUOP_NAME(op_e120_3);
+extern cpuop_func CPUOP_NAME(op_e128_3);
+extern cpuop_func CPUOP_NAME(op_e130_3);
+extern cpuop_func CPUOP_NAME(op_e138_3);
+extern cpuop_func CPUOP_NAME(op_e140_3);
+extern cpuop_func CPUOP_NAME(op_e148_3);
+extern cpuop_func CPUOP_NAME(op_e150_3);
+extern cpuop_func CPUOP_NAME(op_e158_3);
+extern cpuop_func CPUOP_NAME(op_e160_3);
+extern cpuop_func CPUOP_NAME(op_e168_3);
+extern cpuop_func CPUOP_NAME(op_e170_3);
+extern cpuop_func CPUOP_NAME(op_e178_3);
+extern cpuop_func CPUOP_NAME(op_e180_3);
+extern cpuop_func CPUOP_NAME(op_e188_3);
+extern cpuop_func CPUOP_NAME(op_e190_3);
+extern cpuop_func CPUOP_NAME(op_e198_3);
+extern cpuop_func CPUOP_NAME(op_e1a0_3);
+extern cpuop_func CPUOP_NAME(op_e1a8_3);
+extern cpuop_func CPUOP_NAME(op_e1b0_3);
+extern cpuop_func CPUOP_NAME(op_e1b8_3);
+extern cpuop_func CPUOP_NAME(op_e1d0_3);
+extern cpuop_func CPUOP_NAME(op_e1d8_3);
+extern cpuop_func CPUOP_NAME(op_e1e0_3);
+extern cpuop_func CPUOP_NAME(op_e1e8_3);
+extern cpuop_func CPUOP_NAME(op_e1f0_3);
+extern cpuop_func CPUOP_NAME(op_e1f8_3);
+extern cpuop_func CPUOP_NAME(op_e1f9_3);
+extern cpuop_func CPUOP_NAME(op_e2d0_3);
+extern cpuop_func CPUOP_NAME(op_e2d8_3);
+extern cpuop_func CPUOP_NAME(op_e2e0_3);
+extern cpuop_func CPUOP_NAME(op_e2e8_3);
+extern cpuop_func CPUOP_NAME(op_e2f0_3);
+extern cpuop_func CPUOP_NAME(op_e2f8_3);
+extern cpuop_func CPUOP_NAME(op_e2f9_3);
+extern cpuop_func CPUOP_NAME(op_e3d0_3);
+extern cpuop_func CPUOP_NAME(op_e3d8_3);
+extern cpuop_func CPUOP_NAME(op_e3e0_3);
+extern cpuop_func CPUOP_NAME(op_e3e8_3);
+extern cpuop_func CPUOP_NAME(op_e3f0_3);
+extern cpuop_func CPUOP_NAME(op_e3f8_3);
+extern cpuop_func CPUOP_NAME(op_e3f9_3);
+extern cpuop_func CPUOP_NAME(op_e4d0_3);
+extern cpuop_func CPUOP_NAME(op_e4d8_3);
+extern cpuop_func CPUOP_NAME(op_e4e0_3);
+extern cpuop_func CPUOP_NAME(op_e4e8_3);
+extern cpuop_func CPUOP_NAME(op_e4f0_3);
+extern cpuop_func CPUOP_NAME(op_e4f8_3);
+extern cpuop_func CPUOP_NAME(op_e4f9_3);
+extern cpuop_func CPUOP_NAME(op_e5d0_3);
+extern cpuop_func CPUOP_NAME(op_e5d8_3);
+extern cpuop_func CPUOP_NAME(op_e5e0_3);
+extern cpuop_func CPUOP_NAME(op_e5e8_3);
+extern cpuop_func CPUOP_NAME(op_e5f0_3);
+extern cpuop_func CPUOP_NAME(op_e5f8_3);
+extern cpuop_func CPUOP_NAME(op_e5f9_3);
+extern cpuop_func CPUOP_NAME(op_e6d0_3);
+extern cpuop_func CPUOP_NAME(op_e6d8_3);
+extern cpuop_func CPUOP_NAME(op_e6e0_3);
+extern cpuop_func CPUOP_NAME(op_e6e8_3);
+extern cpuop_func CPUOP_NAME(op_e6f0_3);
+extern cpuop_func CPUOP_NAME(op_e6f8_3);
+extern cpuop_func CPUOP_NAME(op_e6f9_3);
+extern cpuop_func CPUOP_NAME(op_e7d0_3);
+extern cpuop_func CPUOP_NAME(op_e7d8_3);
+extern cpuop_func CPUOP_NAME(op_e7e0_3);
+extern cpuop_func CPUOP_NAME(op_e7e8_3);
+extern cpuop_func CPUOP_NAME(op_e7f0_3);
+extern cpuop_func CPUOP_NAME(op_e7f8_3);
+extern cpuop_func CPUOP_NAME(op_e7f9_3);
@@ -3150,20 +3150,23 @@ static void generate_one_opcode (int rp)
 
 #if PALM_PERF
     if (opcode_next_clev[rp] != cpu_level) {
-	fprintf (stblfile, "{ op_%lx_%d, 0, %ld, %d, %d, %d }, /* %s */\n", opcode, opcode_last_postfix[rp],
+	fprintf (stblfile, "{ CPUOP_NAME(op_%lx_%d), 0, %ld, %d, %d, %d }, /* %s */\n", opcode, opcode_last_postfix[rp],
 		opcode, opcode_last_extra[rp], opcode_last_read[rp], opcode_last_write[rp], lookuptab[i].name);
 	return;
     }
 #else	// PALM_PERF
     if (opcode_next_clev[rp] != cpu_level) {
-	fprintf (stblfile, "{ op_%lx_%d, 0, %ld }, /* %s */\n", opcode, opcode_last_postfix[rp],
+	fprintf (stblfile, "{ CPUOP_NAME(op_%lx_%d), 0, %ld }, /* %s */\n", opcode, opcode_last_postfix[rp],
 		 opcode, lookuptab[i].name);
 	return;
     }
-    fprintf (stblfile, "{ op_%lx_%d, 0, %ld }, /* %s */\n", opcode, postfix, opcode, lookuptab[i].name);
+    fprintf (stblfile, "{ CPUOP_NAME(op_%lx_%d), 0, %ld }, /* %s */\n", opcode, postfix, opcode, lookuptab[i].name);
 #endif	// PALM_PERF
-    fprintf (headerfile, "extern cpuop_func op_%lx_%d;\n", opcode, postfix);
-    printf ("unsigned long REGPARAM2 op_%lx_%d(uae_u32 opcode) /* %s */\n{\n", opcode, postfix, lookuptab[i].name);
+    /* PALM: Handler and table names are wrapped in CPUOP_NAME so that the
+       generated files can be compiled a second time with different names
+       and settings (see cpuemu_nocheck.c).  */
+    fprintf (headerfile, "extern cpuop_func CPUOP_NAME(op_%lx_%d);\n", opcode, postfix);
+    printf ("unsigned long REGPARAM2 CPUOP_NAME(op_%lx_%d)(uae_u32 opcode) /* %s */\n{\n", opcode, postfix, lookuptab[i].name);
 
     switch (table68k[opcode].stype) {
      case 0: smsk = 7; break;
@@ -3249,7 +3252,7 @@ static void generate_one_opcode (int rp)
 	opcode_last_extra[rp] = extraCycles;
 	opcode_last_read[rp] = readCycles;
 	opcode_last_write[rp] = writeCycles;
-	fprintf (stblfile, "{ op_%lx_%d, 0, %ld, %d, %d, %d }, /* %s */\n",
+	fprintf (stblfile, "{ CPUOP_NAME(op_%lx_%d), 0, %ld, %d, %d, %d }, /* %s */\n",
 			opcode, postfix, opcode, extraCycles,
 			readCycles, writeCycles, lookuptab[i].name);
 #endif	// PALM_PERF
@@ -3279,7 +3282,7 @@ static void generate_func (void)
 	}
 #endif	// PALM_MIN
 	postfix = i;
-	fprintf (stblfile, "struct cputbl op_smalltbl_%d[] = {\n", postfix);
+	fprintf (stblfile, "struct cputbl CPUOP_NAME(op_smalltbl_%d)[] = {\n", postfix);
 
 	/* sam: this is for people with low memory (eg. me :)) */
 	printf ("\n"
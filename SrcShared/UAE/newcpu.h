@@ -62,6 +62,12 @@ struct cputbl {
 	struct perfRec perf;
 };
 
+/* The generated handler names go through this macro; cpuemu_nocheck.c
+   redefines it to build a second set of handlers from the same source.  */
+#ifndef CPUOP_NAME
+#define CPUOP_NAME(name) name
+#endif
+
 extern unsigned long op_illg (uae_u32) REGPARAM;
 
 typedef char flagtype;
@@ -221,8 +227,11 @@ extern struct cputbl op_smalltbl_2[];
 extern struct cputbl op_smalltbl_3[];
 /* 68000 slow but compatible.  */
 extern struct cputbl op_smalltbl_4[];
+/* 68000 without stack pointer checks (cpuemu_nocheck.c).  */
+extern struct cputbl op_smalltbl_3_nocheck[];
 
-extern cpuop_func *cpufunctbl[65536] ASM_SYM_FOR_FUNC ("cpufunctbl");
+/* Points to the handler set currently in use (see EmCPU68K::SetCheckStackPointer).  */
+extern cpuop_func **cpufunctbl ASM_SYM_FOR_FUNC ("cpufunctbl");
 
 #ifdef __cplusplus
 }